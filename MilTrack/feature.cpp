@@ -8,6 +8,7 @@
 
 
 #include "common.h"
+#include "../SVAF/src/Integral.h"
 
 namespace pc{
 
@@ -20,35 +21,15 @@ float sumRect_1channel(fimg ii_img, pc::Rect rect){
 	return br + tl - tr - bl;
 }
 
-void computeintegral_1channel(uimg& img, fimg& ii_img){
-	ii_img.chns = img.chns;
-	const int cols = ii_img.cols = img.cols;
-	const int rows = ii_img.rows = img.rows;
-	ii_img.data[0] = (float)img.data[0];
-	for (int i = 0; i < rows; i++){
-		for (int j = 0; j < cols; j++){
-			if (i == 0 && j == 0)
-				continue;
-			if (i == 0 && j != 0)
-				ii_img.data[j] = ii_img.data[j - 1] + img.data[j];
-			if (i != 0 && j == 0)
-				ii_img.data[i*cols] = ii_img.data[(i - 1)*cols] + img.data[i*cols];
-			if (i != 0 && j != 0){
-				ii_img.data[i*cols + j] = 
-					ii_img.data[(i - 1)*cols + j] + ii_img.data[i*cols + j - 1]
-					- ii_img.data[(i - 1)*cols + j - 1] + img.data[i*cols + j];
-			}
-		}
-	}
-}
-
+// ͼSURFͬһʵ(SVAF/src/Integral), ԭͼͬߴҺǰ
 void compute_integral(uimg& img, fimg& ii_img){
-	if (img.chns == 1){
-		computeintegral_1channel(img, ii_img);
-	}
-	else{
-		assert(false);
-	}
+	assert(img.chns == 1);
+	ii_img.chns = img.chns;
+	ii_img.cols = img.cols;
+	ii_img.rows = img.rows;
+	const cv::Mat gray(img.rows, img.cols, CV_8UC1, img.data);
+	cv::Mat sum(img.rows, img.cols, CV_32FC1, ii_img.data);
+	svaf::ComputeIntegral(gray, sum, CV_32F, 1.0);
 }
 
 //extern FeatureParam ftrparam;
@@ -69,7 +69,7 @@ bool CVDesciptorLayer::Run(vector<Block>& images, vector<Block>& disp, LayerPara
 bool CVDesciptorLayer::Sift(vector<Block>& images, vector<Block>& disp){
 	Ptr<DescriptorExtractor> extractor = DescriptorExtractor::create(despname);
 	for (int i = 0; i < images.size(); ++i){
-		extractor->compute(images[i].image, images[i].keypoint, images[i].descriptors);
+		Compute(*extractor, images[i], DESC_FLOAT);
 	}
 	return true;
 }
@@ -78,7 +78,7 @@ bool CVDesciptorLayer::Sift(vector<Block>& images, vector<Block>& disp){
 bool CVDesciptorLayer::Surf(vector<Block>& images, vector<Block>& disp){
 	Ptr<DescriptorExtractor> extractor = DescriptorExtractor::create(despname);
 	for (int i = 0; i < images.size(); ++i){
-		extractor->compute(images[i].image, images[i].keypoint, images[i].descriptors);
+		Compute(*extractor, images[i], DESC_FLOAT);
 	}
 	return true;
 }
@@ -87,7 +87,7 @@ bool CVDesciptorLayer::Surf(vector<Block>& images, vector<Block>& disp){
 bool CVDesciptorLayer::Brief(vector<Block>& images, vector<Block>& disp){
 	BriefDescriptorExtractor extractor(brieflength);
 	for (int i = 0; i < images.size(); ++i){
-		extractor.compute(images[i].image, images[i].keypoint, images[i].descriptors);
+		Compute(extractor, images[i], DESC_BINARY);
 	}
 	return true;
 }
@@ -96,7 +96,7 @@ bool CVDesciptorLayer::Brief(vector<Block>& images, vector<Block>& disp){
 bool CVDesciptorLayer::Brisk(vector<Block>& images, vector<Block>& disp){
 	Ptr<DescriptorExtractor> extractor = DescriptorExtractor::create(despname);
 	for (int i = 0; i < images.size(); ++i){
-		extractor->compute(images[i].image, images[i].keypoint, images[i].descriptors);
+		Compute(*extractor, images[i], DESC_BINARY);
 	}
 	return true;
 }
@@ -105,7 +105,7 @@ bool CVDesciptorLayer::Brisk(vector<Block>& images, vector<Block>& disp){
 bool CVDesciptorLayer::ORB(vector<Block>& images, vector<Block>& disp){
 	Ptr<DescriptorExtractor> extractor = DescriptorExtractor::create(despname);
 	for (int i = 0; i < images.size(); ++i){
-		extractor->compute(images[i].image, images[i].keypoint, images[i].descriptors);
+		Compute(*extractor, images[i], DESC_BINARY);
 	}
 	return true;
 }
@@ -114,11 +114,20 @@ bool CVDesciptorLayer::ORB(vector<Block>& images, vector<Block>& disp){
 bool CVDesciptorLayer::Freak(vector<Block>& images, vector<Block>& disp){
 	Ptr<DescriptorExtractor> extractor = DescriptorExtractor::create(despname);
 	for (int i = 0; i < images.size(); ++i){
-		extractor->compute(images[i].image, images[i].keypoint, images[i].descriptors);
+		Compute(*extractor, images[i], DESC_BINARY);
 	}
 	return true;
 }
 
+// ӳߴԤȷ, computeڲɾؼ·ʱٻָ
+void CVDesciptorLayer::Compute(const DescriptorExtractor& extractor, Block& image, DescKind kind){
+	image.descriptors.Create((int)image.keypoint.size(), extractor.descriptorSize(),
+		extractor.descriptorType(), kind);
+	extractor.compute(image.image, image.keypoint, image.descriptors);
+	image.descriptors.SetKind(kind);
+	image.descriptors.Align();
+}
+
 bool CVDesciptorLayer::OppenentColor(vector<Block>& images, vector<Block>& disp){
 	
 	// Adapt to color
@@ -23,6 +23,7 @@ protected:
 	bool ORB(vector<Block>&, vector<Block>&);
 	bool Freak(vector<Block>&, vector<Block>&);
 	bool OppenentColor(vector<Block>&, vector<Block>&);
+	void Compute(const DescriptorExtractor& extractor, Block& image, DescKind kind);
 
 private:
 	int		brieflength;
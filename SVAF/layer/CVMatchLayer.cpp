@@ -140,16 +140,25 @@ bool CVMatchLayer::BFL2(vector<Block>& images, vector<Block>& disp){
 	return true;
 }
 
-// OpenCVBFH1ƥ
+// BFH1ƥ, ֵpopcountƥ, BFMatcher(NORM_HAMMING)ͬ
 bool CVMatchLayer::BFH1(vector<Block>& images, vector<Block>& disp){
-	BFMatcher matcher(NORM_HAMMING, crossCheck);
 	vector<DMatch> matches;
 	images[0].pMatch = &images[1];
-	matcher.match(images[0].descriptors, images[1].descriptors, matches);
+	if (images[0].descriptors.depth() == CV_8U){
+		MatchHamming(images[0].descriptors, images[1].descriptors, nn_, crossCheck);
+		for (int i = 0; i < nn_.size(); ++i){
+			if (nn_[i].idx >= 0){
+				matches.push_back(DMatch(i, nn_[i].idx, nn_[i].d0));
+			}
+		}
+	} else{
+		BFMatcher matcher(NORM_HAMMING, crossCheck);
+		matcher.match(images[0].descriptors, images[1].descriptors, matches);
+	}
 	LOG(INFO) << "Matched Count: " << matches.size();
 
 	float max_dist = FLT_MIN, min_dist = FLT_MAX;
-	for (int i = 0; i < images[0].descriptors.rows; ++i){
+	for (int i = 0; i < matches.size(); ++i){
 		float dist = matches[i].distance;
 		if (dist < min_dist) min_dist = dist;
 		if (dist > max_dist) max_dist = dist;
@@ -158,7 +167,7 @@ bool CVMatchLayer::BFH1(vector<Block>& images, vector<Block>& disp){
 	LOG(INFO) << "min distance: " << min_dist;
 	LOG(INFO) << "max distance: " << max_dist;
 
-	for (int i = 0; i < images[0].descriptors.rows; ++i){
+	for (int i = 0; i < matches.size(); ++i){
 		if (matches[i].distance < 2 * min_dist){
 			images[0].matches.push_back(matches[i]);
 		}
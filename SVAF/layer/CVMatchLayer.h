@@ -4,6 +4,7 @@ Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
 
 #pragma once
 #include "Layer.h"
+#include "../src/DescMatch.h"
 
 namespace svaf{
 
@@ -28,6 +29,7 @@ private:
 	string	matchname;
 	svaf::CVMatchParameter_MatchType type;
 	bool(CVMatchLayer::*ptr)(vector<Block>&, vector<Block>&);
+	vector<DescNN> nn_;
 };
 
 }
@@ -69,7 +69,15 @@ CVPointLayer::CVPointLayer(LayerParameter& layer) : Layer(layer)
 	default:
 		break;
 	}
-	
+
+	// Ԥ, мֵ㷨(FAST/FASTX/BRISK/SURF)Ӧ
+	const PointBudgetParameter& param = layer.cvpoint_param().budget_param();
+	budget_.Reset(param.budget(), param.grid_cols(), param.grid_rows(), param.overshoot());
+	layerparam = layer.cvpoint_param();
+	adaptive_ = budget_.Enabled() && param.adaptive() && Threshold(thresh_);
+	if (adaptive_){
+		budget_.Restart(thresh_);
+	}
 }
 
 // 
@@ -89,9 +97,38 @@ bool CVPointLayer::Run(vector<Block>& images, vector<Block>& disp, LayerParamete
 		}
 	}
 
+	if (adaptive_){
+		SetThreshold(thresh_);
+	}
+	vector<int> before(images.size());
+	for (int i = 0; i < images.size(); ++i){
+		before[i] = (int)images[i].keypoint.size();
+	}
+
 	// 㷨
 	(this->*ptr)(images, disp);
 
+	// ¼ĵkeypointǰ, ڰӦѡȡ, Ԥ
+	if (budget_.Enabled()){
+		int detected = 0;
+		for (int i = 0; i < images.size(); ++i){
+			vector<KeyPoint>& kp = images[i].keypoint;
+			const int added = (int)kp.size() - before[i];
+			vector<KeyPoint> pt(kp.begin(), kp.begin() + added);
+			vector<int> keep;
+			budget_.Select(pt, images[i].image.size(), keep);
+			for (int j = 0; j < keep.size(); ++j){
+				kp[j] = pt[keep[j]];
+			}
+			kp.erase(kp.begin() + keep.size(), kp.begin() + added);
+			detected = max(detected, added);
+			LOG(INFO) << featname << " Kept <" << keep.size() << "> points";
+		}
+		if (adaptive_){
+			thresh_ = budget_.Adapt(thresh_, detected);
+		}
+	}
+
 	if (task_type == SvafApp::S_POINT || task_type == SvafApp::B_POINT || task_type == SvafApp::S_POINTDESP || task_type == SvafApp::B_POINTDESP){
 		__bout = true;
 	} else {
@@ -427,6 +464,43 @@ bool CVPointLayer::SimpleBlob(vector<Block>& images, vector<Block>& disp){
 	return true;
 }
 
+// ǰ㷨ļֵ, 㷨ûֵʱfalse
+bool CVPointLayer::Threshold(double& thresh) const{
+	switch (type)
+	{
+	case svaf::CVPointParameter_PointType_FAST:
+	case svaf::CVPointParameter_PointType_FASTX:
+		thresh = layerparam.fast_param().thresh();
+		return thresh > 0;
+	case svaf::CVPointParameter_PointType_BRISK:
+		thresh = layerparam.brisk_param().thresh();
+		return thresh > 0;
+	case svaf::CVPointParameter_PointType_SURF:
+		thresh = layerparam.surf_param().hassian_thresh();
+		return thresh > 0;
+	default:
+		return false;
+	}
+}
+
+void CVPointLayer::SetThreshold(double thresh){
+	switch (type)
+	{
+	case svaf::CVPointParameter_PointType_FAST:
+	case svaf::CVPointParameter_PointType_FASTX:
+		layerparam.mutable_fast_param()->set_thresh(max(1, cvRound(thresh)));
+		break;
+	case svaf::CVPointParameter_PointType_BRISK:
+		layerparam.mutable_brisk_param()->set_thresh(max(1, cvRound(thresh)));
+		break;
+	case svaf::CVPointParameter_PointType_SURF:
+		layerparam.mutable_surf_param()->set_hassian_thresh((float)thresh);
+		break;
+	default:
+		break;
+	}
+}
+
 bool CVPointLayer::Grid(vector<Block>& images, vector<Block>& disp){
 	Ptr<FeatureDetector> detector = FeatureDetector::create("Grid");
 	return false;
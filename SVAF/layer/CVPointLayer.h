@@ -4,6 +4,7 @@ Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
 
 #pragma once
 #include "Layer.h"
+#include "../src/PointBudget.h"
 
 namespace svaf{
 
@@ -33,12 +34,19 @@ protected:
 	bool Grid(vector<Block>&, vector<Block>&);
 	bool Pyramid(vector<Block>&, vector<Block>&);
 
+	bool Threshold(double&) const;
+	void SetThreshold(double);
+
 private:
 	string featname;
 	svaf::CVPointParameter layerparam;
 	svaf::CVPointParameter_PointType type;
 	bool(CVPointLayer::*ptr)(vector<Block>&, vector<Block>&);
 
+	PointBudget	budget_;
+	bool		adaptive_;
+	double		thresh_;	// Ӧļֵ, ֡
+
 };
 
 }
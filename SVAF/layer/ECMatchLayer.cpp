@@ -4,11 +4,19 @@ Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
 */
 
 #include "ECMatchLayer.h"
+#include <algorithm>
+#include <limits.h>
 
 namespace svaf{
 
 ECMatchLayer::ECMatchLayer(LayerParameter& layer) : Layer(layer)
 {
+	rowtol = layer.ecmatch_param().rowtol();		// ݲ
+	mindisp = layer.ecmatch_param().has_mindisp() ? layer.ecmatch_param().mindisp() : -FLT_MAX;		// ӲΧ, δ趨ʱ
+	maxdisp = layer.ecmatch_param().has_maxdisp() ? layer.ecmatch_param().maxdisp() : FLT_MAX;
+	thresh = layer.ecmatch_param().thresh();
+	crosscheck = layer.ecmatch_param().crosscheck();
+	CHECK_LE(mindisp, maxdisp) << "ECMatch Disparity Range Error!";
 }
 
 
@@ -36,7 +44,11 @@ bool ECMatchLayer::Run(vector<Block>& images, vector<Block>& disp, LayerParamete
 	images[0].pMatch = &images[1];
 	images[1].pMatch = &images[0];
 	
-	ECEular(images);
+	if (crosscheck){
+		ECEularCrossCheck(images);
+	} else{
+		ECEular(images);
+	}
 
 	if (task_type == SvafApp::POINT_MATCH){
 		__bout = true;
@@ -58,113 +70,110 @@ bool ECMatchLayer::Run(vector<Block>& images, vector<Block>& disp, LayerParamete
 	return true;
 }
 
-bool ECMatchLayer::ECEular(vector<Block>& images){
-	int p0_size = images[0].descriptors.rows;
-	int p1_size = images[1].descriptors.rows;
-	int length = images[0].descriptors.cols;
-
-	vector<vector<int>> hash0(images[0].image.rows);
-	vector<vector<int>>	hash1(images[1].image.rows);
-
-	for (int i = 0; i < p0_size; ++i){
-		hash0[images[0].keypoint[i].pt.y].push_back(i);
+// : ؼ㰴ȡзͰ, Ͱڰx
+void EpipolarIndex::Build(const vector<KeyPoint>& keypoint, int rows, int tol){
+	tol_ = max(tol, 0);
+	int nrow = rows;
+	for (int i = 0; i < keypoint.size(); ++i){
+		nrow = max(nrow, cvRound(keypoint[i].pt.y) + 1);
 	}
-	for (int i = 0; i < p1_size; ++i){
-		hash1[images[1].keypoint[i].pt.y].push_back(i);
+	for (int r = 0; r < rows_.size(); ++r){
+		rows_[r].clear();
 	}
+	rows_.resize(nrow);
+	for (int i = 0; i < keypoint.size(); ++i){
+		int r = max(cvRound(keypoint[i].pt.y), 0);
+		rows_[r].push_back(make_pair(keypoint[i].pt.x, i));
+	}
+	for (int r = 0; r < nrow; ++r){
+		sort(rows_[r].begin(), rows_[r].end());
+	}
+}
 
-	DMatch match;
-	float d0, d1, dist;
-	switch (images[0].descriptors.depth())
-	{
-	case CV_32F:
-		for (int i = 0; i < p0_size; ++i){
-			match.queryIdx = i;
-			d0 = d1 = FLT_MAX;
-			vector<int>& hashline = hash1[images[0].keypoint[i].pt.y];
-			for (int j = 0; j < hashline.size(); ++j){
-				dist = 0.0f;
-				for (int k = 0; k < length; ++k){
-					float diff = images[0].descriptors.ptr<float>(i)[k]
-						- images[1].descriptors.ptr<float>(hashline[j])[k];
-					dist += diff * diff;
-				}
-				dist = sqrt(dist);
-
-				if (dist < d0){
-					d1 = d0;
-					d0 = dist;
-					match.trainIdx = hashline[j];
-				} else if (dist < d1){
-					d1 = dist;
-				}
-			}
-
-			match.distance = d0;
-			if (d0 / d1 < 0.65){
-				images[0].matches.push_back(match);
-			}
+// ytol, x[xmin, xmax]ڵĹؼ, ÿжֲ
+void EpipolarIndex::Query(float y, float xmin, float xmax, vector<int>& cand) const{
+	cand.clear();
+	const int r0 = max(cvRound(y) - tol_, 0);
+	const int r1 = min(cvRound(y) + tol_, (int)rows_.size() - 1);
+	for (int r = r0; r <= r1; ++r){
+		const vector<pair<float, int>>& row = rows_[r];
+		vector<pair<float, int>>::const_iterator it =
+			lower_bound(row.begin(), row.end(), make_pair(xmin, INT_MIN));
+		for (; it != row.end() && it->first <= xmax; ++it){
+			cand.push_back(it->second);
 		}
-		break;
-	default:
-		LOG(FATAL) << "No Implyment!";
-		break;
 	}
-	return true;
 }
 
-bool ECMatchLayer::ECEularCrossCheck(vector<Block>& images){
-	int p0_size = images[0].descriptors.rows;
-	int p1_size = images[1].descriptors.rows;
-	int length = images[0].descriptors.cols;
+// ںѡѰiںʹν, (ûкѡʱΪ-1)
+int ECMatchLayer::Nearest(const DescMatrix& query, int i, const DescMatrix& train,
+	const vector<int>& cand, float& d0, float& d1){
+	const int length = query.cols;
+	const float *q = query.Row<float>(i);
+	int match = -1;
+	d0 = d1 = FLT_MAX;
+	for (int j = 0; j < cand.size(); ++j){
+		const float *t = train.Row<float>(cand[j]);
+		float dist = 0.0f;
+		for (int k = 0; k < length; ++k){
+			float diff = q[k] - t[k];
+			dist += diff * diff;
+		}
+		dist = sqrt(dist);
+
+		if (dist < d0){
+			d1 = d0;
+			d0 = dist;
+			match = cand[j];
+		} else if (dist < d1){
+			d1 = dist;
+		}
+	}
+	return match;
+}
 
-	vector<vector<int>> hash0(images[0].image.rows);
-	vector<vector<int>>	hash1(images[1].image.rows);
+// ߴƥ: ͼѡ޶ͼСrowtol, Ӳ[mindisp, maxdisp]֮
+bool ECMatchLayer::ECEular(vector<Block>& images){
+	if (images[0].descriptors.depth() != CV_32F){
+		LOG(FATAL) << "No Implyment!";
+	}
+	const int p0_size = images[0].descriptors.rows;
+	index1_.Build(images[1].keypoint, images[1].image.rows, rowtol);
 
+	float d0, d1;
 	for (int i = 0; i < p0_size; ++i){
-		hash0[images[0].keypoint[i].pt.y].push_back(i);
-	}
-	for (int i = 0; i < p1_size; ++i){
-		hash1[images[1].keypoint[i].pt.y].push_back(i);
+		const Point2f& pt = images[0].keypoint[i].pt;
+		index1_.Query(pt.y, pt.x - maxdisp, pt.x - mindisp, cand_);
+		int j = Nearest(images[0].descriptors, i, images[1].descriptors, cand_, d0, d1);
+		if (j >= 0 && d0 / d1 < thresh){
+			images[0].matches.push_back(DMatch(i, j, d0));
+		}
 	}
+	return true;
+}
 
-	DMatch match;
-	float d0, d1, dist;
-	switch (images[0].descriptors.depth())
-	{
-	case CV_32F:
-		for (int i = 0; i < p0_size; ++i){
-			match.queryIdx = i;
-			d0 = d1 = FLT_MAX;
-			vector<int>& hashline = hash1[images[0].keypoint[i].pt.y];
-			for (int j = 0; j < hashline.size(); ++j){
-				dist = 0.0f;
-				for (int k = 0; k < length; ++k){
-					float diff = images[0].descriptors.ptr<float>(i)[k]
-						- images[1].descriptors.ptr<float>(hashline[j])[k];
-					dist += diff * diff;
-				}
-				dist = sqrt(dist);
-
-				if (dist < d0){
-					d1 = d0;
-					d0 = dist;
-					match.trainIdx = hashline[j];
-				}
-				else if (dist < d1){
-					d1 = dist;
-				}
-			}
+// : ͼͼͬһߴ(Ӳ)ڵҲǸͼ
+bool ECMatchLayer::ECEularCrossCheck(vector<Block>& images){
+	if (images[0].descriptors.depth() != CV_32F){
+		LOG(FATAL) << "No Implyment!";
+	}
+	const int p0_size = images[0].descriptors.rows;
+	index0_.Build(images[0].keypoint, images[0].image.rows, rowtol);
+	index1_.Build(images[1].keypoint, images[1].image.rows, rowtol);
 
-			match.distance = d0;
-			if (d0 / d1 < 0.65){
-				images[0].matches.push_back(match);
-			}
+	float d0, d1, r0, r1;
+	for (int i = 0; i < p0_size; ++i){
+		const Point2f& pt = images[0].keypoint[i].pt;
+		index1_.Query(pt.y, pt.x - maxdisp, pt.x - mindisp, cand_);
+		int j = Nearest(images[0].descriptors, i, images[1].descriptors, cand_, d0, d1);
+		if (j < 0 || !(d0 / d1 < thresh)){
+			continue;
+		}
+		const Point2f& pr = images[1].keypoint[j].pt;
+		index0_.Query(pr.y, pr.x + mindisp, pr.x + maxdisp, cand_);
+		if (Nearest(images[1].descriptors, j, images[0].descriptors, cand_, r0, r1) == i){
+			images[0].matches.push_back(DMatch(i, j, d0));
 		}
-		break;
-	default:
-		LOG(FATAL) << "No Implyment!";
-		break;
 	}
 	return true;
 }
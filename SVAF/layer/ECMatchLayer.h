@@ -7,7 +7,16 @@ Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
 
 namespace svaf{
 
-
+// ߴѡ: ؼ㰴зͰ, Ͱڰx
+class EpipolarIndex
+{
+public:
+	void Build(const vector<KeyPoint>& keypoint, int rows, int tol);
+	void Query(float y, float xmin, float xmax, vector<int>& cand) const;
+private:
+	int		tol_;
+	vector<vector<pair<float, int>>>	rows_;
+};
 
 class ECMatchLayer :
 	public Layer
@@ -20,7 +29,16 @@ protected:
 	bool EularMatch(vector<Block>&);
 	bool ECEular(vector<Block>&);
 	bool ECEularCrossCheck(vector<Block>&);
+	int Nearest(const DescMatrix& query, int i, const DescMatrix& train,
+		const vector<int>& cand, float& d0, float& d1);
 private:
+	int		rowtol;
+	float	mindisp, maxdisp;
+	float	thresh;
+	bool	crosscheck;
+	EpipolarIndex	index0_, index1_;
+	vector<int>		cand_;
+
 	void debug_showmatch(vector<Block>& images){
 		for (int i = 0; i < images[0].matches.size(); ++i){
 			Mat mat0 = images[0].image.clone();
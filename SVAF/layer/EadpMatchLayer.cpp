@@ -11,11 +11,13 @@ using namespace pc;
 namespace svaf{
 
 // 캯
-EadpMatchLayer::EadpMatchLayer(LayerParameter& layer) : Layer(layer)
+EadpMatchLayer::EadpMatchLayer(LayerParameter& layer) : StereoLayer(layer)
 {
 	// 㷨
 	max_disp = layer.eadp_param().max_disp(); // Ӳ
 	factor = layer.eadp_param().factor();
+	// CV_16UӲͼ: ЧӲС0xFFFF(Ч), ЧֵҲ[0, max_disp)
+	CHECK_LT(factor * max_disp, 0xFFFF) << "EADP factor * max_disp Must Be Below 65535!";
 	// Ե˲
 	guildmr = layer.eadp_param().guidmr();
 	dispmr = layer.eadp_param().dispmr();
@@ -23,8 +25,15 @@ EadpMatchLayer::EadpMatchLayer(LayerParameter& layer) : Layer(layer)
 	sc = layer.eadp_param().sc();
 	r1 = layer.eadp_param().r1();
 	r2 = layer.eadp_param().r2();
+	// 16λSIMDоۺ, int汾һ
+	fast = layer.eadp_param().fast();
+	// ֻƥͼROIͼӦߴ
+	roi = layer.eadp_param().roi();
+	// ضӦ(TriangulationLayerʹ)
+	points = layer.eadp_param().points();
 	// ǷӲΪtxtĵ
 	savetxt = layer.eadp_param().savetxt();
+	matcher.SetParam(max_disp, factor, guildmr, dispmr, sg, sc, r1, r2, fast);
 }
 
 // 
@@ -37,11 +46,18 @@ bool EadpMatchLayer::Run(vector<Block>& images, vector<Block>& disp, LayerParame
 	CHECK_GE(images.size(), 2) << "Need Image Pairs";
 	prefix = string("tmp/EADP_") + Circuit::time_id_;
 
+	// ƥ
+	Rect band;
+	if (!StereoBand(images[0], images[1], max_disp, roi, lband, rband, band)){
+		return false;
+	}
+
 	// ִEadpƥ
-	Mat l_disp, r_disp, fill, check;
 	__t.StartWatchTimer();
-	EadpMatch(images[0].image, images[1].image, l_disp, r_disp, check, fill,
-		max_disp, factor, guildmr, dispmr, sg, sc, r1, r2, prefix, savetxt);
+	if (!matcher.Match(lband, rband, l_disp, r_disp, check, fill, prefix, savetxt)){
+		LOG(ERROR) << "Eadp Match Failed, Band " << band;
+		return false;
+	}
 	__t.ReadWatchTimer("Eadp Time");
 	if (__logt){
 		(*figures)[__name + "_t"][*id] = (float)__t;
@@ -64,26 +80,11 @@ bool EadpMatchLayer::Run(vector<Block>& images, vector<Block>& disp, LayerParame
 	RLOG("disparity map has been computed.");
 	CHECK_EQ(l_disp.type(), CV_16U) << "disparity map type error!";
 
-	images[0].pMatch = &images[1];
-	images[0].points.clear();
-	images[1].points.clear();
-	images[0].ptidx.clear();
-	Mat &dispmap = check;
-	int idx = 0;
-	for (int i = 0; i < dispmap.rows; ++i){
-		ushort *ptr = dispmap.ptr<ushort>(i);
-		for (int j = 0; j < dispmap.cols; ++j){
-			ushort val = ptr[j];
-			float dispval = val / (float)factor;
-			if (dispval < max_disp){
-				images[0].points.push_back(Point2f(i,j));
-				images[1].points.push_back(Point2f(i+dispval,j));
-				images[0].ptidx.push_back(idx);
-				idx++;
-			}
-		}
+	StereoBandPublish((World*)param, check, band, factor, max_disp, roi, images[0]);
+	if (points){
+		int idx = StereoBandPoints(check, band, factor, max_disp, roi, images[0], images[1]);
+		LOG(INFO) << "Dense <" << idx << "> pairs point.";
 	}
-	LOG(INFO) << "Dense <" << idx << "> pairs point.";
 
 	return true;
 }
@@ -3,12 +3,13 @@ Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
 */
 
 #pragma once
-#include "Layer.h"
+#include "StereoLayer.h"
+#include "../../SuperPixelSegment/svafinterface.h"
 
 namespace svaf{
 
 class EadpMatchLayer :
-	public Layer
+	public StereoLayer
 {
 public:
 	explicit EadpMatchLayer(LayerParameter& layer);
@@ -24,9 +25,21 @@ private:
 	float	sc;
 	float	r1;
 	float	r2;
+	bool	fast;
+	bool	roi;
+	bool	points;
 	string	prefix;
 	bool	savetxt;
 
+	// ƥӲͼ, ֡ڴ
+	pc::EadpMatcher	matcher;
+	Mat		l_disp;
+	Mat		r_disp;
+	Mat		check;
+	Mat		fill;
+	Mat		lband;
+	Mat		rband;
+
 };
 
 }
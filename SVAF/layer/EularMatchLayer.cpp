@@ -26,9 +26,10 @@ bool EularMatchLayer::Run(vector<Block>& images, vector<Block>& disp, LayerParam
 	images[0].pMatch = &images[1];
 	images[1].pMatch = &images[0];
 	thresh = layer.eularmatch_param().thresh();
+	crosscheck = layer.eularmatch_param().crosscheck();
 
-	// ͼ0Ϊգ˵OpenCVʽOpenCVʽŷϾƥ
-	if (!images[0].descriptors.empty()){
+	// ͼ0OpenCVؼ㣬˵OpenCVʽOpenCVʽŷϾƥ
+	if (!images[0].keypoint.empty()){
 		// Ƿ
 		if (images[0].keypoint.empty() || images[1].keypoint.empty()){
 			LOG(ERROR) << "Match Not Run, No Point";
@@ -72,7 +73,7 @@ bool EularMatchLayer::Run(vector<Block>& images, vector<Block>& disp, LayerParam
 			return false;
 		}
 	}
-	// ͼ0Ϊգ÷OpenCVʽŷʽƥ
+	// ͼ0ûOpenCVؼ㣬÷OpenCVʽ(Surf)ŷʽƥ
 	else{
 		if (images[0].points.size() == 0 || images[1].points.size() == 0){
 			LOG(ERROR) << "No Feature Stored!";
@@ -80,10 +81,12 @@ bool EularMatchLayer::Run(vector<Block>& images, vector<Block>& disp, LayerParam
 			return false;
 		}
 		
-		CHECK_EQ(images[0].despciptors[0].size(), images[1].despciptors[0].size())
+		CHECK_EQ(images[0].descriptors.cols, images[1].descriptors.cols)
 			<< "Descriptor Dimention Not Equal!";
-		CHECK_EQ(images[0].despciptors.size(), images[0].points.size()) << "Desp Count Not Match!";
-		CHECK_EQ(images[1].despciptors.size(), images[1].points.size()) << "Desp Count Not Match!";
+		CHECK_EQ(images[0].descriptors.type(), CV_32F) << "Descriptor Type Error!";
+		CHECK_EQ(images[1].descriptors.type(), CV_32F) << "Descriptor Type Error!";
+		CHECK_EQ(images[0].descriptors.rows, images[0].points.size()) << "Desp Count Not Match!";
+		CHECK_EQ(images[1].descriptors.rows, images[1].points.size()) << "Desp Count Not Match!";
 
 		__t.StartWatchTimer();
 		int matchcount = EularMatch(images);
@@ -129,37 +132,17 @@ bool EularMatchLayer::Run(vector<Block>& images, vector<Block>& disp, LayerParam
 // ִŷʽƥ
 int EularMatchLayer::EularMatch(vector<Block>& images){
 	int count = 0;
-	float d0, d1, dist;
-	unsigned int match;
-	const unsigned int desp0_size = images[0].despciptors.size();
-	const unsigned int desp1_size = images[1].despciptors.size();
-	const unsigned int desp_length = images[0].despciptors[0].size();
+	const unsigned int desp0_size = images[0].descriptors.rows;
 
 	// ͼ0ÿѰҾ̵Ϊƥֵ
+	MatchL2(images[0].descriptors, images[1].descriptors, nn_);
 	images[0].ptidx.resize(desp0_size, -1);
+	images[0].ptdist.assign(desp0_size, FLT_MAX);
 	for (int i = 0; i < desp0_size; ++i){
-		d0 = d1 = FLT_MAX;
-		for (int j = 0; j < desp1_size; ++j){
-			dist = 0.0f;
-			for (int k = 0; k < desp_length; ++k){
-				float diff = images[0].despciptors[i][k] - images[1].despciptors[j][k];
-				dist += diff * diff;
-			}
-			dist = sqrt(dist);
-	
-			if (dist < d0){
-				d1 = d0;
-				d0 = dist;
-				match = j;
-			}
-			else if (dist < d1){
-				d1 = dist;
-			}
-		}
-		 
 		// ǰƥƥȽɸѡԱȶȴֵĽб
-		if (d0 / d1 < thresh /*0.65*/){
-			images[0].ptidx[i] = match;
+		if (nn_[i].d0 / nn_[i].d1 < thresh /*0.65*/){
+			images[0].ptidx[i] = nn_[i].idx;
+			images[0].ptdist[i] = nn_[i].d0;
 			count++;
 		}
 	}
@@ -177,6 +160,17 @@ bool EularMatchLayer::EularMatchCVFormat(vector<Block>& images){
 	int length = images[0].descriptors.cols;
 	float d0, d1, dist;
 
+	// ֵ(ORB/BRIEF/BRISK/FREAK)ú
+	if (images[0].descriptors.Kind() == DESC_BINARY && images[1].descriptors.Kind() == DESC_BINARY){
+		MatchHamming(images[0].descriptors, images[1].descriptors, nn_, crosscheck);
+		for (int i = 0; i < p1_size; ++i){
+			if (nn_[i].idx >= 0 && nn_[i].d0 / nn_[i].d1 < thresh){
+				images[0].matches.push_back(DMatch(i, nn_[i].idx, nn_[i].d0));
+			}
+		}
+		return true;
+	}
+
 	// ͬʽʽͬ㷨ŷʽ뺯ͬ 
 	DMatch match;
 	switch (images[0].descriptors.depth()){
@@ -326,31 +320,10 @@ bool EularMatchLayer::EularMatchCVFormat(vector<Block>& images){
 		}
 		break;
 	case CV_32F:
+		MatchL2(images[0].descriptors, images[1].descriptors, nn_);
 		for (int i = 0; i < p1_size; ++i){
-			match.queryIdx = i;
-			d0 = d1 = FLT_MAX;
-			for (int j = 0; j < p2_size; ++j){
-				dist = 0.0f;
-				for (int k = 0; k < length; ++k){
-					float diff = images[0].descriptors.ptr<float>(i)[k]
-						- images[1].descriptors.ptr<float>(j)[k];
-					dist += diff * diff;
-				}
-				dist = sqrt(dist);
-
-				if (dist < d0){
-					d1 = d0;
-					d0 = dist;
-					match.trainIdx = j;
-				}
-				else if (dist < d1){
-					d1 = dist;
-				}
-			}
-
-			match.distance = d0;
-			if (d0 / d1 < 0.65){
-				images[0].matches.push_back(match);
+			if (nn_[i].d0 / nn_[i].d1 < 0.65){
+				images[0].matches.push_back(DMatch(i, nn_[i].idx, nn_[i].d0));
 			}
 		}
 		break;
@@ -4,6 +4,7 @@ Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
 
 #pragma once
 #include "Layer.h"
+#include "../src/DescMatch.h"
 
 namespace svaf{
 
@@ -57,6 +58,8 @@ protected:
 
 private:
 	float thresh;
+	bool crosscheck;	// ֵӽ
+	vector<DescNN> nn_;	// ÿѯںʹν
 
 };
 
@@ -0,0 +1,305 @@
+/*
+Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
+֡: ǰ֡˫Ŀƥ, λ˲
+*/
+
+#include "FeaturePoolLayer.h"
+
+namespace svaf{
+
+// 캯
+FeaturePoolLayer::FeaturePoolLayer(LayerParameter& layer) : StereoLayer(layer), pWorld_(NULL), frame_(0), failed_(0)
+{
+	capacity = layer.featpool_param().capacity();	// 
+	thresh = layer.featpool_param().thresh();		// ֵ
+	cell = layer.featpool_param().cell();			// ռɢб߳
+	radius = min(layer.featpool_param().radius(), cell);	// ϲ
+	inlier = layer.featpool_param().inlier();		// RANSACڵ
+	iters = max(1, layer.featpool_param().iters());
+	minmatch = max(3, layer.featpool_param().minmatch());
+	store = layer.featpool_param().store();
+	maxfail = layer.featpool_param().maxfail();		// ʧmaxfail֡ؽ, 0Ϊؽ
+	pool_.SetIndex(layer.featpool_param().trees(), layer.featpool_param().checks());
+	CHECK_GT(capacity, 0) << "Feature Pool Capacity Error!";
+}
+
+// 
+FeaturePoolLayer::~FeaturePoolLayer()
+{
+}
+
+// 㷨
+bool FeaturePoolLayer::Run(vector<Block>& images, vector<Block>& disp, LayerParameter& layer, void* param){
+	pWorld_ = (World *)param;
+	CHECK_NOTNULL(pWorld_);
+	CHECK_NOTNULL(images[0].pMatch);
+	frame_++;
+
+	__t.StartWatchTimer();
+	if (!GenerateFeaturePool(images)){
+		return false;
+	}
+
+	// һ֡(Ϊ)ԵǰϵΪϵ
+	Mat RT = Mat::eye(4, 4, CV_64F);
+	bool solved = (pool_.Size() == 0);
+	int matched = SearchFeaturePool();
+	inlier_.assign(curpt_.size(), 0);
+	if (!solved && matched >= minmatch){
+		vector<Point3f> src, dst;
+		src.reserve(matched);
+		dst.reserve(matched);
+		for (int i = 0; i < slot_.size(); ++i){
+			if (slot_[i] >= 0){
+				src.push_back(curpt_[i]);
+				dst.push_back(pool_.Point(slot_[i]));
+			}
+		}
+		vector<uchar> mask;
+		Mat T = SolveRT(src, dst, mask);
+		if (!T.empty()){
+			RT = T;
+			solved = true;
+			for (int i = 0, k = 0; i < slot_.size(); ++i){
+				if (slot_[i] >= 0){
+					inlier_[i] = mask[k++];
+				}
+			}
+		}
+	}
+
+	// ٶʧ볡ٶӦ, ʧmaxfail֡, Եǰ֡½ϵ
+	failed_ = solved ? 0 : failed_ + 1;
+	if (maxfail > 0 && failed_ >= maxfail){
+		LOG(WARNING) << "Feature Pool Lost For <" << failed_ << "> Frames, Reset From Current Frame.";
+		pool_.Clear();
+		RT = Mat::eye(4, 4, CV_64F);
+		inlier_.assign(curpt_.size(), 0);
+		solved = true;
+		failed_ = 0;
+	}
+
+	if (solved){
+		StoreToFeaturePool(RT);
+		pWorld_->pose = RT;
+	} else{
+		LOG(WARNING) << "Feature Pool Pose Failed: <" << matched << "> Matches, Pool Not Updated.";
+	}
+	__t.ReadWatchTimer("Feature Pool Time");
+	if (__logt){
+		(*figures)[__name + "_t"][*id] = (float)__t;
+	}
+
+	int n = 0;
+	for (int i = 0; i < inlier_.size(); ++i){
+		n += inlier_[i];
+	}
+	LOG(INFO) << "Feature Pool <" << pool_.Size() << "/" << capacity << "> Matched <" << matched
+		<< "> Inlier <" << n << "> Of <" << curpt_.size() << ">";
+	if (solved){
+		LOG(INFO) << "Camera -> Pool RT:\n" << RT;
+	}
+
+	if (Layer::task_type == PC_REGISTRATION){
+		__bout = true;
+	} else{
+		__bout = false;
+	}
+	if (solved){
+		DisplayResult(disp, RT);
+	}
+	return solved;
+}
+
+// ռǰ֡ƥɹ˫Ŀ: Ӻ
+bool FeaturePoolLayer::GenerateFeaturePool(vector<Block>& images){
+	Block& image0 = images[0];
+	Block& image1 = *images[0].pMatch;
+	if (!pWorld_->cloudready || pWorld_->voxel.Enabled() || (int)pWorld_->xl.size() != pWorld_->cloud.count){
+		LOG(ERROR) << "Feature Pool Needs TRIANG Points Without Voxel.";
+		return false;
+	}
+	if (image0.descriptors.type() != CV_32F || image1.descriptors.type() != CV_32F){
+		LOG(ERROR) << "Feature Pool Needs Float Descriptors.";
+		return false;
+	}
+	const int dims = image0.descriptors.cols;
+	CHECK_EQ(image1.descriptors.cols, dims) << "Descriptor Dimention Not Equal!";
+
+	const int n = pWorld_->cloud.count;
+	curl_.Create(n, dims, CV_32F, DESC_FLOAT);
+	curr_.Create(n, dims, CV_32F, DESC_FLOAT);
+	pWorld_->cloud.Export(curpt_);
+	// TriangulationLayerͬ˳
+	int k = 0;
+	for (int i = 0; i < image0.ptidx.size() && k < n; ++i){
+		if (image0.ptidx[i] < 0){
+			continue;
+		}
+		memcpy(curl_.Row<float>(k), image0.descriptors.Row<float>(i), dims * sizeof(float));
+		memcpy(curr_.Row<float>(k), image1.descriptors.Row<float>(image0.ptidx[i]), dims * sizeof(float));
+		k++;
+	}
+	CHECK_EQ(k, n) << "Stereo Features Not Match Points!";
+
+	if (pool_.Capacity() == 0 || pool_.Dims() != dims){
+		pool_.Reset(capacity, dims, cell);
+	}
+	return n > 0;
+}
+
+// ǰ֡еƥ, ƥ
+int FeaturePoolLayer::SearchFeaturePool(){
+	pool_.Match(curl_, curr_, thresh, slot_);
+	int matched = 0;
+	for (int i = 0; i < slot_.size(); ++i){
+		if (slot_[i] >= 0){
+			matched++;
+		}
+	}
+	return matched;
+}
+
+// ڵ¹۲, δƥ任ϵϲ
+void FeaturePoolLayer::StoreToFeaturePool(const Mat& RT){
+	const double *T = RT.ptr<double>(0);
+	for (int i = 0; i < curpt_.size(); ++i){
+		if (slot_[i] >= 0 && inlier_[i]){
+			pool_.Touch(slot_[i], frame_);
+			continue;
+		}
+		if (!store){
+			continue;
+		}
+		const Point3f& p = curpt_[i];
+		Point3f q((float)(T[0] * p.x + T[1] * p.y + T[2] * p.z + T[3]),
+			(float)(T[4] * p.x + T[5] * p.y + T[6] * p.z + T[7]),
+			(float)(T[8] * p.x + T[9] * p.y + T[10] * p.z + T[11]));
+		int s = pool_.Nearby(q, radius);
+		if (s >= 0){
+			pool_.Touch(s, frame_);
+		} else{
+			pool_.Insert(curl_.Row<float>(i), curr_.Row<float>(i), q, frame_);
+		}
+	}
+}
+
+// ɶӦ(С, SVD)任 dst = R * src + t
+static Mat RigidTransform(const vector<Point3f>& src, const vector<Point3f>& dst, const vector<int>& idx){
+	Point3d cs(0, 0, 0), cd(0, 0, 0);
+	for (int i = 0; i < idx.size(); ++i){
+		cs += Point3d(src[idx[i]]);
+		cd += Point3d(dst[idx[i]]);
+	}
+	cs *= 1.0 / idx.size();
+	cd *= 1.0 / idx.size();
+	Mat H = Mat::zeros(3, 3, CV_64F);
+	double *h = H.ptr<double>(0);
+	for (int i = 0; i < idx.size(); ++i){
+		Point3d a = Point3d(src[idx[i]]) - cs;
+		Point3d b = Point3d(dst[idx[i]]) - cd;
+		h[0] += a.x * b.x; h[1] += a.x * b.y; h[2] += a.x * b.z;
+		h[3] += a.y * b.x; h[4] += a.y * b.y; h[5] += a.y * b.z;
+		h[6] += a.z * b.x; h[7] += a.z * b.y; h[8] += a.z * b.z;
+	}
+	Mat w, u, vt;
+	SVD::compute(H, w, u, vt);
+	Mat R = vt.t() * u.t();
+	// 
+	if (determinant(R) < 0){
+		vt.row(2) *= -1;
+		R = vt.t() * u.t();
+	}
+	Mat RT = Mat::eye(4, 4, CV_64F);
+	R.copyTo(RT(Rect(0, 0, 3, 3)));
+	Mat t = Mat(cd) - R * Mat(cs);
+	t.copyTo(RT(Rect(3, 0, 1, 3)));
+	return RT;
+}
+
+// RANSAC(3)ǰϵϵı任, ڵ, ʧܷؿվ
+Mat FeaturePoolLayer::SolveRT(vector<Point3f>& src, vector<Point3f>& dst, vector<uchar>& mask){
+	const int n = (int)src.size();
+	mask.assign(n, 0);
+	if (n < 3){
+		return Mat();
+	}
+	const float inlier2 = inlier * inlier;
+	RNG rng(0x5EED + frame_);
+	vector<int> sample(3), best;
+	int bestcount = 0;
+	Mat bestRT;
+	for (int it = 0; it < iters; ++it){
+		sample[0] = rng.uniform(0, n);
+		sample[1] = rng.uniform(0, n);
+		sample[2] = rng.uniform(0, n);
+		if (sample[0] == sample[1] || sample[0] == sample[2] || sample[1] == sample[2]){
+			continue;
+		}
+		// ߵ㲻ȷת
+		Point3f e1 = src[sample[1]] - src[sample[0]];
+		Point3f e2 = src[sample[2]] - src[sample[0]];
+		Point3f c = e1.cross(e2);
+		if (c.dot(c) < 1e-6f * e1.dot(e1) * e2.dot(e2)){
+			continue;
+		}
+		Mat RT = RigidTransform(src, dst, sample);
+		const double *T = RT.ptr<double>(0);
+		int count = 0;
+		for (int i = 0; i < n; ++i){
+			const Point3f& p = src[i];
+			double dx = T[0] * p.x + T[1] * p.y + T[2] * p.z + T[3] - dst[i].x;
+			double dy = T[4] * p.x + T[5] * p.y + T[6] * p.z + T[7] - dst[i].y;
+			double dz = T[8] * p.x + T[9] * p.y + T[10] * p.z + T[11] - dst[i].z;
+			count += (dx * dx + dy * dy + dz * dz < inlier2);
+		}
+		if (count > bestcount){
+			bestcount = count;
+			bestRT = RT;
+		}
+	}
+	if (bestcount < minmatch){
+		return Mat();
+	}
+
+	// ڵ
+	const double *T = bestRT.ptr<double>(0);
+	for (int i = 0; i < n; ++i){
+		const Point3f& p = src[i];
+		double dx = T[0] * p.x + T[1] * p.y + T[2] * p.z + T[3] - dst[i].x;
+		double dy = T[4] * p.x + T[5] * p.y + T[6] * p.z + T[7] - dst[i].y;
+		double dz = T[8] * p.x + T[9] * p.y + T[10] * p.z + T[11] - dst[i].z;
+		if (dx * dx + dy * dy + dz * dz < inlier2){
+			mask[i] = 1;
+			best.push_back(i);
+		}
+	}
+	return RigidTransform(src, dst, best);
+}
+
+// 任ϵĵǰ֡
+void FeaturePoolLayer::DisplayResult(vector<Block>& disp, const Mat& RT){
+	if (!__bout && !__save){
+		return;
+	}
+	const double *T = RT.ptr<double>(0);
+	vector<Point3f> points(curpt_.size());
+	for (int i = 0; i < curpt_.size(); ++i){
+		const Point3f& p = curpt_[i];
+		points[i] = Point3f((float)(T[0] * p.x + T[1] * p.y + T[2] * p.z + T[3]),
+			(float)(T[4] * p.x + T[5] * p.y + T[6] * p.z + T[7]),
+			(float)(T[8] * p.x + T[9] * p.y + T[10] * p.z + T[11]));
+	}
+	if (__bout){
+		Mat im;
+		Block block("Feature Pool", im, false, false, __bout);
+		block.isOutput3DPoint = true;
+		block.point3d = points;
+		disp.push_back(block);
+	}
+	if (__save){
+		pcdsave(string("tmp/P_") + Circuit::time_id_ + ".pcd", points);
+	}
+}
+
+}
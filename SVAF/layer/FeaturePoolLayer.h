@@ -1,23 +1,14 @@
+/*
+Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
+*/
+
 #pragma once
 #include "Layer.h"
 #include "StereoLayer.h"
+#include "../src/FeaturePool.h"
 
 namespace svaf{
 
-typedef struct _UnionFeature{
-	int featid;
-	int	imgIndex;
-	int refIndex;
-	Mat	RT;
-	vector<float> despl;
-	vector<float> despr;
-	Point3f pointL;
-	// used to display
-	Point2f pointl;
-	Point2f pointr;
-	
-} Feat;
-
 class FeaturePoolLayer :
 	public StereoLayer
 {
@@ -25,32 +16,36 @@ public:
 	explicit FeaturePoolLayer(LayerParameter& layer);
 	~FeaturePoolLayer();
 	virtual bool Run(vector<Block>&, vector<Block>&, LayerParameter&, void*);
-	
+
 protected:
-	bool RunForFeaturePool(vector<Block>&, vector<Block>&, LayerParameter&, void*);
-	void GenerateFeaturePool(vector<Block>&);
-	bool ExcuteEularMatch(vector<Block>&);
-	void ClearFeaturePool();
-	void DisplayResult(vector<Block>&, vector<Block>&);
-	//Feat SearchFeaturePool(vector<float>&, vector<float>&);
-	int SearchFeaturePool(vector<float>&, vector<float>&);
-	void StoreToFeaturePool();
-	Mat SolveRT(vector<Point3f>&, vector<Point3f>&);
-	Mat SolveRT(vector<Point3f>&, vector<Point2f>&);
+	bool GenerateFeaturePool(vector<Block>&);
+	int SearchFeaturePool();
+	void StoreToFeaturePool(const Mat& RT);
+	Mat SolveRT(vector<Point3f>&, vector<Point3f>&, vector<uchar>&);
+	void DisplayResult(vector<Block>&, const Mat& RT);
 
 private:
-	World *pWorld_;
-	
-	vector<Feat> featpool_;
-
-	vector<Mat> left;
-	vector<Mat> right;
-
-	vector<int> l_l_idx;
-	vector<int> l_r_idx;
-	vector<int> r_l_idx;
-	vector<int> r_r_idx;
+	World*	pWorld_;
+
+	int		capacity;
+	float	thresh;
+	float	cell;
+	float	radius;
+	float	inlier;
+	int		iters;
+	int		minmatch;
+	bool	store;
+	int		maxfail;
+
+	FeaturePool		pool_;
+	int				frame_;
+	int				failed_;	// ʧܵ֡
+
+	// ǰ֡˫Ŀ, pWorld_->cloudһһӦ
+	DescMatrix		curl_, curr_;
+	vector<Point3f>	curpt_;
+	vector<int>		slot_;		// ƥ䵽زλ, -1Ϊδƥ
+	vector<uchar>	inlier_;
 };
 
 }
-
@@ -52,16 +52,16 @@ bool IAEstimateLayer::Run(vector<Block>& images, vector<Block>& disp, LayerParam
 	pcl::PointCloud<pcl::PointXYZ>::Ptr target(new pcl::PointCloud<pcl::PointXYZ>);
 
 	// ԶѡΪ׼
-	if (pWorld_->pointW.empty()){
-		if (pWorld_->pointL.empty()){
+	if (pWorld_->cloudW.count == 0){
+		if (pWorld_->cloud.count == 0){
 			LOG(ERROR) << "\nLoop Cut Short\n";
 			return false;
 		}
-		pclconvert(*source, pWorld_->pointL);
+		pclconvert(*source, pWorld_->cloud);
 		LOG(INFO) << "SAC-IA use Left Camera Coordinate.";
 		RLOG("SAC-IA use Left Camera Coordinate.");
 	} else{
-		pclconvert(*source, pWorld_->pointW);
+		pclconvert(*source, pWorld_->cloudW);
 		LOG(INFO) << "SAC-IA use World Coordinate.";
 		RLOG("SAC-IA use World Cooordinate.");
 	}
@@ -73,7 +73,12 @@ bool IAEstimateLayer::Run(vector<Block>& images, vector<Block>& disp, LayerParam
 	pcl::PointCloud<pcl::PointXYZ>::Ptr cloud1ds(new pcl::PointCloud<pcl::PointXYZ>);
 	pcl::PointCloud<pcl::PointXYZ>::Ptr cloud2ds(new pcl::PointCloud<pcl::PointXYZ>);
 
-	pc::voxelFilter(source, cloud1ds, voxel_grid);
+	// ѰСvoxel_gridؽʱظ˲
+	if (pWorld_->voxel.Enabled() && pWorld_->voxel.Leaf() >= voxel_grid){
+		cloud1ds = source;
+	} else{
+		pc::voxelFilter(source, cloud1ds, voxel_grid);
+	}
 	pc::voxelFilter(target, cloud2ds, voxel_grid);
 
 	// compute normals
@@ -0,0 +1,162 @@
+/*
+Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
+kdɭֽƥ
+*/
+
+#include "KDTreeMatchLayer.h"
+
+namespace svaf{
+
+// 캯
+KDTreeMatchLayer::KDTreeMatchLayer(LayerParameter& layer) : Layer(layer), trainhash_(0)
+{
+	trees = max(1, layer.kdtreematch_param().trees());		// ĸ
+	checks = layer.kdtreematch_param().checks();			// ÿѯȽϵӸ, ԽԽ׼Խ
+	leafsize = max(1, layer.kdtreematch_param().leafsize());
+	thresh = layer.kdtreematch_param().thresh();
+	keeptrain = layer.kdtreematch_param().keeptrain();		// ͼ1Ϊ̶ģʱֻһ
+	// ƥ伴ȷ
+	if (layer.type() == LayerParameter_LayerType_BF_MATCH){
+		checks = 0;
+	}
+}
+
+// 
+KDTreeMatchLayer::~KDTreeMatchLayer()
+{
+}
+
+// 㷨
+bool KDTreeMatchLayer::Run(vector<Block>& images, vector<Block>& disp, LayerParameter& layer, void* param){
+	CHECK_GE(images.size(), 2) << "Need Image Pair(" << images.size() << ")";
+
+	// ƥ
+	images[0].pMatch = &images[1];
+	images[1].pMatch = &images[0];
+
+	// ͼ0OpenCVؼʱΪOpenCVʽ, ΪSurfʽ
+	const bool cvformat = !images[0].keypoint.empty();
+	const int n0 = cvformat ? (int)images[0].keypoint.size() : (int)images[0].points.size();
+	const int n1 = cvformat ? (int)images[1].keypoint.size() : (int)images[1].points.size();
+	if (n0 == 0 || n1 == 0){
+		LOG(ERROR) << "Match Not Run, No Point";
+		return false;
+	}
+	if (images[0].descriptors.rows != n0 || images[1].descriptors.rows != n1){
+		LOG(ERROR) << "Match Not Run, Point and Discriptor not Match";
+		return false;
+	}
+	CHECK_EQ(images[0].descriptors.cols, images[1].descriptors.cols) << "Descriptor Dimention Not Equal!";
+
+	__t.StartWatchTimer();
+	Match(images);
+	__t.ReadWatchTimer("KDTree Match Time");
+	if (__logt){
+		(*figures)[__name + "_t"][*id] = (float)__t;
+	}
+
+	// ֵ
+	int matchcount = 0;
+	if (cvformat){
+		for (int i = 0; i < n0; ++i){
+			if (nn_[i].idx >= 0 && nn_[i].d0 / nn_[i].d1 < thresh){
+				images[0].matches.push_back(DMatch(i, nn_[i].idx, nn_[i].d0));
+				matchcount++;
+			}
+		}
+	} else{
+		images[0].ptidx.assign(n0, -1);
+		images[0].ptdist.assign(n0, FLT_MAX);
+		for (int i = 0; i < n0; ++i){
+			if (nn_[i].idx >= 0 && nn_[i].d0 / nn_[i].d1 < thresh){
+				images[0].ptidx[i] = nn_[i].idx;
+				images[0].ptdist[i] = nn_[i].d0;
+				matchcount++;
+			}
+		}
+	}
+	(*figures)[__name][*id] = matchcount;
+	LOG(INFO) << "KDTree Matched <" << matchcount << "> points.";
+
+	if (task_type == SvafApp::POINT_MATCH){
+		__bout = true;
+	} else {
+		__bout = false;
+	}
+
+	if (cvformat && (__show || __save || __bout)){
+		Mat img_match;
+		drawMatches(images[0].image, images[0].keypoint, images[1].image, images[1].keypoint,
+			images[0].matches, img_match);
+		disp.push_back(Block("KDTree Matched", img_match, __show, __save, __bout));
+	} else if (!cvformat && (__show || __save)){
+		Mat mat0 = images[0].image.clone();
+		Mat mat1 = images[1].image.clone();
+		Rect roi0(0, 0, mat0.cols, mat0.rows);
+		Rect roi1(mat0.cols, 0, mat1.cols, mat1.rows);
+		Mat image(max(mat0.rows, mat1.rows), mat0.cols + mat1.cols, mat0.type());
+		mat0.copyTo(image(roi0));
+		mat1.copyTo(image(roi1));
+		for (int i = 0; i < images[0].ptidx.size(); ++i){
+			if (images[0].ptidx[i] < 0){
+				continue;
+			}
+			Point2f pt0 = images[0].points[i];
+			Point2f pt1 = images[1].points[images[0].ptidx[i]];
+			pt1.x += mat0.cols;
+			line(image, pt0, pt1, Scalar(255, 128, 0));
+		}
+		disp.push_back(Block("KDTree Match", image, __show, __save));
+	}
+
+	if (matchcount == 0){
+		LOG(ERROR) << "KDTree Loss Match";
+		return false;
+	}
+	return true;
+}
+
+// ݵFNV-1aϣ, м(Matܲ)
+static unsigned long long DescHash(const Mat& desc){
+	unsigned long long h = 14695981039346656037ULL;
+	const size_t rowbytes = desc.cols * desc.elemSize();
+	for (int i = 0; i < desc.rows; ++i){
+		const uchar* b = desc.ptr<uchar>(i);
+		for (size_t j = 0; j < rowbytes; ++j){
+			h = (h ^ b[j]) * 1099511628211ULL;
+		}
+	}
+	return h;
+}
+
+// ͼ0ÿͼ1вںʹν
+void KDTreeMatchLayer::Match(vector<Block>& images){
+	const DescMatrix& query = images[0].descriptors;
+	const DescMatrix& train = images[1].descriptors;
+
+	// ֵӲʺkd, ֱú뱩ƥ
+	if (query.Kind() == DESC_BINARY){
+		MatchHamming(query, train, nn_);
+		return;
+	}
+
+	// ȷҪ
+	if (checks <= 0){
+		MatchL2(query, train, nn_);
+		return;
+	}
+
+	// ģ岻ʱ; Ӹݱ仯ʱؽ(ܱԭظ, ֻȽ)
+	if (!keeptrain){
+		forest_.Build(train, trees, leafsize);
+	} else{
+		const unsigned long long hash = DescHash(train);
+		if (forest_.Empty() || forest_.Size() != train.rows || hash != trainhash_){
+			forest_.Build(train, trees, leafsize);
+			trainhash_ = hash;
+		}
+	}
+	forest_.Match(query, checks, nn_);
+}
+
+}
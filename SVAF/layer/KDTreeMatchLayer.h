@@ -0,0 +1,34 @@
+/*
+Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
+*/
+
+#pragma once
+#include "Layer.h"
+#include "../src/KDForest.h"
+
+namespace svaf{
+
+class KDTreeMatchLayer :
+	public Layer
+{
+public:
+	explicit KDTreeMatchLayer(LayerParameter& layer);
+	~KDTreeMatchLayer();
+	virtual bool Run(vector<Block>&, vector<Block>&, LayerParameter&, void*);
+
+protected:
+	void Match(vector<Block>&);
+
+private:
+	int		trees;
+	int		checks;
+	int		leafsize;
+	float	thresh;
+	bool	keeptrain;
+
+	KDForest		forest_;	// ͼ1
+	unsigned long long	trainhash_;	// ʱݹϣ(keeptrain)
+	vector<DescNN>	nn_;
+};
+
+}
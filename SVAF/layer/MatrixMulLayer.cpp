@@ -4,14 +4,23 @@ Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
 */
 
 #include "MatrixMulLayer.h"
+#include "../src/Calibration.h"
+#include "../src/CpuFeature.h"
 #include <sstream>
+#include <emmintrin.h>
 
 namespace svaf{
 
 // ๹ʱʹļȡ任
 MatrixMulLayer::MatrixMulLayer(LayerParameter& layer) : StereoLayer(layer)
 {
-	if (layer.mxmul_param().has_col0() && layer.mxmul_param().has_col1() && layer.mxmul_param().has_col2()){
+	if (layer.mxmul_param().has_calib()){
+		// ӹı궨жȡ任
+		const Calibration& calib = Calibration::Get(layer.mxmul_param().calib());
+		CHECK(calib.hasM) << layer.mxmul_param().calib() << " Has No Matrix M!";
+		memcpy(M, calib.M, sizeof(M));
+		LOG(INFO) << "Matrix Opened From Calibration " << layer.mxmul_param().calib();
+	} else if (layer.mxmul_param().has_col0() && layer.mxmul_param().has_col1() && layer.mxmul_param().has_col2()){
 		// ļűжȡ任
 		string col[3];
 		col[0] = layer.mxmul_param().col0();
@@ -55,18 +64,67 @@ MatrixMulLayer::~MatrixMulLayer()
 {
 }
 
+// һεĸ任 out = M * [in; 1], ԭؽ; avxʱ8һĲֽAVXں
+static void TransformChunk(const float M[3][4], const float* x, const float* y, const float* z,
+	float* ox, float* oy, float* oz, int n, bool avx){
+	int i = 0;
+	if (avx){
+		i = TransformChunkAVX(M, x, y, z, ox, oy, oz, n);
+	}
+	const __m128 m00 = _mm_set1_ps(M[0][0]), m01 = _mm_set1_ps(M[0][1]), m02 = _mm_set1_ps(M[0][2]), m03 = _mm_set1_ps(M[0][3]);
+	const __m128 m10 = _mm_set1_ps(M[1][0]), m11 = _mm_set1_ps(M[1][1]), m12 = _mm_set1_ps(M[1][2]), m13 = _mm_set1_ps(M[1][3]);
+	const __m128 m20 = _mm_set1_ps(M[2][0]), m21 = _mm_set1_ps(M[2][1]), m22 = _mm_set1_ps(M[2][2]), m23 = _mm_set1_ps(M[2][3]);
+	for (; i + 4 <= n; i += 4){
+		__m128 vx = _mm_loadu_ps(x + i), vy = _mm_loadu_ps(y + i), vz = _mm_loadu_ps(z + i);
+		__m128 rx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, m00), _mm_mul_ps(vy, m01)), _mm_add_ps(_mm_mul_ps(vz, m02), m03));
+		__m128 ry = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, m10), _mm_mul_ps(vy, m11)), _mm_add_ps(_mm_mul_ps(vz, m12), m13));
+		__m128 rz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, m20), _mm_mul_ps(vy, m21)), _mm_add_ps(_mm_mul_ps(vz, m22), m23));
+		_mm_storeu_ps(ox + i, rx);
+		_mm_storeu_ps(oy + i, ry);
+		_mm_storeu_ps(oz + i, rz);
+	}
+	for (; i < n; ++i){
+		float px = x[i], py = y[i], pz = z[i];
+		ox[i] = (px * M[0][0] + py * M[0][1]) + (pz * M[0][2] + M[0][3]);
+		oy[i] = (px * M[1][0] + py * M[1][1]) + (pz * M[1][2] + M[1][3]);
+		oz[i] = (px * M[2][0] + py * M[2][1]) + (pz * M[2][2] + M[2][3]);
+	}
+}
+
+// 任, outinͬ; ϶ʱβ
+void MatrixMulLayer::Transform(const float M[3][4], const CloudSoA& in, CloudSoA& out){
+	const int count = in.count;
+	const int chunk = 16384;
+	const int nchunk = (count + chunk - 1) / chunk;
+	out.Reserve(count);
+	out.count = count;
+	if (count == 0){
+		return;
+	}
+	const float *x = &in.x[0], *y = &in.y[0], *z = &in.z[0];
+	float *ox = &out.x[0], *oy = &out.y[0], *oz = &out.z[0];
+	const bool avx = CpuSupportAVX();
+#ifdef _OPENMP
+#pragma omp parallel for if(nchunk > 1)
+#endif
+	for (int c = 0; c < nchunk; ++c){
+		int begin = c * chunk;
+		int n = min(chunk, count - begin);
+		TransformChunk(M, x + begin, y + begin, z + begin, ox + begin, oy + begin, oz + begin, n, avx);
+	}
+}
+
 bool MatrixMulLayer::Run(vector<Block>& images, vector<Block>& disp, LayerParameter& layer, void* param){
 	auto pWorld = (World*)param;
 	// ͨ˽任Ϊ
-	pWorld->pointW.clear();
-	__t.StartWatchTimer();
-	for (int i = 0; i < pWorld->pointL.size(); ++i){
-		Point3f point;
-		point.x = pWorld->pointL[i].x * M[0][0] + pWorld->pointL[i].y * M[0][1] + pWorld->pointL[i].z * M[0][2] + M[0][3];
-		point.y = pWorld->pointL[i].x * M[1][0] + pWorld->pointL[i].y * M[1][1] + pWorld->pointL[i].z * M[1][2] + M[1][3];
-		point.z = pWorld->pointL[i].x * M[2][0] + pWorld->pointL[i].y * M[2][1] + pWorld->pointL[i].z * M[2][2] + M[2][3];
-		pWorld->pointW.push_back(point);
+	// ֻʹñ֡ؽ(REPROJECT/TRIANG)ĵ
+	if (!pWorld->cloudready){
+		LOG(ERROR) << "No Point Cloud In This Frame, Need REPROJECT or TRIANG Before MXMUL.";
+		return false;
 	}
+	__t.StartWatchTimer();
+	const CloudSoA& cloudW = pWorld->cloudW;
+	Transform(M, pWorld->cloud, pWorld->cloudW);
 	__t.ReadWatchTimer("RT Transform Time");
 	if (__logt){
 		(*figures)[__name + "_t"][*id] = (float)__t;
@@ -74,7 +132,7 @@ bool MatrixMulLayer::Run(vector<Block>& images, vector<Block>& disp, LayerParame
 	
 	// ϵµĵƽ
 	if (__save){
-		pcdsave(string("tmp/W_") + Circuit::time_id_ + ".pcd", pWorld->pointW); // world coord
+		pcdsave(string("tmp/W_") + Circuit::time_id_ + ".pcd", cloudW); // world coord
 	}
 
 	if (Layer::task_type == PC_MULMATRIX){
@@ -87,25 +145,25 @@ bool MatrixMulLayer::Run(vector<Block>& images, vector<Block>& disp, LayerParame
 		Mat im;
 		Block block("Point Cloud World", im, false, false, __bout);
 		block.isOutput3DPoint = true;
-		block.point3d = pWorld->pointW;
+		cloudW.Export(block.point3d);
 		disp.push_back(block);
 	}
 
 	// Ϣ¼־
 	char loginfo[160];
 	string logstr;
-	for (int i = 0; i < (std::min)((int)pWorld->xl.size(), INT_MAX); ++i){
+	for (int i = 0; i < (std::min)((int)pWorld->xl.size(), cloudW.count); ++i){
 		sprintf(loginfo, "(%8.3f, %8.3f) (%8.3f, %8.3f)\t(%8.3f, %8.3f, %8.3f)\n",
 			pWorld->xl[i].x, pWorld->xl[i].y, pWorld->xr[i].x, pWorld->xr[i].y,
-			pWorld->pointW[i].x, pWorld->pointW[i].y, pWorld->pointW[i].z);
+			cloudW.x[i], cloudW.y[i], cloudW.z[i]);
 		logstr += loginfo;
 	}
-	LOG(INFO) << "Left Camera Point: \n \t xl\t\t\t xr \t\t\t pointW\n" << logstr;
+	LOG(INFO) << "Left Camera Point: \n \t xl\t\t\t xr \t\t\t world\n" << logstr;
 
-	if (pWorld->xl.size() == 1){
-		pWorld->x = pWorld->pointW[0].x;
-		pWorld->y = pWorld->pointW[0].y;
-		pWorld->z = pWorld->pointW[0].z;
+	if (pWorld->xl.size() == 1 && cloudW.count == 1){
+		pWorld->x = cloudW.x[0];
+		pWorld->y = cloudW.y[0];
+		pWorld->z = cloudW.z[0];
 		pWorld->a = 0;
 		pWorld->b = 0;
 		pWorld->c = 0;
@@ -16,9 +16,16 @@ public:
 	~MatrixMulLayer();
 	virtual bool Run(vector<Block>&, vector<Block>&, LayerParameter&, void*);
 
+	static void Transform(const float M[3][4], const CloudSoA& in, CloudSoA& out);
+
 protected:
 	float M[3][4];
 };
 
+// 任AVXں(MatrixMulLayer_avx.cpp, AVX), ǰȷCpuSupportAVX()
+// ǰn - n % 8, شĵ
+int TransformChunkAVX(const float M[3][4], const float* x, const float* y, const float* z,
+	float* ox, float* oy, float* oz, int n);
+
 }
 
@@ -0,0 +1,30 @@
+/*
+Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
+任AVXں, ļAVX, MatrixMulLayer.cppCPU
+*/
+
+#include "MatrixMulLayer.h"
+#include <immintrin.h>
+
+namespace svaf{
+
+// 8һ, SSE/·ͬ˳
+int TransformChunkAVX(const float M[3][4], const float* x, const float* y, const float* z,
+	float* ox, float* oy, float* oz, int n){
+	const __m256 m00 = _mm256_set1_ps(M[0][0]), m01 = _mm256_set1_ps(M[0][1]), m02 = _mm256_set1_ps(M[0][2]), m03 = _mm256_set1_ps(M[0][3]);
+	const __m256 m10 = _mm256_set1_ps(M[1][0]), m11 = _mm256_set1_ps(M[1][1]), m12 = _mm256_set1_ps(M[1][2]), m13 = _mm256_set1_ps(M[1][3]);
+	const __m256 m20 = _mm256_set1_ps(M[2][0]), m21 = _mm256_set1_ps(M[2][1]), m22 = _mm256_set1_ps(M[2][2]), m23 = _mm256_set1_ps(M[2][3]);
+	int i = 0;
+	for (; i + 8 <= n; i += 8){
+		__m256 vx = _mm256_loadu_ps(x + i), vy = _mm256_loadu_ps(y + i), vz = _mm256_loadu_ps(z + i);
+		__m256 rx = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, m00), _mm256_mul_ps(vy, m01)), _mm256_add_ps(_mm256_mul_ps(vz, m02), m03));
+		__m256 ry = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, m10), _mm256_mul_ps(vy, m11)), _mm256_add_ps(_mm256_mul_ps(vz, m12), m13));
+		__m256 rz = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, m20), _mm256_mul_ps(vy, m21)), _mm256_add_ps(_mm256_mul_ps(vz, m22), m23));
+		_mm256_storeu_ps(ox + i, rx);
+		_mm256_storeu_ps(oy + i, ry);
+		_mm256_storeu_ps(oz + i, rz);
+	}
+	return i;
+}
+
+}
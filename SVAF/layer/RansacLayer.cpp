@@ -4,12 +4,43 @@ Ransacɸѡƥ
 */
 
 #include "RansacLayer.h"
+#include "TriangulationLayer.h"
 
 namespace svaf{
 
 // 캯
-RansacLayer::RansacLayer(LayerParameter& layer) : Layer(layer)
+RansacLayer::RansacLayer(LayerParameter& layer) : Layer(layer), calib_(NULL), calib_new_(NULL)
 {
+	const RansacParameter& param = layer.ransac_param();
+	opt_.thresh = param.thresh();				// вֵ()
+	opt_.confidence = param.confidence();
+	opt_.maxiters = max(1, param.maxiters());
+	opt_.budget = param.budget();				// ʱ()
+	opt_.prosac = param.prosac();				// ƥ뽥
+	opt_.sprt = param.sprt();
+	switch (param.model()){
+	case svaf::RansacParameter_ModelType_FUNDAMENTAL:
+		opt_.model = RANSAC_FUNDAMENTAL;
+		break;
+	case svaf::RansacParameter_ModelType_ESSENTIAL:
+		opt_.model = RANSAC_ESSENTIAL;
+		break;
+	case svaf::RansacParameter_ModelType_DISPARITY:
+		opt_.model = RANSAC_DISPARITY;
+		break;
+	default:
+		opt_.model = RANSAC_HOMOGRAPHY;
+		break;
+	}
+
+	// ʾҪڲ, ʱͼǷ񾭹ѡԭʼ
+	if (opt_.model == RANSAC_ESSENTIAL){
+		CHECK(param.has_calib()) << "Ransac ESSENTIAL Needs calib!";
+		const Calibration& calib = Calibration::Get(param.calib());
+		CHECK(calib.raw.valid || calib.rect.valid) << "No Stereo Calibration In " << param.calib();
+		calib_ = &calib.raw;
+		calib_new_ = &calib.rect;
+	}
 }
 
 // 
@@ -17,41 +48,91 @@ RansacLayer::~RansacLayer()
 {
 }
 
+// ԭػΪһ(ȥ)
+void RansacLayer::NormalizePoints(vector<Point2f>& pt, const double* fc, const double* cc,
+	const double* kc, double alpha_c){
+	const int count = (int)pt.size();
+	xn_.resize(count);
+	yn_.resize(count);
+	TriangulationLayer::NormalizePixel(pt, fc, cc, kc, alpha_c, &xn_[0], &yn_[0]);
+	for (int i = 0; i < count; ++i){
+		pt[i] = Point2f((float)xn_[i], (float)yn_[i]);
+	}
+}
+
 // 㷨
 bool RansacLayer::Run(vector<Block>& images, vector<Block>& disp, LayerParameter& layer, void* param){
 	CHECK_GE(images.size(), 2) << "Need Binocular Image!";
 	CHECK_NOTNULL(images[0].pMatch);
 	Block& image0 = images[0];
 	Block& image1 = *images[0].pMatch;
+	auto pWorld = (World*)param;
+
+	const StereoCalib* c = NULL;
+	if (opt_.model == RANSAC_ESSENTIAL){
+		const bool rectified = (pWorld != NULL && pWorld->rectified);
+		c = rectified ? calib_new_ : calib_;
+		CHECK(c->valid) << "No " << (rectified ? "Rectified" : "Raw") << " Calibration For Ransac ESSENTIAL!";
+	}
 	
-	// Ransac㷨ֵ
-	float thresh = layer.ransac_param().thresh();
+	// ƥ, PROSAC: ʹptidxӦľ, ȡOpenCVʽmatches
+	vector<float> dist;
+	if (opt_.prosac && image0.ptdist.size() == image0.ptidx.size()){
+		dist = image0.ptdist;
+	} else if (opt_.prosac && !image0.matches.empty()){
+		dist.assign(image0.points.size(), FLT_MAX);
+		for (int i = 0; i < image0.matches.size(); ++i){
+			const DMatch& m = image0.matches[i];
+			if (m.queryIdx >= 0 && m.queryIdx < dist.size()){
+				dist[m.queryIdx] = min(dist[m.queryIdx], m.distance);
+			}
+		}
+	}
 
-	// RansacֱҪĸƥ
+	// ԭͼƥ, ģΪ ͼ0 ~ model(ͼ1)
 	vector<Point2f> pt0, pt1;
+	vector<float> score;
 	for (int i = 0; i < image0.ptidx.size(); ++i){
 		if (image0.ptidx[i] < 0){
 			continue;
 		}
-		pt0.push_back(image0.points[i]);
-		pt1.push_back(image1.points[image0.ptidx[i]]);
+		Point2f p0 = image0.points[i];
+		Point2f p1 = image1.points[image0.ptidx[i]];
+		p0.x += image0.roi.x;
+		p0.y += image0.roi.y;
+		p1.x += image1.roi.x;
+		p1.y += image1.roi.y;
+		pt0.push_back(p0);
+		pt1.push_back(p1);
+		if (!dist.empty()){
+			score.push_back(dist[i]);
+		}
 	}
 
-	if (pt0.size() < 4){
-		LOG(ERROR) << "Ransac Need More Than 4 Point.";
+	const int minpts = (opt_.model == RANSAC_HOMOGRAPHY) ? 4 : (opt_.model == RANSAC_DISPARITY ? 2 : 7);
+	if (pt0.size() < minpts){
+		LOG(ERROR) << "Ransac Need More Than " << minpts << " Point.";
 		LOG(ERROR) << "\nRansac No Work!\n";
-		RLOG("Ransac Need More Than 4 Point!");
+		RLOG("Ransac Need More Point!");
 		return true;
 	}
 
-	// OpenCVRansac㷨
-	vector<uchar> mask(pt0.size());
+	// ʾ: һȥ(TriangulationLayerͬ), ֵ㵽һ
+	RansacOption opt = opt_;
+	if (opt.model == RANSAC_ESSENTIAL){
+		NormalizePoints(pt0, c->fc_left, c->cc_left, c->kc_left, c->alpha_c_left);
+		NormalizePoints(pt1, c->fc_right, c->cc_right, c->kc_right, c->alpha_c_right);
+		opt.thresh = (float)(opt_.thresh / c->fc_left[0]);
+	}
+	vector<uchar> mask;
+	Mat model;
 	__t.StartWatchTimer();
-	Mat homography = findHomography(pt1, pt0, mask, CV_RANSAC, thresh);
+	ransac_.Run(pt1, pt0, score, opt, model, mask);
 	__t.ReadWatchTimer("Ransac Time");
 	if (__logt){
 		(*figures)[__name + "_t"][*id] = (float)__t;
 	}
+	LOG(INFO) << "Ransac Hypotheses: " << ransac_.Iterations() << "\n" << model;
 
 	int count = 0, j = 0;
 	for (int i = 0; i < image0.ptidx.size(); ++i){
@@ -4,6 +4,8 @@ Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
 
 #pragma once
 #include "Layer.h"
+#include "../src/Ransac.h"
+#include "../src/Calibration.h"
 
 namespace svaf{
 
@@ -14,6 +16,17 @@ public:
 	explicit RansacLayer(LayerParameter& layer);
 	~RansacLayer();
 	virtual bool Run(vector<Block>&, vector<Block>&, LayerParameter&, void*);
+
+protected:
+	void NormalizePoints(vector<Point2f>& pt, const double* fc, const double* cc,
+		const double* kc, double alpha_c);
+
+private:
+	RansacOption	opt_;
+	Ransac			ransac_;
+	const StereoCalib	*calib_;		// ʾ: ԭʼͼ
+	const StereoCalib	*calib_new_;	// ʾ: ͼ
+	vector<double>		xn_, yn_;
 };
 
 }
@@ -0,0 +1,292 @@
+/*
+Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
+ɳӲͼֱؽ(˫Ŀ)
+*/
+
+#include "ReprojectLayer.h"
+#include "../src/Calibration.h"
+#include <emmintrin.h>
+
+namespace svaf{
+
+// 캯
+ReprojectLayer::ReprojectLayer(LayerParameter& layer) : StereoLayer(layer), pWorld_(NULL)
+{
+	stride = max(1, layer.reproject_param().stride());	// 
+	color = layer.reproject_param().color();			// Ƿɫ
+	pointl = layer.reproject_param().pointl();			// ʾʱͬʱб
+	savepc = layer.reproject_param().savepc();
+	voxel = layer.reproject_param().voxel();			// ر߳, 0Ϊ
+
+	// 궨: ʹùı궨, ζȡstereoRectifyQ
+	if (layer.reproject_param().has_calib()){
+		const Calibration& calib = Calibration::Get(layer.reproject_param().calib());
+		if (calib.hasQ){
+			SetQ(calib.Q);
+		} else{
+			CHECK(calib.rect.valid) << "Reproject Needs Q Or Rectified Calibration!";
+			const StereoCalib& r = calib.rect;
+			fx = r.fc_left[0];
+			fy = r.fc_left[1];
+			cx = r.cc_left[0];
+			cy = r.cc_left[1];
+			doffs = r.cc_left[0] - r.cc_right[0];
+			baseline = sqrt(r.T[0] * r.T[0] + r.T[1] * r.T[1] + r.T[2] * r.T[2]);
+		}
+	} else if (layer.reproject_param().has_calib_file()){
+		ReadCalib(layer.reproject_param().calib_file());
+	} else{
+		fx = layer.reproject_param().fx();
+		fy = layer.reproject_param().has_fy() ? layer.reproject_param().fy() : fx;
+		cx = layer.reproject_param().cx();
+		cy = layer.reproject_param().cy();
+		doffs = layer.reproject_param().has_cx_right() ? cx - layer.reproject_param().cx_right() : 0;
+		baseline = layer.reproject_param().baseline();
+	}
+	CHECK_GT(fx, 0) << "Reproject Focal Length Error!";
+	CHECK_GT(baseline, 0) << "Reproject Baseline Error!";
+	LOG(INFO) << "Reproject f(" << fx << ", " << fy << ") c(" << cx << ", " << cy
+		<< ") doffs " << doffs << " baseline " << baseline;
+}
+
+// 
+ReprojectLayer::~ReprojectLayer()
+{
+}
+
+// ȡQ: [1 0 0 -cx; 0 1 0 -cy; 0 0 0 f; 0 0 -1/Tx (cx-cx')/Tx]
+void ReprojectLayer::ReadCalib(const string& filename){
+	FileStorage fs(filename, FileStorage::READ);
+	if (!fs.isOpened()){
+		LOG(FATAL) << filename << " Open Failed!";
+	}
+	Mat Q;
+	fs["Q"] >> Q;
+	CHECK(Q.rows == 4 && Q.cols == 4) << filename << " Need 4x4 Matrix Q!";
+	Q.convertTo(Q, CV_64F);
+	Q = Q.clone();
+	SetQ((const double*)Q.data);
+	LOG(INFO) << "Reproject File: " << filename << " Opened.";
+}
+
+// Q()õ
+void ReprojectLayer::SetQ(const double* Q){
+	const double invTx = Q[14];
+	CHECK_NE(invTx, 0) << "Q(3, 2) Should Not Be Zero!";
+	cx = -Q[3];
+	cy = -Q[7];
+	fx = fy = Q[11];
+	baseline = abs(1.0 / invTx);
+	doffs = -Q[15] / invTx;
+}
+
+// ߷: rx[k] = (k*stride - cx) / fx, ry[k] = (k*stride - cy) / fy
+void ReprojectLayer::BuildRayTable(int cols, int rows){
+	int ncol = (cols + stride - 1) / stride;
+	int nrow = (rows + stride - 1) / stride;
+	rx_.resize(ncol);
+	ry_.resize(nrow);
+	for (int k = 0; k < ncol; ++k){
+		rx_[k] = (k * stride - cx) / fx;
+	}
+	for (int k = 0; k < nrow; ++k){
+		ry_[k] = (k * stride - cy) / fy;
+	}
+}
+
+// ؽһ(Ѱstride)Ӳ, ׷ӵpWorld_->cloud[offset...], µĵ
+int ReprojectLayer::ReprojectRow(const ushort* disp, int count, const float* rx, float ry,
+	const uchar* rgb, int channels, int offset){
+	CloudSoA& cloud = pWorld_->cloud;
+	float *X = &cloud.x[0];
+	float *Y = &cloud.y[0];
+	float *Z = &cloud.z[0];
+	const float zk = fx * baseline;
+	const int rgbstep = channels * stride;
+	const int gi = (channels >= 3) ? 1 : 0;
+	const int ri = (channels >= 3) ? 2 : 0;
+	int n = offset;
+	int k = 0;
+
+	// 4Ӳһ: Z = f*B / (d - doffs), X = rx*Z, Y = ry*Z
+	const __m128i zero = _mm_setzero_si128();
+	const __m128 vscale = _mm_set1_ps(scale);
+	const __m128 vmax = _mm_set1_ps(maxdisp);
+	const __m128 voff = _mm_set1_ps(doffs);
+	const __m128 vzk = _mm_set1_ps(zk);
+	const __m128 vry = _mm_set1_ps(ry);
+	const __m128 vzero = _mm_setzero_ps();
+	float xs[4], ys[4], zs[4];
+	for (; k + 4 <= count; k += 4){
+		__m128i d16 = _mm_loadl_epi64((const __m128i*)(disp + k));
+		__m128 d = _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(d16, zero)), vscale);
+		__m128 w = _mm_sub_ps(d, voff);
+		int mask = _mm_movemask_ps(_mm_and_ps(_mm_cmplt_ps(d, vmax), _mm_cmpgt_ps(w, vzero)));
+		if (mask == 0){
+			continue;
+		}
+		__m128 z = _mm_div_ps(vzk, w);
+		_mm_storeu_ps(xs, _mm_mul_ps(_mm_loadu_ps(rx + k), z));
+		_mm_storeu_ps(ys, _mm_mul_ps(vry, z));
+		_mm_storeu_ps(zs, z);
+		for (int j = 0; j < 4; ++j){
+			if (mask & (1 << j)){
+				X[n] = xs[j];
+				Y[n] = ys[j];
+				Z[n] = zs[j];
+				if (rgb){
+					const uchar *p = rgb + (k + j) * rgbstep;
+					cloud.b[n] = p[0];
+					cloud.g[n] = p[gi];
+					cloud.r[n] = p[ri];
+				}
+				n++;
+			}
+		}
+	}
+
+	// ʣಿ
+	for (; k < count; ++k){
+		float d = disp[k] * scale;
+		float w = d - doffs;
+		if (d < maxdisp && w > 0){
+			float z = zk / w;
+			X[n] = rx[k] * z;
+			Y[n] = ry * z;
+			Z[n] = z;
+			if (rgb){
+				const uchar *p = rgb + k * rgbstep;
+				cloud.b[n] = p[0];
+				cloud.g[n] = p[gi];
+				cloud.r[n] = p[ri];
+			}
+			n++;
+		}
+	}
+	return n;
+}
+
+// 㷨
+bool ReprojectLayer::Run(vector<Block>& images, vector<Block>& disp, LayerParameter& layer, void* param){
+	pWorld_ = (World *)param;
+	CHECK_NOTNULL(pWorld_);
+	CloudSoA& cloud = pWorld_->cloud;
+	VoxelHash& vox = pWorld_->voxel;
+	cloud.count = 0;
+	pWorld_->cloudready = false;
+	pWorld_->xl.clear();	// ܵ޶Ӧϵ
+	pWorld_->xr.clear();
+	vox.Reset(voxel);
+	if (pWorld_->disp.empty()){
+		LOG(ERROR) << "No Disparity Map, Need SGM_MATCH or EADP_MATCH Before REPROJECT.";
+		return false;
+	}
+	CHECK_EQ(pWorld_->disp.type(), CV_16U) << "disparity map type error!";
+
+	__t.StartWatchTimer();
+	const Rect& band = pWorld_->dispband;
+	const Rect& valid = pWorld_->dispvalid;
+	scale = 1.0f / pWorld_->dispfactor;
+	maxdisp = (float)pWorld_->maxdisp;
+
+	// ԭͼ, ֻ߱ͼʱؽ
+	int x0 = (valid.x + stride - 1) / stride;
+	int x1 = (valid.br().x + stride - 1) / stride;
+	int y0 = (valid.y + stride - 1) / stride;
+	int y1 = (valid.br().y + stride - 1) / stride;
+	int ncol = max(0, x1 - x0);
+	int nrow = max(0, y1 - y0);
+	if ((int)rx_.size() < x1 || (int)ry_.size() < y1){
+		BuildRayTable(max(valid.br().x, band.br().x), max(valid.br().y, band.br().y));
+	}
+
+	// Ԥ(ֻ), ؽʱֻһ
+	size_t capacity = vox.Enabled() ? (size_t)ncol : (size_t)ncol * nrow;
+	if (cloud.x.size() < capacity){
+		cloud.x.resize(capacity);
+		cloud.y.resize(capacity);
+		cloud.z.resize(capacity);
+	}
+	if (color && cloud.r.size() < capacity){
+		cloud.r.resize(capacity);
+		cloud.g.resize(capacity);
+		cloud.b.resize(capacity);
+	}
+	if (stride > 1){
+		rowbuf_.resize(ncol);
+	}
+
+	// ɫȡͼ
+	Block& image0 = images[0];
+	Rect lext = ImageExtent(image0);
+	bool usecolor = color && !vox.Enabled() && !image0.image.empty() && image0.image.depth() == CV_8U;
+	int channels = image0.image.channels();
+
+	int n = 0;
+	for (int r = y0; r < y1; ++r){
+		int y = r * stride;
+		const ushort *row = pWorld_->disp.ptr<ushort>(y - band.y) + (x0 * stride - band.x);
+		const ushort *d = row;
+		if (stride > 1){
+			for (int k = 0; k < ncol; ++k){
+				rowbuf_[k] = row[k * stride];
+			}
+			d = &rowbuf_[0];
+		}
+		const uchar *rgb = NULL;
+		if (usecolor){
+			rgb = image0.image.ptr<uchar>(y - lext.y) + (x0 * stride - lext.x) * channels;
+		}
+		if (vox.Enabled()){
+			// д, ȫֱʵ
+			int m = ReprojectRow(d, ncol, &rx_[0] + x0, ry_[r], rgb, channels, 0);
+			for (int i = 0; i < m; ++i){
+				vox.Add(cloud.x[i], cloud.y[i], cloud.z[i]);
+			}
+		} else{
+			n = ReprojectRow(d, ncol, &rx_[0] + x0, ry_[r], rgb, channels, n);
+		}
+	}
+	if (vox.Enabled()){
+		// л, ĸдcloud
+		vox.Export(cloud.x, cloud.y, cloud.z);
+		n = vox.Count();
+	}
+	cloud.count = n;
+	pWorld_->cloudready = true;
+	__t.ReadWatchTimer("Reproject Time");
+	if (__logt){
+		(*figures)[__name + "_t"][*id] = (float)__t;
+	}
+	LOG(INFO) << "Reproject <" << n << "> Points From " << valid << " Stride " << stride << " Voxel " << voxel;
+
+	if (Layer::task_type == PC_TRIANGLE){
+		__bout = true;
+	} else{
+		__bout = false;
+	}
+
+	// 
+	if (__bout && pointl){
+		Mat im;
+		Block block("Point Cloud Camera", im, false, false, __bout);
+		block.isOutput3DPoint = true;
+		cloud.Export(block.point3d);
+		if (usecolor){
+			block.color3d.resize(n);
+			for (int i = 0; i < n; ++i){
+				block.color3d[i] = Color3f(cloud.r[i] / 255.0f, cloud.g[i] / 255.0f, cloud.b[i] / 255.0f);
+			}
+		}
+		disp.push_back(block);
+	}
+
+	// 
+	if (__save || savepc){
+		pcdsave(string("tmp/R_") + Circuit::time_id_ + ".pcd", cloud);
+	}
+
+	return n > 0;
+}
+
+}
@@ -0,0 +1,48 @@
+/*
+Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
+*/
+
+#pragma once
+#include "StereoLayer.h"
+
+namespace svaf{
+
+class ReprojectLayer :
+	public StereoLayer
+{
+public:
+	explicit ReprojectLayer(LayerParameter& layer);
+	~ReprojectLayer();
+	virtual bool Run(vector<Block>&, vector<Block>&, LayerParameter&, void*);
+
+protected:
+	void ReadCalib(const string& filename);
+	void SetQ(const double* Q);
+	void BuildRayTable(int cols, int rows);
+	int ReprojectRow(const ushort* disp, int count, const float* rx, float ry,
+		const uchar* rgb, int channels, int offset);
+
+private:
+	World*	pWorld_;
+
+	// 
+	float	fx, fy;
+	float	cx, cy;
+	float	doffs;		// ֮ cx - cx_right
+	float	baseline;
+	float	scale;		// 1 / dispfactor
+	float	maxdisp;
+
+	int		stride;
+	bool	color;
+	bool	pointl;
+	bool	savepc;
+	float	voxel;
+
+	// strideÿ/ÿ߷(ԭͼ), ֡
+	vector<float>	rx_;
+	vector<float>	ry_;
+	vector<ushort>	rowbuf_;
+};
+
+}
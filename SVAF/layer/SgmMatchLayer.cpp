@@ -16,10 +16,23 @@ SgmMatchLayer::SgmMatchLayer(LayerParameter& layer) : StereoLayer(layer)
 	// 㷨
 	max_disp = layer.sgm_param().max_disp();	// Ӳ
 	factor = layer.sgm_param().factor();
+	// CV_16UӲͼ: ЧӲС0xFFFF(Ч), ЧֵҲ[0, max_disp)
+	CHECK_LT(factor * max_disp, 0xFFFF) << "SGM factor * max_disp Must Be Below 65535!";
 	dispmr = layer.sgm_param().dispmr();
 	r1 = layer.sgm_param().r1();				// P1ͷ
 	r2 = layer.sgm_param().r2();				// P2ͷ
 	savetxt = layer.sgm_param().savetxt();		// ǷӲΪtxtĵ
+	pyramid = layer.sgm_param().pyramid();		// ɴֵĽ
+	margin = layer.sgm_param().margin();		// ֲӲչ
+	temporal = layer.sgm_param().temporal();	// ǰһ֡Ӳȷ
+	tile = layer.sgm_param().tile();
+	motion = layer.sgm_param().motion();		// ֿ˶ֵ
+	uniqueness = layer.sgm_param().uniqueness();	// WTAΨһԱ(ٷֱ)
+	subpixel = layer.sgm_param().subpixel();	// Ӳ
+	roi = layer.sgm_param().roi();				// ֻƥͼROIͼӦߴ
+	points = layer.sgm_param().points();		// ضӦ(TriangulationLayerʹ)
+	matcher.SetParam(max_disp, factor, dispmr, r1, r2, pyramid, margin, temporal, tile, motion,
+		uniqueness, subpixel);
 }
 
 // 
@@ -31,12 +44,24 @@ SgmMatchLayer::~SgmMatchLayer()
 bool SgmMatchLayer::Run(vector<Block>& images, vector<Block>& disp, LayerParameter& layer, void* param){
 	CHECK_GE(images.size(), 2) << "Need Image Pairs";
 	
+	// ƥ
+	Rect band;
+	if (!StereoBand(images[0], images[1], max_disp, roi, lband, rband, band)){
+		return false;
+	}
+	// ǰһ֡Ӳڴ, ԭ߶ȱ仯(ȱ仯ʱƥؽ)
+	if (temporal && (band.x != lastband.x || band.y != lastband.y || band.height != lastband.height)){
+		matcher.ResetTemporal();
+	}
+	lastband = band;
+
 	// ִSGMƥ㷨
 	prefix = string("tmp/SGM_") + Circuit::time_id_;
-	Mat l_disp, r_disp, fill, check;
 	__t.StartWatchTimer();
-	SgmMatch(images[0].image, images[1].image, l_disp, r_disp, check, fill,
-		max_disp, factor, dispmr, r1, r2, prefix, savetxt);
+	if (!matcher.Match(lband, rband, l_disp, r_disp, check, fill, prefix, savetxt)){
+		LOG(ERROR) << "SGM Match Failed, Band " << band;
+		return false;
+	}
 	__t.ReadWatchTimer("SGM Time");
 	if (__logt){
 		(*figures)[__name + "_t"][*id] = (float)__t;
@@ -59,26 +84,11 @@ bool SgmMatchLayer::Run(vector<Block>& images, vector<Block>& disp, LayerParamet
 	RLOG("disparity map has been computed.");
 	CHECK_EQ(l_disp.type(), CV_16U) << "disparity map type error!";
 
-	images[0].pMatch = &images[1];
-	images[0].points.clear();
-	images[1].points.clear();
-	images[0].ptidx.clear();
-	Mat &dispmap = fill;
-	int idx = 0;
-	for (int i = 0; i < fill.rows; ++i){
-		ushort *ptr = fill.ptr<ushort>(i);
-		for (int j = 0; j < fill.cols; ++j){
-			ushort val = ptr[j];
-			float dispval = val / (float)factor;
-			if (dispval < max_disp){
-				images[0].points.push_back(Point2f(i, j));
-				images[1].points.push_back(Point2f(i + dispval, j));
-				images[0].ptidx.push_back(idx);
-				idx++;
-			}
-		}
+	StereoBandPublish((World*)param, fill, band, factor, max_disp, roi, images[0]);
+	if (points){
+		int idx = StereoBandPoints(fill, band, factor, max_disp, roi, images[0], images[1]);
+		LOG(INFO) << "Dense <" << idx << "> pairs point.";
 	}
-	LOG(INFO) << "Dense <" << idx << "> pairs point.";
 	return true;
 }
 
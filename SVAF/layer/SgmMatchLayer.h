@@ -4,6 +4,7 @@ Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
 
 #pragma once
 #include "StereoLayer.h"
+#include "../../SuperPixelSegment/svafinterface.h"
 
 namespace svaf{
 
@@ -23,6 +24,25 @@ private:
 	float	r2;
 	string	prefix;
 	bool	savetxt;
+	int		pyramid;
+	int		margin;
+	bool	temporal;
+	int		tile;
+	int		motion;
+	int		uniqueness;
+	bool	subpixel;
+	bool	roi;
+	bool	points;
+
+	// ƥӲͼ, ֡ڴ
+	pc::SgmMatcher	matcher;
+	Mat		l_disp;
+	Mat		r_disp;
+	Mat		check;
+	Mat		fill;
+	Mat		lband;
+	Mat		rband;
+	Rect	lastband;	// һ֡ƥ(temporal)
 
 };
 
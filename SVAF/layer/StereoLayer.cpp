@@ -44,6 +44,19 @@ void StereoLayer::pcdsave(string filename, vector<Point3f>& points, bool is_dens
 	return;
 }
 
+// SoAʽĵ
+void StereoLayer::pcdsave(string filename, const CloudSoA& soa, bool is_dense){
+	pcl::PointCloud<pcl::PointXYZ> cloud;
+	pclconvert(cloud, soa);
+	cloud.is_dense = is_dense;
+	if (!cloud.empty()){
+		pcl::io::savePCDFileASCII(filename, cloud);
+		LOG(INFO) << filename << " Saved <" << cloud.size() << "> Points.";
+	} else{
+		LOG(ERROR) << "PCL Write Error, Empty Cloud.";
+	}
+}
+
 // PCLȡpcdļ
 void StereoLayer::pcdread(string filename, vector<Point3f>& points){
 	pcl::PointCloud<pcl::PointXYZ>::Ptr cloud(new pcl::PointCloud<pcl::PointXYZ>);
@@ -95,6 +108,19 @@ void StereoLayer::pclconvert(pcl::PointCloud<pcl::PointXYZ>& cloud, vector<Point
 
 }
 
+// SoAʽĵתΪpclʽ
+void StereoLayer::pclconvert(pcl::PointCloud<pcl::PointXYZ>& cloud, const CloudSoA& soa){
+	cloud.clear();
+	cloud.width = soa.count;
+	cloud.height = 1;
+	cloud.resize(soa.count);
+	for (int i = 0; i < soa.count; ++i){
+		cloud.points[i].x = soa.x[i];
+		cloud.points[i].y = soa.y[i];
+		cloud.points[i].z = soa.z[i];
+	}
+}
+
 // pclʽĵתΪʽ
 void StereoLayer::pclconvert(vector<Point3f>& points, pcl::PointCloud<pcl::PointXYZ>& incloud){
 	points.clear();
@@ -104,6 +130,112 @@ void StereoLayer::pclconvert(vector<Point3f>& points, pcl::PointCloud<pcl::Point
 	}
 }
 
+// ͼԭͼеλ: roiͬС˵ѱ(/)ü, Ϊԭͼ
+Rect StereoLayer::ImageExtent(Block& block){
+	const Rect& roi = block.roi;
+	if (block.image.cols == roi.width && block.image.rows == roi.height){
+		return roi;
+	}
+	return Rect(0, 0, block.image.cols, block.image.rows);
+}
+
+// ͼȡԭͼµ, ͼĲָƱ߽; ȫͼʱ
+static void BandView(Block& block, Rect& extent, Rect& band, Mat& out){
+	Rect inner = band & extent;
+	Mat sub = block.image(inner - extent.tl());
+	if (inner == band){
+		out = sub;
+		return;
+	}
+	copyMakeBorder(sub, out, inner.y - band.y, band.br().y - inner.br().y,
+		inner.x - band.x, band.br().x - inner.br().x, BORDER_REPLICATE);
+}
+
+// Ҫ: ͼROI(roionlyΪfalseʱΪͼ)
+Rect StereoLayer::StereoBandValid(Block& left, Rect& band, bool roionly){
+	Rect lext = ImageExtent(left);
+	Rect lroi = (roionly && left.roi.area() > 0) ? (left.roi & lext) : lext;
+	return lroi & band;
+}
+
+// ƥ: ͼROIͼӲΧڵͬһߴ, ͼԭͼ,
+// ˴ӲԭͼӲ. roionlyΪfalseʱƥͼ. falseʾͼûй
+bool StereoLayer::StereoBand(Block& left, Block& right, int max_disp, bool roionly, Mat& lband, Mat& rband, Rect& band){
+	Rect lext = ImageExtent(left);
+	Rect rext = ImageExtent(right);
+	Rect lroi = (roionly && left.roi.area() > 0) ? (left.roi & lext) : lext;
+
+	if (!roionly){
+		band = lext;
+		lband = left.image;
+		rband = right.image;
+		return true;
+	}
+
+	int y0 = max(lroi.y, rext.y);
+	int y1 = min(lroi.br().y, rext.br().y);
+	int x1 = lroi.br().x;
+	int x0 = max(lroi.x - (max_disp - 1), rext.x);
+	x0 = min(x0, lroi.x);
+	if (y1 <= y0 || x1 <= rext.x || lroi.width <= 0){
+		LOG(ERROR) << "Stereo Band Empty, Left ROI " << lroi << " Right " << rext;
+		return false;
+	}
+	// ƥΪӲΧ
+	x0 = min(x0, x1 - max_disp);
+
+	band = Rect(x0, y0, x1 - x0, y1 - y0);
+	BandView(left, lext, band, lband);
+	BandView(right, rext, band, rband);
+	return true;
+}
+
+// ͼROIЧӲתΪҶӦ, ԸԵroi(TriangulationLayerһ)
+int StereoLayer::StereoBandPoints(Mat& dispmap, Rect& band, int factor, int max_disp, bool roionly, Block& left, Block& right){
+	Rect valid = StereoBandValid(left, band, roionly);
+	Point lorg = left.roi.area() > 0 ? left.roi.tl() : Point(0, 0);
+	Point rorg = right.roi.area() > 0 ? right.roi.tl() : Point(0, 0);
+
+	left.pMatch = &right;
+	left.points.clear();
+	right.points.clear();
+	left.ptidx.clear();
+	left.ptdist.clear();
+	left.points.reserve(valid.area());
+	right.points.reserve(valid.area());
+	left.ptidx.reserve(valid.area());
+
+	int idx = 0;
+	for (int y = valid.y; y < valid.br().y; ++y){
+		const ushort *ptr = dispmap.ptr<ushort>(y - band.y);
+		for (int x = valid.x; x < valid.br().x; ++x){
+			if (ptr[x - band.x] == 0xFFFF){
+				continue;	// ЧӲ
+			}
+			float dispval = ptr[x - band.x] / (float)factor;
+			if (dispval < max_disp){
+				left.points.push_back(Point2f((float)(x - lorg.x), (float)(y - lorg.y)));
+				right.points.push_back(Point2f(x - dispval - rorg.x, (float)(y - rorg.y)));
+				left.ptidx.push_back(idx);
+				idx++;
+			}
+		}
+	}
+	return idx;
+}
+
+// Ӳͼؽ(ֻMatͷ, )
+void StereoLayer::StereoBandPublish(World* pWorld, Mat& dispmap, Rect& band, int factor, int max_disp, bool roionly, Block& left){
+	if (pWorld == NULL){
+		return;
+	}
+	pWorld->disp = dispmap;
+	pWorld->dispband = band;
+	pWorld->dispvalid = StereoBandValid(left, band, roionly);
+	pWorld->dispfactor = factor;
+	pWorld->maxdisp = max_disp;
+}
+
 // תŷ
 std::vector<float> StereoLayer::computeEularAngles(Eigen::Matrix4f& R, bool israd){
 	std::vector<float> result(3, 0);
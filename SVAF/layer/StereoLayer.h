@@ -23,10 +23,17 @@ protected:
 	void pcdread(string filename, vector<Point3f>& points);
 	void pcdsave(string filename, pcl::PointCloud<pcl::PointXYZ>& cloud, bool is_dense = false);
 	void pcdsave(string filename, pcl::PointCloud<pcl::PointXYZRGB>& cloud, bool is_dense = false);
+	void pcdsave(string filename, const CloudSoA& cloud, bool is_dense = true);
 	void pcdread(string filename, pcl::PointCloud<pcl::PointXYZ>& cloud);
 	void pclconvert(pcl::PointCloud<pcl::PointXYZ>& cloud, vector<Point3f>& inpoints);
 	void pclconvert(vector<Point3f>& points, pcl::PointCloud<pcl::PointXYZ>& incloud);
+	void pclconvert(pcl::PointCloud<pcl::PointXYZ>& cloud, const CloudSoA& soa);
 	std::vector<float> computeEularAngles(Eigen::Matrix4f& R, bool israd = true);
+	static Rect ImageExtent(Block& block);
+	static Rect StereoBandValid(Block& left, Rect& band, bool roionly);
+	bool StereoBand(Block& left, Block& right, int max_disp, bool roionly, Mat& lband, Mat& rband, Rect& band);
+	int StereoBandPoints(Mat& dispmap, Rect& band, int factor, int max_disp, bool roionly, Block& left, Block& right);
+	void StereoBandPublish(World* pWorld, Mat& dispmap, Rect& band, int factor, int max_disp, bool roionly, Block& left);
 
 };
 
@@ -4,6 +4,7 @@ Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
 */
 
 #include "StereoRectifyLayer.h"
+#include "../src/Calibration.h"
 #ifdef _OPENMP
 #include <omp.h>
 #endif
@@ -85,10 +86,20 @@ void StereoRectifyLayer::ReadTable(const string& filename){
 	RLOG(string("Rectify file: \"" + filename + "\" opened. Table has been created."));
 }
 
+// ݱļ: ֱָ, ɹı궨(ֱʺͲ)
+string StereoRectifyLayer::TableName(LayerParameter& layer){
+	if (layer.rectify_param().has_filename()){
+		return layer.rectify_param().filename();
+	}
+	CHECK(layer.rectify_param().has_calib()) << "Rectify Needs filename Or calib!";
+	const Calibration& calib = Calibration::Get(layer.rectify_param().calib());
+	return calib.RectifyTable(layer.rectify_param().cache_dir());
+}
+
 // 캯ݸಢȡݱ
 StereoRectifyLayer::StereoRectifyLayer(LayerParameter& layer) : Layer(layer)
 {
-	ReadTable(layer.rectify_param().filename());
+	ReadTable(TableName(layer));
 }
 
 // 
@@ -99,7 +110,7 @@ StereoRectifyLayer::~StereoRectifyLayer()
 // 㷨
 bool StereoRectifyLayer::Run(vector<Block>& images, vector<Block>& disp, LayerParameter& layer, void* param){
 	if (pTable[0][0] == NULL){
-		ReadTable(layer.rectify_param().filename());
+		ReadTable(TableName(layer));
 	}
 
 	CHECK_GE(images.size(), 2) << "Need Image Pair(" << images.size() << ")";
@@ -217,9 +228,9 @@ bool StereoRectifyLayer::Run(vector<Block>& images, vector<Block>& disp, LayerPa
 #pragma omp parallel for
 #endif
 		for (int i = 0; i < right; ++i){
-			*(r_rect + ind_new_left[i]) = 0.5 +
-				a1_right[i] * *(r_data + ind_1_left[i]) + a2_right[i] * *(r_data + ind_2_right[i])
-				+ a3_right[i] * *(r_data + ind_3_left[i]) + a4_right[i] * *(r_data + ind_4_right[i]);
+			*(r_rect + ind_new_right[i]) = 0.5 +
+				a1_right[i] * *(r_data + ind_1_right[i]) + a2_right[i] * *(r_data + ind_2_right[i])
+				+ a3_right[i] * *(r_data + ind_3_right[i]) + a4_right[i] * *(r_data + ind_4_right[i]);
 		}
 	}
 	else if (rchannels > 1){
@@ -15,6 +15,7 @@ class StereoRectifyLayer :
 public:
 	static void *pTable[14][2];
 	static void ReleaseTable();
+	static string TableName(LayerParameter&);
 	void ReadTable(const string&);
 
 public:
@@ -31,8 +31,13 @@ bool SurfDescriptorLayer::Run(vector<Block>& images, vector<Block>& disp,
 	SetParam(layer);
 	for (int i = 0; i < images.size(); ++i){
 		// Surf㷨
+		// ֱд
 		__t.StartWatchTimer();
-		SurfDescriptor(images[i].image, images[i].points, images[i].points_sc, images[i].despciptors);
+		DescMatrix& desc = images[i].descriptors;
+		desc.Create((int)images[i].points.size(), 64, CV_32F, DESC_FLOAT);
+		// ͼ㹲
+		SurfDescriptorIntegral(images[i].integral.Get(images[i].image), images[i].points, images[i].points_sc,
+			desc.rows ? desc.Row<float>(0) : NULL, desc.Stride());
 		__t.ReadWatchTimer("My Surf Desp Time");
 		if (__logt){
 			char alicia[3];
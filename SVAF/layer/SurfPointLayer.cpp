@@ -18,6 +18,11 @@ namespace svaf{
 // 캯
 SurfPointLayer::SurfPointLayer(LayerParameter& layer) : Layer(layer)
 {
+	const PointBudgetParameter& param = layer.surfpoint_param().budget_param();
+	budget_.Reset(param.budget(), param.grid_cols(), param.grid_rows(), param.overshoot());
+	adaptive_ = budget_.Enabled() && param.adaptive();
+	thresh_ = layer.surfpoint_param().thresh();
+	budget_.Restart(thresh_);
 }
 
 // 
@@ -28,11 +33,29 @@ SurfPointLayer::~SurfPointLayer()
 // 㷨
 bool SurfPointLayer::Run(vector<Block>& images, vector<Block>& disp, LayerParameter& layer, void* param){
 	SetParam(layer);
+	if (adaptive_){
+		suparam.thresh = (float)thresh_;
+	}
+	int detected = 0;
 	for (int i = 0; i < images.size(); ++i){
 		// Surf㷨
 		vector<int> label;
 		__t.StartWatchTimer();
-		SurfPoint(images[i].image, images[i].points, images[i].points_sc, label);
+		if (budget_.Enabled()){
+			// ڰӦѡȡ, Ԥ
+			vector<Point2f> points;
+			vector<float> scales, response;
+			vector<int> keep;
+			SurfPointIntegral(images[i].integral.Get(images[i].image), points, scales, label, &response);
+			budget_.Select(points, response, images[i].image.size(), keep);
+			for (int j = 0; j < keep.size(); ++j){
+				images[i].points.push_back(points[keep[j]]);
+				images[i].points_sc.push_back(scales[keep[j]]);
+			}
+			detected = max(detected, (int)points.size());
+		} else{
+			SurfPointIntegral(images[i].integral.Get(images[i].image), images[i].points, images[i].points_sc, label);
+		}
 		__t.ReadWatchTimer("My SURF Time");
 		char alicia[3];
 		sprintf(alicia, "%d", i);
@@ -42,6 +65,10 @@ bool SurfPointLayer::Run(vector<Block>& images, vector<Block>& disp, LayerParame
 		}
 		LOG(INFO) << "Surf Detected <" << images[i].points.size() << "> points";
 	}
+	if (adaptive_){
+		thresh_ = budget_.Adapt(thresh_, detected);
+		LOG(INFO) << "Surf threshold for next frame: " << thresh_;
+	}
 
 	if (task_type == SvafApp::S_POINT || task_type == SvafApp::B_POINT || task_type == SvafApp::S_POINTDESP || task_type == SvafApp::B_POINTDESP){
 		__bout = true;
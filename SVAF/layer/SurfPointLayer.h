@@ -5,6 +5,7 @@ Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
 
 #pragma once
 #include "Layer.h"
+#include "../src/PointBudget.h"
 
 namespace svaf{
 
@@ -16,6 +17,11 @@ public:
 	~SurfPointLayer();
 	virtual bool Run(vector<Block>&, vector<Block>&, LayerParameter&, void*);
 	void SetParam(LayerParameter&);
+
+private:
+	PointBudget	budget_;
+	bool		adaptive_;
+	double		thresh_;	// Ӧĺɭбֵ, ֡
 };
 
 }
@@ -1,38 +1,42 @@
 /*
 Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
-MatlabӶάӲָά
+ͼӦָά(Matlabstereo_triangulationһ)
 */
 
 #include "TriangulationLayer.h"
-#include <direct.h>
+#include <emmintrin.h>
 
 namespace svaf{
 
 // 캯
 TriangulationLayer::TriangulationLayer(LayerParameter& layer) : StereoLayer(layer)
 {
-	// ù·
-	if (layer.triang_param().has_toolbox_dir()){
-		toolbox_dir = layer.triang_param().toolbox_dir();
-	}else{
-		toolbox_dir = "D:/Program Files/Matlab/R2016a/toolbox/calib/";
-	}
-
 	// ñ궨ļ·
 	if (layer.triang_param().has_calibmat_dir()){
 		calibmat_dir = layer.triang_param().calibmat_dir();
 	}else{
 		calibmat_dir = "./calib/";
 	}
-	isMatlabVisible = layer.triang_param().visible(); // MatlabǷɼ
 	isSavePointCloud = layer.triang_param().savepc(); // Ƿ񱣴
-	OpenMatlab(); // Matlab
+	voxel = layer.triang_param().voxel(); // ر߳, 0Ϊ
+
+	// 궨ֻڹʱȡһ, ʹùı궨
+	if (layer.triang_param().has_calib()){
+		const Calibration& calib = Calibration::Get(layer.triang_param().calib());
+		calib_ = &calib.raw;
+		calib_new_ = &calib.rect;
+	} else{
+		Calibration::ImportStereo(calibmat_dir + layer.triang_param().calib_raw(), "", local_[0]);
+		Calibration::ImportStereo(calibmat_dir + layer.triang_param().calib_rect(), "_new", local_[1]);
+		calib_ = &local_[0];
+		calib_new_ = &local_[1];
+	}
+	CHECK(calib_->valid || calib_new_->valid) << "No Stereo Calibration In " << calibmat_dir;
 }
 
 // 
 TriangulationLayer::~TriangulationLayer()
 {
-	CloseMatlab(); // رMatlab
 }
 
 // 㷨
@@ -42,8 +46,8 @@ bool TriangulationLayer::Run(vector<Block>& images, vector<Block>& disp, LayerPa
 	pWorld_ = (World *)param;
 	pWorld_->xl.clear();
 	pWorld_->xr.clear();
-	pWorld_->pointL.clear();
-	pWorld_->pointR.clear();
+	pWorld_->cloud.count = 0;
+	pWorld_->cloudready = false;
 	
 	Block& image0 = images[0];
 	Block& image1 = *images[0].pMatch;
@@ -68,13 +72,20 @@ bool TriangulationLayer::Run(vector<Block>& images, vector<Block>& disp, LayerPa
 		LOG(ERROR) << "More Than 4 Point Needed to Estimate Position and Attitude.";
 	}
 
-	isMatlabVisible = layer.triang_param().visible();
 	char loginfo[120];
 	string logstr;
 	
 	// ɶάά
 	__t.StartWatchTimer();
 	ComputeWorld();
+	CloudSoA& cloud = pWorld_->cloud;
+	pWorld_->cloudready = true;
+	if (pWorld_->voxel.Enabled()){
+		// ػĵxl/xrһһӦ
+		LOG(INFO) << "Triang Voxel " << voxel << ": <" << pWorld_->xl.size() << "> -> <" << cloud.count << "> Points";
+		pWorld_->xl.clear();
+		pWorld_->xr.clear();
+	}
 	__t.ReadWatchTimer("Triang Compute Time");
 	if (__logt){
 		(*figures)[__name + "_t"][*id] = (float)__t;
@@ -91,183 +102,208 @@ bool TriangulationLayer::Run(vector<Block>& images, vector<Block>& disp, LayerPa
 		Mat im;
 		Block block("Point Cloud Camera", im, false, false, __bout);
 		block.isOutput3DPoint = true;
-		block.point3d = pWorld_->pointW;
+		cloud.Export(block.point3d);
 		disp.push_back(block);
 	}
 
 	// ʾ
-	if (pWorld_->pointL.size() < 20){
+	if (cloud.count < 20){
 		for (int i = 0; i < pWorld_->xl.size(); ++i){
 			sprintf(loginfo, "(%8.3f, %8.3f) (%8.3f, %8.3f)\t(%8.3f, %8.3f, %8.3f)\n",
 				pWorld_->xl[i].x, pWorld_->xl[i].y, pWorld_->xr[i].x, pWorld_->xr[i].y,
-				pWorld_->pointL[i].x, pWorld_->pointL[i].y, pWorld_->pointL[i].z);
+				cloud.x[i], cloud.y[i], cloud.z[i]);
 			logstr += loginfo;
 		}
-		LOG(INFO) << "Left Camera Point: \n \t xl\t\t\t xr \t\t\t pointL\n" << logstr;
+		LOG(INFO) << "Left Camera Point: \n \t xl\t\t\t xr \t\t\t point\n" << logstr;
 	}else{
-		LOG(INFO) << "Left Camera Point Count " << pWorld_->pointL.size();
+		LOG(INFO) << "Left Camera Point Count " << cloud.count;
 	}
 	
 	// 
 	if (__save){
-		pcdsave(string("tmp/C_") + Circuit::time_id_ + ".pcd", pWorld_->pointL);// camera coord
+		pcdsave(string("tmp/C_") + Circuit::time_id_ + ".pcd", cloud);// camera coord
 		//LOG(INFO) << "ref_pointcloud.pc Point Cloud File Has Been Saved.";
 	}
 
+#ifdef _WIN32
 	HWND hw = ::FindWindow(NULL, "right Adaboost");
 	if (hw != NULL){
 		::SetForegroundWindow(hw);
 	}
+#endif
 
 	return true;
 }
 
-// Matlab䣬ͼά
-void TriangulationLayer::ComputeWorld(){
-	// ֮ǰûдMatlabMatlab
-	if (!m_Ep){
-		OpenMatlab();
+// һȥ(normalize_pixel + comp_distortion_oulu), һ
+void TriangulationLayer::NormalizePixel(const vector<Point2f>& x, const double* fc, const double* cc,
+	const double* kc, double alpha_c, double* xn, double* yn){
+	const int count = x.size();
+	const bool distort = kc[0] != 0 || kc[1] != 0 || kc[2] != 0 || kc[3] != 0 || kc[4] != 0;
+	const __m128d vfx = _mm_set1_pd(fc[0]), vfy = _mm_set1_pd(fc[1]);
+	const __m128d vcx = _mm_set1_pd(cc[0]), vcy = _mm_set1_pd(cc[1]);
+	const __m128d valpha = _mm_set1_pd(alpha_c);
+	const __m128d k1 = _mm_set1_pd(kc[0]), k2 = _mm_set1_pd(kc[1]), k3 = _mm_set1_pd(kc[4]);
+	const __m128d p1 = _mm_set1_pd(kc[2]), p2 = _mm_set1_pd(kc[3]);
+	const __m128d one = _mm_set1_pd(1.0), two = _mm_set1_pd(2.0);
+	int i = 0;
+	for (; i + 2 <= count; i += 2){
+		__m128d xd = _mm_div_pd(_mm_sub_pd(_mm_set_pd(x[i + 1].x, x[i].x), vcx), vfx);
+		__m128d yd = _mm_div_pd(_mm_sub_pd(_mm_set_pd(x[i + 1].y, x[i].y), vcy), vfy);
+		xd = _mm_sub_pd(xd, _mm_mul_pd(valpha, yd));
+		__m128d u = xd, v = yd;
+		if (distort){
+			for (int kk = 0; kk < 20; ++kk){
+				__m128d r2 = _mm_add_pd(_mm_mul_pd(u, u), _mm_mul_pd(v, v));
+				__m128d r4 = _mm_mul_pd(r2, r2);
+				__m128d kr = _mm_add_pd(_mm_add_pd(_mm_add_pd(one, _mm_mul_pd(k1, r2)),
+					_mm_mul_pd(k2, r4)), _mm_mul_pd(k3, _mm_mul_pd(r4, r2)));
+				__m128d uv2 = _mm_mul_pd(two, _mm_mul_pd(u, v));
+				__m128d dx = _mm_add_pd(_mm_mul_pd(p1, uv2),
+					_mm_mul_pd(p2, _mm_add_pd(r2, _mm_mul_pd(two, _mm_mul_pd(u, u)))));
+				__m128d dy = _mm_add_pd(_mm_mul_pd(p1, _mm_add_pd(r2, _mm_mul_pd(two, _mm_mul_pd(v, v)))),
+					_mm_mul_pd(p2, uv2));
+				u = _mm_div_pd(_mm_sub_pd(xd, dx), kr);
+				v = _mm_div_pd(_mm_sub_pd(yd, dy), kr);
+			}
+		}
+		_mm_storeu_pd(xn + i, u);
+		_mm_storeu_pd(yn + i, v);
 	}
-	const int pointCount = pWorld_->xl.size();
-	pWorld_->pointL.resize(pointCount);
-	pWorld_->pointR.resize(pointCount);
+	for (; i < count; ++i){
+		double xd = (x[i].x - cc[0]) / fc[0];
+		double yd = (x[i].y - cc[1]) / fc[1];
+		xd = xd - alpha_c * yd;
+		double u = xd, v = yd;
+		if (distort){
+			for (int kk = 0; kk < 20; ++kk){
+				double r2 = u * u + v * v;
+				double r4 = r2 * r2;
+				double kr = 1.0 + kc[0] * r2 + kc[1] * r4 + kc[4] * (r4 * r2);
+				double uv2 = 2.0 * (u * v);
+				double dx = kc[2] * uv2 + kc[3] * (r2 + 2.0 * (u * u));
+				double dy = kc[2] * (r2 + 2.0 * (v * v)) + kc[3] * uv2;
+				u = (xd - dx) / kr;
+				v = (yd - dy) / kr;
+			}
+		}
+		xn[i] = u;
+		yn[i] = v;
+	}
+}
 
-	// ͼӦMatlab
-	Matlab::mxArray* leftPoint = Matlab::mxCreateDoubleMatrix(2, pointCount, Matlab::mxREAL);
-	Matlab::mxArray* rightPoint = Matlab::mxCreateDoubleMatrix(2, pointCount, Matlab::mxREAL);
-	for (int i = 0; i < pointCount; ++i){
-		Matlab::mxGetPr(leftPoint)[2 * i] = pWorld_->xl[i].x;
-		Matlab::mxGetPr(leftPoint)[2 * i + 1] = pWorld_->xl[i].y;
-		Matlab::mxGetPr(rightPoint)[2 * i] = pWorld_->xr[i].x;
-		Matlab::mxGetPr(rightPoint)[2 * i + 1] = pWorld_->xr[i].y;
+// ͼά, е㷨(stereo_triangulation), һ
+void TriangulationLayer::ComputeWorld(){
+	const StereoCalib& c = pWorld_->rectified ? *calib_new_ : *calib_;
+	CHECK(c.valid) << "No " << (pWorld_->rectified ? "Rectified" : "Raw") << " Calibration For Triangulation!";
+	// ؽʱֱд, ȫֱʵ
+	VoxelHash& vox = pWorld_->voxel;
+	vox.Reset(voxel);
+	CloudSoA& cloud = pWorld_->cloud;
+	const int pointCount = pWorld_->xl.size();
+	cloud.count = 0;
+	if (pointCount == 0){
+		return;
 	}
-	// ùά
-	Matlab::engEvalString(m_Ep, "clear xL, clear xR");
-	Matlab::engPutVariable(m_Ep, "xL", leftPoint);
-	Matlab::engPutVariable(m_Ep, "xR", rightPoint);
-	if (pWorld_->rectified){
-		Matlab::engEvalString(m_Ep, "[XL, XR] = stereo_triangulation(xL, xR, om_new, T_new, fc_left_new, cc_left_new, kc_left_new, alpha_c_left_new, fc_right_new, cc_right_new, kc_right_new, alpha_c_right_new); ");
-	} else{
-		Matlab::engEvalString(m_Ep, "[XL, XR] = stereo_triangulation(xL, xR, om, T, fc_left, cc_left, kc_left, alpha_c_left, fc_right, cc_right, kc_right, alpha_c_right); ");
+	if (!vox.Enabled()){
+		cloud.Reserve(pointCount);
+		cloud.count = pointCount;
 	}
-	
-	// Matlabϵµά
-	Matlab::mxArray* xL = Matlab::engGetVariable(m_Ep, "XL");
-	Matlab::mxArray* xR = Matlab::engGetVariable(m_Ep, "XR");
-
-	CHECK_NOTNULL(xL);
-	CHECK_NOTNULL(xR);
 
-	for (int i = 0; i < pointCount; ++i){
-		pWorld_->pointL[i].x = Matlab::mxGetPr(xL)[3 * i + 0];
-		pWorld_->pointL[i].y = Matlab::mxGetPr(xL)[3 * i + 1];
-		pWorld_->pointL[i].z = Matlab::mxGetPr(xL)[3 * i + 2];
-		pWorld_->pointR[i].x = Matlab::mxGetPr(xR)[3 * i + 0];
-		pWorld_->pointR[i].y = Matlab::mxGetPr(xR)[3 * i + 1];
-		pWorld_->pointR[i].z = Matlab::mxGetPr(xR)[3 * i + 2];
+	// һ
+	if ((int)xt_.size() < pointCount){
+		xt_.resize(pointCount);
+		yt_.resize(pointCount);
+		xtt_.resize(pointCount);
+		ytt_.resize(pointCount);
 	}
+	NormalizePixel(pWorld_->xl, c.fc_left, c.cc_left, c.kc_left, c.alpha_c_left, &xt_[0], &yt_[0]);
+	NormalizePixel(pWorld_->xr, c.fc_right, c.cc_right, c.kc_right, c.alpha_c_right, &xtt_[0], &ytt_[0]);
 
-	// MatlabFigureʾά
-	if (__show){
-		Matlab::engEvalString(m_Ep, "figure(1), scatter3(XL(1, :), XL(2, :), XL(3, :));");
-		HWND hw = ::FindWindow(NULL, "right Adaboost");
-		if (hw != NULL){
-			::SetForegroundWindow(hw);
+	const double *R = c.R, *T = c.T;
+	__m128d vR[9], vT[3];
+	for (int k = 0; k < 9; ++k){
+		vR[k] = _mm_set1_pd(R[k]);
+	}
+	for (int k = 0; k < 3; ++k){
+		vT[k] = _mm_set1_pd(T[k]);
+	}
+	const __m128d one = _mm_set1_pd(1.0), half = _mm_set1_pd(0.5);
+	double out[3][2];
+
+	int i = 0;
+	for (; i + 2 <= pointCount; i += 2){
+		__m128d a = _mm_loadu_pd(&xt_[i]), b = _mm_loadu_pd(&yt_[i]);
+		__m128d e = _mm_loadu_pd(&xtt_[i]), f = _mm_loadu_pd(&ytt_[i]);
+		// u = R * [a b 1]
+		__m128d u0 = _mm_add_pd(_mm_add_pd(_mm_mul_pd(vR[0], a), _mm_mul_pd(vR[1], b)), vR[2]);
+		__m128d u1 = _mm_add_pd(_mm_add_pd(_mm_mul_pd(vR[3], a), _mm_mul_pd(vR[4], b)), vR[5]);
+		__m128d u2 = _mm_add_pd(_mm_add_pd(_mm_mul_pd(vR[6], a), _mm_mul_pd(vR[7], b)), vR[8]);
+		__m128d n_xt2 = _mm_add_pd(_mm_add_pd(_mm_mul_pd(a, a), _mm_mul_pd(b, b)), one);
+		__m128d n_xtt2 = _mm_add_pd(_mm_add_pd(_mm_mul_pd(e, e), _mm_mul_pd(f, f)), one);
+		__m128d dot_xttu = _mm_add_pd(_mm_add_pd(_mm_mul_pd(u0, e), _mm_mul_pd(u1, f)), u2);
+		__m128d dot_uT = _mm_add_pd(_mm_add_pd(_mm_mul_pd(u0, vT[0]), _mm_mul_pd(u1, vT[1])), _mm_mul_pd(u2, vT[2]));
+		__m128d dot_xttT = _mm_add_pd(_mm_add_pd(_mm_mul_pd(e, vT[0]), _mm_mul_pd(f, vT[1])), vT[2]);
+		__m128d DD = _mm_sub_pd(_mm_mul_pd(n_xt2, n_xtt2), _mm_mul_pd(dot_xttu, dot_xttu));
+		__m128d NN1 = _mm_sub_pd(_mm_mul_pd(dot_xttu, dot_xttT), _mm_mul_pd(n_xtt2, dot_uT));
+		__m128d NN2 = _mm_sub_pd(_mm_mul_pd(n_xt2, dot_xttT), _mm_mul_pd(dot_uT, dot_xttu));
+		__m128d Zt = _mm_div_pd(NN1, DD);
+		__m128d Ztt = _mm_div_pd(NN2, DD);
+		// X1 = xt * Zt, X2 = R' * (xtt * Ztt - T), XL = (X1 + X2) / 2
+		__m128d w0 = _mm_sub_pd(_mm_mul_pd(e, Ztt), vT[0]);
+		__m128d w1 = _mm_sub_pd(_mm_mul_pd(f, Ztt), vT[1]);
+		__m128d w2 = _mm_sub_pd(Ztt, vT[2]);
+		__m128d X2x = _mm_add_pd(_mm_add_pd(_mm_mul_pd(vR[0], w0), _mm_mul_pd(vR[3], w1)), _mm_mul_pd(vR[6], w2));
+		__m128d X2y = _mm_add_pd(_mm_add_pd(_mm_mul_pd(vR[1], w0), _mm_mul_pd(vR[4], w1)), _mm_mul_pd(vR[7], w2));
+		__m128d X2z = _mm_add_pd(_mm_add_pd(_mm_mul_pd(vR[2], w0), _mm_mul_pd(vR[5], w1)), _mm_mul_pd(vR[8], w2));
+		__m128d XLx = _mm_mul_pd(half, _mm_add_pd(_mm_mul_pd(a, Zt), X2x));
+		__m128d XLy = _mm_mul_pd(half, _mm_add_pd(_mm_mul_pd(b, Zt), X2y));
+		__m128d XLz = _mm_mul_pd(half, _mm_add_pd(Zt, X2z));
+		_mm_storeu_pd(out[0], XLx);
+		_mm_storeu_pd(out[1], XLy);
+		_mm_storeu_pd(out[2], XLz);
+		if (vox.Enabled()){
+			vox.Add(out[0][0], out[1][0], out[2][0]);
+			vox.Add(out[0][1], out[1][1], out[2][1]);
+			continue;
+		}
+		for (int j = 0; j < 2; ++j){
+			cloud.x[i + j] = (float)out[0][j];
+			cloud.y[i + j] = (float)out[1][j];
+			cloud.z[i + j] = (float)out[2][j];
 		}
 	}
 
-	Matlab::mxDestroyArray(leftPoint);
-	Matlab::mxDestroyArray(rightPoint);
-
-	// openCV汾
-	//Matlab::mxArray* om_new = Matlab::engGetVariable(m_Ep, "om_new");
-	//Matlab::mxArray* T_new = Matlab::engGetVariable(m_Ep, "T_new");
-	//Matlab::mxArray* KK_left_new = Matlab::engGetVariable(m_Ep, "KK_left_new");
-	//Matlab::mxArray* KK_right_new = Matlab::engGetVariable(m_Ep, "KK_right_new");
-
-	//Mat proj1(3, 4, CV_32FC1);
-	//Mat proj2(3, 4, CV_32FC1);
-	//Mat om(3, 1, CV_32FC1);
-	//Mat R(3, 3, CV_32FC1);
-	//Mat T(3, 1, CV_32FC1);
-	//Mat KK_left(3, 3, CV_32FC1);
-	//Mat KK_right(3, 3, CV_32FC1);
-
-	//float* data = om.ptr<float>(0);
-	//data[0] = Matlab::mxGetPr(om_new)[0];
-	//data[1] = Matlab::mxGetPr(om_new)[1];
-	//data[2] = Matlab::mxGetPr(om_new)[2];
-	//Rodrigues(om, R);
-	//
-	//data = T.ptr<float>(0);
-	//data[0] = Matlab::mxGetPr(T_new)[0];
-	//data[1] = Matlab::mxGetPr(T_new)[1];
-	//data[2] = Matlab::mxGetPr(T_new)[2];
-	//
-	//for (int i = 0; i < 3; ++i){
-	//	float * ldata = KK_left.ptr<float>(i);
-	//	float * rdata = KK_right.ptr<float>(i);
-	//	for (int j = 0; j < 3; ++j){
-	//		ldata[j] = Matlab::mxGetPr(KK_left_new)[3 * j + i];
-	//		rdata[j] = Matlab::mxGetPr(KK_right_new)[3 * j + i];
-	//		cout << ldata[j] << endl;
-	//	}
-	//	cout << endl;
-	//}
-
-	//proj1(Range(0, 3), Range(0, 3)) = Mat::eye(3, 3, CV_32FC1);
-	//proj1.col(3) = Mat::zeros(3, 1, CV_32FC1);
-
-	//R.convertTo(proj2(Range(0, 3), Range(0, 3)), CV_32FC1);
-	//T.convertTo(proj2.col(3), CV_32FC1);
-
-	////proj1 = KK_left * proj1;
-	////proj2 = KK_right * proj2;
-	//KK_left.convertTo(proj1(Range(0, 3), Range(0, 3)), CV_32FC1);
-	//KK_right.convertTo(proj2(Range(0, 3), Range(0, 3)), CV_32FC1);
-	//proj1.col(3) = Mat::zeros(3, 1, CV_32FC1);
-	//proj2.col(3) = Mat::zeros(3, 1, CV_32FC1);
-
-	//vector<Point2f>& pt1 = pWorld_->xl;
-	//vector<Point2f>& pt2 = pWorld_->xr;
-
-	//Mat aaa;
-	//triangulatePoints(proj1, proj2, pt1, pt2, aaa);
-
-	//for (int i = 0; i < aaa.cols; ++i){
-	//	cout << aaa.ptr<float>(i)[0] << ", " << aaa.ptr<float>(i)[1] << ", " << aaa.ptr<float>(i)[2] << ", " << aaa.ptr<float>(i)[3] << endl;
-	//	cout << pWorld_->pointL[i].x << ", " << pWorld_->pointL[i].y << ", " << pWorld_->pointL[i].z << ", " << endl;
-	//}
-
-	//waitKey();
-}
-
-// Matlabع
-void TriangulationLayer::OpenMatlab(){
-	if (!(m_Ep = Matlab::engOpen(nullptr))){
-		LOG(FATAL) << "engOpen failed!";
-		return;
+	// ʣಿ
+	for (; i < pointCount; ++i){
+		double a = xt_[i], b = yt_[i], e = xtt_[i], f = ytt_[i];
+		double u0 = R[0] * a + R[1] * b + R[2];
+		double u1 = R[3] * a + R[4] * b + R[5];
+		double u2 = R[6] * a + R[7] * b + R[8];
+		double n_xt2 = a * a + b * b + 1.0;
+		double n_xtt2 = e * e + f * f + 1.0;
+		double dot_xttu = u0 * e + u1 * f + u2;
+		double dot_uT = u0 * T[0] + u1 * T[1] + u2 * T[2];
+		double dot_xttT = e * T[0] + f * T[1] + T[2];
+		double DD = n_xt2 * n_xtt2 - dot_xttu * dot_xttu;
+		double Zt = (dot_xttu * dot_xttT - n_xtt2 * dot_uT) / DD;
+		double Ztt = (n_xt2 * dot_xttT - dot_uT * dot_xttu) / DD;
+		double w0 = e * Ztt - T[0], w1 = f * Ztt - T[1], w2 = Ztt - T[2];
+		double XLx = 0.5 * (a * Zt + (R[0] * w0 + R[3] * w1 + R[6] * w2));
+		double XLy = 0.5 * (b * Zt + (R[1] * w0 + R[4] * w1 + R[7] * w2));
+		double XLz = 0.5 * (Zt + (R[2] * w0 + R[5] * w1 + R[8] * w2));
+		if (vox.Enabled()){
+			vox.Add(XLx, XLy, XLz);
+			continue;
+		}
+		cloud.x[i] = (float)XLx;
+		cloud.y[i] = (float)XLy;
+		cloud.z[i] = (float)XLz;
+	}
+	if (vox.Enabled()){
+		vox.Export(cloud.x, cloud.y, cloud.z);
+		cloud.count = vox.Count();
 	}
-	char matlab_cmd[256];
-	char current_path[256];
-	string current;
-	getcwd(current_path, 256);
-	current = current_path;
-	sprintf(matlab_cmd, "cd %s", current.c_str());
-	Matlab::engEvalString(m_Ep, matlab_cmd);
-	Matlab::engSetVisible(m_Ep, isMatlabVisible);
-	sprintf(matlab_cmd, "addpath(\'%s')", toolbox_dir.c_str());
-	Matlab::engEvalString(m_Ep, matlab_cmd);
-	sprintf(matlab_cmd, "cd %s", calibmat_dir.c_str());
-	Matlab::engEvalString(m_Ep, matlab_cmd);
-	Matlab::engEvalString(m_Ep, "clear");
-	Matlab::engEvalString(m_Ep, "load('Calib_Results_stereo.mat')");
-	Matlab::engEvalString(m_Ep, "load('Calib_Results_stereo_rectified.mat')");
-}
-
-// رMatlab
-void TriangulationLayer::CloseMatlab(){
-	Matlab::engClose(m_Ep);
 }
 
 }
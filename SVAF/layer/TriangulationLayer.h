@@ -4,15 +4,7 @@ Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
 
 #pragma once
 #include "StereoLayer.h"
-
-#pragma comment(lib, "libeng.lib")
-#pragma comment(lib, "libmx.lib")
-#pragma comment(lib, "libmat.lib")
-#pragma comment(lib, "libmex.lib")
-
-namespace Matlab{
-#include <engine.h>
-}
+#include "../src/Calibration.h"
 
 namespace svaf{
 
@@ -23,19 +15,25 @@ public:
 	explicit TriangulationLayer(LayerParameter& layer);
 	~TriangulationLayer();
 	virtual bool Run(vector<Block>&, vector<Block>&, LayerParameter&, void*);
+	// һȥ, RansacLayer(ʾ)Ҳʹ
+	static void NormalizePixel(const vector<Point2f>& x, const double* fc, const double* cc,
+		const double* kc, double alpha_c, double* xn, double* yn);
 protected:
-	void OpenMatlab();
-	void CloseMatlab();
 	void ComputeWorld();
 
 private:
 	World *pWorld_;
-	Matlab::Engine* m_Ep;
 
-	string toolbox_dir, calibmat_dir;
-	bool isMatlabVisible;
+	string calibmat_dir;
 	bool isSavePointCloud;
+	float voxel;
+
+	const StereoCalib *calib_;		// ԭʼͼ: om, T, fc_left, ...
+	const StereoCalib *calib_new_;	// ͼ: om_new, T_new, fc_left_new, ...
+	StereoCalib local_[2];			// δʹù궨ʱԶȡ
+
+	// һ(SoA), ֡
+	vector<double> xt_, yt_, xtt_, ytt_;
 };
 
 }
-
@@ -0,0 +1,429 @@
+/*
+Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
+˫Ŀ궨: ʱȡһ, 㹲
+*/
+
+#include "Calibration.h"
+
+namespace svaf{
+
+map<string, Calibration*> Calibration::store_;
+
+// Ʊ궨ļ: ͷ(ħ, 汾, cols, rows, flags) + 110double + У
+static const uint CALIB_MAGIC = 0x42435653;	// "SVCB"
+static const uint CALIB_VERSION = 1;
+static const int CALIB_STEREO = 32;
+static const int CALIB_DOUBLES = 2 * CALIB_STEREO + 9 + 9 + 16 + 12;
+
+enum{
+	CALIB_HAS_RAW = 1,
+	CALIB_HAS_RECT = 2,
+	CALIB_HAS_RLR = 4,
+	CALIB_HAS_Q = 8,
+	CALIB_HAS_M = 16
+};
+
+// StereoCalibdouble黥ת
+static double* PackStereo(const StereoCalib& c, double* p){
+	memcpy(p, c.fc_left, sizeof(c.fc_left)); p += 2;
+	memcpy(p, c.cc_left, sizeof(c.cc_left)); p += 2;
+	memcpy(p, c.kc_left, sizeof(c.kc_left)); p += 5;
+	*p++ = c.alpha_c_left;
+	memcpy(p, c.fc_right, sizeof(c.fc_right)); p += 2;
+	memcpy(p, c.cc_right, sizeof(c.cc_right)); p += 2;
+	memcpy(p, c.kc_right, sizeof(c.kc_right)); p += 5;
+	*p++ = c.alpha_c_right;
+	memcpy(p, c.R, sizeof(c.R)); p += 9;
+	memcpy(p, c.T, sizeof(c.T)); p += 3;
+	return p;
+}
+
+static const double* UnpackStereo(StereoCalib& c, const double* p){
+	memcpy(c.fc_left, p, sizeof(c.fc_left)); p += 2;
+	memcpy(c.cc_left, p, sizeof(c.cc_left)); p += 2;
+	memcpy(c.kc_left, p, sizeof(c.kc_left)); p += 5;
+	c.alpha_c_left = *p++;
+	memcpy(c.fc_right, p, sizeof(c.fc_right)); p += 2;
+	memcpy(c.cc_right, p, sizeof(c.cc_right)); p += 2;
+	memcpy(c.kc_right, p, sizeof(c.kc_right)); p += 5;
+	c.alpha_c_right = *p++;
+	memcpy(c.R, p, sizeof(c.R)); p += 9;
+	memcpy(c.T, p, sizeof(c.T)); p += 3;
+	return p;
+}
+
+// 䱣.mat(v7, zlibѹ)ֱӽ, Ķsvaf/calib2yml.mԱתyml/xml;
+// ļԭ, Ҳתʱؿ
+static string MatConverted(const string& filename){
+	size_t dot = filename.find_last_of('.');
+	if (dot == string::npos || (filename.substr(dot) != ".mat" && filename.substr(dot) != ".MAT")){
+		return filename;
+	}
+	const char* exts[] = { ".yml", ".yaml", ".xml" };
+	for (int i = 0; i < 3; ++i){
+		string name = filename.substr(0, dot) + exts[i];
+		FILE* fp = fopen(name.c_str(), "rb");
+		if (fp != NULL){
+			fclose(fp);
+			LOG(INFO) << filename << " Read From Converted " << name;
+			return name;
+		}
+	}
+	LOG(ERROR) << filename << " Is a Matlab File, Convert It With svaf/calib2yml.m First!";
+	return "";
+}
+
+// 캯
+Calibration::Calibration() : cols(0), rows(0), hasRect(false), hasQ(false), hasM(false)
+{
+	memset(&raw, 0, sizeof(raw));
+	memset(&rect, 0, sizeof(rect));
+	memset(R_L, 0, sizeof(R_L));
+	memset(R_R, 0, sizeof(R_R));
+	memset(Q, 0, sizeof(Q));
+	memset(M, 0, sizeof(M));
+}
+
+// ļȡı궨: .binֱӶȡ, yml/xml벢Աд.bin
+const Calibration& Calibration::Get(const string& filename){
+	map<string, Calibration*>::iterator it = store_.find(filename);
+	if (it != store_.end()){
+		return *it->second;
+	}
+	Calibration* calib = new Calibration();
+	size_t dot = filename.find_last_of('.');
+	string ext = dot == string::npos ? "" : filename.substr(dot);
+	if (ext == ".bin"){
+		if (!calib->Load(filename)){
+			LOG(FATAL) << filename << " Calibration Load Failed!";
+		}
+	} else{
+		if (!calib->Import(filename)){
+			LOG(FATAL) << filename << " Calibration Import Failed!";
+		}
+		string binname = filename.substr(0, dot) + ".bin";
+		if (calib->Save(binname)){
+			LOG(INFO) << "Calibration Cached To " << binname;
+		}
+	}
+	store_[filename] = calib;
+	return *calib;
+}
+
+// ͷб궨
+void Calibration::Release(){
+	for (map<string, Calibration*>::iterator it = store_.begin(); it != store_.end(); ++it){
+		delete it->second;
+	}
+	store_.clear();
+}
+
+// ȡ궨(), ȱʡ0
+static bool ReadCalibVar(FileStorage& fs, const string& name, double* data, int count){
+	FileNode node = fs[name];
+	if (node.empty()){
+		return false;
+	}
+	memset(data, 0, sizeof(double) * count);
+	if (node.isReal() || node.isInt()){
+		data[0] = (double)node;
+		return true;
+	}
+	Mat m;
+	node >> m;
+	m.convertTo(m, CV_64F);
+	m = m.reshape(1, 1);
+	for (int i = 0; i < min(count, m.cols); ++i){
+		data[i] = m.at<double>(0, i);
+	}
+	return true;
+}
+
+// ȡһ˫Ŀ, Calib_Results_stereo(_rectified).matͬ
+bool Calibration::ImportStereo(FileStorage& fs, const string& suffix, StereoCalib& calib){
+	double om[3];
+	calib.valid = false;
+	bool ok = ReadCalibVar(fs, "om" + suffix, om, 3)
+		&& ReadCalibVar(fs, "T" + suffix, calib.T, 3)
+		&& ReadCalibVar(fs, "fc_left" + suffix, calib.fc_left, 2)
+		&& ReadCalibVar(fs, "cc_left" + suffix, calib.cc_left, 2)
+		&& ReadCalibVar(fs, "fc_right" + suffix, calib.fc_right, 2)
+		&& ReadCalibVar(fs, "cc_right" + suffix, calib.cc_right, 2);
+	if (!ok){
+		return false;
+	}
+	// бʡ
+	if (!ReadCalibVar(fs, "kc_left" + suffix, calib.kc_left, 5)){
+		memset(calib.kc_left, 0, sizeof(calib.kc_left));
+	}
+	if (!ReadCalibVar(fs, "kc_right" + suffix, calib.kc_right, 5)){
+		memset(calib.kc_right, 0, sizeof(calib.kc_right));
+	}
+	if (!ReadCalibVar(fs, "alpha_c_left" + suffix, &calib.alpha_c_left, 1)){
+		calib.alpha_c_left = 0;
+	}
+	if (!ReadCalibVar(fs, "alpha_c_right" + suffix, &calib.alpha_c_right, 1)){
+		calib.alpha_c_right = 0;
+	}
+
+	Mat omv(3, 1, CV_64F, om);
+	Mat R(3, 3, CV_64F, calib.R);
+	Rodrigues(omv, R);
+	calib.valid = true;
+	return true;
+}
+
+bool Calibration::ImportStereo(const string& filename, const string& suffix, StereoCalib& calib){
+	calib.valid = false;
+	const string path = MatConverted(filename);
+	if (path.empty()){
+		return false;
+	}
+	FileStorage fs(path, FileStorage::READ);
+	if (!fs.isOpened()){
+		LOG(WARNING) << path << " Open Failed!";
+		return false;
+	}
+	if (!ImportStereo(fs, suffix, calib)){
+		LOG(WARNING) << path << " Need om" << suffix << ", T" << suffix << ", fc/cc_left" << suffix << ", fc/cc_right" << suffix;
+		return false;
+	}
+	LOG(INFO) << "Stereo Calib File: " << path << " Opened.";
+	return true;
+}
+
+// yml/xmlȫ궨
+bool Calibration::Import(const string& filename){
+	const string path = MatConverted(filename);
+	if (path.empty()){
+		return false;
+	}
+	FileStorage fs(path, FileStorage::READ);
+	if (!fs.isOpened()){
+		LOG(ERROR) << path << " Open Failed!";
+		return false;
+	}
+	double size[2] = { 0 };
+	if (ReadCalibVar(fs, "nx", &size[0], 1) && ReadCalibVar(fs, "ny", &size[1], 1)){
+		cols = (int)size[0];
+		rows = (int)size[1];
+	}
+	ImportStereo(fs, "", raw);
+	ImportStereo(fs, "_new", rect);
+	hasRect = ReadCalibVar(fs, "R_L", R_L, 9) && ReadCalibVar(fs, "R_R", R_R, 9);
+	hasQ = ReadCalibVar(fs, "Q", Q, 16);
+	double m[12];
+	hasM = ReadCalibVar(fs, "M", m, 12);
+	for (int i = 0; hasM && i < 12; ++i){
+		M[i / 4][i % 4] = (float)m[i];
+	}
+	if (!hasRect && raw.valid){
+		RectifyRotation();
+	}
+	LOG(INFO) << "Calibration File: " << filename << " Imported. raw " << raw.valid << " rect " << rect.valid
+		<< " R_L/R_R " << hasRect << " Q " << hasQ << " M " << hasM;
+	return raw.valid || rect.valid || hasQ || hasM;
+}
+
+// ȡƱ궨ļ
+bool Calibration::Load(const string& filename){
+	FILE *fp = fopen(filename.c_str(), "rb");
+	if (fp == NULL){
+		LOG(ERROR) << filename << " Open Failed!";
+		return false;
+	}
+	uint head[5];
+	double data[CALIB_DOUBLES];
+	uint check = 0;
+	bool ok = fread(head, 4, 5, fp) == 5 && head[0] == CALIB_MAGIC && head[1] == CALIB_VERSION
+		&& fread(data, sizeof(double), CALIB_DOUBLES, fp) == CALIB_DOUBLES
+		&& fread(&check, 4, 1, fp) == 1 && check == 5 + CALIB_DOUBLES;
+	fclose(fp);
+	if (!ok){
+		LOG(ERROR) << filename << " Is Not A Calibration File!";
+		return false;
+	}
+	cols = head[2];
+	rows = head[3];
+	const double* p = UnpackStereo(raw, data);
+	p = UnpackStereo(rect, p);
+	memcpy(R_L, p, sizeof(R_L)); p += 9;
+	memcpy(R_R, p, sizeof(R_R)); p += 9;
+	memcpy(Q, p, sizeof(Q)); p += 16;
+	for (int i = 0; i < 12; ++i){
+		M[i / 4][i % 4] = (float)p[i];
+	}
+	raw.valid = (head[4] & CALIB_HAS_RAW) != 0;
+	rect.valid = (head[4] & CALIB_HAS_RECT) != 0;
+	hasRect = (head[4] & CALIB_HAS_RLR) != 0;
+	hasQ = (head[4] & CALIB_HAS_Q) != 0;
+	hasM = (head[4] & CALIB_HAS_M) != 0;
+	LOG(INFO) << "Calibration File: " << filename << " Opened.";
+	return true;
+}
+
+// дƱ궨ļ
+bool Calibration::Save(const string& filename) const{
+	FILE *fp = fopen(filename.c_str(), "wb");
+	if (fp == NULL){
+		LOG(WARNING) << filename << " Open Failed!";
+		return false;
+	}
+	uint head[5] = { CALIB_MAGIC, CALIB_VERSION, (uint)cols, (uint)rows, 0 };
+	head[4] = (raw.valid ? CALIB_HAS_RAW : 0) | (rect.valid ? CALIB_HAS_RECT : 0)
+		| (hasRect ? CALIB_HAS_RLR : 0) | (hasQ ? CALIB_HAS_Q : 0) | (hasM ? CALIB_HAS_M : 0);
+	double data[CALIB_DOUBLES];
+	double* p = PackStereo(raw, data);
+	p = PackStereo(rect, p);
+	memcpy(p, R_L, sizeof(R_L)); p += 9;
+	memcpy(p, R_R, sizeof(R_R)); p += 9;
+	memcpy(p, Q, sizeof(Q)); p += 16;
+	for (int i = 0; i < 12; ++i){
+		p[i] = M[i / 4][i % 4];
+	}
+	uint check = 5 + CALIB_DOUBLES;
+	fwrite(head, 4, 5, fp);
+	fwrite(data, sizeof(double), CALIB_DOUBLES, fp);
+	fwrite(&check, 4, 1, fp);
+	fclose(fp);
+	return true;
+}
+
+// ת(rectify_stereo_pair): תomһ, ٰѻתx
+void Calibration::RectifyRotation(){
+	Mat R(3, 3, CV_64F, raw.R), om;
+	Rodrigues(R, om);
+	Mat r_r;
+	Rodrigues(-om / 2, r_r);
+	Mat r_l = r_r.t();
+	Mat t = r_r * Mat(3, 1, CV_64F, raw.T);
+
+	Mat uu = (Mat_<double>(3, 1) << 1, 0, 0);
+	if (uu.dot(t) < 0){
+		uu = -uu;
+	}
+	Mat ww = t.cross(uu);
+	double nw = norm(ww);
+	if (nw > 0){
+		ww = ww / nw * acos(abs(t.dot(uu)) / (norm(t) * norm(uu)));
+	}
+	Mat R2;
+	Rodrigues(ww, R2);
+	Mat RR(3, 3, CV_64F, R_R), RL(3, 3, CV_64F, R_L);
+	Mat(R2 * r_r).copyTo(RR);
+	Mat(R2 * r_l).copyTo(RL);
+	hasRect = true;
+}
+
+// 궨ɢ(FNV-1a), ұļ
+unsigned long long Calibration::Hash() const{
+	double data[2 * CALIB_STEREO + 18];
+	double* p = PackStereo(raw, data);
+	p = PackStereo(rect, p);
+	memcpy(p, R_L, sizeof(R_L)); p += 9;
+	memcpy(p, R_R, sizeof(R_R));
+	unsigned long long h = 14695981039346656037ULL;
+	const uchar* b = (const uchar*)data;
+	for (size_t i = 0; i < sizeof(data); ++i){
+		h = (h ^ b[i]) * 1099511628211ULL;
+	}
+	return h;
+}
+
+// Ľ(rect_index):  -> R' -> ӻ -> ԭͼ˫Բֵ
+static void RectifyIndex(int cols, int rows, const double* fc, const double* cc, const double* kc, double alpha_c,
+	const double* R, const double* fc_new, const double* cc_new, double alpha_new,
+	vector<float> a[4], vector<uint> ind[5]){
+	for (int k = 0; k < 4; ++k){
+		a[k].clear();
+	}
+	for (int k = 0; k < 5; ++k){
+		ind[k].clear();
+	}
+	for (int y = 0; y < rows; ++y){
+		for (int x = 0; x < cols; ++x){
+			// inv(KK_new) * [x y 1]
+			double yn = (y - cc_new[1]) / fc_new[1];
+			double xn = (x - cc_new[0]) / fc_new[0] - alpha_new * yn;
+			// R' * ray
+			double rx = R[0] * xn + R[3] * yn + R[6];
+			double ry = R[1] * xn + R[4] * yn + R[7];
+			double rz = R[2] * xn + R[5] * yn + R[8];
+			if (rz <= 0){
+				continue;
+			}
+			double u = rx / rz, v = ry / rz;
+			// apply_distortion
+			double r2 = u * u + v * v;
+			double cdist = 1 + kc[0] * r2 + kc[1] * r2 * r2 + kc[4] * r2 * r2 * r2;
+			double ud = u * cdist + 2 * kc[2] * u * v + kc[3] * (r2 + 2 * u * u);
+			double vd = v * cdist + kc[2] * (r2 + 2 * v * v) + 2 * kc[3] * u * v;
+			double px = fc[0] * (ud + alpha_c * vd) + cc[0];
+			double py = fc[1] * vd + cc[1];
+			int x0 = (int)floor(px), y0 = (int)floor(py);
+			if (x0 < 0 || x0 > cols - 2 || y0 < 0 || y0 > rows - 2){
+				continue;
+			}
+			float ax = (float)(px - x0), ay = (float)(py - y0);
+			a[0].push_back((1 - ay) * (1 - ax));
+			a[1].push_back((1 - ay) * ax);
+			a[2].push_back(ay * (1 - ax));
+			a[3].push_back(ay * ax);
+			ind[0].push_back(y0 * cols + x0);
+			ind[1].push_back(y0 * cols + x0 + 1);
+			ind[2].push_back((y0 + 1) * cols + x0);
+			ind[3].push_back((y0 + 1) * cols + x0 + 1);
+			ind[4].push_back(y * cols + x);
+		}
+	}
+}
+
+// ұ(StereoRectifyLayer::ReadTableʽͬ), ֱʺͲcache_dir
+string Calibration::RectifyTable(const string& cache_dir) const{
+	CHECK(raw.valid && rect.valid && hasRect) << "Rectify Table Needs Raw And Rectified Calibration!";
+	CHECK(cols > 0 && rows > 0) << "Rectify Table Needs Image Size (nx, ny)!";
+
+	char name[64];
+	sprintf(name, "rectify_%dx%d_%016llx.bin", cols, rows, Hash());
+	string filename = cache_dir + name;
+	FILE *fp = fopen(filename.c_str(), "rb");
+	if (fp != NULL){
+		fclose(fp);
+		LOG(INFO) << "Rectify Table Cache Hit: " << filename;
+		return filename;
+	}
+
+	vector<float> la[4], ra[4];
+	vector<uint> lind[5], rind[5];
+	RectifyIndex(cols, rows, raw.fc_left, raw.cc_left, raw.kc_left, raw.alpha_c_left,
+		R_L, rect.fc_left, rect.cc_left, rect.alpha_c_left, la, lind);
+	RectifyIndex(cols, rows, raw.fc_right, raw.cc_right, raw.kc_right, raw.alpha_c_right,
+		R_R, rect.fc_right, rect.cc_right, rect.alpha_c_right, ra, rind);
+
+	fp = fopen(filename.c_str(), "wb");
+	if (fp == NULL){
+		LOG(FATAL) << filename << " Create Failed!";
+	}
+	uint l_length = lind[4].size(), r_length = rind[4].size();
+	uint head[4] = { (uint)cols, (uint)rows, l_length, r_length };
+	fwrite(head, 4, 4, fp);
+	for (int k = 0; k < 4; ++k){
+		fwrite(la[k].data(), 4, l_length, fp);
+	}
+	for (int k = 0; k < 5; ++k){
+		fwrite(lind[k].data(), 4, l_length, fp);
+	}
+	for (int k = 0; k < 4; ++k){
+		fwrite(ra[k].data(), 4, r_length, fp);
+	}
+	for (int k = 0; k < 5; ++k){
+		fwrite(rind[k].data(), 4, r_length, fp);
+	}
+	uint check = 5 + 9 * (l_length + r_length);
+	fwrite(&check, 4, 1, fp);
+	fclose(fp);
+	LOG(INFO) << "Rectify Table Created: " << filename;
+	return filename;
+}
+
+}
@@ -0,0 +1,67 @@
+/*
+Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
+˫Ŀ궨: ʱȡһ, 㹲
+*/
+
+#pragma once
+
+#include <opencv2\opencv.hpp>
+#include <glog\logging.h>
+#include <string>
+#include <map>
+
+using namespace std;
+using namespace cv;
+
+namespace svaf{
+
+typedef unsigned int uint;
+
+// ˫Ŀ궨(Bouguetʽ)
+typedef struct _StereoCalib{
+	bool	valid;
+	double	fc_left[2], cc_left[2], kc_left[5], alpha_c_left;
+	double	fc_right[2], cc_right[2], kc_right[5], alpha_c_right;
+	double	R[9];		// rodrigues(om),  = R *  + T
+	double	T[3];
+} StereoCalib;
+
+class Calibration
+{
+public:
+	// ļȡı궨, ÿļֻһ
+	static const Calibration& Get(const string& filename);
+	static void Release();
+
+	// ȡ䵼ı궨(OpenCV yml/xml), suffixΪ"""_new"
+	// .matʱȡsvaf/calib2yml.mͬĿ¼תͬyml/xml
+	static bool ImportStereo(FileStorage& fs, const string& suffix, StereoCalib& calib);
+	static bool ImportStereo(const string& filename, const string& suffix, StereoCalib& calib);
+
+	// (ô̻)ұ, رļ
+	string RectifyTable(const string& cache_dir) const;
+
+public:
+	int			cols, rows;	// 궨ͼߴ(nx, ny)
+	StereoCalib	raw;		// ԭʼͼ: om, T, fc_left, ...
+	StereoCalib	rect;		// ͼ: om_new, T_new, fc_left_new, ...
+	bool		hasRect;	// ת R_L, R_R
+	double		R_L[9], R_R[9];
+	bool		hasQ;		// ͶӰ(stereoRectify)
+	double		Q[16];
+	bool		hasM;		//  -> 
+	float		M[3][4];
+
+protected:
+	Calibration();
+	bool Load(const string& filename);
+	bool Save(const string& filename) const;
+	bool Import(const string& filename);
+	void RectifyRotation();
+	unsigned long long Hash() const;
+
+private:
+	static map<string, Calibration*> store_;
+};
+
+}
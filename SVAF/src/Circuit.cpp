@@ -26,7 +26,11 @@ Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
 #include "..\layer\CVDesciptorLayer.h"
 #include "..\layer\StereoRectifyLayer.h"
 #include "..\layer\TriangulationLayer.h"
+#include "..\layer\ReprojectLayer.h"
+#include "..\layer\KDTreeMatchLayer.h"
+#include "..\layer\FeaturePoolLayer.h"
 #include "..\layer\SurfDescriptorLayer.h"
+#include "Calibration.h"
 
 #include <WinBase.h>
 
@@ -54,6 +58,9 @@ Circuit::Circuit(SvafTask& svafTask, bool gui_mode) :
 	Layer::pCir = this;
 	pause_ms_ = svafTask.pause();
 	world_.rectified = false;
+	world_.dispfactor = 1;
+	world_.maxdisp = 0;
+	world_.cloudready = false;
 
 	// ̼ͨųʼ
 	if (useMapping_){
@@ -89,6 +96,8 @@ Circuit::~Circuit(){
 	}
 	// ͷ
 	StereoRectifyLayer::ReleaseTable();
+	// ͷŹı궨
+	Calibration::Release();
 	// ͷŽ̼ͨԴ
 	if (useMapping_){
 		if (!UnmapViewOfFile(c_fileMapping_)){}
@@ -242,6 +251,7 @@ void Circuit::Build(){
 		// ƥ
 		case svaf::LayerParameter_LayerType_KDTREE_MATCH:
 			Layer::task_type = SvafApp::POINT_MATCH;
+			layerinstance = new KDTreeMatchLayer(layer);
 			break;
 		case svaf::LayerParameter_LayerType_EULAR_MATCH:
 			Layer::task_type = SvafApp::POINT_MATCH;
@@ -250,12 +260,16 @@ void Circuit::Build(){
 		case svaf::LayerParameter_LayerType_RANSAC:
 			Layer::task_type = SvafApp::RANSAC_MATCH;
 			layerinstance = new RansacLayer(layer);
+			param = (void*)&world_;
 			break;
+		// BF_MATCHΪȷ, FLANN_MATCHͬKDTREE_MATCH, ʹkdtreematch_param
 		case svaf::LayerParameter_LayerType_BF_MATCH:
 			Layer::task_type = SvafApp::RANSAC_MATCH;
+			layerinstance = new KDTreeMatchLayer(layer);
 			break;
 		case svaf::LayerParameter_LayerType_FLANN_MATCH:
 			Layer::task_type = SvafApp::RANSAC_MATCH;
+			layerinstance = new KDTreeMatchLayer(layer);
 			break;
 		case svaf::LayerParameter_LayerType_EC_MATCH:
 			Layer::task_type = SvafApp::RANSAC_MATCH;
@@ -269,10 +283,12 @@ void Circuit::Build(){
 		case svaf::LayerParameter_LayerType_SGM_MATCH:
 			Layer::task_type = SvafApp::STEREO_MATCH;
 			layerinstance = new SgmMatchLayer(layer);
+			param = (void*)&world_;
 			break;
 		case svaf::LayerParameter_LayerType_EADP_MATCH:
 			Layer::task_type = SvafApp::STEREO_MATCH;
 			layerinstance = new EadpMatchLayer(layer);
+			param = (void*)&world_;
 			break;
 		// άؽӲά
 		case svaf::LayerParameter_LayerType_TRIANG:
@@ -280,6 +296,12 @@ void Circuit::Build(){
 			layerinstance = new TriangulationLayer(layer);
 			param = (void*)&world_;
 			break;
+		// ɳӲͼֱؽ
+		case svaf::LayerParameter_LayerType_REPROJECT:
+			Layer::task_type = SvafApp::PC_TRIANGLE;
+			layerinstance = new ReprojectLayer(layer);
+			param = (void*)&world_;
+			break;
 		// þ˷άռ任
 		case svaf::LayerParameter_LayerType_MXMUL:
 			Layer::task_type = SvafApp::PC_MULMATRIX;
@@ -292,6 +314,12 @@ void Circuit::Build(){
 			layerinstance = new CenterPointLayer(layer);
 			param = (void*)&world_;
 			break;
+		// ֡, λ
+		case svaf::LayerParameter_LayerType_FEAT_POOL:
+			Layer::task_type = SvafApp::PC_REGISTRATION;
+			layerinstance = new FeaturePoolLayer(layer);
+			param = (void*)&world_;
+			break;
 		// SAC-IAƳʼ׼
 		case svaf::LayerParameter_LayerType_IA_EST:
 			Layer::task_type = SvafApp::PC_REGISTRATION;
@@ -457,6 +485,12 @@ void Circuit::InitStep(){
 	world_.a = 0;
 	world_.b = 0;
 	world_.c = 0;
+	world_.disp.release();
+	world_.cloud.count = 0;
+	world_.cloudready = false;
+	world_.cloudW.count = 0;
+	world_.voxel.Reset(0);
+	world_.pose.release();
 
 	char buf[256] = { 0 };
 	sprintf(buf, "Frame %d Begin.", id_);
@@ -8,6 +8,9 @@ Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
 
 #include "Param.h"
 #include "Figures.h"
+#include "VoxelHash.h"
+#include "DescMatrix.h"
+#include "Integral.h"
 #include <windows.h>
 
 using namespace std;
@@ -27,18 +30,51 @@ struct _Node{
 };
 typedef _Node<string> Node;
 
+// ܵ(SoA), Ԥ, ֡, countΪЧ
+typedef struct _CloudSoA{
+	int				count;
+	vector<float>	x, y, z;
+	vector<uchar>	r, g, b;
+	_CloudSoA() : count(0){}
+
+	// ֻ
+	void Reserve(int n){
+		if ((int)x.size() < n){
+			x.resize(n);
+			y.resize(n);
+			z.resize(n);
+		}
+	}
+	void Export(vector<Point3f>& points) const{
+		points.resize(count);
+		for (int i = 0; i < count; ++i){
+			points[i] = Point3f(x[i], y[i], z[i]);
+		}
+	}
+} CloudSoA;
+
 typedef struct _World{
 	bool		rectified;
 	int			fetchtype;
 	float		x, y, z, a, b, c; // ץȡ㣬ץȡ
 
 	vector<Point2f> xl, xr;
-	vector<Point3f> pointL, pointR;
-	vector<Point3f> pointW; // Left Camera -> world
 
 	vector<Point3f> matchpt1;
 	vector<Point3f> matchpt0;
 	vector<Point2f> matchpt2;
+
+	// Ӳ(SGM/EADP)ؽ
+	Mat			disp;		// CV_16U, Ӳ*dispfactor
+	Rect		dispband;	// Ӳͼԭͼеλ
+	Rect		dispvalid;	// Ҫؽ(ͼROI)
+	int			dispfactor;
+	int			maxdisp;
+	CloudSoA	cloud;		// (REPROJECT/TRIANG), ʱΪ
+	bool		cloudready;	// cloudΪ֡ؽ, ÿ֡
+	CloudSoA	cloudW;		// (MXMUL)
+	VoxelHash	voxel;		// ʽؽ
+	Mat			pose;		// 4x4 CV_64F,  -> ϵ(FEAT_POOL)
 } World;
 
 struct Color3f{
@@ -53,17 +89,18 @@ typedef struct _Block{
 	string	name;
 	Mat		image;
 	Rect	roi;
+	IntegralCache	integral;	// imageĻͼ, ͬ֡㹲
 	
 	vector<Point2f>	points;
 	vector<float>	points_sc;
-	vector<vector<float>>	despciptors;
 
 	vector<KeyPoint>	keypoint;
-	Mat					descriptors;
+	DescMatrix			descriptors;	// pointskeypoint, ÿһ
 	vector<DMatch>		matches;
 
 	_Block*	pMatch;
 	vector<int>		ptidx;
+	vector<float>	ptdist;		// ptidxӦƥ, ƥδʱΪ
 	vector<Point3f>	point3d;
 	vector<Color3f> color3d;
 
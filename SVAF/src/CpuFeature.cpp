@@ -0,0 +1,56 @@
+/*
+Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
+ʱCPUָ, ѡSIMDں
+*/
+
+#include "CpuFeature.h"
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace svaf{
+
+#ifdef _MSC_VER
+// cpuid: 1ŹECX27λOSXSAVE, 28λAVX; 7ŹEBX5λAVX2
+// ϵͳͨXCR0XMM/YMM״̬(1, 2λ)
+static bool DetectAVX(bool avx2){
+	int info[4];
+	__cpuid(info, 0);
+	const int nids = info[0];
+	if (nids < 1){
+		return false;
+	}
+	__cpuid(info, 1);
+	if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0){
+		return false;
+	}
+	if ((_xgetbv(0) & 6) != 6){
+		return false;
+	}
+	if (!avx2){
+		return true;
+	}
+	if (nids < 7){
+		return false;
+	}
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) != 0;
+}
+#else
+static bool DetectAVX(bool avx2){
+	__builtin_cpu_init();
+	return avx2 ? __builtin_cpu_supports("avx2") != 0 : __builtin_cpu_supports("avx") != 0;
+}
+#endif
+
+bool CpuSupportAVX(){
+	static const bool avx = DetectAVX(false);
+	return avx;
+}
+
+bool CpuSupportAVX2(){
+	static const bool avx2 = DetectAVX(true);
+	return avx2;
+}
+
+}
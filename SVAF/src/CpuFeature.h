@@ -0,0 +1,18 @@
+/*
+Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
+ʱCPUָ, ѡSIMDں
+*/
+
+#pragma once
+
+// ҲSurfDetect, ֻڽ
+
+namespace svaf{
+
+// CPUϵͳ֧AVX(YMM״̬), ֻһ
+bool CpuSupportAVX();
+
+// CpuSupportAVXCPU֧AVX2
+bool CpuSupportAVX2();
+
+}
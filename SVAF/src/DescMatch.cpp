@@ -0,0 +1,338 @@
+/*
+Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
+ӱƥ: SIMDŷ/, ߳, ںʹνڹֵ
+*/
+
+#include "DescMatch.h"
+#include "CpuFeature.h"
+#include <xmmintrin.h>
+#include <float.h>
+#include <limits.h>
+#include <algorithm>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace svaf{
+
+static const int QBLOCK = 32;	// ѯֿ
+static const int TBLOCK = 128;	// ѵֿ, 64άfloatʱ32KB, L1/L2
+static const int NCAND = 4;		// ÿѯĺѡ
+
+// ԭƥͬάۼ˳, ֤λһ
+static inline float ExactL2(const float* a, const float* b, int n){
+	float dist = 0.0f;
+	for (int k = 0; k < n; ++k){
+		float diff = a[k] - b[k];
+		dist += diff * diff;
+	}
+	return sqrt(dist);
+}
+
+static inline float Dot(const float* a, const float* b, int n){
+	__m128 s = _mm_setzero_ps();
+	int k = 0;
+	for (; k + 4 <= n; k += 4){
+		s = _mm_add_ps(s, _mm_mul_ps(_mm_loadu_ps(a + k), _mm_loadu_ps(b + k)));
+	}
+	float v[4];
+	_mm_storeu_ps(v, s);
+	float sum = v[0] + v[1] + v[2] + v[3];
+	for (; k < n; ++k){
+		sum += a[k] * b[k];
+	}
+	return sum;
+}
+
+// 4ѯ1ѵӵĵ, ѵֻһ
+static inline void Dot4(const float* const* q, const float* t, int n, float* out){
+	__m128 s0 = _mm_setzero_ps();
+	__m128 s1 = _mm_setzero_ps();
+	__m128 s2 = _mm_setzero_ps();
+	__m128 s3 = _mm_setzero_ps();
+	int k = 0;
+	for (; k + 4 <= n; k += 4){
+		__m128 b = _mm_loadu_ps(t + k);
+		s0 = _mm_add_ps(s0, _mm_mul_ps(_mm_loadu_ps(q[0] + k), b));
+		s1 = _mm_add_ps(s1, _mm_mul_ps(_mm_loadu_ps(q[1] + k), b));
+		s2 = _mm_add_ps(s2, _mm_mul_ps(_mm_loadu_ps(q[2] + k), b));
+		s3 = _mm_add_ps(s3, _mm_mul_ps(_mm_loadu_ps(q[3] + k), b));
+	}
+	_MM_TRANSPOSE4_PS(s0, s1, s2, s3);
+	_mm_storeu_ps(out, _mm_add_ps(_mm_add_ps(s0, s1), _mm_add_ps(s2, s3)));
+	for (; k < n; ++k){
+		out[0] += q[0][k] * t[k];
+		out[1] += q[1][k] * t[k];
+		out[2] += q[2][k] * t[k];
+		out[3] += q[3][k] * t[k];
+	}
+}
+
+// ƾѡ
+static inline void Insert(float* cd, int* cj, float d, int j){
+	if (d >= cd[NCAND - 1]){
+		return;
+	}
+	int p = NCAND - 1;
+	for (; p > 0 && cd[p - 1] > d; --p){
+		cd[p] = cd[p - 1];
+		cj[p] = cj[p - 1];
+	}
+	cd[p] = d;
+	cj[p] = j;
+}
+
+void MatchL2(const DescMatrix& query, const DescMatrix& train, vector<DescNN>& nn){
+	CHECK_EQ(query.type(), CV_32F) << "L2 Match Needs Float Descriptors!";
+	CHECK_EQ(train.type(), CV_32F) << "L2 Match Needs Float Descriptors!";
+	CHECK_EQ(query.cols, train.cols) << "Descriptor Dimention Not Equal!";
+	const int nq = query.rows;
+	const int nt = train.rows;
+	const int n = query.cols;
+	nn.resize(nq);
+	if (nq == 0){
+		return;
+	}
+
+	// ģƽ
+	vector<float> qn(nq), tn(max(nt, 1));
+	float tmax = 0.0f;
+	for (int i = 0; i < nq; ++i){
+		qn[i] = Dot(query.Row<float>(i), query.Row<float>(i), n);
+	}
+	for (int j = 0; j < nt; ++j){
+		tn[j] = Dot(train.Row<float>(j), train.Row<float>(j), n);
+		tmax = max(tmax, tn[j]);
+	}
+	// ƾάۼӾ֮Ͻ(ģ)
+	const float eps = 4.0f * (n + 4) * FLT_EPSILON;
+
+	const int nblock = (nq + QBLOCK - 1) / QBLOCK;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+	for (int b = 0; b < nblock; ++b){
+		const int q0 = b * QBLOCK;
+		const int q1 = min(nq, q0 + QBLOCK);
+		float cd[QBLOCK][NCAND];
+		int cj[QBLOCK][NCAND];
+		for (int i = 0; i < QBLOCK; ++i){
+			for (int c = 0; c < NCAND; ++c){
+				cd[i][c] = FLT_MAX;
+				cj[i][c] = -1;
+			}
+		}
+
+		// ֿɸѡ: d^2 = |a|^2 + |b|^2 - 2a.b, 
+		for (int t0 = 0; t0 < nt; t0 += TBLOCK){
+			const int t1 = min(nt, t0 + TBLOCK);
+			for (int i = q0; i < q1; i += 4){
+				const float* q[4];
+				for (int r = 0; r < 4; ++r){
+					q[r] = query.Row<float>(min(i + r, q1 - 1));
+				}
+				const int m = min(4, q1 - i);
+				float dot[4];
+				for (int j = t0; j < t1; ++j){
+					Dot4(q, train.Row<float>(j), n, dot);
+					for (int r = 0; r < m; ++r){
+						Insert(cd[i + r - q0], cj[i + r - q0], qn[i + r] + tn[j] - 2.0f * dot[r], j);
+					}
+				}
+			}
+		}
+
+		// ȷ: ƾ벻νĺѡǰ
+		for (int i = q0; i < q1; ++i){
+			const float *a = query.Row<float>(i);
+			const float *cdi = cd[i - q0];
+			const int *cji = cj[i - q0];
+			const float bound = cdi[1] + 2.0f * eps * (qn[i] + tmax);
+			int sel[NCAND];
+			int m = 0;
+			for (int c = 0; c < NCAND; ++c){
+				if (cji[c] >= 0 && cdi[c] <= bound){
+					sel[m++] = cji[c];
+				}
+			}
+			// ԭʵͬı˳͸¹
+			DescNN& r = nn[i];
+			r.idx = -1;
+			r.d0 = r.d1 = FLT_MAX;
+			if (m == NCAND){
+				// ѡװ(ظ), ˻Ϊȫ
+				for (int j = 0; j < nt; ++j){
+					float dist = ExactL2(a, train.Row<float>(j), n);
+					if (dist < r.d0){
+						r.d1 = r.d0;
+						r.d0 = dist;
+						r.idx = j;
+					} else if (dist < r.d1){
+						r.d1 = dist;
+					}
+				}
+				continue;
+			}
+			sort(sel, sel + m);
+			for (int c = 0; c < m; ++c){
+				float dist = ExactL2(a, train.Row<float>(sel[c]), n);
+				if (dist < r.d0){
+					r.d1 = r.d0;
+					r.d0 = dist;
+					r.idx = sel[c];
+				} else if (dist < r.d1){
+					r.d1 = dist;
+				}
+			}
+		}
+	}
+}
+
+// 64λpopcount
+static inline int Popcnt64(uint64 x){
+#if defined(_MSC_VER) && defined(_M_X64)
+	return (int)__popcnt64(x);
+#elif defined(_MSC_VER)
+	return (int)(__popcnt((unsigned int)x) + __popcnt((unsigned int)(x >> 32)));
+#else
+	return __builtin_popcountll(x);
+#endif
+}
+
+// , ÿ32ֽڼһ, bound(ʱֵֻ֤bound)
+static int Hamming(const uint64* a, const uint64* b, int words, int bound){
+	int d = 0;
+	for (int k = 0; k < words; k += 4){
+		d += Popcnt64(a[k] ^ b[k]) + Popcnt64(a[k + 1] ^ b[k + 1])
+			+ Popcnt64(a[k + 2] ^ b[k + 2]) + Popcnt64(a[k + 3] ^ b[k + 3]);
+		if (d > bound){
+			return d;
+		}
+	}
+	return d;
+}
+
+typedef int (*HammingFunc)(const uint64* a, const uint64* b, int words, int bound);
+
+// ֽڷͰĶֵӱ, п뵽32ֽ, 벿Ϊ0
+class HammingTable
+{
+public:
+	explicit HammingTable(const DescMatrix& m);
+	void Search(const DescMatrix& query, vector<DescNN>& nn) const;
+
+private:
+	int				nbytes_;
+	int				words_;		// ÿuint64, 4ı
+	vector<uint64>	data_;		// ֽ
+	vector<int>		idx_;		//  -> ԭ
+	int				start_[257];
+};
+
+HammingTable::HammingTable(const DescMatrix& m){
+	nbytes_ = m.cols * (int)m.elemSize();
+	words_ = (int)alignSize(max(nbytes_, 1), 32) / 8;
+	data_.assign((size_t)m.rows * words_, 0);
+	idx_.resize(m.rows);
+
+	// 
+	memset(start_, 0, sizeof(start_));
+	for (int j = 0; j < m.rows; ++j){
+		start_[m.Row<uchar>(j)[0] + 1]++;
+	}
+	for (int b = 0; b < 256; ++b){
+		start_[b + 1] += start_[b];
+	}
+	int fill[256];
+	memcpy(fill, start_, sizeof(fill));
+	for (int j = 0; j < m.rows; ++j){
+		int s = fill[m.Row<uchar>(j)[0]]++;
+		memcpy(&data_[(size_t)s * words_], m.Row<uchar>(j), nbytes_);
+		idx_[s] = j;
+	}
+}
+
+void HammingTable::Search(const DescMatrix& query, vector<DescNN>& nn) const{
+	const int nq = query.rows;
+	nn.resize(nq);
+
+	// ֽ밴λ, λͰ½
+	int order[256];
+	for (int i = 0; i < 256; ++i){
+		order[i] = i;
+	}
+	int bits[256];
+	for (int i = 0; i < 256; ++i){
+		bits[i] = Popcnt64((uint64)i);
+	}
+	for (int i = 1; i < 256; ++i){
+		int v = order[i], p = i;
+		for (; p > 0 && bits[order[p - 1]] > bits[v]; --p){
+			order[p] = order[p - 1];
+		}
+		order[p] = v;
+	}
+	// CPU֧ʱʹAVX2ں, Ϊpopcnt
+	const HammingFunc hamming = CpuSupportAVX2() ? HammingAVX2 : Hamming;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+	{
+		vector<uint64> q(words_, 0);
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+		for (int i = 0; i < nq; ++i){
+			memcpy(&q[0], query.Row<uchar>(i), nbytes_);
+			const int p = query.Row<uchar>(i)[0];
+			int d0 = INT_MAX, d1 = INT_MAX, best = -1;
+			for (int o = 0; o < 256; ++o){
+				const int m = order[o];
+				if (bits[m] > d1){
+					break;
+				}
+				const int b = p ^ m;
+				for (int s = start_[b]; s < start_[b + 1]; ++s){
+					const int j = idx_[s];
+					int d = hamming(&q[0], &data_[(size_t)s * words_], words_, d1);
+					// ˳ͬ: ͬȡС, νΪڶСֵ
+					if (d < d0 || (d == d0 && j < best)){
+						d1 = d0;
+						d0 = d;
+						best = j;
+					} else if (d < d1){
+						d1 = d;
+					}
+				}
+			}
+			nn[i].idx = best;
+			nn[i].d0 = (d0 == INT_MAX) ? FLT_MAX : (float)d0;
+			nn[i].d1 = (d1 == INT_MAX) ? FLT_MAX : (float)d1;
+		}
+	}
+}
+
+void MatchHamming(const DescMatrix& query, const DescMatrix& train, vector<DescNN>& nn, bool crosscheck){
+	CHECK_EQ(query.depth(), CV_8U) << "Hamming Match Needs Binary Descriptors!";
+	CHECK_EQ(train.depth(), CV_8U) << "Hamming Match Needs Binary Descriptors!";
+	CHECK_EQ(query.cols, train.cols) << "Descriptor Dimention Not Equal!";
+	nn.resize(query.rows);
+	if (query.rows == 0){
+		return;
+	}
+	HammingTable(train).Search(query, nn);
+
+	// : ѵѯƥ
+	if (crosscheck){
+		vector<DescNN> back;
+		HammingTable(query).Search(train, back);
+		for (int i = 0; i < query.rows; ++i){
+			if (nn[i].idx >= 0 && back[nn[i].idx].idx != i){
+				nn[i].idx = -1;
+			}
+		}
+	}
+}
+
+}
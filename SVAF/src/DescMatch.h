@@ -0,0 +1,37 @@
+/*
+Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
+ӱƥ: SIMDŷ/, ߳, ںʹνڹֵ
+*/
+
+#pragma once
+
+#include "DescMatrix.h"
+#include <glog\logging.h>
+#include <vector>
+
+using namespace std;
+
+namespace svaf{
+
+// һѯӵƥ
+typedef struct _DescNN{
+	int		idx;	// , ѵΪʱΪ-1
+	float	d0;		// 
+	float	d1;		// ν, ֻһѵʱΪFLT_MAX
+} DescNN;
+
+// ŷϾ(CV_32F).  |a|^2 + |b|^2 - 2a.b ֿɸѡѡ, άȷ,
+//  sqrt(sum((a - b)^2)) ıƥȫһ
+void MatchL2(const DescMatrix& query, const DescMatrix& train, vector<DescNN>& nn);
+
+// (CV_8Uλ, ORB/BRIEF/BRISK/FREAK). ѵֽڷͰ, ֽھ
+// Сǰ̭, Ƚϵıƥһ(ͬʱȡС).
+// crosscheckʱڲΪڵĲѯidxΪ-1
+void MatchHamming(const DescMatrix& query, const DescMatrix& train, vector<DescNN>& nn,
+	bool crosscheck = false);
+
+// AVX2ں(DescMatch_avx2.cpp, AVX2), ǰȷCpuSupportAVX2()
+// wordsΪ4ı, ÿ32ֽڼһ, bound
+int HammingAVX2(const uint64* a, const uint64* b, int words, int bound);
+
+}
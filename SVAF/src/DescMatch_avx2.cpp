@@ -0,0 +1,32 @@
+/*
+Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
+ƥAVX2ں, ļAVX2, DescMatch.cppCPU
+*/
+
+#include "DescMatch.h"
+#include <immintrin.h>
+
+namespace svaf{
+
+// ֽڲpopcount
+int HammingAVX2(const uint64* a, const uint64* b, int words, int bound){
+	const __m256i lut = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+		0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+	const __m256i low = _mm256_set1_epi8(0x0f);
+	int d = 0;
+	for (int k = 0; k < words; k += 4){
+		__m256i x = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(a + k)),
+			_mm256_loadu_si256((const __m256i*)(b + k)));
+		__m256i c = _mm256_add_epi8(_mm256_shuffle_epi8(lut, _mm256_and_si256(x, low)),
+			_mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(x, 4), low)));
+		__m256i s = _mm256_sad_epu8(c, _mm256_setzero_si256());
+		d += _mm256_extract_epi32(s, 0) + _mm256_extract_epi32(s, 2)
+			+ _mm256_extract_epi32(s, 4) + _mm256_extract_epi32(s, 6);
+		if (d > bound){
+			return d;
+		}
+	}
+	return d;
+}
+
+}
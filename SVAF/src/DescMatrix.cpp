@@ -0,0 +1,84 @@
+/*
+Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
+
+*/
+
+#include "DescMatrix.h"
+
+namespace svaf{
+
+DescMatrix& DescMatrix::operator=(const DescMatrix& m){
+	if (this != &m){
+		Mat::operator=(m);
+		kind_ = m.kind_;
+	}
+	return *this;
+}
+
+// ͨMatֵʱΪʽ, : CV_32FΪ,
+// CV_8U趨UCHAR/BINARY, δ趨ʱOpenCVĶӴ
+DescMatrix& DescMatrix::operator=(const Mat& m){
+	DescKind kind = DESC_FLOAT;
+	if (m.depth() != CV_32F){
+		kind = (kind_ == DESC_FLOAT) ? DESC_BINARY : kind_;
+	}
+	Assign(m, kind);
+	return *this;
+}
+
+// ľ, ߴͲѶʱ
+void DescMatrix::Create(int rows, int cols, int type, DescKind kind){
+	kind_ = kind;
+	if (!empty() && Aligned() && this->rows == rows && this->cols == cols && this->type() == type){
+		return;
+	}
+	if (rows <= 0 || cols <= 0){
+		release();
+		return;
+	}
+	// ALIGNֽ, ȡ㴦rows*strideһΰ, ٽȡǰcols;
+	// MatROI/reshape, bufü
+	const int esz = CV_ELEM_SIZE(type);
+	CV_Assert(ALIGN % esz == 0);
+	const int stride = (int)alignSize(cols * esz, ALIGN) / esz;
+	Mat buf(1, rows * stride + ALIGN / esz, type);
+	const int off = (int)(alignPtr(buf.data, ALIGN) - buf.data);
+	CV_Assert(off % esz == 0);
+	Mat::operator=(buf.colRange(off / esz, off / esz + rows * stride).reshape(0, rows).colRange(0, cols));
+}
+
+// Ϊʽ
+void DescMatrix::Assign(const Mat& m, DescKind kind){
+	if (m.empty()){
+		release();
+		kind_ = kind;
+		return;
+	}
+	Mat src = m;
+	if (!empty() && src.datastart == datastart){
+		src = src.clone();	// mڴ
+	}
+	Create(src.rows, src.cols, src.type(), kind);
+	const size_t rowbytes = src.cols * src.elemSize();
+	for (int i = 0; i < src.rows; ++i){
+		memcpy(ptr(i), src.ptr(i), rowbytes);
+	}
+}
+
+// OpenCV·ڴ(compute)ʱָ
+void DescMatrix::Align(){
+	if (!Aligned()){
+		Mat src = *this;
+		release();
+		Assign(src, kind_);
+	}
+}
+
+bool DescMatrix::Aligned() const{
+	if (empty()){
+		return true;
+	}
+	return ((size_t)data & (ALIGN - 1)) == 0 && (step[0] & (ALIGN - 1)) == 0;
+}
+
+}
@@ -0,0 +1,54 @@
+/*
+Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
+
+*/
+
+#pragma once
+
+#include <opencv2\opencv.hpp>
+
+using namespace std;
+using namespace cv;
+
+namespace svaf{
+
+// 
+typedef enum _DescKind{
+	DESC_FLOAT = 0,		// CV_32F, SURF/SIFT, ŷϾ
+	DESC_UCHAR,			// CV_8U, ŷϾ
+	DESC_BINARY			// CV_8Uλ, ORB/BRIEF/BRISK/FREAK, 
+} DescKind;
+
+// װ64ֽڶ, п뵽64ֽڵ, ֮û.
+// Mat(, step[0]Ϊп), ֱӽOpenCVƥ;
+// һڴжROI, ͨMatü, ƬͿЧ
+class DescMatrix : public Mat
+{
+public:
+	enum { ALIGN = 64 };
+
+	DescMatrix() : kind_(DESC_FLOAT){}
+	DescMatrix(const DescMatrix& m) : Mat(m), kind_(m.kind_){}
+	DescMatrix& operator=(const DescMatrix& m);
+	DescMatrix& operator=(const Mat& m);
+
+	// ľ, ߴͲѶʱ
+	void Create(int rows, int cols, int type, DescKind kind);
+	// Ϊʽ
+	void Assign(const Mat& m, DescKind kind);
+	// OpenCV·ڴ(compute)ʱָ
+	void Align();
+
+	bool Aligned() const;
+	DescKind Kind() const { return kind_; }
+	void SetKind(DescKind kind){ kind_ = kind; }
+	int Stride() const { return (int)step[0]; }
+
+	template<typename T> T* Row(int i){ return (T*)(data + step[0] * i); }
+	template<typename T> const T* Row(int i) const { return (const T*)(data + step[0] * i); }
+
+private:
+	DescKind	kind_;
+};
+
+}
@@ -0,0 +1,247 @@
+/*
+Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
+: ֡˫Ŀ(Ӻά), , ʹ̭
+*/
+
+#include "FeaturePool.h"
+#include <float.h>
+#include <math.h>
+
+namespace svaf{
+
+static const int MINREBUILD = 64;	// ں¼max(64, 1/4)ʱؽ
+
+static inline float L2(const float* a, const float* b, int n){
+	float dist = 0.0f;
+	for (int k = 0; k < n; ++k){
+		float diff = a[k] - b[k];
+		dist += diff * diff;
+	}
+	return sqrt(dist);
+}
+
+FeaturePool::FeaturePool() : cap_(0), dims_(0), count_(0), cell_(1.0f), head_(-1), tail_(-1),
+	trees_(4), checks_(64), stale_(0)
+{
+}
+
+void FeaturePool::Reset(int capacity, int dims, float cell){
+	CHECK_GT(capacity, 0) << "Feature Pool Capacity Error!";
+	CHECK_GT(cell, 0) << "Feature Pool Cell Size Error!";
+	cap_ = capacity;
+	dims_ = dims;
+	cell_ = cell;
+	despl_.Create(cap_, dims_, CV_32F, DESC_FLOAT);
+	despr_.Create(cap_, dims_, CV_32F, DESC_FLOAT);
+	point_.resize(cap_);
+	gen_.assign(cap_, 0);
+	seen_.assign(cap_, -1);
+	prev_.resize(cap_);
+	next_.resize(cap_);
+	Clear();
+}
+
+void FeaturePool::SetIndex(int trees, int checks){
+	trees_ = max(trees, 1);
+	checks_ = checks;
+}
+
+void FeaturePool::Clear(){
+	count_ = 0;
+	head_ = tail_ = -1;
+	grid_.clear();
+	forest_.Release();
+	rowslot_.clear();
+	rowgen_.clear();
+	fresh_.clear();
+	stale_ = 0;
+}
+
+void FeaturePool::Unlink(int s){
+	if (prev_[s] >= 0){
+		next_[prev_[s]] = next_[s];
+	} else{
+		head_ = next_[s];
+	}
+	if (next_[s] >= 0){
+		prev_[next_[s]] = prev_[s];
+	} else{
+		tail_ = prev_[s];
+	}
+}
+
+void FeaturePool::PushFront(int s){
+	prev_[s] = -1;
+	next_[s] = head_;
+	if (head_ >= 0){
+		prev_[head_] = s;
+	}
+	head_ = s;
+	if (tail_ < 0){
+		tail_ = s;
+	}
+}
+
+// ÿά21λ
+long long FeaturePool::Key(int ix, int iy, int iz) const{
+	const long long m = (1 << 21) - 1;
+	return ((ix & m) << 42) | ((iy & m) << 21) | (iz & m);
+}
+
+void FeaturePool::GridAdd(int s){
+	const Point3f& p = point_[s];
+	grid_[Key((int)floor(p.x / cell_), (int)floor(p.y / cell_), (int)floor(p.z / cell_))].push_back(s);
+}
+
+void FeaturePool::GridRemove(int s){
+	const Point3f& p = point_[s];
+	unordered_map<long long, vector<int>>::iterator it =
+		grid_.find(Key((int)floor(p.x / cell_), (int)floor(p.y / cell_), (int)floor(p.z / cell_)));
+	if (it == grid_.end()){
+		return;
+	}
+	vector<int>& v = it->second;
+	for (int i = 0; i < v.size(); ++i){
+		if (v[i] == s){
+			v[i] = v.back();
+			v.pop_back();
+			break;
+		}
+	}
+	if (v.empty()){
+		grid_.erase(it);
+	}
+}
+
+int FeaturePool::Nearby(const Point3f& p, float radius) const{
+	const int cx = (int)floor(p.x / cell_);
+	const int cy = (int)floor(p.y / cell_);
+	const int cz = (int)floor(p.z / cell_);
+	float best = radius * radius;
+	int slot = -1;
+	for (int dx = -1; dx <= 1; ++dx){
+		for (int dy = -1; dy <= 1; ++dy){
+			for (int dz = -1; dz <= 1; ++dz){
+				unordered_map<long long, vector<int>>::const_iterator it = grid_.find(Key(cx + dx, cy + dy, cz + dz));
+				if (it == grid_.end()){
+					continue;
+				}
+				for (int i = 0; i < it->second.size(); ++i){
+					const Point3f d = point_[it->second[i]] - p;
+					float d2 = d.dot(d);
+					if (d2 <= best){
+						best = d2;
+						slot = it->second[i];
+					}
+				}
+			}
+		}
+	}
+	return slot;
+}
+
+int FeaturePool::Insert(const float* despl, const float* despr, const Point3f& p, int frame){
+	int s;
+	if (count_ < cap_){
+		s = count_++;
+	} else{
+		// ̭δ, е֮
+		s = tail_;
+		Unlink(s);
+		GridRemove(s);
+		stale_++;
+	}
+	memcpy(despl_.Row<float>(s), despl, dims_ * sizeof(float));
+	memcpy(despr_.Row<float>(s), despr, dims_ * sizeof(float));
+	point_[s] = p;
+	gen_[s]++;
+	seen_[s] = frame;
+	GridAdd(s);
+	PushFront(s);
+	fresh_.push_back(make_pair(s, gen_[s]));
+	return s;
+}
+
+void FeaturePool::Touch(int slot, int frame){
+	seen_[slot] = frame;
+	if (head_ != slot){
+		Unlink(slot);
+		PushFront(slot);
+	}
+}
+
+// Եǰؽ
+void FeaturePool::Rebuild(){
+	DescMatrix snapshot;
+	snapshot.Create(count_, dims_, CV_32F, DESC_FLOAT);
+	rowslot_.resize(count_);
+	rowgen_.resize(count_);
+	for (int s = 0; s < count_; ++s){
+		memcpy(snapshot.Row<float>(s), despl_.Row<float>(s), dims_ * sizeof(float));
+		rowslot_[s] = s;
+		rowgen_[s] = gen_[s];
+	}
+	forest_.Build(snapshot, trees_, 8);
+	fresh_.clear();
+	stale_ = 0;
+}
+
+void FeaturePool::Match(const DescMatrix& despl, const DescMatrix& despr, float thresh, vector<int>& slot){
+	CHECK_EQ(despl.cols, dims_) << "Descriptor Dimention Not Equal!";
+	CHECK_EQ(despr.rows, despl.rows) << "Stereo Descriptor Count Not Match!";
+	const int nq = despl.rows;
+	slot.assign(nq, -1);
+	if (count_ == 0 || nq == 0){
+		return;
+	}
+
+	if ((int)fresh_.size() + stale_ > max(MINREBUILD, count_ / 4)){
+		Rebuild();
+	}
+	if (!forest_.Empty()){
+		forest_.Match(despl, checks_, nn_);
+	} else{
+		DescNN none = { -1, FLT_MAX, FLT_MAX };
+		nn_.assign(nq, none);
+	}
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+	for (int i = 0; i < nq; ++i){
+		const float *q = despl.Row<float>(i);
+		int best = -1;
+		float d0 = FLT_MAX, d1 = nn_[i].d1;
+		// еѱ̭ʱ, Ϊνıع
+		if (nn_[i].idx >= 0 && rowgen_[nn_[i].idx] == gen_[rowslot_[nn_[i].idx]]){
+			best = rowslot_[nn_[i].idx];
+			d0 = nn_[i].d0;
+		} else if (nn_[i].idx >= 0){
+			d1 = min(d1, nn_[i].d0);
+		}
+		// ֮Ƚ
+		for (int f = 0; f < fresh_.size(); ++f){
+			const int s = fresh_[f].first;
+			if (fresh_[f].second != gen_[s]){
+				continue;
+			}
+			float dist = L2(q, despl_.Row<float>(s), dims_);
+			if (dist < d0){
+				d1 = d0;
+				d0 = dist;
+				best = s;
+			} else if (dist < d1){
+				d1 = dist;
+			}
+		}
+		if (best < 0 || !(d0 / d1 < thresh)){
+			continue;
+		}
+		// Ӹ
+		if (L2(despr.Row<float>(i), despr_.Row<float>(best), dims_) < d1){
+			slot[i] = best;
+		}
+	}
+}
+
+}
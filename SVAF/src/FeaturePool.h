@@ -0,0 +1,78 @@
+/*
+Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
+: ֡˫Ŀ(Ӻά), , ʹ̭
+*/
+
+#pragma once
+
+#include "DescMatrix.h"
+#include "KDForest.h"
+#include <vector>
+#include <unordered_map>
+
+using namespace std;
+using namespace cv;
+
+namespace svaf{
+
+class FeaturePool
+{
+public:
+	FeaturePool();
+
+	// /ά/ռɢб߳
+	void Reset(int capacity, int dims, float cell);
+	// , KDForest
+	void SetIndex(int trees, int checks);
+	void Clear();
+	int Size() const { return count_; }
+	int Capacity() const { return cap_; }
+	int Dims() const { return dims_; }
+
+	// ӽ(ֵ), ӵľСڴν, ʧΪ-1
+	void Match(const DescMatrix& despl, const DescMatrix& despr, float thresh, vector<int>& slot);
+	// άradius(cell), ûΪ-1
+	int Nearby(const Point3f& p, float radius) const;
+	// һ, ʱ̭δ, زλ
+	int Insert(const float* despl, const float* despr, const Point3f& p, int frame);
+	// frame֡۲⵽
+	void Touch(int slot, int frame);
+	const Point3f& Point(int slot) const { return point_[slot]; }
+	int Seen(int slot) const { return seen_[slot]; }
+
+private:
+	void Unlink(int s);
+	void PushFront(int s);
+	void GridAdd(int s);
+	void GridRemove(int s);
+	long long Key(int ix, int iy, int iz) const;
+	void Rebuild();
+
+	int				cap_;
+	int				dims_;
+	int				count_;
+	float			cell_;
+
+	// λ
+	DescMatrix		despl_, despr_;
+	vector<Point3f>	point_;
+	vector<int>		gen_;		// λõĴ, ʶеĹ
+	vector<int>		seen_;
+
+	// LRU˫, head_ʹ
+	vector<int>		prev_, next_;
+	int				head_, tail_;
+
+	// άռɢ
+	unordered_map<long long, vector<int>>	grid_;
+
+	// () + ֮¼
+	KDForest		forest_;
+	int				trees_, checks_;
+	vector<int>		rowslot_, rowgen_;
+	vector<pair<int, int>>	fresh_;	// (λ, gen)
+	int				stale_;
+	vector<DescNN>	nn_;
+};
+
+}
@@ -0,0 +1,181 @@
+/*
+Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
+ͼ: SURFMILٹ, ǰ׺ + ֿۼ
+*/
+
+#include "Integral.h"
+#include <emmintrin.h>
+#include <limits.h>
+
+using namespace std;
+using namespace cv;
+
+namespace svaf{
+
+static const int TILE = 128;	// ۼÿ̸߳
+
+// һеǰ׺(int32), ÿ16
+static void RowPrefix(const uchar* src, int* dst, int cols){
+	const __m128i zero = _mm_setzero_si128();
+	__m128i carry = _mm_setzero_si128();
+	int j = 0;
+	for (; j + 16 <= cols; j += 16){
+		__m128i v = _mm_loadu_si128((const __m128i*)(src + j));
+		__m128i lo = _mm_unpacklo_epi8(v, zero);
+		__m128i hi = _mm_unpackhi_epi8(v, zero);
+		__m128i q[4] = { _mm_unpacklo_epi16(lo, zero), _mm_unpackhi_epi16(lo, zero),
+			_mm_unpacklo_epi16(hi, zero), _mm_unpackhi_epi16(hi, zero) };
+		for (int k = 0; k < 4; ++k){
+			__m128i x = q[k];
+			x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+			x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+			x = _mm_add_epi32(x, carry);
+			_mm_storeu_si128((__m128i*)(dst + j + 4 * k), x);
+			carry = _mm_shuffle_epi32(x, 0xFF);
+		}
+	}
+	int s = j ? dst[j - 1] : 0;
+	for (; j < cols; ++j){
+		s += src[j];
+		dst[j] = s;
+	}
+}
+
+// ۼ(int32), float; preoutͬһڴ
+static void ColumnTileF(const int* pre, size_t pstep, float* out, size_t ostep, int rows, int width, float scale){
+	__m128i acc[TILE / 4];
+	int *a = (int*)acc;
+	memset(acc, 0, sizeof(acc));
+	const __m128 vs = _mm_set1_ps(scale);
+	for (int i = 0; i < rows; ++i){
+		const int *p = pre + i * pstep;
+		float *o = out + i * ostep;
+		int j = 0;
+		for (; j + 4 <= width; j += 4){
+			__m128i s = _mm_add_epi32(acc[j / 4], _mm_loadu_si128((const __m128i*)(p + j)));
+			acc[j / 4] = s;
+			_mm_storeu_ps(o + j, _mm_mul_ps(_mm_cvtepi32_ps(s), vs));
+		}
+		for (; j < width; ++j){
+			a[j] += p[j];
+			o[j] = a[j] * scale;
+		}
+	}
+}
+
+// ۼ(int32), int32
+static void ColumnTileS(const int* pre, size_t pstep, int* out, size_t ostep, int rows, int width){
+	__m128i acc[TILE / 4];
+	int *a = (int*)acc;
+	memset(acc, 0, sizeof(acc));
+	for (int i = 0; i < rows; ++i){
+		const int *p = pre + i * pstep;
+		int *o = out + i * ostep;
+		int j = 0;
+		for (; j + 4 <= width; j += 4){
+			__m128i s = _mm_add_epi32(acc[j / 4], _mm_loadu_si128((const __m128i*)(p + j)));
+			acc[j / 4] = s;
+			_mm_storeu_si128((__m128i*)(o + j), s);
+		}
+		for (; j < width; ++j){
+			a[j] += p[j];
+			o[j] = a[j];
+		}
+	}
+}
+
+// ۼ, ACCΪۼ
+template<typename ACC, typename OUT>
+static void ColumnTile(const int* pre, size_t pstep, OUT* out, size_t ostep, int rows, int width, double scale){
+	ACC acc[TILE];
+	for (int j = 0; j < width; ++j){
+		acc[j] = 0;
+	}
+	for (int i = 0; i < rows; ++i){
+		const int *p = pre + i * pstep;
+		OUT *o = out + i * ostep;
+		for (int j = 0; j < width; ++j){
+			acc[j] += p[j];
+			o[j] = (OUT)(acc[j] * scale);
+		}
+	}
+}
+
+void ComputeIntegral(const Mat& gray, Mat& sum, int depth, double scale){
+	CV_Assert(gray.type() == CV_8UC1);
+	CV_Assert(depth == CV_32F || depth == CV_32S || depth == CV_64F);
+	const int rows = gray.rows;
+	const int cols = gray.cols;
+	const bool exact = (double)rows * cols * 255 <= INT_MAX;	// int32ۼӲ
+	CV_Assert(depth != CV_32S || (exact && scale == 1.0));
+	sum.create(rows, cols, depth);
+	if (rows == 0 || cols == 0){
+		return;
+	}
+
+	// ǰ׺, Ϊ4ֽʱֱдsum
+	Mat pre = (depth == CV_64F) ? Mat(rows, cols, CV_32S) : Mat(rows, cols, CV_32S, sum.data, sum.step);
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+	for (int i = 0; i < rows; ++i){
+		RowPrefix(gray.ptr<uchar>(i), pre.ptr<int>(i), cols);
+	}
+
+	// зֿ, ÿ϶ۼ
+	const int tiles = (cols + TILE - 1) / TILE;
+	const size_t pstep = pre.step / sizeof(int);
+	const size_t ostep = sum.step / sum.elemSize();
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+	for (int t = 0; t < tiles; ++t){
+		const int c0 = t * TILE;
+		const int width = min(TILE, cols - c0);
+		const int *p = pre.ptr<int>(0) + c0;
+		if (depth == CV_32F && exact){
+			ColumnTileF(p, pstep, sum.ptr<float>(0) + c0, ostep, rows, width, (float)scale);
+		} else if (depth == CV_32F){
+			ColumnTile<double, float>(p, pstep, sum.ptr<float>(0) + c0, ostep, rows, width, scale);
+		} else if (depth == CV_32S){
+			ColumnTileS(p, pstep, sum.ptr<int>(0) + c0, ostep, rows, width);
+		} else if (exact){
+			ColumnTile<int, double>(p, pstep, sum.ptr<double>(0) + c0, ostep, rows, width, scale);
+		} else{
+			ColumnTile<double, double>(p, pstep, sum.ptr<double>(0) + c0, ostep, rows, width, scale);
+		}
+	}
+}
+
+IntegralCache::IntegralCache() : data_(NULL), type_(-1), depth_(-1), scale_(0)
+{
+}
+
+void IntegralCache::Release(){
+	sum_.release();
+	gray_.release();
+	data_ = NULL;
+}
+
+const Mat& IntegralCache::Get(const Mat& image, int depth, double scale){
+	if (!sum_.empty() && image.data == data_ && image.size() == size_ && image.type() == type_
+		&& depth == depth_ && scale == scale_){
+		return sum_;
+	}
+	// ɵĽԱ, ԭظ
+	sum_.release();
+	if (image.channels() == 3){
+		cvtColor(image, gray_, CV_BGR2GRAY);
+		ComputeIntegral(gray_, sum_, depth, scale);
+	} else{
+		ComputeIntegral(image, sum_, depth, scale);
+	}
+	data_ = image.data;
+	size_ = image.size();
+	type_ = image.type();
+	depth_ = depth;
+	scale_ = scale;
+	return sum_;
+}
+
+}
@@ -0,0 +1,40 @@
+/*
+Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
+ͼ: SURFMILٹ, ǰ׺ + ֿۼ
+*/
+
+#pragma once
+
+#include <opencv2\opencv.hpp>
+
+// ҲMilTrack(cvռ), ﲻʹusing
+
+namespace svaf{
+
+// ͼ sum(r, c) = scale * gray(0..r, 0..c)֮(ǰ), ԭͼͬߴ
+// grayΪCV_8UC1; depthΪCV_32F/CV_32S/CV_64F, CV_32SʱscaleΪ1
+// ۼʹint32(ʱ)double, ֻʱһ; sumߴʱԭд
+void ComputeIntegral(const cv::Mat& gray, cv::Mat& sum, int depth = CV_32F, double scale = 1.0);
+
+// ͼĻͼ, ͬһ֡ڸ㹲(Block::integral)
+class IntegralCache
+{
+public:
+	IntegralCache();
+
+	// ͼ(BGRҶ)Ļͼ, ͼ//ϵϴͬʱֱӷ
+	// ͼݱԭ޸ĺRelease
+	const cv::Mat& Get(const cv::Mat& image, int depth = CV_32F, double scale = 1.0 / 255);
+	void Release();
+
+private:
+	cv::Mat			sum_;
+	cv::Mat			gray_;
+	const uchar*	data_;
+	cv::Size		size_;
+	int				type_;
+	int				depth_;
+	double			scale_;
+};
+
+}
@@ -0,0 +1,249 @@
+/*
+Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
+kdɭ: , һȶ
+*/
+
+#include "KDForest.h"
+#include <xmmintrin.h>
+#include <float.h>
+#include <queue>
+#include <algorithm>
+
+namespace svaf{
+
+static const int SAMPLES = 100;		// ƷĲ
+static const int RANDDIM = 5;		// ڷļάѡָά
+
+// ŷϾƽ
+static inline float L2Sqr(const float* a, const float* b, int n){
+	__m128 s = _mm_setzero_ps();
+	int k = 0;
+	for (; k + 4 <= n; k += 4){
+		__m128 d = _mm_sub_ps(_mm_loadu_ps(a + k), _mm_loadu_ps(b + k));
+		s = _mm_add_ps(s, _mm_mul_ps(d, d));
+	}
+	float v[4];
+	_mm_storeu_ps(v, s);
+	float sum = v[0] + v[1] + v[2] + v[3];
+	for (; k < n; ++k){
+		float d = a[k] - b[k];
+		sum += d * d;
+	}
+	return sum;
+}
+
+// ķ֧, ָľ½
+typedef struct _Branch{
+	float	dist;
+	int		tree;
+	int		node;
+	bool operator<(const _Branch& b) const { return dist > b.dist; }
+} Branch;
+
+KDForest::KDForest() : leafsize_(8)
+{
+}
+
+void KDForest::Release(){
+	data_.release();
+	root_.clear();
+	nodes_.clear();
+	perm_.clear();
+}
+
+void KDForest::Build(const DescMatrix& train, int trees, int leafsize){
+	CHECK_EQ(train.type(), CV_32F) << "KDForest Needs Float Descriptors!";
+	Release();
+	data_.Assign(train, DESC_FLOAT);
+	leafsize_ = max(leafsize, 1);
+	trees = max(trees, 1);
+	root_.assign(trees, -1);
+	nodes_.assign(trees, vector<Node>());
+	perm_.assign(trees, vector<int>());
+	if (data_.rows == 0){
+		return;
+	}
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+	for (int t = 0; t < trees; ++t){
+		RNG rng(0x9E3779B9u + t);	// ÿ̶, ɸ
+		vector<int>& perm = perm_[t];
+		perm.resize(data_.rows);
+		for (int i = 0; i < data_.rows; ++i){
+			perm[i] = i;
+		}
+		for (int i = data_.rows - 1; i > 0; --i){
+			swap(perm[i], perm[rng.uniform(0, i + 1)]);
+		}
+		nodes_[t].reserve(2 * data_.rows / leafsize_ + 1);
+		vector<float> mean(data_.cols), var(data_.cols);
+		root_[t] = BuildNode(t, 0, data_.rows, rng, mean, var);
+	}
+}
+
+// ڷļάѡһ, Ծֵָ
+int KDForest::BuildNode(int tree, int begin, int end, RNG& rng, vector<float>& mean, vector<float>& var){
+	vector<Node>& nodes = nodes_[tree];
+	vector<int>& perm = perm_[tree];
+	const int id = (int)nodes.size();
+	Node node;
+	node.dim = -1;
+	node.val = 0;
+	node.lo = begin;
+	node.hi = end;
+	nodes.push_back(node);
+	if (end - begin <= leafsize_){
+		return id;
+	}
+
+	const int n = data_.cols;
+	const int cnt = min(end - begin, SAMPLES);
+	fill(mean.begin(), mean.end(), 0.0f);
+	fill(var.begin(), var.end(), 0.0f);
+	for (int i = 0; i < cnt; ++i){
+		const float *p = data_.Row<float>(perm[begin + i]);
+		for (int k = 0; k < n; ++k){
+			mean[k] += p[k];
+		}
+	}
+	for (int k = 0; k < n; ++k){
+		mean[k] /= cnt;
+	}
+	for (int i = 0; i < cnt; ++i){
+		const float *p = data_.Row<float>(perm[begin + i]);
+		for (int k = 0; k < n; ++k){
+			float d = p[k] - mean[k];
+			var[k] += d * d;
+		}
+	}
+	int top[RANDDIM];
+	int ntop = 0;
+	for (int k = 0; k < n; ++k){
+		if (ntop < RANDDIM || var[k] > var[top[ntop - 1]]){
+			int p = (ntop < RANDDIM) ? ntop++ : ntop - 1;
+			for (; p > 0 && var[top[p - 1]] < var[k]; --p){
+				top[p] = top[p - 1];
+			}
+			top[p] = k;
+		}
+	}
+	const int dim = top[rng.uniform(0, ntop)];
+	float val = mean[dim];
+
+	// ֵָ, ˻ʱȡλ
+	int *first = &perm[0] + begin;
+	int *last = &perm[0] + end;
+	int *mid = partition(first, last, [&](int i){ return data_.Row<float>(i)[dim] < val; });
+	if (mid == first || mid == last){
+		mid = first + (end - begin) / 2;
+		nth_element(first, mid, last, [&](int a, int b){
+			return data_.Row<float>(a)[dim] < data_.Row<float>(b)[dim]; });
+		val = data_.Row<float>(*mid)[dim];
+	}
+	const int split = (int)(mid - &perm[0]);
+
+	int lo = BuildNode(tree, begin, split, rng, mean, var);
+	int hi = BuildNode(tree, split, end, rng, mean, var);
+	nodes[id].dim = dim;
+	nodes[id].val = val;
+	nodes[id].lo = lo;
+	nodes[id].hi = hi;
+	return id;
+}
+
+DescNN KDForest::Search(const float* q, int checks, vector<int>& visited, int stamp) const{
+	const int n = data_.cols;
+	float d0 = FLT_MAX, d1 = FLT_MAX;
+	int best = -1;
+
+	// ȷ
+	if (checks <= 0){
+		for (int j = 0; j < data_.rows; ++j){
+			float d = L2Sqr(q, data_.Row<float>(j), n);
+			if (d < d0){
+				d1 = d0;
+				d0 = d;
+				best = j;
+			} else if (d < d1){
+				d1 = d;
+			}
+		}
+	} else{
+		priority_queue<Branch> heap;
+		int checked = 0;
+		for (int t = 0; t < root_.size(); ++t){
+			Branch b = { 0.0f, t, root_[t] };
+			heap.push(b);
+		}
+		// ÿδ½Сķ֧½Ҷڵ, ;һѹ
+		while (!heap.empty() && (checked < checks || best < 0)){
+			Branch b = heap.top();
+			heap.pop();
+			if (b.dist >= d1){
+				continue;
+			}
+			const vector<Node>& nodes = nodes_[b.tree];
+			const vector<int>& perm = perm_[b.tree];
+			int id = b.node;
+			while (nodes[id].dim >= 0){
+				const Node& nd = nodes[id];
+				float diff = q[nd.dim] - nd.val;
+				Branch other = { b.dist + diff * diff, b.tree, diff < 0 ? nd.hi : nd.lo };
+				if (other.dist < d1){
+					heap.push(other);
+				}
+				id = diff < 0 ? nd.lo : nd.hi;
+			}
+			for (int s = nodes[id].lo; s < nodes[id].hi; ++s){
+				int j = perm[s];
+				if (visited[j] == stamp){
+					continue;
+				}
+				visited[j] = stamp;
+				checked++;
+				float d = L2Sqr(q, data_.Row<float>(j), n);
+				if (d < d0){
+					d1 = d0;
+					d0 = d;
+					best = j;
+				} else if (d < d1){
+					d1 = d;
+				}
+			}
+		}
+	}
+
+	DescNN r;
+	r.idx = best;
+	r.d0 = (d0 == FLT_MAX) ? FLT_MAX : sqrt(d0);
+	r.d1 = (d1 == FLT_MAX) ? FLT_MAX : sqrt(d1);
+	return r;
+}
+
+void KDForest::Match(const DescMatrix& query, int checks, vector<DescNN>& nn) const{
+	CHECK_EQ(query.type(), CV_32F) << "KDForest Needs Float Descriptors!";
+	CHECK_EQ(query.cols, data_.cols) << "Descriptor Dimention Not Equal!";
+	const int nq = query.rows;
+	nn.resize(nq);
+	if (checks <= 0){
+		MatchL2(query, data_, nn);
+		return;
+	}
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+	{
+		vector<int> visited(max(data_.rows, 1), -1);
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 16)
+#endif
+		for (int i = 0; i < nq; ++i){
+			nn[i] = Search(query.Row<float>(i), checks, visited, i);
+		}
+	}
+}
+
+}
@@ -0,0 +1,49 @@
+/*
+Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
+kdɭ: , һȶ
+*/
+
+#pragma once
+
+#include "DescMatrix.h"
+#include "DescMatch.h"
+#include <vector>
+
+using namespace std;
+
+namespace svaf{
+
+class KDForest
+{
+public:
+	KDForest();
+
+	// ѵ(CV_32F), ÿһ߳
+	void Build(const DescMatrix& train, int trees, int leafsize);
+	void Release();
+	bool Empty() const { return data_.empty(); }
+	int Size() const { return data_.rows; }
+
+	// ںʹν(ŷϾ), ÿѯȽchecks, checks <= 0 Ϊȷ
+	void Match(const DescMatrix& query, int checks, vector<DescNN>& nn) const;
+	// Ӳѯ, visitedΪ߳еı(Size()), stampÿβѯͬ
+	DescNN Search(const float* q, int checks, vector<int>& visited, int stamp) const;
+
+private:
+	// ڲڵdim >= 0, Ҷڵdim < 0[lo, hi)Ϊperm_еķΧ
+	typedef struct _Node{
+		int		dim;
+		float	val;
+		int		lo, hi;		// ڲڵΪӽڵ
+	} Node;
+
+	int BuildNode(int tree, int begin, int end, RNG& rng, vector<float>& mean, vector<float>& var);
+
+	DescMatrix			data_;
+	int					leafsize_;
+	vector<int>			root_;
+	vector<vector<Node>>	nodes_;
+	vector<vector<int>>		perm_;
+};
+
+}
@@ -0,0 +1,107 @@
+/*
+Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
+Ԥ: ڰӦѡȡǿĵ, ֵ֡Ӧ
+*/
+
+#include "PointBudget.h"
+#include <algorithm>
+
+namespace svaf{
+
+PointBudget::PointBudget() : budget_(0), cols_(1), rows_(1), overshoot_(1.5f), init_(0)
+{
+}
+
+void PointBudget::Reset(int budget, int cols, int rows, float overshoot){
+	budget_ = max(budget, 0);
+	cols_ = max(cols, 1);
+	rows_ = max(rows, 1);
+	overshoot_ = max(overshoot, 1.0f);
+}
+
+// ӦӴСȡǰk()
+static void TopK(vector<int>& idx, const vector<float>& response, int k){
+	if (k < (int)idx.size()){
+		nth_element(idx.begin(), idx.begin() + k, idx.end(),
+			[&response](int a, int b){ return response[a] > response[b]; });
+	}
+}
+
+void PointBudget::Select(const vector<Point2f>& points, const vector<float>& response, Size size,
+	vector<int>& keep) const{
+	CV_Assert(points.size() == response.size());
+	const int n = (int)points.size();
+	keep.clear();
+	if (budget_ <= 0 || n <= budget_){
+		for (int i = 0; i < n; ++i){
+			keep.push_back(i);
+		}
+		return;
+	}
+
+	// Ͱ
+	const int cells = cols_ * rows_;
+	const float sx = (float)cols_ / max(size.width, 1);
+	const float sy = (float)rows_ / max(size.height, 1);
+	vector<int> start(cells + 1, 0), cell(n), order(n);
+	for (int i = 0; i < n; ++i){
+		const int cx = min(max((int)(points[i].x * sx), 0), cols_ - 1);
+		const int cy = min(max((int)(points[i].y * sy), 0), rows_ - 1);
+		cell[i] = cy * cols_ + cx;
+		start[cell[i] + 1]++;
+	}
+	for (int c = 0; c < cells; ++c){
+		start[c + 1] += start[c];
+	}
+	vector<int> fill(start.begin(), start.end() - 1);
+	for (int i = 0; i < n; ++i){
+		order[fill[cell[i]]++] = i;
+	}
+
+	// ÿ, ٵĸʣµǿ
+	const int quota = budget_ / cells;
+	vector<int> rest, bucket;
+	for (int c = 0; c < cells; ++c){
+		bucket.assign(order.begin() + start[c], order.begin() + start[c + 1]);
+		TopK(bucket, response, quota);
+		const int take = min(quota, (int)bucket.size());
+		keep.insert(keep.end(), bucket.begin(), bucket.begin() + take);
+		rest.insert(rest.end(), bucket.begin() + take, bucket.end());
+	}
+	const int spare = budget_ - (int)keep.size();
+	TopK(rest, response, spare);
+	keep.insert(keep.end(), rest.begin(), rest.begin() + min(spare, (int)rest.size()));
+	sort(keep.begin(), keep.end());
+}
+
+void PointBudget::Select(const vector<KeyPoint>& keypoints, Size size, vector<int>& keep) const{
+	vector<Point2f> points(keypoints.size());
+	vector<float> response(keypoints.size());
+	for (int i = 0; i < keypoints.size(); ++i){
+		points[i] = keypoints[i].pt;
+		response[i] = keypoints[i].response;
+	}
+	Select(points, response, size, keep);
+}
+
+double PointBudget::Adapt(double thresh, int detected){
+	if (budget_ <= 0){
+		return thresh;
+	}
+	if (init_ <= 0){
+		init_ = thresh;
+	}
+	// ֵɱ仯, ÿ֡һ
+	const double target = budget_ * overshoot_;
+	if (detected > target){
+		thresh *= min(2.0, sqrt(detected / target));
+	} else if (detected < budget_){
+		thresh *= max(0.5, sqrt((double)max(detected, 1) / budget_));
+	}
+	if (init_ > 0){
+		thresh = min(max(thresh, init_ / 4), init_ * 256);
+	}
+	return thresh;
+}
+
+}
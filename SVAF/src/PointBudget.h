@@ -0,0 +1,43 @@
+/*
+Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
+Ԥ: ڰӦѡȡǿĵ, ֵ֡Ӧ
+*/
+
+#pragma once
+
+#include <opencv2\opencv.hpp>
+#include <vector>
+
+using namespace std;
+using namespace cv;
+
+namespace svaf{
+
+class PointBudget
+{
+public:
+	PointBudget();
+
+	// budgetΪÿͼĵ(0), cols x rows, ĿΪovershoot * budget
+	void Reset(int budget, int cols, int rows, float overshoot);
+	bool Enabled() const { return budget_ > 0; }
+	int Budget() const { return budget_; }
+
+	// ĵ±(, ԭ˳): ÿȡǰbudget/, ǿ
+	void Select(const vector<Point2f>& points, const vector<float>& response, Size size,
+		vector<int>& keep) const;
+	void Select(const vector<KeyPoint>& keypoints, Size size, vector<int>& keep) const;
+
+	// ݱ֡ļֵ(ӦԽԽǿ), һֵ֡, ڳʼֵ[1/4, 256]
+	double Adapt(double thresh, int detected);
+	// ֵ´initʼ
+	void Restart(double init){ init_ = init; }
+
+private:
+	int		budget_;
+	int		cols_, rows_;
+	float	overshoot_;
+	double	init_;
+};
+
+}
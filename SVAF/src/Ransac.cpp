@@ -0,0 +1,472 @@
+/*
+Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
+³ģ͹: PROSAC, SPRTǰܾ, ̲֤߳
+*/
+
+#include "Ransac.h"
+#include <glog/logging.h>
+#include <xmmintrin.h>
+#include <algorithm>
+
+namespace svaf{
+
+static const int BATCH = 64;		// ÿֲ֤, ̶Ա֤߳޹
+static const double EPS0 = 0.1;		// ڵʳʼ
+static const double DELTA0 = 0.01;	// ģ֧ʳʼ
+static const double SPRT_TM = 200;	// һģ͵ĺʱ(֤һΪλ)
+
+static const int POP4[16] = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 };
+
+// 4ӦĲвƽ
+template<int MODEL>
+static inline __m128 Residual(const __m128* f, __m128 x0, __m128 y0, __m128 x1, __m128 y1){
+	if (MODEL == RANSAC_HOMOGRAPHY){
+		// ת
+		__m128 u = _mm_add_ps(_mm_add_ps(_mm_mul_ps(f[0], x0), _mm_mul_ps(f[1], y0)), f[2]);
+		__m128 v = _mm_add_ps(_mm_add_ps(_mm_mul_ps(f[3], x0), _mm_mul_ps(f[4], y0)), f[5]);
+		__m128 w = _mm_add_ps(_mm_add_ps(_mm_mul_ps(f[6], x0), _mm_mul_ps(f[7], y0)), f[8]);
+		__m128 dx = _mm_sub_ps(_mm_div_ps(u, w), x1);
+		__m128 dy = _mm_sub_ps(_mm_div_ps(v, w), y1);
+		return _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+	} else if (MODEL == RANSAC_DISPARITY){
+		__m128 d = _mm_sub_ps(y1, _mm_add_ps(_mm_mul_ps(f[0], y0), f[1]));
+		return _mm_mul_ps(d, d);
+	} else{
+		// Sampson
+		__m128 a = _mm_add_ps(_mm_add_ps(_mm_mul_ps(f[0], x0), _mm_mul_ps(f[1], y0)), f[2]);
+		__m128 b = _mm_add_ps(_mm_add_ps(_mm_mul_ps(f[3], x0), _mm_mul_ps(f[4], y0)), f[5]);
+		__m128 c = _mm_add_ps(_mm_add_ps(_mm_mul_ps(f[6], x0), _mm_mul_ps(f[7], y0)), f[8]);
+		__m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(f[0], x1), _mm_mul_ps(f[3], y1)), f[6]);
+		__m128 e = _mm_add_ps(_mm_add_ps(_mm_mul_ps(f[1], x1), _mm_mul_ps(f[4], y1)), f[7]);
+		__m128 num = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x1, a), _mm_mul_ps(y1, b)), c);
+		__m128 den = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, a), _mm_mul_ps(b, b)),
+			_mm_add_ps(_mm_mul_ps(d, d), _mm_mul_ps(e, e)));
+		return _mm_div_ps(_mm_mul_ps(num, num), den);
+	}
+}
+
+// ͳڵ, lamǿʱÿ4һSPRT, ȻȳAܾ(*tested < n)
+template<int MODEL>
+static int VerifyT(const double* m, const float* X0, const float* Y0, const float* X1, const float* Y1,
+	int n, float thr2, const double* lam, double A, int* tested, uchar* mask){
+	__m128 f[9];
+	for (int k = 0; k < 9; ++k){
+		f[k] = _mm_set1_ps((float)m[k]);
+	}
+	const __m128 vt = _mm_set1_ps(thr2);
+	double lambda = 1.0;
+	int count = 0;
+	for (int k = 0; k < n; k += 4){
+		__m128 r = Residual<MODEL>(f, _mm_loadu_ps(X0 + k), _mm_loadu_ps(Y0 + k), _mm_loadu_ps(X1 + k), _mm_loadu_ps(Y1 + k));
+		int bits = _mm_movemask_ps(_mm_cmplt_ps(r, vt));
+		if (k + 4 > n){
+			bits &= (1 << (n - k)) - 1;
+		}
+		count += POP4[bits];
+		if (mask){
+			for (int j = 0; j < 4 && k + j < n; ++j){
+				mask[k + j] = (bits >> j) & 1;
+			}
+		}
+		if (lam && k + 4 <= n){
+			lambda *= lam[POP4[bits]];
+			if (lambda > A){
+				*tested = k + 4;
+				return count;
+			}
+		}
+	}
+	*tested = n;
+	return count;
+}
+
+// SPRTоֵ, Chum & Matas 2008
+static double SprtThreshold(double eps, double delta, double ms){
+	double C = (1 - delta) * log((1 - delta) / (1 - eps)) + delta * log(delta / eps);
+	double K = SPRT_TM * C / ms + 1;
+	double A = K;
+	for (int i = 0; i < 10; ++i){
+		A = K + log(A);
+	}
+	return A;
+}
+
+// Ƿ()
+static inline bool Collinear(const Point2f& a, const Point2f& b, const Point2f& c){
+	float cross = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+	return fabs(cross) < 1e-5f;
+}
+
+// ͶӰΪʾ: ֵ(s, s, 0)
+static void EssentialProject(double* m){
+	Mat F(3, 3, CV_64F, m);
+	SVD svd(F);
+	double s = (svd.w.at<double>(0) + svd.w.at<double>(1)) * 0.5;
+	Mat E = svd.u * Mat::diag((Mat_<double>(3, 1) << s, s, 0)) * svd.vt;
+	E.copyTo(F);
+}
+
+Ransac::Ransac() : model_(RANSAC_HOMOGRAPHY), m_(4), n_(0), thr2_(0), iters_(0),
+	s0_(1), s1_(1), subset_(0), t_(0)
+{
+}
+
+// һ(ƽsqrt(2)), ˳ʹ˳֤ȼ֤
+void Ransac::Setup(const vector<Point2f>& src, const vector<Point2f>& dst, const vector<float>& score, bool prosac){
+	n_ = (int)src.size();
+	RNG rng(0x2545F491u);
+	perm_.resize(n_);
+	for (int i = 0; i < n_; ++i){
+		perm_[i] = i;
+	}
+	for (int i = n_ - 1; i > 0; --i){
+		swap(perm_[i], perm_[rng.uniform(0, i + 1)]);
+	}
+
+	c0_ = c1_ = Point2d(0, 0);
+	s0_ = s1_ = 1.0;
+	if (model_ != RANSAC_ESSENTIAL){
+		for (int i = 0; i < n_; ++i){
+			c0_ += Point2d(src[i].x, src[i].y);
+			c1_ += Point2d(dst[i].x, dst[i].y);
+		}
+		c0_ *= 1.0 / n_;
+		c1_ *= 1.0 / n_;
+		double d0 = 0, d1 = 0;
+		for (int i = 0; i < n_; ++i){
+			d0 += norm(Point2d(src[i].x, src[i].y) - c0_);
+			d1 += norm(Point2d(dst[i].x, dst[i].y) - c1_);
+		}
+		s0_ = d0 > 0 ? sqrt(2.0) * n_ / d0 : 1.0;
+		s1_ = d1 > 0 ? sqrt(2.0) * n_ / d1 : 1.0;
+	}
+
+	const int padded = (n_ + 3) & ~3;
+	x0_.assign(padded, 0);
+	y0_.assign(padded, 0);
+	x1_.assign(padded, 0);
+	y1_.assign(padded, 0);
+	for (int k = 0; k < n_; ++k){
+		const int i = perm_[k];
+		x0_[k] = (float)(s0_ * (src[i].x - c0_.x));
+		y0_[k] = (float)(s0_ * (src[i].y - c0_.y));
+		x1_[k] = (float)(s1_ * (dst[i].x - c1_.x));
+		y1_[k] = (float)(s1_ * (dst[i].y - c1_.y));
+	}
+
+	order_.resize(n_);
+	for (int k = 0; k < n_; ++k){
+		order_[k] = k;
+	}
+	if (prosac){
+		stable_sort(order_.begin(), order_.end(), [&](int a, int b){ return score[perm_[a]] < score[perm_[b]]; });
+	}
+}
+
+// PROSAC: ǰnӼڵgrowth_[n-1]ʱ, TN = maxiters
+void Ransac::Prosac(int maxiters){
+	growth_.assign(n_, 0);
+	double Tn = maxiters;
+	for (int i = 0; i < m_; ++i){
+		Tn *= (double)(m_ - i) / (n_ - i);
+	}
+	int Tn1 = 1;
+	growth_[m_ - 1] = 1;
+	for (int k = m_ + 1; k <= n_; ++k){
+		double Tnext = Tn * k / (k - m_);
+		Tn1 += (int)ceil(Tnext - Tn);
+		Tn = Tnext;
+		growth_[k - 1] = Tn1;
+	}
+	subset_ = m_;
+	t_ = 0;
+}
+
+// һС(Һλ)
+void Ransac::Sample(RNG& rng, int* sample){
+	int range = n_;
+	int fixed = 0;
+	if (!growth_.empty()){
+		t_++;
+		if (t_ > growth_[subset_ - 1] && subset_ < n_){
+			subset_++;
+		}
+		range = subset_;
+		if (growth_[subset_ - 1] >= t_){
+			// m-1ȡǰsubset_-1, ϵsubset_
+			range = subset_ - 1;
+			sample[0] = order_[subset_ - 1];
+			fixed = 1;
+		}
+	}
+	for (int j = fixed; j < m_; ++j){
+		int p;
+		bool dup;
+		do{
+			p = order_[rng.uniform(0, range)];
+			dup = false;
+			for (int i = 0; i < j; ++i){
+				dup |= (sample[i] == p);
+			}
+		} while (dup);
+		sample[j] = p;
+	}
+}
+
+// Сģ, ؽĸ(ߵ㷨3)
+int Ransac::Solve(const int* sample, double models[][9]) const{
+	Point2f a[7], b[7];
+	for (int j = 0; j < m_; ++j){
+		a[j] = Point2f(x0_[sample[j]], y0_[sample[j]]);
+		b[j] = Point2f(x1_[sample[j]], y1_[sample[j]]);
+	}
+
+	if (model_ == RANSAC_HOMOGRAPHY){
+		for (int i = 0; i < 4; ++i){
+			if (Collinear(a[(i + 1) % 4], a[(i + 2) % 4], a[(i + 3) % 4]) ||
+				Collinear(b[(i + 1) % 4], b[(i + 2) % 4], b[(i + 3) % 4])){
+				return 0;
+			}
+		}
+		Mat H = getPerspectiveTransform(a, b);
+		if (H.empty()){
+			return 0;
+		}
+		memcpy(models[0], H.ptr<double>(0), 9 * sizeof(double));
+		return 1;
+	} else if (model_ == RANSAC_DISPARITY){
+		double dy = a[1].y - a[0].y;
+		if (fabs(dy) < 1e-6){
+			return 0;
+		}
+		models[0][0] = (b[1].y - b[0].y) / dy;
+		models[0][1] = b[0].y - models[0][0] * a[0].y;
+		return 1;
+	}
+
+	Mat F = findFundamentalMat(Mat(7, 1, CV_32FC2, a), Mat(7, 1, CV_32FC2, b), CV_FM_7POINT);
+	int count = F.rows / 3;
+	for (int s = 0; s < count; ++s){
+		memcpy(models[s], F.ptr<double>(s * 3), 9 * sizeof(double));
+		if (model_ == RANSAC_ESSENTIAL){
+			EssentialProject(models[s]);
+		}
+	}
+	return count;
+}
+
+// ȫڵС, ʧܷ0
+int Ransac::Refine(const vector<int>& inliers, double* m) const{
+	const int k = (int)inliers.size();
+	if (model_ == RANSAC_DISPARITY){
+		double sy0 = 0, sy1 = 0, syy = 0, sxy = 0;
+		for (int i = 0; i < k; ++i){
+			double y0 = y0_[inliers[i]], y1 = y1_[inliers[i]];
+			sy0 += y0;
+			sy1 += y1;
+			syy += y0 * y0;
+			sxy += y0 * y1;
+		}
+		double var = syy - sy0 * sy0 / k;
+		if (k < 2 || var < 1e-9){
+			return 0;
+		}
+		m[0] = (sxy - sy0 * sy1 / k) / var;
+		m[1] = (sy1 - m[0] * sy0) / k;
+		return 1;
+	}
+
+	vector<Point2f> a(k), b(k);
+	for (int i = 0; i < k; ++i){
+		a[i] = Point2f(x0_[inliers[i]], y0_[inliers[i]]);
+		b[i] = Point2f(x1_[inliers[i]], y1_[inliers[i]]);
+	}
+	Mat M;
+	if (model_ == RANSAC_HOMOGRAPHY){
+		if (k < 4){
+			return 0;
+		}
+		M = findHomography(a, b, 0);
+	} else{
+		if (k < 8){
+			return 0;
+		}
+		M = findFundamentalMat(a, b, CV_FM_8POINT);
+	}
+	if (M.rows != 3 || M.cols != 3){
+		return 0;
+	}
+	memcpy(m, M.ptr<double>(0), 9 * sizeof(double));
+	if (model_ == RANSAC_ESSENTIAL){
+		EssentialProject(m);
+	}
+	return 1;
+}
+
+int Ransac::Verify(const double* m, const double* lam, double A, int* tested, uchar* mask) const{
+	const float *X0 = &x0_[0], *Y0 = &y0_[0], *X1 = &x1_[0], *Y1 = &y1_[0];
+	switch (model_){
+	case RANSAC_HOMOGRAPHY:
+		return VerifyT<RANSAC_HOMOGRAPHY>(m, X0, Y0, X1, Y1, n_, thr2_, lam, A, tested, mask);
+	case RANSAC_DISPARITY:
+		return VerifyT<RANSAC_DISPARITY>(m, X0, Y0, X1, Y1, n_, thr2_, lam, A, tested, mask);
+	default:
+		return VerifyT<RANSAC_FUNDAMENTAL>(m, X0, Y0, X1, Y1, n_, thr2_, lam, A, tested, mask);
+	}
+}
+
+// 任: p' = T * p, T = [s 0 -s*cx; 0 s -s*cy; 0 0 1]
+void Ransac::Denormalize(const double* m, Mat& model) const{
+	if (model_ == RANSAC_DISPARITY){
+		double a = m[0] * s0_ / s1_;
+		double b = m[1] / s1_ + c1_.y - a * c0_.y;
+		model = (Mat_<double>(1, 2) << a, b);
+		return;
+	}
+	Mat T0 = (Mat_<double>(3, 3) << s0_, 0, -s0_ * c0_.x, 0, s0_, -s0_ * c0_.y, 0, 0, 1);
+	Mat T1 = (Mat_<double>(3, 3) << s1_, 0, -s1_ * c1_.x, 0, s1_, -s1_ * c1_.y, 0, 0, 1);
+	Mat M(3, 3, CV_64F, (void*)m);
+	if (model_ == RANSAC_HOMOGRAPHY){
+		model = T1.inv() * M * T0;
+		if (fabs(model.at<double>(2, 2)) > DBL_EPSILON){
+			model /= model.at<double>(2, 2);
+		}
+	} else{
+		model = T1.t() * M * T0;
+		model /= norm(model);
+	}
+}
+
+int Ransac::Run(const vector<Point2f>& src, const vector<Point2f>& dst, const vector<float>& score,
+	const RansacOption& opt, Mat& model, vector<uchar>& mask){
+	CHECK_EQ(src.size(), dst.size()) << "Ransac Point Count Not Match!";
+	const int n = (int)src.size();
+	model_ = opt.model;
+	m_ = (model_ == RANSAC_HOMOGRAPHY) ? 4 : (model_ == RANSAC_DISPARITY ? 2 : 7);
+	iters_ = 0;
+	mask.assign(n, 0);
+	model.release();
+	growth_.clear();
+	if (n < m_){
+		return 0;
+	}
+
+	const bool prosac = opt.prosac && score.size() == n;
+	Setup(src, dst, score, prosac);
+	double thr = opt.thresh;
+	if (model_ == RANSAC_HOMOGRAPHY || model_ == RANSAC_DISPARITY){
+		thr *= s1_;
+	} else if (model_ == RANSAC_FUNDAMENTAL){
+		thr *= sqrt(s0_ * s1_);
+	}
+	thr2_ = (float)(thr * thr);
+	if (prosac){
+		Prosac(max(opt.maxiters, 1));
+	}
+
+	RNG rng(0x9E3779B9u);
+	const double ms = (m_ == 7) ? 2.0 : 1.0;	// ÿƽ
+	double eps = EPS0, delta = DELTA0;
+	double A = SprtThreshold(eps, delta, ms);
+	double lam[5];
+	double best[9] = { 0 };
+	int bestcount = 0;
+	double rejectsum = 0;
+	int rejectcnt = 0;
+	int needed = max(opt.maxiters, 1);
+
+	vector<int> samples(BATCH * m_);
+	vector<double> hyp(BATCH * 3 * 9);
+	vector<int> hn(BATCH), hcount(BATCH * 3), htested(BATCH * 3);
+	const int64 start = getTickCount();
+	const double tickms = getTickFrequency() / 1000.0;
+
+	while (iters_ < needed){
+		const int nb = min(BATCH, needed - iters_);
+		for (int h = 0; h < nb; ++h){
+			Sample(rng, &samples[h * m_]);
+		}
+		const bool sprt = opt.sprt && eps > delta;
+		for (int k = 0; k <= 4; ++k){
+			lam[k] = pow(delta / eps, k) * pow((1 - delta) / (1 - eps), 4 - k);
+		}
+
+		// ֤
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+		for (int h = 0; h < nb; ++h){
+			double (*models)[9] = (double (*)[9])&hyp[h * 27];
+			hn[h] = Solve(&samples[h * m_], models);
+			for (int s = 0; s < hn[h]; ++s){
+				hcount[h * 3 + s] = Verify(models[s], sprt ? lam : NULL, A, &htested[h * 3 + s], NULL);
+			}
+		}
+
+		// ˳Լ, ߳޹
+		for (int h = 0; h < nb; ++h){
+			for (int s = 0; s < hn[h]; ++s){
+				const int c = hcount[h * 3 + s];
+				if (htested[h * 3 + s] < n_){
+					rejectsum += (double)c / htested[h * 3 + s];
+					rejectcnt++;
+				} else if (c > bestcount){
+					bestcount = c;
+					memcpy(best, &hyp[(h * 3 + s) * 9], 9 * sizeof(double));
+				}
+			}
+		}
+		iters_ += nb;
+
+		// ڵ/ģ֧, Ӧֹ
+		if (bestcount > 0){
+			eps = max((double)bestcount / n_, EPS0 * 0.1);
+			double p = pow(eps, m_);
+			if (opt.sprt && eps > delta){
+				p *= 1.0 - 1.0 / A;		// ģͱSPRTܵĸΪ1/A
+			}
+			if (p >= 1.0){
+				needed = iters_;
+			} else if (p > DBL_EPSILON){
+				double k = log(1.0 - opt.confidence) / log(1.0 - p);
+				needed = (int)min((double)opt.maxiters, ceil(k));
+			}
+		}
+		if (rejectcnt > 0){
+			delta = min(max(rejectsum / rejectcnt, 1e-4), 0.5);
+		}
+		if (eps > delta){
+			A = SprtThreshold(eps, delta, ms);
+		}
+		if (opt.budget > 0 && (getTickCount() - start) / tickms > opt.budget){
+			break;
+		}
+	}
+
+	if (bestcount < m_){
+		return 0;
+	}
+
+	// ڵ, ڵ㲻ʱ
+	vector<uchar> smask(n_);
+	int tested;
+	Verify(best, NULL, 0, &tested, &smask[0]);
+	vector<int> inliers;
+	for (int k = 0; k < n_; ++k){
+		if (smask[k]){
+			inliers.push_back(k);
+		}
+	}
+	double refined[9];
+	if (Refine(inliers, refined) && Verify(refined, NULL, 0, &tested, NULL) >= bestcount){
+		memcpy(best, refined, sizeof(best));
+	}
+	bestcount = Verify(best, NULL, 0, &tested, &smask[0]);
+	for (int k = 0; k < n_; ++k){
+		mask[perm_[k]] = smask[k];
+	}
+	Denormalize(best, model);
+	return bestcount;
+}
+
+}
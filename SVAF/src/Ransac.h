@@ -0,0 +1,75 @@
+/*
+Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
+³ģ͹: PROSAC, SPRTǰܾ, ̲֤߳
+*/
+
+#pragma once
+
+#include <opencv2\opencv.hpp>
+#include <vector>
+
+using namespace std;
+using namespace cv;
+
+namespace svaf{
+
+// ģ, Ӧ dst ~ model(src)
+typedef enum _RansacModel{
+	RANSAC_HOMOGRAPHY = 0,	// dst ~ H * src, 4
+	RANSAC_FUNDAMENTAL,		// dst' * F * src = 0, 7
+	RANSAC_ESSENTIAL,		// ͬ, Ϊһ, 7ͶӰΪʾ
+	RANSAC_DISPARITY		// ˫Ŀ(һά): y_dst = a * y_src + b, 2
+} RansacModel;
+
+typedef struct _RansacOption{
+	RansacModel	model;
+	float		thresh;		// вֵ(, ʾΪһ)
+	float		confidence;	// ӦֹŶ
+	int			maxiters;	// 
+	float		budget;		// ʱ(), <= 0ʱ
+	bool		prosac;		// score(ԽСԽɿ)
+	bool		sprt;		// ʱȼ, ǰܾ
+	_RansacOption() : model(RANSAC_HOMOGRAPHY), thresh(3.0f), confidence(0.995f), maxiters(2000),
+		budget(0), prosac(true), sprt(true){}
+} RansacOption;
+
+class Ransac
+{
+public:
+	Ransac();
+
+	// ڵ, modelΪ3x3(ӲģΪ1x2 [a b])CV_64F, maskͬ; ʧܷ0
+	int Run(const vector<Point2f>& src, const vector<Point2f>& dst, const vector<float>& score,
+		const RansacOption& opt, Mat& model, vector<uchar>& mask);
+	// ϴɵļ
+	int Iterations() const { return iters_; }
+
+private:
+	void Setup(const vector<Point2f>& src, const vector<Point2f>& dst, const vector<float>& score, bool prosac);
+	void Prosac(int maxiters);
+	void Sample(RNG& rng, int* sample);
+	int Solve(const int* sample, double models[][9]) const;
+	int Refine(const vector<int>& inliers, double* m) const;
+	int Verify(const double* m, const double* lam, double A, int* tested, uchar* mask) const;
+	void Denormalize(const double* m, Mat& model) const;
+
+	RansacModel	model_;
+	int			m_;			// С
+	int			n_;			// Ӧ
+	float		thr2_;		// һµֵƽ
+	int			iters_;
+
+	// һ(˳)ĶӦ, SoA4
+	vector<float>	x0_, y0_, x1_, y1_;
+	vector<int>		perm_;		// Һλ -> ±
+	vector<int>		order_;		// scoreĴҺλ
+	double			s0_, s1_;	// һ: p' = s * (p - c)
+	Point2d			c0_, c1_;
+
+	// PROSAC
+	vector<int>		growth_;
+	int				subset_;
+	int				t_;
+};
+
+}
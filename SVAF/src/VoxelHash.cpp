@@ -0,0 +1,66 @@
+/*
+Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
+ʽؽ: Ѱַɢ, ÿر
+*/
+
+#include "VoxelHash.h"
+
+namespace svaf{
+
+static const unsigned int VOXEL_INIT_SIZE = 1 << 12;
+
+// 캯
+VoxelHash::VoxelHash() : leaf_(0), inv_(0), mask_(VOXEL_INIT_SIZE - 1)
+{
+	Slot empty = { 0, 0, 0, 0, 0, 0, 0 };
+	table_.assign(VOXEL_INIT_SIZE, empty);
+}
+
+// ֻùĲ, ֡
+void VoxelHash::Reset(float leaf){
+	for (size_t k = 0; k < used_.size(); ++k){
+		table_[used_[k]].n = 0;
+	}
+	used_.clear();
+	leaf_ = leaf > 0 ? leaf : 0;
+	inv_ = leaf > 0 ? 1.0f / leaf : 0;
+}
+
+// ӱɢ, ״γֵ˳
+void VoxelHash::Grow(){
+	vector<Slot> old;
+	old.swap(table_);
+	vector<unsigned int> order;
+	order.swap(used_);
+
+	Slot empty = { 0, 0, 0, 0, 0, 0, 0 };
+	table_.assign(old.size() * 2, empty);
+	mask_ = (unsigned int)table_.size() - 1;
+	used_.reserve(order.size());
+	for (size_t k = 0; k < order.size(); ++k){
+		const Slot& s = old[order[k]];
+		unsigned int i = Hash(s.kx, s.ky, s.kz) & mask_;
+		while (table_[i].n != 0){
+			i = (i + 1) & mask_;
+		}
+		table_[i] = s;
+		used_.push_back(i);
+	}
+}
+
+// ״γֵ˳
+void VoxelHash::Export(vector<float>& x, vector<float>& y, vector<float>& z) const{
+	if (x.size() < used_.size()){
+		x.resize(used_.size());
+		y.resize(used_.size());
+		z.resize(used_.size());
+	}
+	for (size_t k = 0; k < used_.size(); ++k){
+		const Slot& s = table_[used_[k]];
+		x[k] = s.x;
+		y[k] = s.y;
+		z[k] = s.z;
+	}
+}
+
+}
@@ -0,0 +1,82 @@
+/*
+Stereo Vision Algorithm Framework, Copyright(c) 2016-2018, Peng Chao
+ʽؽ: Ѱַɢ, ÿر
+*/
+
+#pragma once
+
+#include <opencv2\opencv.hpp>
+#include <vector>
+#include <math.h>
+
+using namespace std;
+using namespace cv;
+
+namespace svaf{
+
+class VoxelHash
+{
+public:
+	VoxelHash();
+
+	// ر߳, leaf <= 0 ʾ
+	void Reset(float leaf);
+	bool Enabled() const { return leaf_ > 0; }
+	float Leaf() const { return leaf_; }
+	int Count() const { return (int)used_.size(); }
+
+	// һ, ص; ֵ±곬intΧĵ㶪
+	inline void Add(float x, float y, float z){
+		const float fx = x * inv_, fy = y * inv_, fz = z * inv_;
+		// NaNıȽϽΪ, infֵתintΪδΪ
+		if (!(fabs(fx) < 2.0e9f && fabs(fy) < 2.0e9f && fabs(fz) < 2.0e9f)){
+			return;
+		}
+		int kx = (int)floor(fx);
+		int ky = (int)floor(fy);
+		int kz = (int)floor(fz);
+		unsigned int i = Hash(kx, ky, kz) & mask_;
+		for (;;){
+			Slot& s = table_[i];
+			if (s.n == 0){
+				s.kx = kx; s.ky = ky; s.kz = kz;
+				s.n = 1;
+				s.x = x; s.y = y; s.z = z;
+				used_.push_back(i);
+				if (used_.size() * 2 > table_.size()){
+					Grow();
+				}
+				return;
+			}
+			if (s.kx == kx && s.ky == ky && s.kz == kz){
+				float w = 1.0f / ++s.n;
+				s.x += (x - s.x) * w;
+				s.y += (y - s.y) * w;
+				s.z += (z - s.z) * w;
+				return;
+			}
+			i = (i + 1) & mask_;
+		}
+	}
+
+	// ״γֵ˳(SoA), ֻ, ǰCount()Ч
+	void Export(vector<float>& x, vector<float>& y, vector<float>& z) const;
+
+private:
+	struct Slot{
+		int		kx, ky, kz;
+		int		n;			// , 0Ϊ
+		float	x, y, z;	// 
+	};
+	static inline unsigned int Hash(int kx, int ky, int kz){
+		return ((unsigned int)kx * 73856093u) ^ ((unsigned int)ky * 19349663u) ^ ((unsigned int)kz * 83492791u);
+	}
+	void Grow();
+
+	float			leaf_, inv_;
+	unsigned int	mask_;
+	vector<Slot>	table_;		// Ϊ2, װʲ1/2
+	vector<unsigned int> used_;	// ռõĲ, 
+};
+
+}
@@ -0,0 +1,50 @@
+function calib2yml(matfile, ymlfile)
+% CALIB2YML  Export Camera Calibration Toolbox results to an OpenCV yml file.
+%   calib2yml('Calib_Results_stereo.mat') writes Calib_Results_stereo.yml next
+%   to the .mat file; calib2yml(matfile, ymlfile) chooses the output name.
+%   Svaf reads the yml with cv::FileStorage using the toolbox variable names
+%   (om, T, fc/cc/kc/alpha_c_left/right, with or without _new), so TRIANG and
+%   RANSAC configs that still name the .mat load the converted file instead.
+
+if nargin < 2
+    [p, n] = fileparts(matfile);
+    ymlfile = fullfile(p, [n '.yml']);
+end
+
+S = load(matfile);
+names = {'om', 'T', 'fc_left', 'cc_left', 'kc_left', 'alpha_c_left', ...
+    'fc_right', 'cc_right', 'kc_right', 'alpha_c_right', 'nx', 'ny'};
+suffixes = {'', '_new'};
+
+fid = fopen(ymlfile, 'w');
+if fid < 0
+    error('calib2yml: cannot write %s', ymlfile);
+end
+fprintf(fid, '%%YAML:1.0\n');
+count = 0;
+for k = 1:numel(names)
+    for s = 1:numel(suffixes)
+        name = [names{k} suffixes{s}];
+        if ~isfield(S, name)
+            continue;
+        end
+        v = double(S.(name));
+        if isempty(v)
+            continue;
+        end
+        if isscalar(v)
+            fprintf(fid, '%s: %.17g\n', name, v);
+        else
+            % opencv-matrix data is row-major
+            data = v.';
+            fprintf(fid, '%s: !!opencv-matrix\n   rows: %d\n   cols: %d\n   dt: d\n   data: [ ', ...
+                name, size(v, 1), size(v, 2));
+            fprintf(fid, '%.17g, ', data(1:end-1));
+            fprintf(fid, '%.17g ]\n', data(end));
+        end
+        count = count + 1;
+    end
+end
+fclose(fid);
+fprintf('%s: %d variables -> %s\n', matfile, count, ymlfile);
+end
@@ -109,6 +109,9 @@ const ::google::protobuf::internal::GeneratedMessageReflection*
 const ::google::protobuf::Descriptor* SURFPointParameter_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   SURFPointParameter_reflection_ = NULL;
+const ::google::protobuf::Descriptor* PointBudgetParameter_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  PointBudgetParameter_reflection_ = NULL;
 const ::google::protobuf::Descriptor* STARPointParameter_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   STARPointParameter_reflection_ = NULL;
@@ -218,6 +221,7 @@ const ::google::protobuf::internal::GeneratedMessageReflection*
 const ::google::protobuf::Descriptor* RansacParameter_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   RansacParameter_reflection_ = NULL;
+const ::google::protobuf::EnumDescriptor* RansacParameter_ModelType_descriptor_ = NULL;
 const ::google::protobuf::Descriptor* BruteForceMatchParameter_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   BruteForceMatchParameter_reflection_ = NULL;
@@ -246,6 +250,9 @@ const ::google::protobuf::internal::GeneratedMessageReflection*
 const ::google::protobuf::Descriptor* TriangularParameter_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   TriangularParameter_reflection_ = NULL;
+const ::google::protobuf::Descriptor* ReprojectParameter_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  ReprojectParameter_reflection_ = NULL;
 const ::google::protobuf::Descriptor* MatrixMulParameter_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   MatrixMulParameter_reflection_ = NULL;
@@ -255,6 +262,9 @@ const ::google::protobuf::internal::GeneratedMessageReflection*
 const ::google::protobuf::Descriptor* CenterPointParameter_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   CenterPointParameter_reflection_ = NULL;
+const ::google::protobuf::Descriptor* FeaturePoolParameter_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  FeaturePoolParameter_reflection_ = NULL;
 const ::google::protobuf::Descriptor* CoordiParameter_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   CoordiParameter_reflection_ = NULL;
@@ -384,8 +394,10 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(StereoOperationParameter));
   StereoRectifyParameter_descriptor_ = file->message_type(6);
-  static const int StereoRectifyParameter_offsets_[1] = {
+  static const int StereoRectifyParameter_offsets_[3] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StereoRectifyParameter, filename_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StereoRectifyParameter, calib_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StereoRectifyParameter, cache_dir_),
   };
   StereoRectifyParameter_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -753,11 +765,12 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(SIFTPointParameter));
   SURFPointParameter_descriptor_ = file->message_type(28);
-  static const int SURFPointParameter_offsets_[4] = {
+  static const int SURFPointParameter_offsets_[5] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SURFPointParameter, stride_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SURFPointParameter, octaves_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SURFPointParameter, intervals_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SURFPointParameter, thresh_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SURFPointParameter, budget_param_),
   };
   SURFPointParameter_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -770,7 +783,26 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(SURFPointParameter));
-  STARPointParameter_descriptor_ = file->message_type(29);
+  PointBudgetParameter_descriptor_ = file->message_type(29);
+  static const int PointBudgetParameter_offsets_[5] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PointBudgetParameter, budget_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PointBudgetParameter, grid_cols_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PointBudgetParameter, grid_rows_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PointBudgetParameter, adaptive_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PointBudgetParameter, overshoot_),
+  };
+  PointBudgetParameter_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      PointBudgetParameter_descriptor_,
+      PointBudgetParameter::default_instance_,
+      PointBudgetParameter_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PointBudgetParameter, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PointBudgetParameter, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(PointBudgetParameter));
+  STARPointParameter_descriptor_ = file->message_type(30);
   static const int STARPointParameter_offsets_[1] = {
   };
   STARPointParameter_reflection_ =
@@ -784,7 +816,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(STARPointParameter));
-  BRISKPointParameter_descriptor_ = file->message_type(30);
+  BRISKPointParameter_descriptor_ = file->message_type(31);
   static const int BRISKPointParameter_offsets_[1] = {
   };
   BRISKPointParameter_reflection_ =
@@ -798,7 +830,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(BRISKPointParameter));
-  FASTPointParameter_descriptor_ = file->message_type(31);
+  FASTPointParameter_descriptor_ = file->message_type(32);
   static const int FASTPointParameter_offsets_[2] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FASTPointParameter, thresh_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FASTPointParameter, nms_),
@@ -814,7 +846,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(FASTPointParameter));
-  ORBPointParameter_descriptor_ = file->message_type(32);
+  ORBPointParameter_descriptor_ = file->message_type(33);
   static const int ORBPointParameter_offsets_[1] = {
   };
   ORBPointParameter_reflection_ =
@@ -828,7 +860,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(ORBPointParameter));
-  KAZEPointParameter_descriptor_ = file->message_type(33);
+  KAZEPointParameter_descriptor_ = file->message_type(34);
   static const int KAZEPointParameter_offsets_[1] = {
   };
   KAZEPointParameter_reflection_ =
@@ -842,7 +874,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(KAZEPointParameter));
-  HarrisPointParameter_descriptor_ = file->message_type(34);
+  HarrisPointParameter_descriptor_ = file->message_type(35);
   static const int HarrisPointParameter_offsets_[1] = {
   };
   HarrisPointParameter_reflection_ =
@@ -856,7 +888,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(HarrisPointParameter));
-  FastParamCP_descriptor_ = file->message_type(35);
+  FastParamCP_descriptor_ = file->message_type(36);
   static const int FastParamCP_offsets_[3] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FastParamCP, thresh_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FastParamCP, isnms_),
@@ -874,7 +906,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(FastParamCP));
   FastParamCP_FastType_descriptor_ = FastParamCP_descriptor_->enum_type(0);
-  MSERParamCP_descriptor_ = file->message_type(36);
+  MSERParamCP_descriptor_ = file->message_type(37);
   static const int MSERParamCP_offsets_[9] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MSERParamCP, delta_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MSERParamCP, min_area_),
@@ -897,7 +929,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(MSERParamCP));
-  ORBParamCP_descriptor_ = file->message_type(37);
+  ORBParamCP_descriptor_ = file->message_type(38);
   static const int ORBParamCP_offsets_[8] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ORBParamCP, nfeatures_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ORBParamCP, scalefactor_),
@@ -920,7 +952,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(ORBParamCP));
   ORBParamCP_OBRScoreType_descriptor_ = ORBParamCP_descriptor_->enum_type(0);
-  BriskParamCP_descriptor_ = file->message_type(38);
+  BriskParamCP_descriptor_ = file->message_type(39);
   static const int BriskParamCP_offsets_[3] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BriskParamCP, thresh_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BriskParamCP, octaves_),
@@ -937,7 +969,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(BriskParamCP));
-  FreakParamCP_descriptor_ = file->message_type(39);
+  FreakParamCP_descriptor_ = file->message_type(40);
   static const int FreakParamCP_offsets_[4] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FreakParamCP, orientnorm_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FreakParamCP, scalenorm_),
@@ -955,7 +987,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(FreakParamCP));
-  StarParamCP_descriptor_ = file->message_type(40);
+  StarParamCP_descriptor_ = file->message_type(41);
   static const int StarParamCP_offsets_[5] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StarParamCP, maxsize_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StarParamCP, response_thresh_),
@@ -974,7 +1006,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(StarParamCP));
-  SiftParamCP_descriptor_ = file->message_type(41);
+  SiftParamCP_descriptor_ = file->message_type(42);
   static const int SiftParamCP_offsets_[5] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SiftParamCP, nfeatures_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SiftParamCP, octaves_),
@@ -993,7 +1025,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(SiftParamCP));
-  SurfParamCP_descriptor_ = file->message_type(42);
+  SurfParamCP_descriptor_ = file->message_type(43);
   static const int SurfParamCP_offsets_[5] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SurfParamCP, hassian_thresh_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SurfParamCP, octaves_),
@@ -1012,7 +1044,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(SurfParamCP));
-  GFTTParamCP_descriptor_ = file->message_type(43);
+  GFTTParamCP_descriptor_ = file->message_type(44);
   static const int GFTTParamCP_offsets_[6] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GFTTParamCP, maxcornners_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GFTTParamCP, quality_),
@@ -1032,7 +1064,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(GFTTParamCP));
-  HarrisParamCP_descriptor_ = file->message_type(44);
+  HarrisParamCP_descriptor_ = file->message_type(45);
   static const int HarrisParamCP_offsets_[5] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HarrisParamCP, maxcornners_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HarrisParamCP, quality_),
@@ -1051,7 +1083,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(HarrisParamCP));
-  DenseParamCP_descriptor_ = file->message_type(45);
+  DenseParamCP_descriptor_ = file->message_type(46);
   static const int DenseParamCP_offsets_[7] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DenseParamCP, initfeatscale_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DenseParamCP, featscalelevel_),
@@ -1072,7 +1104,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(DenseParamCP));
-  SimpleBlobParamCP_descriptor_ = file->message_type(46);
+  SimpleBlobParamCP_descriptor_ = file->message_type(47);
   static const int SimpleBlobParamCP_offsets_[1] = {
   };
   SimpleBlobParamCP_reflection_ =
@@ -1086,7 +1118,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(SimpleBlobParamCP));
-  AkazeParamCP_descriptor_ = file->message_type(47);
+  AkazeParamCP_descriptor_ = file->message_type(48);
   static const int AkazeParamCP_offsets_[1] = {
   };
   AkazeParamCP_reflection_ =
@@ -1100,8 +1132,8 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(AkazeParamCP));
-  CVPointParameter_descriptor_ = file->message_type(48);
-  static const int CVPointParameter_offsets_[15] = {
+  CVPointParameter_descriptor_ = file->message_type(49);
+  static const int CVPointParameter_offsets_[16] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CVPointParameter, type_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CVPointParameter, isadd_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CVPointParameter, fast_param_),
@@ -1117,6 +1149,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CVPointParameter, dense_param_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CVPointParameter, sb_param_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CVPointParameter, akaze_param_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CVPointParameter, budget_param_),
   };
   CVPointParameter_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -1130,7 +1163,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(CVPointParameter));
   CVPointParameter_PointType_descriptor_ = CVPointParameter_descriptor_->enum_type(0);
-  FeatureDescriptorParameter_descriptor_ = file->message_type(49);
+  FeatureDescriptorParameter_descriptor_ = file->message_type(50);
   static const int FeatureDescriptorParameter_offsets_[1] = {
   };
   FeatureDescriptorParameter_reflection_ =
@@ -1144,7 +1177,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(FeatureDescriptorParameter));
-  SIFTDescriptorParameter_descriptor_ = file->message_type(50);
+  SIFTDescriptorParameter_descriptor_ = file->message_type(51);
   static const int SIFTDescriptorParameter_offsets_[1] = {
   };
   SIFTDescriptorParameter_reflection_ =
@@ -1158,7 +1191,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(SIFTDescriptorParameter));
-  SURFDescriptorParameter_descriptor_ = file->message_type(51);
+  SURFDescriptorParameter_descriptor_ = file->message_type(52);
   static const int SURFDescriptorParameter_offsets_[1] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SURFDescriptorParameter, upright_),
   };
@@ -1173,7 +1206,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(SURFDescriptorParameter));
-  STARDescriptorParameter_descriptor_ = file->message_type(52);
+  STARDescriptorParameter_descriptor_ = file->message_type(53);
   static const int STARDescriptorParameter_offsets_[1] = {
   };
   STARDescriptorParameter_reflection_ =
@@ -1187,7 +1220,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(STARDescriptorParameter));
-  BRIEFDescriptorParameter_descriptor_ = file->message_type(53);
+  BRIEFDescriptorParameter_descriptor_ = file->message_type(54);
   static const int BRIEFDescriptorParameter_offsets_[1] = {
   };
   BRIEFDescriptorParameter_reflection_ =
@@ -1201,7 +1234,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(BRIEFDescriptorParameter));
-  BRISKDescriptorParameter_descriptor_ = file->message_type(54);
+  BRISKDescriptorParameter_descriptor_ = file->message_type(55);
   static const int BRISKDescriptorParameter_offsets_[1] = {
   };
   BRISKDescriptorParameter_reflection_ =
@@ -1215,7 +1248,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(BRISKDescriptorParameter));
-  FASTDescriptorParameter_descriptor_ = file->message_type(55);
+  FASTDescriptorParameter_descriptor_ = file->message_type(56);
   static const int FASTDescriptorParameter_offsets_[1] = {
   };
   FASTDescriptorParameter_reflection_ =
@@ -1229,7 +1262,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(FASTDescriptorParameter));
-  ORBDescriptorParameter_descriptor_ = file->message_type(56);
+  ORBDescriptorParameter_descriptor_ = file->message_type(57);
   static const int ORBDescriptorParameter_offsets_[1] = {
   };
   ORBDescriptorParameter_reflection_ =
@@ -1243,7 +1276,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(ORBDescriptorParameter));
-  KAZEDescriptorParameter_descriptor_ = file->message_type(57);
+  KAZEDescriptorParameter_descriptor_ = file->message_type(58);
   static const int KAZEDescriptorParameter_offsets_[1] = {
   };
   KAZEDescriptorParameter_reflection_ =
@@ -1257,7 +1290,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(KAZEDescriptorParameter));
-  BriefDespCV_descriptor_ = file->message_type(58);
+  BriefDespCV_descriptor_ = file->message_type(59);
   static const int BriefDespCV_offsets_[1] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BriefDespCV, length_),
   };
@@ -1272,7 +1305,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(BriefDespCV));
-  CVDescriptorParameter_descriptor_ = file->message_type(59);
+  CVDescriptorParameter_descriptor_ = file->message_type(60);
   static const int CVDescriptorParameter_offsets_[2] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CVDescriptorParameter, type_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CVDescriptorParameter, brief_param_),
@@ -1289,7 +1322,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(CVDescriptorParameter));
   CVDescriptorParameter_DespType_descriptor_ = CVDescriptorParameter_descriptor_->enum_type(0);
-  VectorMatchParameter_descriptor_ = file->message_type(60);
+  VectorMatchParameter_descriptor_ = file->message_type(61);
   static const int VectorMatchParameter_offsets_[1] = {
   };
   VectorMatchParameter_reflection_ =
@@ -1303,8 +1336,13 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(VectorMatchParameter));
-  KDTreeMatchParameter_descriptor_ = file->message_type(61);
-  static const int KDTreeMatchParameter_offsets_[1] = {
+  KDTreeMatchParameter_descriptor_ = file->message_type(62);
+  static const int KDTreeMatchParameter_offsets_[5] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KDTreeMatchParameter, trees_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KDTreeMatchParameter, checks_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KDTreeMatchParameter, leafsize_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KDTreeMatchParameter, thresh_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KDTreeMatchParameter, keeptrain_),
   };
   KDTreeMatchParameter_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -1317,9 +1355,10 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(KDTreeMatchParameter));
-  EularMatchParameter_descriptor_ = file->message_type(62);
-  static const int EularMatchParameter_offsets_[1] = {
+  EularMatchParameter_descriptor_ = file->message_type(63);
+  static const int EularMatchParameter_offsets_[2] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(EularMatchParameter, thresh_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(EularMatchParameter, crosscheck_),
   };
   EularMatchParameter_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -1332,9 +1371,16 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(EularMatchParameter));
-  RansacParameter_descriptor_ = file->message_type(63);
-  static const int RansacParameter_offsets_[1] = {
+  RansacParameter_descriptor_ = file->message_type(64);
+  static const int RansacParameter_offsets_[8] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RansacParameter, thresh_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RansacParameter, model_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RansacParameter, confidence_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RansacParameter, maxiters_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RansacParameter, budget_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RansacParameter, prosac_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RansacParameter, sprt_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RansacParameter, calib_),
   };
   RansacParameter_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -1347,7 +1393,8 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(RansacParameter));
-  BruteForceMatchParameter_descriptor_ = file->message_type(64);
+  RansacParameter_ModelType_descriptor_ = RansacParameter_descriptor_->enum_type(0);
+  BruteForceMatchParameter_descriptor_ = file->message_type(65);
   static const int BruteForceMatchParameter_offsets_[1] = {
   };
   BruteForceMatchParameter_reflection_ =
@@ -1361,7 +1408,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(BruteForceMatchParameter));
-  FLANNMatchParameter_descriptor_ = file->message_type(65);
+  FLANNMatchParameter_descriptor_ = file->message_type(66);
   static const int FLANNMatchParameter_offsets_[1] = {
   };
   FLANNMatchParameter_reflection_ =
@@ -1375,8 +1422,13 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(FLANNMatchParameter));
-  ECMatchParameter_descriptor_ = file->message_type(66);
-  static const int ECMatchParameter_offsets_[1] = {
+  ECMatchParameter_descriptor_ = file->message_type(67);
+  static const int ECMatchParameter_offsets_[5] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ECMatchParameter, rowtol_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ECMatchParameter, mindisp_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ECMatchParameter, maxdisp_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ECMatchParameter, thresh_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ECMatchParameter, crosscheck_),
   };
   ECMatchParameter_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -1389,7 +1441,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(ECMatchParameter));
-  CVMatchParameter_descriptor_ = file->message_type(67);
+  CVMatchParameter_descriptor_ = file->message_type(68);
   static const int CVMatchParameter_offsets_[2] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CVMatchParameter, type_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CVMatchParameter, crosscheck_),
@@ -1406,7 +1458,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(CVMatchParameter));
   CVMatchParameter_MatchType_descriptor_ = CVMatchParameter_descriptor_->enum_type(0);
-  StereoMatchParameter_descriptor_ = file->message_type(68);
+  StereoMatchParameter_descriptor_ = file->message_type(69);
   static const int StereoMatchParameter_offsets_[1] = {
   };
   StereoMatchParameter_reflection_ =
@@ -1420,8 +1472,8 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(StereoMatchParameter));
-  SGMMatchParameter_descriptor_ = file->message_type(69);
-  static const int SGMMatchParameter_offsets_[7] = {
+  SGMMatchParameter_descriptor_ = file->message_type(70);
+  static const int SGMMatchParameter_offsets_[16] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SGMMatchParameter, max_disp_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SGMMatchParameter, factor_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SGMMatchParameter, dispmr_),
@@ -1429,6 +1481,15 @@ void protobuf_AssignDesc_svaf_2eproto() {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SGMMatchParameter, r2_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SGMMatchParameter, prefix_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SGMMatchParameter, savetxt_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SGMMatchParameter, pyramid_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SGMMatchParameter, margin_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SGMMatchParameter, temporal_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SGMMatchParameter, tile_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SGMMatchParameter, motion_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SGMMatchParameter, uniqueness_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SGMMatchParameter, subpixel_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SGMMatchParameter, roi_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SGMMatchParameter, points_),
   };
   SGMMatchParameter_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -1441,8 +1502,8 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(SGMMatchParameter));
-  EADPMatchParameter_descriptor_ = file->message_type(70);
-  static const int EADPMatchParameter_offsets_[10] = {
+  EADPMatchParameter_descriptor_ = file->message_type(71);
+  static const int EADPMatchParameter_offsets_[13] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(EADPMatchParameter, max_disp_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(EADPMatchParameter, factor_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(EADPMatchParameter, guidmr_),
@@ -1453,6 +1514,9 @@ void protobuf_AssignDesc_svaf_2eproto() {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(EADPMatchParameter, r2_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(EADPMatchParameter, prefix_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(EADPMatchParameter, savetxt_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(EADPMatchParameter, fast_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(EADPMatchParameter, roi_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(EADPMatchParameter, points_),
   };
   EADPMatchParameter_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -1465,7 +1529,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(EADPMatchParameter));
-  OutputParameter_descriptor_ = file->message_type(71);
+  OutputParameter_descriptor_ = file->message_type(72);
   static const int OutputParameter_offsets_[1] = {
   };
   OutputParameter_reflection_ =
@@ -1479,13 +1543,17 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(OutputParameter));
-  TriangularParameter_descriptor_ = file->message_type(72);
-  static const int TriangularParameter_offsets_[5] = {
+  TriangularParameter_descriptor_ = file->message_type(73);
+  static const int TriangularParameter_offsets_[9] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TriangularParameter, visible_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TriangularParameter, toolbox_dir_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TriangularParameter, calibmat_dir_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TriangularParameter, savepc_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TriangularParameter, pcname_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TriangularParameter, calib_raw_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TriangularParameter, calib_rect_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TriangularParameter, calib_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TriangularParameter, voxel_),
   };
   TriangularParameter_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -1498,12 +1566,40 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(TriangularParameter));
-  MatrixMulParameter_descriptor_ = file->message_type(73);
-  static const int MatrixMulParameter_offsets_[4] = {
+  ReprojectParameter_descriptor_ = file->message_type(74);
+  static const int ReprojectParameter_offsets_[13] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReprojectParameter, calib_file_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReprojectParameter, fx_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReprojectParameter, fy_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReprojectParameter, cx_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReprojectParameter, cy_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReprojectParameter, cx_right_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReprojectParameter, baseline_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReprojectParameter, stride_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReprojectParameter, color_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReprojectParameter, pointl_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReprojectParameter, savepc_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReprojectParameter, calib_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReprojectParameter, voxel_),
+  };
+  ReprojectParameter_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      ReprojectParameter_descriptor_,
+      ReprojectParameter::default_instance_,
+      ReprojectParameter_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReprojectParameter, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReprojectParameter, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(ReprojectParameter));
+  MatrixMulParameter_descriptor_ = file->message_type(75);
+  static const int MatrixMulParameter_offsets_[5] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MatrixMulParameter, filename_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MatrixMulParameter, col0_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MatrixMulParameter, col1_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MatrixMulParameter, col2_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MatrixMulParameter, calib_),
   };
   MatrixMulParameter_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -1516,7 +1612,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(MatrixMulParameter));
-  PositionEstimateParameter_descriptor_ = file->message_type(74);
+  PositionEstimateParameter_descriptor_ = file->message_type(76);
   static const int PositionEstimateParameter_offsets_[1] = {
   };
   PositionEstimateParameter_reflection_ =
@@ -1530,7 +1626,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(PositionEstimateParameter));
-  CenterPointParameter_descriptor_ = file->message_type(75);
+  CenterPointParameter_descriptor_ = file->message_type(77);
   static const int CenterPointParameter_offsets_[1] = {
   };
   CenterPointParameter_reflection_ =
@@ -1544,7 +1640,32 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(CenterPointParameter));
-  CoordiParameter_descriptor_ = file->message_type(76);
+  FeaturePoolParameter_descriptor_ = file->message_type(78);
+  static const int FeaturePoolParameter_offsets_[11] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FeaturePoolParameter, capacity_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FeaturePoolParameter, thresh_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FeaturePoolParameter, cell_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FeaturePoolParameter, radius_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FeaturePoolParameter, inlier_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FeaturePoolParameter, iters_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FeaturePoolParameter, minmatch_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FeaturePoolParameter, trees_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FeaturePoolParameter, checks_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FeaturePoolParameter, store_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FeaturePoolParameter, maxfail_),
+  };
+  FeaturePoolParameter_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      FeaturePoolParameter_descriptor_,
+      FeaturePoolParameter::default_instance_,
+      FeaturePoolParameter_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FeaturePoolParameter, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(FeaturePoolParameter, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(FeaturePoolParameter));
+  CoordiParameter_descriptor_ = file->message_type(79);
   static const int CoordiParameter_offsets_[6] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CoordiParameter, x_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CoordiParameter, y_),
@@ -1564,7 +1685,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(CoordiParameter));
-  SACIAParameter_descriptor_ = file->message_type(77);
+  SACIAParameter_descriptor_ = file->message_type(80);
   static const int SACIAParameter_offsets_[6] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SACIAParameter, max_iter_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SACIAParameter, min_cors_),
@@ -1584,7 +1705,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(SACIAParameter));
-  SACIAEstimateParameter_descriptor_ = file->message_type(78);
+  SACIAEstimateParameter_descriptor_ = file->message_type(81);
   static const int SACIAEstimateParameter_offsets_[3] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SACIAEstimateParameter, pcd_filename_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SACIAEstimateParameter, ia_param_),
@@ -1601,7 +1722,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(SACIAEstimateParameter));
-  ICPParameter_descriptor_ = file->message_type(79);
+  ICPParameter_descriptor_ = file->message_type(82);
   static const int ICPParameter_offsets_[3] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ICPParameter, max_iter_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ICPParameter, max_resp_),
@@ -1618,7 +1739,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(ICPParameter));
-  IAICPEstimateParameter_descriptor_ = file->message_type(80);
+  IAICPEstimateParameter_descriptor_ = file->message_type(83);
   static const int IAICPEstimateParameter_offsets_[4] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(IAICPEstimateParameter, pcd_filename_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(IAICPEstimateParameter, sacia_param_),
@@ -1636,7 +1757,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(IAICPEstimateParameter));
-  NDTParameter_descriptor_ = file->message_type(81);
+  NDTParameter_descriptor_ = file->message_type(84);
   static const int NDTParameter_offsets_[4] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NDTParameter, max_iter_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NDTParameter, step_size_),
@@ -1654,7 +1775,7 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(NDTParameter));
-  IANDTEstimateParameter_descriptor_ = file->message_type(82);
+  IANDTEstimateParameter_descriptor_ = file->message_type(85);
   static const int IANDTEstimateParameter_offsets_[4] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(IANDTEstimateParameter, pcd_filename_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(IANDTEstimateParameter, sacia_param_),
@@ -1672,8 +1793,8 @@ void protobuf_AssignDesc_svaf_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(IANDTEstimateParameter));
-  LayerParameter_descriptor_ = file->message_type(83);
-  static const int LayerParameter_offsets_[70] = {
+  LayerParameter_descriptor_ = file->message_type(86);
+  static const int LayerParameter_offsets_[72] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LayerParameter, name_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LayerParameter, bottom_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LayerParameter, top_),
@@ -1739,8 +1860,10 @@ void protobuf_AssignDesc_svaf_2eproto() {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LayerParameter, output_param_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LayerParameter, triang_param_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LayerParameter, mxmul_param_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LayerParameter, reproject_param_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LayerParameter, posest_param_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LayerParameter, centerpoint_param_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LayerParameter, featpool_param_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LayerParameter, sacia_param_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LayerParameter, iaicp_param_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LayerParameter, iandt_param_),
@@ -1827,6 +1950,8 @@ void protobuf_RegisterTypes(const ::std::string&) {
     SIFTPointParameter_descriptor_, &SIFTPointParameter::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     SURFPointParameter_descriptor_, &SURFPointParameter::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    PointBudgetParameter_descriptor_, &PointBudgetParameter::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     STARPointParameter_descriptor_, &STARPointParameter::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
@@ -1915,12 +2040,16 @@ void protobuf_RegisterTypes(const ::std::string&) {
     OutputParameter_descriptor_, &OutputParameter::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     TriangularParameter_descriptor_, &TriangularParameter::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    ReprojectParameter_descriptor_, &ReprojectParameter::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     MatrixMulParameter_descriptor_, &MatrixMulParameter::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     PositionEstimateParameter_descriptor_, &PositionEstimateParameter::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     CenterPointParameter_descriptor_, &CenterPointParameter::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    FeaturePoolParameter_descriptor_, &FeaturePoolParameter::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     CoordiParameter_descriptor_, &CoordiParameter::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
@@ -1958,6 +2087,7 @@ void protobuf_ShutdownFile_svaf_2eproto() {
   delete StereoOperationParameter_reflection_;
   delete StereoRectifyParameter::default_instance_;
   delete StereoRectifyParameter_reflection_;
+  delete StereoRectifyParameter::_default_cache_dir_;
   delete DataParameter::default_instance_;
   delete DataParameter_reflection_;
   delete ImageDataParameter::default_instance_;
@@ -2002,6 +2132,8 @@ void protobuf_ShutdownFile_svaf_2eproto() {
   delete SIFTPointParameter_reflection_;
   delete SURFPointParameter::default_instance_;
   delete SURFPointParameter_reflection_;
+  delete PointBudgetParameter::default_instance_;
+  delete PointBudgetParameter_reflection_;
   delete STARPointParameter::default_instance_;
   delete STARPointParameter_reflection_;
   delete BRISKPointParameter::default_instance_;
@@ -2093,12 +2225,18 @@ void protobuf_ShutdownFile_svaf_2eproto() {
   delete TriangularParameter::default_instance_;
   delete TriangularParameter_reflection_;
   delete TriangularParameter::_default_pcname_;
+  delete TriangularParameter::_default_calib_raw_;
+  delete TriangularParameter::_default_calib_rect_;
+  delete ReprojectParameter::default_instance_;
+  delete ReprojectParameter_reflection_;
   delete MatrixMulParameter::default_instance_;
   delete MatrixMulParameter_reflection_;
   delete PositionEstimateParameter::default_instance_;
   delete PositionEstimateParameter_reflection_;
   delete CenterPointParameter::default_instance_;
   delete CenterPointParameter_reflection_;
+  delete FeaturePoolParameter::default_instance_;
+  delete FeaturePoolParameter_reflection_;
   delete CoordiParameter::default_instance_;
   delete CoordiParameter_reflection_;
   delete SACIAParameter::default_instance_;
@@ -2133,298 +2271,344 @@ void protobuf_AddDesc_svaf_2eproto() {
     "(\010:\004true\022\026\n\007saveseg\030\004 \001(\010:\005false\022\034\n\007segn"
     "ame\030\005 \001(\t:\013./supix.seg\"\026\n\024ImageResizePar"
     "ameter\"\024\n\022ImageCropParameter\"\032\n\030StereoOp"
-    "erationParameter\"*\n\026StereoRectifyParamet"
-    "er\022\020\n\010filename\030\001 \001(\t\"\036\n\rDataParameter\022\r\n"
-    "\005color\030\001 \001(\010\"\"\n\022ImageDataParameter\022\014\n\004na"
-    "me\030\001 \003(\t\",\n\rBinocularPair\022\014\n\004left\030\001 \001(\t\022"
-    "\r\n\005right\030\002 \001(\t\"\\\n\022ImagePairParameter\022!\n\004"
-    "pair\030\001 \003(\0132\023.svaf.BinocularPair\022#\n\005_pair"
-    "\030\377\001 \003(\0132\023.svaf.BinocularPair\"\"\n\022VideoDat"
-    "aParameter\022\014\n\004name\030\001 \003(\t\"\\\n\022VideoPairPar"
-    "ameter\022!\n\004pair\030\001 \003(\0132\023.svaf.BinocularPai"
-    "r\022#\n\005_pair\030\377\001 \003(\0132\023.svaf.BinocularPair\"%"
-    "\n\023CameraDataParameter\022\016\n\006camera\030\001 \001(\005\">\n"
-    "\023CameraPairParameter\022\022\n\nleftcamera\030\001 \001(\005"
-    "\022\023\n\013rightcamera\030\002 \001(\005\"&\n\026DSPCameraDataPa"
-    "rameter\022\014\n\004chns\030\001 \001(\005\"&\n\026DSPCameraPairPa"
-    "rameter\022\014\n\004chns\030\001 \001(\005\"\025\n\023KinectDataParam"
-    "eter\"$\n\024ImageFolderParameter\022\014\n\004name\030\001 \003"
-    "(\t\"b\n\030ImagePairFolderParameter\022!\n\004pair\030\001"
-    " \003(\0132\023.svaf.BinocularPair\022#\n\005_pair\030\377\001 \003("
-    "\0132\023.svaf.BinocularPair\"\024\n\022RecognizeParam"
-    "eter\"g\n\014ROIExtention\022\017\n\004left\030\001 \001(\005:\0010\022\020\n"
-    "\005right\030\002 \001(\005:\0010\022\016\n\003top\030\003 \001(\005:\0010\022\021\n\006botto"
-    "m\030\004 \001(\005:\0010\022\021\n\006xshift\030\005 \001(\005:\0010\"\305\001\n\021Adaboo"
-    "stParameter\022\020\n\010detector\030\001 \001(\t\022\031\n\nsync_fr"
-    "ame\030\002 \001(\010:\005false\022\031\n\nsync_video\030\003 \001(\010:\005fa"
-    "lse\022\034\n\rsync_epipolar\030\004 \001(\010:\005false\022\021\n\006thr"
-    "esh\030\005 \001(\002:\0010\022\021\n\003nms\030\006 \001(\002:\0040.65\022$\n\010pad_r"
-    "ect\030\007 \001(\0132\022.svaf.ROIExtention\"\020\n\016TrackPa"
-    "rameter\"H\n\021InitRectParameter\022\t\n\001x\030\001 \001(\r\022"
-    "\t\n\001y\030\002 \001(\r\022\r\n\005width\030\003 \001(\r\022\016\n\006height\030\004 \001("
-    "\r\"\317\006\n\021MilTrackParameter\022=\n\tinit_type\030\001 \001"
-    "(\0162 .svaf.MilTrackParameter.InitType:\010AU"
-    "TORECT\022:\n\ntrack_type\030\002 \001(\0162!.svaf.MilTra"
-    "ckParameter.TrackType:\003MIL\022\027\n\013track_coun"
-    "t\030\003 \001(\005:\00220\022*\n\tinit_rect\030\004 \003(\0132\027.svaf.In"
-    "itRectParameter\022\025\n\010tr_width\030\005 \001(\r:\003200\022\026"
-    "\n\ttr_height\030\006 \001(\r:\003150\022\030\n\013scalefactor\030\007 "
-    "\001(\002:\0030.5\022\027\n\013init_negnum\030\013 \001(\r:\00265\022\022\n\006neg"
-    "num\030\014 \001(\r:\00265\022\026\n\006posmax\030\r \001(\r:\006100000\022\025\n"
-    "\tsrchwinsz\030\016 \001(\r:\00225\022\032\n\017negsample_strat\030"
-    "\017 \001(\r:\0011\022\024\n\007numfeat\030\020 \001(\r:\003250\022\022\n\006numsel"
-    "\030\021 \001(\r:\00250\022\023\n\005lrate\030\025 \001(\002:\0040.85\022\021\n\006posra"
-    "d\030\026 \001(\002:\0011\022\026\n\013init_posrad\030\027 \001(\002:\0013\022\032\n\017ha"
-    "armin_rectnum\030\030 \001(\r:\0012\022\032\n\017haarmax_rectnu"
-    "m\030\031 \001(\r:\0016\022\025\n\007uselogr\030\035 \001(\010:\004true\022\022\n\003tss"
-    "\030\037 \001(\010:\005false\022\023\n\004pool\030  \001(\010:\005false\022\023\n\004sy"
-    "nc\030! \001(\010:\005false\022\026\n\007mixfeat\030\" \001(\010:\005false\022"
-    "\027\n\010showprob\030# \001(\010:\005false\"=\n\010InitType\022\t\n\005"
-    "MOUSE\020\001\022\n\n\006SELECT\020\002\022\014\n\010AUTORECT\020\003\022\014\n\010ADA"
-    "BOOST\020\004\"R\n\tTrackType\022\007\n\003MIL\020\001\022\007\n\003ADA\020\002\022\014"
-    "\n\010MIL_GRAY\020\013\022\013\n\007MIL_RGB\020\014\022\013\n\007MIL_LUV\020\r\022\013"
-    "\n\007MIL_HSV\020\016\"\027\n\025FeaturePointParameter\"\024\n\022"
-    "SIFTPointParameter\"i\n\022SURFPointParameter"
-    "\022\021\n\006stride\030\001 \001(\005:\0012\022\022\n\007octaves\030\002 \001(\005:\0015\022"
-    "\024\n\tintervals\030\003 \001(\005:\0014\022\026\n\006thresh\030\004 \001(\002:\0060"
-    ".0004\"\024\n\022STARPointParameter\"\025\n\023BRISKPoin"
-    "tParameter\";\n\022FASTPointParameter\022\022\n\006thre"
-    "sh\030\001 \001(\005:\00240\022\021\n\003nms\030\002 \001(\010:\004true\"\023\n\021ORBPo"
-    "intParameter\"\024\n\022KAZEPointParameter\"\026\n\024Ha"
-    "rrisPointParameter\"\230\001\n\013FastParamCP\022\022\n\006th"
-    "resh\030\001 \001(\005:\00240\022\023\n\005isnms\030\002 \001(\010:\004true\0221\n\005f"
-    "type\030\003 \001(\0162\032.svaf.FastParamCP.FastType:\006"
-    "T_9_16\"-\n\010FastType\022\n\n\006T_9_16\020\001\022\n\n\006T_7_12"
-    "\020\002\022\t\n\005T_5_8\020\003\"\354\001\n\013MSERParamCP\022\020\n\005delta\030\001"
-    " \001(\005:\0015\022\024\n\010min_area\030\002 \001(\005:\00260\022\027\n\010max_are"
-    "a\030\003 \001(\005:\00514400\022\027\n\tmax_varia\030\004 \001(\002:\0040.25\022"
-    "\027\n\nmin_divers\030\005 \001(\002:\0030.2\022\032\n\rmax_evolutio"
-    "n\030\006 \001(\005:\003200\022\031\n\013area_thresh\030\007 \001(\002:\0041.01\022"
-    "\031\n\nmin_margin\030\010 \001(\002:\0050.003\022\030\n\redgeblur_s"
-    "ize\030\t \001(\005:\0015\"\234\002\n\nORBParamCP\022\026\n\tnfeatures"
-    "\030\001 \001(\005:\003500\022\030\n\013scalefactor\030\002 \001(\002:\0031.2\022\022\n"
-    "\007nlevels\030\003 \001(\005:\0018\022\026\n\nedgethresh\030\004 \001(\005:\0023"
-    "1\022\025\n\nfirstlevel\030\005 \001(\005:\0010\022\020\n\005wta_k\030\006 \001(\005:"
-    "\0012\022>\n\tscoretype\030\007 \001(\0162\035.svaf.ORBParamCP."
-    "OBRScoreType:\014HARRIS_SCORE\022\025\n\tpatchsize\030"
-    "\010 \001(\005:\00231\"0\n\014OBRScoreType\022\020\n\014HARRIS_SCOR"
-    "E\020\001\022\016\n\nFAST_SCORE\020\002\"J\n\014BriskParamCP\022\022\n\006t"
-    "hresh\030\001 \001(\005:\00230\022\022\n\007octaves\030\002 \001(\005:\0013\022\022\n\007p"
-    "tscale\030\003 \001(\002:\0011\"j\n\014FreakParamCP\022\030\n\norien"
-    "tnorm\030\001 \001(\010:\004true\022\027\n\tscalenorm\030\002 \001(\010:\004tr"
-    "ue\022\023\n\007ptscale\030\003 \001(\002:\00222\022\022\n\007octaves\030\004 \001(\005"
-    ":\0014\"\217\001\n\013StarParamCP\022\023\n\007maxsize\030\001 \001(\005:\00216"
-    "\022\033\n\017response_thresh\030\002 \001(\005:\00230\022\034\n\020project"
-    "ed_thresh\030\003 \001(\005:\00210\022\033\n\020binarized_thresh\030"
-    "\004 \001(\005:\0018\022\023\n\010nms_size\030\005 \001(\005:\0015\"\203\001\n\013SiftPa"
-    "ramCP\022\024\n\tnfeatures\030\001 \001(\005:\0010\022\022\n\007octaves\030\002"
-    " \001(\005:\0013\022\035\n\017contrast_thresh\030\003 \001(\002:\0040.04\022\027"
-    "\n\013edge_thresh\030\004 \001(\002:\00210\022\022\n\005sigma\030\005 \001(\002:\003"
-    "1.6\"\207\001\n\013SurfParamCP\022\036\n\016hassian_thresh\030\001 "
-    "\001(\002:\0060.0004\022\022\n\007octaves\030\002 \001(\005:\0014\022\023\n\010intev"
-    "als\030\003 \001(\005:\0012\022\027\n\010extended\030\004 \001(\010:\005false\022\026\n"
-    "\007upright\030\005 \001(\010:\005false\"\224\001\n\013GFTTParamCP\022\031\n"
-    "\013maxcornners\030\001 \001(\005:\0041000\022\025\n\007quality\030\002 \001("
-    "\002:\0040.01\022\022\n\007mindist\030\003 \001(\002:\0011\022\024\n\tblocksize"
-    "\030\004 \001(\005:\0013\022\030\n\tuseharris\030\005 \001(\010:\005false\022\017\n\001k"
-    "\030\006 \001(\002:\0040.04\"|\n\rHarrisParamCP\022\031\n\013maxcorn"
-    "ners\030\001 \001(\005:\0041000\022\025\n\007quality\030\002 \001(\002:\0040.01\022"
-    "\022\n\007mindist\030\003 \001(\002:\0011\022\024\n\tblocksize\030\004 \001(\005:\001"
-    "3\022\017\n\001k\030\006 \001(\002:\0040.04\"\302\001\n\014DenseParamCP\022\030\n\ri"
-    "nitfeatscale\030\001 \001(\002:\0011\022\031\n\016featscalelevel\030"
-    "\002 \001(\005:\0011\022\031\n\014featscalemul\030\003 \001(\002:\0030.1\022\025\n\ni"
-    "nitxystep\030\004 \001(\005:\0016\022\024\n\tinitbound\030\005 \001(\005:\0010"
-    "\022\031\n\013varyxyscale\030\006 \001(\010:\004true\022\032\n\013varybdsca"
-    "le\030\007 \001(\010:\005false\"\023\n\021SimpleBlobParamCP\"\016\n\014"
-    "AkazeParamCP\"\202\006\n\020CVPointParameter\022.\n\004typ"
-    "e\030\001 \001(\0162 .svaf.CVPointParameter.PointTyp"
-    "e\022\024\n\005isadd\030\002 \001(\010:\005false\022%\n\nfast_param\030\013 "
-    "\001(\0132\021.svaf.FastParamCP\022%\n\nmser_param\030\r \001"
-    "(\0132\021.svaf.MSERParamCP\022#\n\torb_param\030\016 \001(\013"
-    "2\020.svaf.ORBParamCP\022\'\n\013brisk_param\030\017 \001(\0132"
-    "\022.svaf.BriskParamCP\022\'\n\013freak_param\030\020 \001(\013"
-    "2\022.svaf.FreakParamCP\022%\n\nstar_param\030\021 \001(\013"
-    "2\021.svaf.StarParamCP\022%\n\nsift_param\030\022 \001(\0132"
-    "\021.svaf.SiftParamCP\022%\n\nsurf_param\030\023 \001(\0132\021"
-    ".svaf.SurfParamCP\022%\n\ngftt_param\030\024 \001(\0132\021."
-    "svaf.GFTTParamCP\022)\n\014harris_param\030\025 \001(\0132\023"
-    ".svaf.HarrisParamCP\022\'\n\013dense_param\030\026 \001(\013"
-    "2\022.svaf.DenseParamCP\022)\n\010sb_param\030\027 \001(\0132\027"
-    ".svaf.SimpleBlobParamCP\022\'\n\013akaze_param\030\030"
-    " \001(\0132\022.svaf.AkazeParamCP\"\236\001\n\tPointType\022\010"
-    "\n\004FAST\020\001\022\t\n\005FASTX\020\002\022\010\n\004MSER\020\003\022\007\n\003ORB\020\004\022\t"
-    "\n\005BRISK\020\005\022\t\n\005FREAK\020\006\022\010\n\004STAR\020\007\022\010\n\004SIFT\020\010"
-    "\022\010\n\004SURF\020\t\022\010\n\004GFTT\020\n\022\n\n\006HARRIS\020\013\022\t\n\005DENS"
-    "E\020\014\022\t\n\005SBLOB\020\r\022\t\n\005AKAZE\020\016\"\034\n\032FeatureDesc"
-    "riptorParameter\"\031\n\027SIFTDescriptorParamet"
-    "er\"1\n\027SURFDescriptorParameter\022\026\n\007upright"
-    "\030\001 \001(\010:\005false\"\031\n\027STARDescriptorParameter"
-    "\"\032\n\030BRIEFDescriptorParameter\"\032\n\030BRISKDes"
-    "criptorParameter\"\031\n\027FASTDescriptorParame"
-    "ter\"\030\n\026ORBDescriptorParameter\"\031\n\027KAZEDes"
-    "criptorParameter\"!\n\013BriefDespCV\022\022\n\006lengt"
-    "h\030\001 \001(\005:\00232\"\313\001\n\025CVDescriptorParameter\0222\n"
-    "\004type\030\001 \001(\0162$.svaf.CVDescriptorParameter"
-    ".DespType\022&\n\013brief_param\030\002 \001(\0132\021.svaf.Br"
-    "iefDespCV\"V\n\010DespType\022\010\n\004SIFT\020\001\022\010\n\004SURF\020"
-    "\002\022\t\n\005BRIEF\020\003\022\t\n\005BRISK\020\004\022\007\n\003ORB\020\005\022\t\n\005FREA"
-    "K\020\006\022\014\n\010OPPONENT\020\007\"\026\n\024VectorMatchParamete"
-    "r\"\026\n\024KDTreeMatchParameter\"+\n\023EularMatchP"
-    "arameter\022\024\n\006thresh\030\001 \001(\002:\0040.65\"$\n\017Ransac"
-    "Parameter\022\021\n\006thresh\030\001 \001(\002:\0015\"\032\n\030BruteFor"
+    "erationParameter\"V\n\026StereoRectifyParamet"
+    "er\022\020\n\010filename\030\001 \001(\t\022\r\n\005calib\030\002 \001(\t\022\033\n\tc"
+    "ache_dir\030\003 \001(\t:\010./calib/\"\036\n\rDataParamete"
+    "r\022\r\n\005color\030\001 \001(\010\"\"\n\022ImageDataParameter\022\014"
+    "\n\004name\030\001 \003(\t\",\n\rBinocularPair\022\014\n\004left\030\001 "
+    "\001(\t\022\r\n\005right\030\002 \001(\t\"\\\n\022ImagePairParameter"
+    "\022!\n\004pair\030\001 \003(\0132\023.svaf.BinocularPair\022#\n\005_"
+    "pair\030\377\001 \003(\0132\023.svaf.BinocularPair\"\"\n\022Vide"
+    "oDataParameter\022\014\n\004name\030\001 \003(\t\"\\\n\022VideoPai"
+    "rParameter\022!\n\004pair\030\001 \003(\0132\023.svaf.Binocula"
+    "rPair\022#\n\005_pair\030\377\001 \003(\0132\023.svaf.BinocularPa"
+    "ir\"%\n\023CameraDataParameter\022\016\n\006camera\030\001 \001("
+    "\005\">\n\023CameraPairParameter\022\022\n\nleftcamera\030\001"
+    " \001(\005\022\023\n\013rightcamera\030\002 \001(\005\"&\n\026DSPCameraDa"
+    "taParameter\022\014\n\004chns\030\001 \001(\005\"&\n\026DSPCameraPa"
+    "irParameter\022\014\n\004chns\030\001 \001(\005\"\025\n\023KinectDataP"
+    "arameter\"$\n\024ImageFolderParameter\022\014\n\004name"
+    "\030\001 \003(\t\"b\n\030ImagePairFolderParameter\022!\n\004pa"
+    "ir\030\001 \003(\0132\023.svaf.BinocularPair\022#\n\005_pair\030\377"
+    "\001 \003(\0132\023.svaf.BinocularPair\"\024\n\022RecognizeP"
+    "arameter\"g\n\014ROIExtention\022\017\n\004left\030\001 \001(\005:\001"
+    "0\022\020\n\005right\030\002 \001(\005:\0010\022\016\n\003top\030\003 \001(\005:\0010\022\021\n\006b"
+    "ottom\030\004 \001(\005:\0010\022\021\n\006xshift\030\005 \001(\005:\0010\"\305\001\n\021Ad"
+    "aboostParameter\022\020\n\010detector\030\001 \001(\t\022\031\n\nsyn"
+    "c_frame\030\002 \001(\010:\005false\022\031\n\nsync_video\030\003 \001(\010"
+    ":\005false\022\034\n\rsync_epipolar\030\004 \001(\010:\005false\022\021\n"
+    "\006thresh\030\005 \001(\002:\0010\022\021\n\003nms\030\006 \001(\002:\0040.65\022$\n\010p"
+    "ad_rect\030\007 \001(\0132\022.svaf.ROIExtention\"\020\n\016Tra"
+    "ckParameter\"H\n\021InitRectParameter\022\t\n\001x\030\001 "
+    "\001(\r\022\t\n\001y\030\002 \001(\r\022\r\n\005width\030\003 \001(\r\022\016\n\006height\030"
+    "\004 \001(\r\"\317\006\n\021MilTrackParameter\022=\n\tinit_type"
+    "\030\001 \001(\0162 .svaf.MilTrackParameter.InitType"
+    ":\010AUTORECT\022:\n\ntrack_type\030\002 \001(\0162!.svaf.Mi"
+    "lTrackParameter.TrackType:\003MIL\022\027\n\013track_"
+    "count\030\003 \001(\005:\00220\022*\n\tinit_rect\030\004 \003(\0132\027.sva"
+    "f.InitRectParameter\022\025\n\010tr_width\030\005 \001(\r:\0032"
+    "00\022\026\n\ttr_height\030\006 \001(\r:\003150\022\030\n\013scalefacto"
+    "r\030\007 \001(\002:\0030.5\022\027\n\013init_negnum\030\013 \001(\r:\00265\022\022\n"
+    "\006negnum\030\014 \001(\r:\00265\022\026\n\006posmax\030\r \001(\r:\00610000"
+    "0\022\025\n\tsrchwinsz\030\016 \001(\r:\00225\022\032\n\017negsample_st"
+    "rat\030\017 \001(\r:\0011\022\024\n\007numfeat\030\020 \001(\r:\003250\022\022\n\006nu"
+    "msel\030\021 \001(\r:\00250\022\023\n\005lrate\030\025 \001(\002:\0040.85\022\021\n\006p"
+    "osrad\030\026 \001(\002:\0011\022\026\n\013init_posrad\030\027 \001(\002:\0013\022\032"
+    "\n\017haarmin_rectnum\030\030 \001(\r:\0012\022\032\n\017haarmax_re"
+    "ctnum\030\031 \001(\r:\0016\022\025\n\007uselogr\030\035 \001(\010:\004true\022\022\n"
+    "\003tss\030\037 \001(\010:\005false\022\023\n\004pool\030  \001(\010:\005false\022\023"
+    "\n\004sync\030! \001(\010:\005false\022\026\n\007mixfeat\030\" \001(\010:\005fa"
+    "lse\022\027\n\010showprob\030# \001(\010:\005false\"=\n\010InitType"
+    "\022\t\n\005MOUSE\020\001\022\n\n\006SELECT\020\002\022\014\n\010AUTORECT\020\003\022\014\n"
+    "\010ADABOOST\020\004\"R\n\tTrackType\022\007\n\003MIL\020\001\022\007\n\003ADA"
+    "\020\002\022\014\n\010MIL_GRAY\020\013\022\013\n\007MIL_RGB\020\014\022\013\n\007MIL_LUV"
+    "\020\r\022\013\n\007MIL_HSV\020\016\"\027\n\025FeaturePointParameter"
+    "\"\024\n\022SIFTPointParameter\"\233\001\n\022SURFPointPara"
+    "meter\022\021\n\006stride\030\001 \001(\005:\0012\022\022\n\007octaves\030\002 \001("
+    "\005:\0015\022\024\n\tintervals\030\003 \001(\005:\0014\022\026\n\006thresh\030\004 \001"
+    "(\002:\0060.0004\0220\n\014budget_param\030\005 \001(\0132\032.svaf."
+    "PointBudgetParameter\"\205\001\n\024PointBudgetPara"
+    "meter\022\021\n\006budget\030\001 \001(\005:\0010\022\024\n\tgrid_cols\030\002 "
+    "\001(\005:\0018\022\024\n\tgrid_rows\030\003 \001(\005:\0016\022\026\n\010adaptive"
+    "\030\004 \001(\010:\004true\022\026\n\tovershoot\030\005 \001(\002:\0031.5\"\024\n\022"
+    "STARPointParameter\"\025\n\023BRISKPointParamete"
+    "r\";\n\022FASTPointParameter\022\022\n\006thresh\030\001 \001(\005:"
+    "\00240\022\021\n\003nms\030\002 \001(\010:\004true\"\023\n\021ORBPointParame"
+    "ter\"\024\n\022KAZEPointParameter\"\026\n\024HarrisPoint"
+    "Parameter\"\230\001\n\013FastParamCP\022\022\n\006thresh\030\001 \001("
+    "\005:\00240\022\023\n\005isnms\030\002 \001(\010:\004true\0221\n\005ftype\030\003 \001("
+    "\0162\032.svaf.FastParamCP.FastType:\006T_9_16\"-\n"
+    "\010FastType\022\n\n\006T_9_16\020\001\022\n\n\006T_7_12\020\002\022\t\n\005T_5"
+    "_8\020\003\"\354\001\n\013MSERParamCP\022\020\n\005delta\030\001 \001(\005:\0015\022\024"
+    "\n\010min_area\030\002 \001(\005:\00260\022\027\n\010max_area\030\003 \001(\005:\005"
+    "14400\022\027\n\tmax_varia\030\004 \001(\002:\0040.25\022\027\n\nmin_di"
+    "vers\030\005 \001(\002:\0030.2\022\032\n\rmax_evolution\030\006 \001(\005:\003"
+    "200\022\031\n\013area_thresh\030\007 \001(\002:\0041.01\022\031\n\nmin_ma"
+    "rgin\030\010 \001(\002:\0050.003\022\030\n\redgeblur_size\030\t \001(\005"
+    ":\0015\"\234\002\n\nORBParamCP\022\026\n\tnfeatures\030\001 \001(\005:\0035"
+    "00\022\030\n\013scalefactor\030\002 \001(\002:\0031.2\022\022\n\007nlevels\030"
+    "\003 \001(\005:\0018\022\026\n\nedgethresh\030\004 \001(\005:\00231\022\025\n\nfirs"
+    "tlevel\030\005 \001(\005:\0010\022\020\n\005wta_k\030\006 \001(\005:\0012\022>\n\tsco"
+    "retype\030\007 \001(\0162\035.svaf.ORBParamCP.OBRScoreT"
+    "ype:\014HARRIS_SCORE\022\025\n\tpatchsize\030\010 \001(\005:\00231"
+    "\"0\n\014OBRScoreType\022\020\n\014HARRIS_SCORE\020\001\022\016\n\nFA"
+    "ST_SCORE\020\002\"J\n\014BriskParamCP\022\022\n\006thresh\030\001 \001"
+    "(\005:\00230\022\022\n\007octaves\030\002 \001(\005:\0013\022\022\n\007ptscale\030\003 "
+    "\001(\002:\0011\"j\n\014FreakParamCP\022\030\n\norientnorm\030\001 \001"
+    "(\010:\004true\022\027\n\tscalenorm\030\002 \001(\010:\004true\022\023\n\007pts"
+    "cale\030\003 \001(\002:\00222\022\022\n\007octaves\030\004 \001(\005:\0014\"\217\001\n\013S"
+    "tarParamCP\022\023\n\007maxsize\030\001 \001(\005:\00216\022\033\n\017respo"
+    "nse_thresh\030\002 \001(\005:\00230\022\034\n\020projected_thresh"
+    "\030\003 \001(\005:\00210\022\033\n\020binarized_thresh\030\004 \001(\005:\0018\022"
+    "\023\n\010nms_size\030\005 \001(\005:\0015\"\203\001\n\013SiftParamCP\022\024\n\t"
+    "nfeatures\030\001 \001(\005:\0010\022\022\n\007octaves\030\002 \001(\005:\0013\022\035"
+    "\n\017contrast_thresh\030\003 \001(\002:\0040.04\022\027\n\013edge_th"
+    "resh\030\004 \001(\002:\00210\022\022\n\005sigma\030\005 \001(\002:\0031.6\"\207\001\n\013S"
+    "urfParamCP\022\036\n\016hassian_thresh\030\001 \001(\002:\0060.00"
+    "04\022\022\n\007octaves\030\002 \001(\005:\0014\022\023\n\010intevals\030\003 \001(\005"
+    ":\0012\022\027\n\010extended\030\004 \001(\010:\005false\022\026\n\007upright\030"
+    "\005 \001(\010:\005false\"\224\001\n\013GFTTParamCP\022\031\n\013maxcornn"
+    "ers\030\001 \001(\005:\0041000\022\025\n\007quality\030\002 \001(\002:\0040.01\022\022"
+    "\n\007mindist\030\003 \001(\002:\0011\022\024\n\tblocksize\030\004 \001(\005:\0013"
+    "\022\030\n\tuseharris\030\005 \001(\010:\005false\022\017\n\001k\030\006 \001(\002:\0040"
+    ".04\"|\n\rHarrisParamCP\022\031\n\013maxcornners\030\001 \001("
+    "\005:\0041000\022\025\n\007quality\030\002 \001(\002:\0040.01\022\022\n\007mindis"
+    "t\030\003 \001(\002:\0011\022\024\n\tblocksize\030\004 \001(\005:\0013\022\017\n\001k\030\006 "
+    "\001(\002:\0040.04\"\302\001\n\014DenseParamCP\022\030\n\rinitfeatsc"
+    "ale\030\001 \001(\002:\0011\022\031\n\016featscalelevel\030\002 \001(\005:\0011\022"
+    "\031\n\014featscalemul\030\003 \001(\002:\0030.1\022\025\n\ninitxystep"
+    "\030\004 \001(\005:\0016\022\024\n\tinitbound\030\005 \001(\005:\0010\022\031\n\013varyx"
+    "yscale\030\006 \001(\010:\004true\022\032\n\013varybdscale\030\007 \001(\010:"
+    "\005false\"\023\n\021SimpleBlobParamCP\"\016\n\014AkazePara"
+    "mCP\"\264\006\n\020CVPointParameter\022.\n\004type\030\001 \001(\0162 "
+    ".svaf.CVPointParameter.PointType\022\024\n\005isad"
+    "d\030\002 \001(\010:\005false\022%\n\nfast_param\030\013 \001(\0132\021.sva"
+    "f.FastParamCP\022%\n\nmser_param\030\r \001(\0132\021.svaf"
+    ".MSERParamCP\022#\n\torb_param\030\016 \001(\0132\020.svaf.O"
+    "RBParamCP\022\'\n\013brisk_param\030\017 \001(\0132\022.svaf.Br"
+    "iskParamCP\022\'\n\013freak_param\030\020 \001(\0132\022.svaf.F"
+    "reakParamCP\022%\n\nstar_param\030\021 \001(\0132\021.svaf.S"
+    "tarParamCP\022%\n\nsift_param\030\022 \001(\0132\021.svaf.Si"
+    "ftParamCP\022%\n\nsurf_param\030\023 \001(\0132\021.svaf.Sur"
+    "fParamCP\022%\n\ngftt_param\030\024 \001(\0132\021.svaf.GFTT"
+    "ParamCP\022)\n\014harris_param\030\025 \001(\0132\023.svaf.Har"
+    "risParamCP\022\'\n\013dense_param\030\026 \001(\0132\022.svaf.D"
+    "enseParamCP\022)\n\010sb_param\030\027 \001(\0132\027.svaf.Sim"
+    "pleBlobParamCP\022\'\n\013akaze_param\030\030 \001(\0132\022.sv"
+    "af.AkazeParamCP\0220\n\014budget_param\030\003 \001(\0132\032."
+    "svaf.PointBudgetParameter\"\236\001\n\tPointType\022"
+    "\010\n\004FAST\020\001\022\t\n\005FASTX\020\002\022\010\n\004MSER\020\003\022\007\n\003ORB\020\004\022"
+    "\t\n\005BRISK\020\005\022\t\n\005FREAK\020\006\022\010\n\004STAR\020\007\022\010\n\004SIFT\020"
+    "\010\022\010\n\004SURF\020\t\022\010\n\004GFTT\020\n\022\n\n\006HARRIS\020\013\022\t\n\005DEN"
+    "SE\020\014\022\t\n\005SBLOB\020\r\022\t\n\005AKAZE\020\016\"\034\n\032FeatureDes"
+    "criptorParameter\"\031\n\027SIFTDescriptorParame"
+    "ter\"1\n\027SURFDescriptorParameter\022\026\n\007uprigh"
+    "t\030\001 \001(\010:\005false\"\031\n\027STARDescriptorParamete"
+    "r\"\032\n\030BRIEFDescriptorParameter\"\032\n\030BRISKDe"
+    "scriptorParameter\"\031\n\027FASTDescriptorParam"
+    "eter\"\030\n\026ORBDescriptorParameter\"\031\n\027KAZEDe"
+    "scriptorParameter\"!\n\013BriefDespCV\022\022\n\006leng"
+    "th\030\001 \001(\005:\00232\"\313\001\n\025CVDescriptorParameter\0222"
+    "\n\004type\030\001 \001(\0162$.svaf.CVDescriptorParamete"
+    "r.DespType\022&\n\013brief_param\030\002 \001(\0132\021.svaf.B"
+    "riefDespCV\"V\n\010DespType\022\010\n\004SIFT\020\001\022\010\n\004SURF"
+    "\020\002\022\t\n\005BRIEF\020\003\022\t\n\005BRISK\020\004\022\007\n\003ORB\020\005\022\t\n\005FRE"
+    "AK\020\006\022\014\n\010OPPONENT\020\007\"\026\n\024VectorMatchParamet"
+    "er\"\201\001\n\024KDTreeMatchParameter\022\020\n\005trees\030\001 \001"
+    "(\005:\0014\022\022\n\006checks\030\002 \001(\005:\00264\022\023\n\010leafsize\030\003 "
+    "\001(\005:\0018\022\024\n\006thresh\030\004 \001(\002:\0040.65\022\030\n\tkeeptrai"
+    "n\030\005 \001(\010:\005false\"F\n\023EularMatchParameter\022\024\n"
+    "\006thresh\030\001 \001(\002:\0040.65\022\031\n\ncrosscheck\030\002 \001(\010:"
+    "\005false\"\253\002\n\017RansacParameter\022\021\n\006thresh\030\001 \001"
+    "(\002:\0015\022:\n\005model\030\002 \001(\0162\037.svaf.RansacParame"
+    "ter.ModelType:\nHOMOGRAPHY\022\031\n\nconfidence\030"
+    "\003 \001(\002:\0050.995\022\026\n\010maxiters\030\004 \001(\005:\0042000\022\021\n\006"
+    "budget\030\005 \001(\002:\0010\022\024\n\006prosac\030\006 \001(\010:\004true\022\022\n"
+    "\004sprt\030\007 \001(\010:\004true\022\r\n\005calib\030\010 \001(\t\"J\n\tMode"
+    "lType\022\016\n\nHOMOGRAPHY\020\000\022\017\n\013FUNDAMENTAL\020\001\022\r"
+    "\n\tESSENTIAL\020\002\022\r\n\tDISPARITY\020\003\"\032\n\030BruteFor"
     "ceMatchParameter\"\025\n\023FLANNMatchParameter\""
-    "\022\n\020ECMatchParameter\"\234\001\n\020CVMatchParameter"
-    "\022.\n\004type\030\001 \001(\0162 .svaf.CVMatchParameter.M"
-    "atchType\022\030\n\ncrosscheck\030\002 \001(\010:\004true\">\n\tMa"
-    "tchType\022\010\n\004BFL1\020\001\022\010\n\004BFL2\020\002\022\010\n\004BFH1\020\003\022\010\n"
-    "\004BFH2\020\004\022\t\n\005FLANN\020\005\"\026\n\024StereoMatchParamet"
-    "er\"\242\001\n\021SGMMatchParameter\022\024\n\010max_disp\030\001 \001"
-    "(\005:\00224\022\024\n\006factor\030\002 \001(\005:\0042560\022\021\n\006dispmr\030\003"
-    " \001(\005:\0011\022\016\n\002r1\030\004 \001(\002:\00210\022\017\n\002r2\030\005 \001(\002:\003500"
-    "\022\025\n\006prefix\030\006 \001(\t:\005./sgm\022\026\n\007savetxt\030\007 \001(\010"
-    ":\005false\"\332\001\n\022EADPMatchParameter\022\024\n\010max_di"
-    "sp\030\001 \001(\005:\00224\022\024\n\006factor\030\002 \001(\005:\0042560\022\021\n\006gu"
-    "idmr\030\003 \001(\005:\0011\022\021\n\006dispmr\030\004 \001(\005:\0011\022\017\n\002sg\030\005"
-    " \001(\002:\003-25\022\020\n\002sc\030\006 \001(\002:\00425.5\022\016\n\002r1\030\007 \001(\002:"
-    "\00210\022\017\n\002r2\030\010 \001(\002:\003500\022\026\n\006prefix\030\t \001(\t:\006./"
-    "eadp\022\026\n\007savetxt\030\n \001(\010:\005false\"\021\n\017OutputPa"
-    "rameter\"\223\001\n\023TriangularParameter\022\025\n\007visib"
-    "le\030\001 \001(\010:\004true\022\023\n\013toolbox_dir\030\002 \001(\t\022\024\n\014c"
-    "alibmat_dir\030\003 \001(\t\022\025\n\006savepc\030\004 \001(\010:\005false"
-    "\022#\n\006pcname\030\005 \001(\t:\023./ref_pointcloud.pc\"P\n"
-    "\022MatrixMulParameter\022\020\n\010filename\030\001 \001(\t\022\014\n"
-    "\004col0\030\002 \001(\t\022\014\n\004col1\030\003 \001(\t\022\014\n\004col2\030\004 \001(\t\""
-    "\033\n\031PositionEstimateParameter\"\026\n\024CenterPo"
-    "intParameter\"e\n\017CoordiParameter\022\014\n\001x\030\001 \001"
-    "(\002:\0010\022\014\n\001y\030\002 \001(\002:\0010\022\014\n\001z\030\003 \001(\002:\0010\022\014\n\001a\030\004"
-    " \001(\002:\0010\022\014\n\001b\030\005 \001(\002:\0010\022\014\n\001c\030\006 \001(\002:\0010\"\230\001\n\016"
-    "SACIAParameter\022\026\n\010max_iter\030\001 \001(\005:\0041000\022\023"
-    "\n\010min_cors\030\002 \001(\002:\0013\022\026\n\010max_cors\030\003 \001(\002:\0041"
-    "000\022\025\n\nvoxel_grid\030\004 \001(\002:\0013\022\024\n\010norm_rad\030\005"
-    " \001(\002:\00220\022\024\n\010feat_rad\030\006 \001(\002:\00250\"\201\001\n\026SACIA"
-    "EstimateParameter\022\024\n\014pcd_filename\030\001 \001(\t\022"
-    "&\n\010ia_param\030\002 \001(\0132\024.svaf.SACIAParameter\022"
-    ")\n\ncoor_param\030\003 \001(\0132\025.svaf.CoordiParamet"
-    "er\"K\n\014ICPParameter\022\023\n\010max_iter\030\001 \001(\005:\0012\022"
-    "\024\n\010max_resp\030\002 \001(\002:\00210\022\020\n\003esp\030\003 \001(\002:\0030.1\""
-    "\253\001\n\026IAICPEstimateParameter\022\024\n\014pcd_filena"
-    "me\030\001 \001(\t\022)\n\013sacia_param\030\002 \001(\0132\024.svaf.SAC"
-    "IAParameter\022%\n\ticp_param\030\003 \001(\0132\022.svaf.IC"
-    "PParameter\022)\n\ncoor_param\030\004 \001(\0132\025.svaf.Co"
-    "ordiParameter\"f\n\014NDTParameter\022\025\n\010max_ite"
-    "r\030\001 \001(\005:\003100\022\025\n\tstep_size\030\002 \001(\002:\00210\022\026\n\nr"
-    "esolution\030\003 \001(\002:\00210\022\020\n\003esp\030\004 \001(\002:\0030.1\"\253\001"
-    "\n\026IANDTEstimateParameter\022\024\n\014pcd_filename"
-    "\030\001 \001(\t\022)\n\013sacia_param\030\002 \001(\0132\024.svaf.SACIA"
-    "Parameter\022%\n\tndt_param\030\003 \001(\0132\022.svaf.NDTP"
-    "arameter\022)\n\ncoor_param\030\004 \001(\0132\025.svaf.Coor"
-    "diParameter\"\245!\n\016LayerParameter\022\014\n\004name\030\001"
-    " \001(\t\022\016\n\006bottom\030\002 \001(\t\022\013\n\003top\030\003 \001(\t\022\023\n\004sho"
-    "w\030\004 \001(\010:\005false\022\023\n\004save\030\005 \001(\010:\005false\022\023\n\004l"
-    "ogt\030\006 \001(\010:\005false\022\023\n\004logi\030\007 \001(\010:\005false\022,\n"
-    "\004type\030\n \001(\0162\036.svaf.LayerParameter.LayerT"
-    "ype\0225\n\rimageop_param\030\310\001 \001(\0132\035.svaf.Image"
-    "OperationParameter\0226\n\013supix_param\030\311\001 \001(\013"
-    "2 .svaf.SuperPixelSegmentParameter\0221\n\014re"
-    "size_param\030\312\001 \001(\0132\032.svaf.ImageResizePara"
-    "meter\022-\n\ncrop_param\030\313\001 \001(\0132\030.svaf.ImageC"
-    "ropParameter\0227\n\016stereoop_param\030\360\001 \001(\0132\036."
-    "svaf.StereoOperationParameter\0224\n\rrectify"
-    "_param\030\361\001 \001(\0132\034.svaf.StereoRectifyParame"
-    "ter\022\'\n\ndata_param\030d \001(\0132\023.svaf.DataParam"
-    "eter\0221\n\017imagedata_param\030e \001(\0132\030.svaf.Ima"
-    "geDataParameter\0221\n\017imagepair_param\030f \001(\013"
-    "2\030.svaf.ImagePairParameter\0221\n\017videodata_"
-    "param\030g \001(\0132\030.svaf.VideoDataParameter\0221\n"
-    "\017videopair_param\030h \001(\0132\030.svaf.VideoPairP"
-    "arameter\0223\n\020cameradata_param\030i \001(\0132\031.sva"
-    "f.CameraDataParameter\0223\n\020camerapair_para"
-    "m\030j \001(\0132\031.svaf.CameraPairParameter\0229\n\023ds"
-    "pcameradata_param\030k \001(\0132\034.svaf.DSPCamera"
-    "DataParameter\0229\n\023dspcamerapair_param\030l \001"
-    "(\0132\034.svaf.DSPCameraPairParameter\0223\n\020kine"
-    "ctdata_param\030m \001(\0132\031.svaf.KinectDataPara"
-    "meter\0220\n\014folder_param\030o \001(\0132\032.svaf.Image"
-    "FolderParameter\0228\n\020pairfolder_param\030p \001("
-    "\0132\036.svaf.ImagePairFolderParameter\0221\n\017rec"
-    "ognize_param\030x \001(\0132\030.svaf.RecognizeParam"
-    "eter\022/\n\016adaboost_param\030y \001(\0132\027.svaf.Adab"
-    "oostParameter\022*\n\013track_param\030\202\001 \001(\0132\024.sv"
-    "af.TrackParameter\0220\n\016miltrack_param\030\203\001 \001"
-    "(\0132\027.svaf.MilTrackParameter\0220\n\016bittrack_"
-    "param\030\204\001 \001(\0132\027.svaf.MilTrackParameter\0228\n"
-    "\022featurepoint_param\030\214\001 \001(\0132\033.svaf.Featur"
-    "ePointParameter\0222\n\017siftpoint_param\030\215\001 \001("
-    "\0132\030.svaf.SIFTPointParameter\0222\n\017surfpoint"
-    "_param\030\216\001 \001(\0132\030.svaf.SURFPointParameter\022"
-    "2\n\017starpoint_param\030\217\001 \001(\0132\030.svaf.STARPoi"
-    "ntParameter\0224\n\020briskpoint_param\030\220\001 \001(\0132\031"
-    ".svaf.BRISKPointParameter\0222\n\017fastpoint_p"
-    "aram\030\221\001 \001(\0132\030.svaf.FASTPointParameter\0220\n"
-    "\016orbpoint_param\030\222\001 \001(\0132\027.svaf.ORBPointPa"
-    "rameter\0222\n\017kazepoint_param\030\223\001 \001(\0132\030.svaf"
-    ".KAZEPointParameter\0226\n\021harrispoint_param"
-    "\030\224\001 \001(\0132\032.svaf.HarrisPointParameter\022.\n\rc"
-    "vpoint_param\030\225\001 \001(\0132\026.svaf.CVPointParame"
-    "ter\022B\n\027featuredescriptor_param\030\226\001 \001(\0132 ."
-    "svaf.FeatureDescriptorParameter\022<\n\024siftd"
-    "escriptor_param\030\227\001 \001(\0132\035.svaf.SIFTDescri"
-    "ptorParameter\022<\n\024surfdescriptor_param\030\230\001"
-    " \001(\0132\035.svaf.SURFDescriptorParameter\022<\n\024s"
-    "tardescriptor_param\030\231\001 \001(\0132\035.svaf.STARDe"
-    "scriptorParameter\022>\n\025briefdescriptor_par"
-    "am\030\232\001 \001(\0132\036.svaf.BRIEFDescriptorParamete"
-    "r\022>\n\025briskdescriptor_param\030\233\001 \001(\0132\036.svaf"
-    ".BRISKDescriptorParameter\022<\n\024fastdescrip"
-    "tor_param\030\234\001 \001(\0132\035.svaf.FASTDescriptorPa"
-    "rameter\022:\n\023orbdescriptor_param\030\235\001 \001(\0132\034."
-    "svaf.ORBDescriptorParameter\022<\n\024kazedescr"
-    "iptor_param\030\236\001 \001(\0132\035.svaf.KAZEDescriptor"
-    "Parameter\0228\n\022cvdescriptor_param\030\237\001 \001(\0132\033"
-    ".svaf.CVDescriptorParameter\0226\n\021vectormat"
-    "ch_param\030\240\001 \001(\0132\032.svaf.VectorMatchParame"
-    "ter\0226\n\021kdtreematch_param\030\241\001 \001(\0132\032.svaf.K"
-    "DTreeMatchParameter\0224\n\020eularmatch_param\030"
-    "\242\001 \001(\0132\031.svaf.EularMatchParameter\022,\n\014ran"
-    "sac_param\030\243\001 \001(\0132\025.svaf.RansacParameter\022"
-    "6\n\rbfmatch_param\030\244\001 \001(\0132\036.svaf.BruteForc"
-    "eMatchParameter\0224\n\020flannmatch_param\030\245\001 \001"
-    "(\0132\031.svaf.FLANNMatchParameter\022.\n\recmatch"
-    "_param\030\250\001 \001(\0132\026.svaf.ECMatchParameter\022.\n"
-    "\rcvmatch_param\030\251\001 \001(\0132\026.svaf.CVMatchPara"
-    "meter\0226\n\021stereomatch_param\030\252\001 \001(\0132\032.svaf"
-    ".StereoMatchParameter\022+\n\tsgm_param\030\253\001 \001("
-    "\0132\027.svaf.SGMMatchParameter\022-\n\neadp_param"
-    "\030\254\001 \001(\0132\030.svaf.EADPMatchParameter\022,\n\014out"
-    "put_param\030\264\001 \001(\0132\025.svaf.OutputParameter\022"
-    "0\n\014triang_param\030\265\001 \001(\0132\031.svaf.Triangular"
-    "Parameter\022.\n\013mxmul_param\030\266\001 \001(\0132\030.svaf.M"
-    "atrixMulParameter\0226\n\014posest_param\030\276\001 \001(\013"
-    "2\037.svaf.PositionEstimateParameter\0226\n\021cen"
-    "terpoint_param\030\277\001 \001(\0132\032.svaf.CenterPoint"
-    "Parameter\0222\n\013sacia_param\030\302\001 \001(\0132\034.svaf.S"
-    "ACIAEstimateParameter\0222\n\013iaicp_param\030\303\001 "
-    "\001(\0132\034.svaf.IAICPEstimateParameter\0222\n\013ian"
-    "dt_param\030\304\001 \001(\0132\034.svaf.IANDTEstimatePara"
-    "meter\"\353\005\n\tLayerType\022\010\n\004NONE\020\000\022\t\n\005IMAGE\020\001"
-    "\022\016\n\nIMAGE_PAIR\020\002\022\t\n\005VIDEO\020\003\022\016\n\nVIDEO_PAI"
-    "R\020\004\022\n\n\006CAMERA\020\005\022\017\n\013CAMERA_PAIR\020\006\022\007\n\003DSP\020"
-    "\007\022\014\n\010DSP_PAIR\020\010\022\n\n\006KINECT\020\t\022\020\n\014IMAGE_FOL"
-    "DER\020\013\022\025\n\021IMAGE_PAIR_FOLDER\020\014\022\014\n\010ADABOOST"
-    "\020\025\022\014\n\010MILTRACK\020\037\022\014\n\010BITTRACK\020 \022\016\n\nSIFT_P"
-    "OINT\020)\022\016\n\nSURF_POINT\020*\022\016\n\nSTAR_POINT\020+\022\017"
-    "\n\013BRISK_POINT\020,\022\016\n\nFAST_POINT\020-\022\r\n\tORB_P"
-    "OINT\020.\022\016\n\nKAZE_POINT\020/\022\020\n\014HARRIS_POINT\0200"
-    "\022\014\n\010CV_POINT\0201\022\r\n\tSIFT_DESP\0203\022\r\n\tSURF_DE"
-    "SP\0204\022\r\n\tSTAR_DESP\0205\022\016\n\nBRIEF_DESP\0206\022\016\n\nB"
-    "RISK_DESP\0207\022\r\n\tFAST_DESP\0208\022\014\n\010ORB_DESP\0209"
-    "\022\r\n\tKAZE_DESP\020:\022\013\n\007CV_DESP\020;\022\020\n\014KDTREE_M"
-    "ATCH\020=\022\017\n\013EULAR_MATCH\020>\022\n\n\006RANSAC\020\?\022\014\n\010B"
-    "F_MATCH\020@\022\017\n\013FLANN_MATCH\020A\022\014\n\010EC_MATCH\020D"
-    "\022\014\n\010CV_MATCH\020E\022\r\n\tSGM_MATCH\020G\022\016\n\nEADP_MA"
-    "TCH\020H\022\n\n\006TRIANG\020Q\022\t\n\005MXMUL\020R\022\016\n\nCENTER_P"
-    "OS\020[\022\n\n\006IA_EST\020^\022\r\n\tIAICP_EST\020_\022\r\n\tIANDT"
-    "_EST\020`\022\r\n\tSUPIX_SEG\020e\022\014\n\007RECTIFY\020\215\001", 12035);
+    "x\n\020ECMatchParameter\022\021\n\006rowtol\030\001 \001(\005:\0011\022\017"
+    "\n\007mindisp\030\002 \001(\002\022\017\n\007maxdisp\030\003 \001(\002\022\024\n\006thre"
+    "sh\030\004 \001(\002:\0040.65\022\031\n\ncrosscheck\030\005 \001(\010:\005fals"
+    "e\"\234\001\n\020CVMatchParameter\022.\n\004type\030\001 \001(\0162 .s"
+    "vaf.CVMatchParameter.MatchType\022\030\n\ncrossc"
+    "heck\030\002 \001(\010:\004true\">\n\tMatchType\022\010\n\004BFL1\020\001\022"
+    "\010\n\004BFL2\020\002\022\010\n\004BFH1\020\003\022\010\n\004BFH2\020\004\022\t\n\005FLANN\020\005"
+    "\"\026\n\024StereoMatchParameter\"\340\002\n\021SGMMatchPar"
+    "ameter\022\024\n\010max_disp\030\001 \001(\005:\00224\022\024\n\006factor\030\002"
+    " \001(\005:\0042560\022\021\n\006dispmr\030\003 \001(\005:\0011\022\016\n\002r1\030\004 \001("
+    "\002:\00210\022\017\n\002r2\030\005 \001(\002:\003500\022\025\n\006prefix\030\006 \001(\t:\005"
+    "./sgm\022\026\n\007savetxt\030\007 \001(\010:\005false\022\022\n\007pyramid"
+    "\030\010 \001(\005:\0010\022\021\n\006margin\030\t \001(\005:\0012\022\027\n\010temporal"
+    "\030\n \001(\010:\005false\022\020\n\004tile\030\013 \001(\005:\00216\022\021\n\006motio"
+    "n\030\014 \001(\005:\0018\022\025\n\nuniqueness\030\r \001(\005:\0010\022\027\n\010sub"
+    "pixel\030\016 \001(\010:\005false\022\021\n\003roi\030\017 \001(\010:\004true\022\024\n"
+    "\006points\030\020 \001(\010:\004true\"\230\002\n\022EADPMatchParamet"
+    "er\022\024\n\010max_disp\030\001 \001(\005:\00224\022\024\n\006factor\030\002 \001(\005"
+    ":\0042560\022\021\n\006guidmr\030\003 \001(\005:\0011\022\021\n\006dispmr\030\004 \001("
+    "\005:\0011\022\017\n\002sg\030\005 \001(\002:\003-25\022\020\n\002sc\030\006 \001(\002:\00425.5\022"
+    "\016\n\002r1\030\007 \001(\002:\00210\022\017\n\002r2\030\010 \001(\002:\003500\022\026\n\006pref"
+    "ix\030\t \001(\t:\006./eadp\022\026\n\007savetxt\030\n \001(\010:\005false"
+    "\022\023\n\004fast\030\013 \001(\010:\005false\022\021\n\003roi\030\014 \001(\010:\004true"
+    "\022\024\n\006points\030\r \001(\010:\004true\"\021\n\017OutputParamete"
+    "r\"\231\002\n\023TriangularParameter\022\025\n\007visible\030\001 \001"
+    "(\010:\004true\022\023\n\013toolbox_dir\030\002 \001(\t\022\024\n\014calibma"
+    "t_dir\030\003 \001(\t\022\025\n\006savepc\030\004 \001(\010:\005false\022#\n\006pc"
+    "name\030\005 \001(\t:\023./ref_pointcloud.pc\022+\n\tcalib"
+    "_raw\030\006 \001(\t:\030Calib_Results_stereo.yml\0226\n\n"
+    "calib_rect\030\007 \001(\t:\"Calib_Results_stereo_r"
+    "ectified.yml\022\r\n\005calib\030\010 \001(\t\022\020\n\005voxel\030\t \001"
+    "(\002:\0010\"\363\001\n\022ReprojectParameter\022\022\n\ncalib_fi"
+    "le\030\001 \001(\t\022\n\n\002fx\030\002 \001(\002\022\n\n\002fy\030\003 \001(\002\022\n\n\002cx\030\004"
+    " \001(\002\022\n\n\002cy\030\005 \001(\002\022\020\n\010cx_right\030\006 \001(\002\022\020\n\010ba"
+    "seline\030\007 \001(\002\022\021\n\006stride\030\010 \001(\005:\0011\022\024\n\005color"
+    "\030\t \001(\010:\005false\022\024\n\006pointl\030\n \001(\010:\004true\022\025\n\006s"
+    "avepc\030\013 \001(\010:\005false\022\r\n\005calib\030\014 \001(\t\022\020\n\005vox"
+    "el\030\r \001(\002:\0010\"_\n\022MatrixMulParameter\022\020\n\010fil"
+    "ename\030\001 \001(\t\022\014\n\004col0\030\002 \001(\t\022\014\n\004col1\030\003 \001(\t\022"
+    "\014\n\004col2\030\004 \001(\t\022\r\n\005calib\030\005 \001(\t\"\033\n\031Position"
+    "EstimateParameter\"\026\n\024CenterPointParamete"
+    "r\"\364\001\n\024FeaturePoolParameter\022\026\n\010capacity\030\001"
+    " \001(\005:\0045000\022\024\n\006thresh\030\002 \001(\002:\0040.65\022\020\n\004cell"
+    "\030\003 \001(\002:\00210\022\021\n\006radius\030\004 \001(\002:\0015\022\021\n\006inlier\030"
+    "\005 \001(\002:\0015\022\022\n\005iters\030\006 \001(\005:\003200\022\023\n\010minmatch"
+    "\030\007 \001(\005:\0016\022\020\n\005trees\030\010 \001(\005:\0014\022\022\n\006checks\030\t "
+    "\001(\005:\00264\022\023\n\005store\030\n \001(\010:\004true\022\022\n\007maxfail\030"
+    "\013 \001(\005:\0015\"e\n\017CoordiParameter\022\014\n\001x\030\001 \001(\002:\001"
+    "0\022\014\n\001y\030\002 \001(\002:\0010\022\014\n\001z\030\003 \001(\002:\0010\022\014\n\001a\030\004 \001(\002"
+    ":\0010\022\014\n\001b\030\005 \001(\002:\0010\022\014\n\001c\030\006 \001(\002:\0010\"\230\001\n\016SACI"
+    "AParameter\022\026\n\010max_iter\030\001 \001(\005:\0041000\022\023\n\010mi"
+    "n_cors\030\002 \001(\002:\0013\022\026\n\010max_cors\030\003 \001(\002:\0041000\022"
+    "\025\n\nvoxel_grid\030\004 \001(\002:\0013\022\024\n\010norm_rad\030\005 \001(\002"
+    ":\00220\022\024\n\010feat_rad\030\006 \001(\002:\00250\"\201\001\n\026SACIAEsti"
+    "mateParameter\022\024\n\014pcd_filename\030\001 \001(\t\022&\n\010i"
+    "a_param\030\002 \001(\0132\024.svaf.SACIAParameter\022)\n\nc"
+    "oor_param\030\003 \001(\0132\025.svaf.CoordiParameter\"K"
+    "\n\014ICPParameter\022\023\n\010max_iter\030\001 \001(\005:\0012\022\024\n\010m"
+    "ax_resp\030\002 \001(\002:\00210\022\020\n\003esp\030\003 \001(\002:\0030.1\"\253\001\n\026"
+    "IAICPEstimateParameter\022\024\n\014pcd_filename\030\001"
+    " \001(\t\022)\n\013sacia_param\030\002 \001(\0132\024.svaf.SACIAPa"
+    "rameter\022%\n\ticp_param\030\003 \001(\0132\022.svaf.ICPPar"
+    "ameter\022)\n\ncoor_param\030\004 \001(\0132\025.svaf.Coordi"
+    "Parameter\"f\n\014NDTParameter\022\025\n\010max_iter\030\001 "
+    "\001(\005:\003100\022\025\n\tstep_size\030\002 \001(\002:\00210\022\026\n\nresol"
+    "ution\030\003 \001(\002:\00210\022\020\n\003esp\030\004 \001(\002:\0030.1\"\253\001\n\026IA"
+    "NDTEstimateParameter\022\024\n\014pcd_filename\030\001 \001"
+    "(\t\022)\n\013sacia_param\030\002 \001(\0132\024.svaf.SACIAPara"
+    "meter\022%\n\tndt_param\030\003 \001(\0132\022.svaf.NDTParam"
+    "eter\022)\n\ncoor_param\030\004 \001(\0132\025.svaf.CoordiPa"
+    "rameter\"\254\"\n\016LayerParameter\022\014\n\004name\030\001 \001(\t"
+    "\022\016\n\006bottom\030\002 \001(\t\022\013\n\003top\030\003 \001(\t\022\023\n\004show\030\004 "
+    "\001(\010:\005false\022\023\n\004save\030\005 \001(\010:\005false\022\023\n\004logt\030"
+    "\006 \001(\010:\005false\022\023\n\004logi\030\007 \001(\010:\005false\022,\n\004typ"
+    "e\030\n \001(\0162\036.svaf.LayerParameter.LayerType\022"
+    "5\n\rimageop_param\030\310\001 \001(\0132\035.svaf.ImageOper"
+    "ationParameter\0226\n\013supix_param\030\311\001 \001(\0132 .s"
+    "vaf.SuperPixelSegmentParameter\0221\n\014resize"
+    "_param\030\312\001 \001(\0132\032.svaf.ImageResizeParamete"
+    "r\022-\n\ncrop_param\030\313\001 \001(\0132\030.svaf.ImageCropP"
+    "arameter\0227\n\016stereoop_param\030\360\001 \001(\0132\036.svaf"
+    ".StereoOperationParameter\0224\n\rrectify_par"
+    "am\030\361\001 \001(\0132\034.svaf.StereoRectifyParameter\022"
+    "\'\n\ndata_param\030d \001(\0132\023.svaf.DataParameter"
+    "\0221\n\017imagedata_param\030e \001(\0132\030.svaf.ImageDa"
+    "taParameter\0221\n\017imagepair_param\030f \001(\0132\030.s"
+    "vaf.ImagePairParameter\0221\n\017videodata_para"
+    "m\030g \001(\0132\030.svaf.VideoDataParameter\0221\n\017vid"
+    "eopair_param\030h \001(\0132\030.svaf.VideoPairParam"
+    "eter\0223\n\020cameradata_param\030i \001(\0132\031.svaf.Ca"
+    "meraDataParameter\0223\n\020camerapair_param\030j "
+    "\001(\0132\031.svaf.CameraPairParameter\0229\n\023dspcam"
+    "eradata_param\030k \001(\0132\034.svaf.DSPCameraData"
+    "Parameter\0229\n\023dspcamerapair_param\030l \001(\0132\034"
+    ".svaf.DSPCameraPairParameter\0223\n\020kinectda"
+    "ta_param\030m \001(\0132\031.svaf.KinectDataParamete"
+    "r\0220\n\014folder_param\030o \001(\0132\032.svaf.ImageFold"
+    "erParameter\0228\n\020pairfolder_param\030p \001(\0132\036."
+    "svaf.ImagePairFolderParameter\0221\n\017recogni"
+    "ze_param\030x \001(\0132\030.svaf.RecognizeParameter"
+    "\022/\n\016adaboost_param\030y \001(\0132\027.svaf.Adaboost"
+    "Parameter\022*\n\013track_param\030\202\001 \001(\0132\024.svaf.T"
+    "rackParameter\0220\n\016miltrack_param\030\203\001 \001(\0132\027"
+    ".svaf.MilTrackParameter\0220\n\016bittrack_para"
+    "m\030\204\001 \001(\0132\027.svaf.MilTrackParameter\0228\n\022fea"
+    "turepoint_param\030\214\001 \001(\0132\033.svaf.FeaturePoi"
+    "ntParameter\0222\n\017siftpoint_param\030\215\001 \001(\0132\030."
+    "svaf.SIFTPointParameter\0222\n\017surfpoint_par"
+    "am\030\216\001 \001(\0132\030.svaf.SURFPointParameter\0222\n\017s"
+    "tarpoint_param\030\217\001 \001(\0132\030.svaf.STARPointPa"
+    "rameter\0224\n\020briskpoint_param\030\220\001 \001(\0132\031.sva"
+    "f.BRISKPointParameter\0222\n\017fastpoint_param"
+    "\030\221\001 \001(\0132\030.svaf.FASTPointParameter\0220\n\016orb"
+    "point_param\030\222\001 \001(\0132\027.svaf.ORBPointParame"
+    "ter\0222\n\017kazepoint_param\030\223\001 \001(\0132\030.svaf.KAZ"
+    "EPointParameter\0226\n\021harrispoint_param\030\224\001 "
+    "\001(\0132\032.svaf.HarrisPointParameter\022.\n\rcvpoi"
+    "nt_param\030\225\001 \001(\0132\026.svaf.CVPointParameter\022"
+    "B\n\027featuredescriptor_param\030\226\001 \001(\0132 .svaf"
+    ".FeatureDescriptorParameter\022<\n\024siftdescr"
+    "iptor_param\030\227\001 \001(\0132\035.svaf.SIFTDescriptor"
+    "Parameter\022<\n\024surfdescriptor_param\030\230\001 \001(\013"
+    "2\035.svaf.SURFDescriptorParameter\022<\n\024stard"
+    "escriptor_param\030\231\001 \001(\0132\035.svaf.STARDescri"
+    "ptorParameter\022>\n\025briefdescriptor_param\030\232"
+    "\001 \001(\0132\036.svaf.BRIEFDescriptorParameter\022>\n"
+    "\025briskdescriptor_param\030\233\001 \001(\0132\036.svaf.BRI"
+    "SKDescriptorParameter\022<\n\024fastdescriptor_"
+    "param\030\234\001 \001(\0132\035.svaf.FASTDescriptorParame"
+    "ter\022:\n\023orbdescriptor_param\030\235\001 \001(\0132\034.svaf"
+    ".ORBDescriptorParameter\022<\n\024kazedescripto"
+    "r_param\030\236\001 \001(\0132\035.svaf.KAZEDescriptorPara"
+    "meter\0228\n\022cvdescriptor_param\030\237\001 \001(\0132\033.sva"
+    "f.CVDescriptorParameter\0226\n\021vectormatch_p"
+    "aram\030\240\001 \001(\0132\032.svaf.VectorMatchParameter\022"
+    "6\n\021kdtreematch_param\030\241\001 \001(\0132\032.svaf.KDTre"
+    "eMatchParameter\0224\n\020eularmatch_param\030\242\001 \001"
+    "(\0132\031.svaf.EularMatchParameter\022,\n\014ransac_"
+    "param\030\243\001 \001(\0132\025.svaf.RansacParameter\0226\n\rb"
+    "fmatch_param\030\244\001 \001(\0132\036.svaf.BruteForceMat"
+    "chParameter\0224\n\020flannmatch_param\030\245\001 \001(\0132\031"
+    ".svaf.FLANNMatchParameter\022.\n\recmatch_par"
+    "am\030\250\001 \001(\0132\026.svaf.ECMatchParameter\022.\n\rcvm"
+    "atch_param\030\251\001 \001(\0132\026.svaf.CVMatchParamete"
+    "r\0226\n\021stereomatch_param\030\252\001 \001(\0132\032.svaf.Ste"
+    "reoMatchParameter\022+\n\tsgm_param\030\253\001 \001(\0132\027."
+    "svaf.SGMMatchParameter\022-\n\neadp_param\030\254\001 "
+    "\001(\0132\030.svaf.EADPMatchParameter\022,\n\014output_"
+    "param\030\264\001 \001(\0132\025.svaf.OutputParameter\0220\n\014t"
+    "riang_param\030\265\001 \001(\0132\031.svaf.TriangularPara"
+    "meter\022.\n\013mxmul_param\030\266\001 \001(\0132\030.svaf.Matri"
+    "xMulParameter\0222\n\017reproject_param\030\267\001 \001(\0132"
+    "\030.svaf.ReprojectParameter\0226\n\014posest_para"
+    "m\030\276\001 \001(\0132\037.svaf.PositionEstimateParamete"
+    "r\0226\n\021centerpoint_param\030\277\001 \001(\0132\032.svaf.Cen"
+    "terPointParameter\0223\n\016featpool_param\030\301\001 \001"
+    "(\0132\032.svaf.FeaturePoolParameter\0222\n\013sacia_"
+    "param\030\302\001 \001(\0132\034.svaf.SACIAEstimateParamet"
+    "er\0222\n\013iaicp_param\030\303\001 \001(\0132\034.svaf.IAICPEst"
+    "imateParameter\0222\n\013iandt_param\030\304\001 \001(\0132\034.s"
+    "vaf.IANDTEstimateParameter\"\211\006\n\tLayerType"
+    "\022\010\n\004NONE\020\000\022\t\n\005IMAGE\020\001\022\016\n\nIMAGE_PAIR\020\002\022\t\n"
+    "\005VIDEO\020\003\022\016\n\nVIDEO_PAIR\020\004\022\n\n\006CAMERA\020\005\022\017\n\013"
+    "CAMERA_PAIR\020\006\022\007\n\003DSP\020\007\022\014\n\010DSP_PAIR\020\010\022\n\n\006"
+    "KINECT\020\t\022\020\n\014IMAGE_FOLDER\020\013\022\025\n\021IMAGE_PAIR"
+    "_FOLDER\020\014\022\014\n\010ADABOOST\020\025\022\014\n\010MILTRACK\020\037\022\014\n"
+    "\010BITTRACK\020 \022\016\n\nSIFT_POINT\020)\022\016\n\nSURF_POIN"
+    "T\020*\022\016\n\nSTAR_POINT\020+\022\017\n\013BRISK_POINT\020,\022\016\n\n"
+    "FAST_POINT\020-\022\r\n\tORB_POINT\020.\022\016\n\nKAZE_POIN"
+    "T\020/\022\020\n\014HARRIS_POINT\0200\022\014\n\010CV_POINT\0201\022\r\n\tS"
+    "IFT_DESP\0203\022\r\n\tSURF_DESP\0204\022\r\n\tSTAR_DESP\0205"
+    "\022\016\n\nBRIEF_DESP\0206\022\016\n\nBRISK_DESP\0207\022\r\n\tFAST"
+    "_DESP\0208\022\014\n\010ORB_DESP\0209\022\r\n\tKAZE_DESP\020:\022\013\n\007"
+    "CV_DESP\020;\022\020\n\014KDTREE_MATCH\020=\022\017\n\013EULAR_MAT"
+    "CH\020>\022\n\n\006RANSAC\020\?\022\014\n\010BF_MATCH\020@\022\017\n\013FLANN_"
+    "MATCH\020A\022\014\n\010EC_MATCH\020D\022\014\n\010CV_MATCH\020E\022\r\n\tS"
+    "GM_MATCH\020G\022\016\n\nEADP_MATCH\020H\022\n\n\006TRIANG\020Q\022\t"
+    "\n\005MXMUL\020R\022\r\n\tREPROJECT\020S\022\016\n\nCENTER_POS\020["
+    "\022\r\n\tFEAT_POOL\020]\022\n\n\006IA_EST\020^\022\r\n\tIAICP_EST"
+    "\020_\022\r\n\tIANDT_EST\020`\022\r\n\tSUPIX_SEG\020e\022\014\n\007RECT"
+    "IFY\020\215\001", 13846);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "svaf.proto", &protobuf_RegisterTypes);
   SvafTask::_default_name_ =
@@ -2437,6 +2621,8 @@ void protobuf_AddDesc_svaf_2eproto() {
   ImageResizeParameter::default_instance_ = new ImageResizeParameter();
   ImageCropParameter::default_instance_ = new ImageCropParameter();
   StereoOperationParameter::default_instance_ = new StereoOperationParameter();
+  StereoRectifyParameter::_default_cache_dir_ =
+      new ::std::string("./calib/", 8);
   StereoRectifyParameter::default_instance_ = new StereoRectifyParameter();
   DataParameter::default_instance_ = new DataParameter();
   ImageDataParameter::default_instance_ = new ImageDataParameter();
@@ -2460,6 +2646,7 @@ void protobuf_AddDesc_svaf_2eproto() {
   FeaturePointParameter::default_instance_ = new FeaturePointParameter();
   SIFTPointParameter::default_instance_ = new SIFTPointParameter();
   SURFPointParameter::default_instance_ = new SURFPointParameter();
+  PointBudgetParameter::default_instance_ = new PointBudgetParameter();
   STARPointParameter::default_instance_ = new STARPointParameter();
   BRISKPointParameter::default_instance_ = new BRISKPointParameter();
   FASTPointParameter::default_instance_ = new FASTPointParameter();
@@ -2509,10 +2696,16 @@ void protobuf_AddDesc_svaf_2eproto() {
   OutputParameter::default_instance_ = new OutputParameter();
   TriangularParameter::_default_pcname_ =
       new ::std::string("./ref_pointcloud.pc", 19);
+  TriangularParameter::_default_calib_raw_ =
+      new ::std::string("Calib_Results_stereo.yml", 24);
+  TriangularParameter::_default_calib_rect_ =
+      new ::std::string("Calib_Results_stereo_rectified.yml", 34);
   TriangularParameter::default_instance_ = new TriangularParameter();
+  ReprojectParameter::default_instance_ = new ReprojectParameter();
   MatrixMulParameter::default_instance_ = new MatrixMulParameter();
   PositionEstimateParameter::default_instance_ = new PositionEstimateParameter();
   CenterPointParameter::default_instance_ = new CenterPointParameter();
+  FeaturePoolParameter::default_instance_ = new FeaturePoolParameter();
   CoordiParameter::default_instance_ = new CoordiParameter();
   SACIAParameter::default_instance_ = new SACIAParameter();
   SACIAEstimateParameter::default_instance_ = new SACIAEstimateParameter();
@@ -2550,6 +2743,7 @@ void protobuf_AddDesc_svaf_2eproto() {
   FeaturePointParameter::default_instance_->InitAsDefaultInstance();
   SIFTPointParameter::default_instance_->InitAsDefaultInstance();
   SURFPointParameter::default_instance_->InitAsDefaultInstance();
+  PointBudgetParameter::default_instance_->InitAsDefaultInstance();
   STARPointParameter::default_instance_->InitAsDefaultInstance();
   BRISKPointParameter::default_instance_->InitAsDefaultInstance();
   FASTPointParameter::default_instance_->InitAsDefaultInstance();
@@ -2594,9 +2788,11 @@ void protobuf_AddDesc_svaf_2eproto() {
   EADPMatchParameter::default_instance_->InitAsDefaultInstance();
   OutputParameter::default_instance_->InitAsDefaultInstance();
   TriangularParameter::default_instance_->InitAsDefaultInstance();
+  ReprojectParameter::default_instance_->InitAsDefaultInstance();
   MatrixMulParameter::default_instance_->InitAsDefaultInstance();
   PositionEstimateParameter::default_instance_->InitAsDefaultInstance();
   CenterPointParameter::default_instance_->InitAsDefaultInstance();
+  FeaturePoolParameter::default_instance_->InitAsDefaultInstance();
   CoordiParameter::default_instance_->InitAsDefaultInstance();
   SACIAParameter::default_instance_->InitAsDefaultInstance();
   SACIAEstimateParameter::default_instance_->InitAsDefaultInstance();
@@ -4094,8 +4290,11 @@ void StereoOperationParameter::Swap(StereoOperationParameter* other) {
 
 // ===================================================================
 
+::std::string* StereoRectifyParameter::_default_cache_dir_ = NULL;
 #ifndef _MSC_VER
 const int StereoRectifyParameter::kFilenameFieldNumber;
+const int StereoRectifyParameter::kCalibFieldNumber;
+const int StereoRectifyParameter::kCacheDirFieldNumber;
 #endif  // !_MSC_VER
 
 StereoRectifyParameter::StereoRectifyParameter()
@@ -4118,6 +4317,8 @@ void StereoRectifyParameter::SharedCtor() {
   ::google::protobuf::internal::GetEmptyString();
   _cached_size_ = 0;
   filename_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  calib_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  cache_dir_ = const_cast< ::std::string*>(_default_cache_dir_);
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -4130,6 +4331,12 @@ void StereoRectifyParameter::SharedDtor() {
   if (filename_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
     delete filename_;
   }
+  if (calib_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete calib_;
+  }
+  if (cache_dir_ != _default_cache_dir_) {
+    delete cache_dir_;
+  }
   if (this != default_instance_) {
   }
 }
@@ -4156,9 +4363,21 @@ StereoRectifyParameter* StereoRectifyParameter::New() const {
 }
 
 void StereoRectifyParameter::Clear() {
-  if (has_filename()) {
-    if (filename_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-      filename_->clear();
+  if (_has_bits_[0 / 32] & 7) {
+    if (has_filename()) {
+      if (filename_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        filename_->clear();
+      }
+    }
+    if (has_calib()) {
+      if (calib_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        calib_->clear();
+      }
+    }
+    if (has_cache_dir()) {
+      if (cache_dir_ != _default_cache_dir_) {
+        cache_dir_->assign(*_default_cache_dir_);
+      }
     }
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
@@ -4187,6 +4406,40 @@ bool StereoRectifyParameter::MergePartialFromCodedStream(
         } else {
           goto handle_unusual;
         }
+        if (input->ExpectTag(18)) goto parse_calib;
+        break;
+      }
+
+      // optional string calib = 2;
+      case 2: {
+        if (tag == 18) {
+         parse_calib:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_calib()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->calib().data(), this->calib().length(),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "calib");
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(26)) goto parse_cache_dir;
+        break;
+      }
+
+      // optional string cache_dir = 3 [default = "./calib/"];
+      case 3: {
+        if (tag == 26) {
+         parse_cache_dir:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_cache_dir()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->cache_dir().data(), this->cache_dir().length(),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "cache_dir");
+        } else {
+          goto handle_unusual;
+        }
         if (input->ExpectAtEnd()) goto success;
         break;
       }
@@ -4226,6 +4479,26 @@ void StereoRectifyParameter::SerializeWithCachedSizes(
       1, this->filename(), output);
   }
 
+  // optional string calib = 2;
+  if (has_calib()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->calib().data(), this->calib().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "calib");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      2, this->calib(), output);
+  }
+
+  // optional string cache_dir = 3 [default = "./calib/"];
+  if (has_cache_dir()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->cache_dir().data(), this->cache_dir().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "cache_dir");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      3, this->cache_dir(), output);
+  }
+
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -4247,6 +4520,28 @@ void StereoRectifyParameter::SerializeWithCachedSizes(
         1, this->filename(), target);
   }
 
+  // optional string calib = 2;
+  if (has_calib()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->calib().data(), this->calib().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "calib");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->calib(), target);
+  }
+
+  // optional string cache_dir = 3 [default = "./calib/"];
+  if (has_cache_dir()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->cache_dir().data(), this->cache_dir().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "cache_dir");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        3, this->cache_dir(), target);
+  }
+
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -4266,6 +4561,20 @@ int StereoRectifyParameter::ByteSize() const {
           this->filename());
     }
 
+    // optional string calib = 2;
+    if (has_calib()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->calib());
+    }
+
+    // optional string cache_dir = 3 [default = "./calib/"];
+    if (has_cache_dir()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->cache_dir());
+    }
+
   }
   if (!unknown_fields().empty()) {
     total_size +=
@@ -4296,6 +4605,12 @@ void StereoRectifyParameter::MergeFrom(const StereoRectifyParameter& from) {
     if (from.has_filename()) {
       set_filename(from.filename());
     }
+    if (from.has_calib()) {
+      set_calib(from.calib());
+    }
+    if (from.has_cache_dir()) {
+      set_cache_dir(from.cache_dir());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -4320,6 +4635,8 @@ bool StereoRectifyParameter::IsInitialized() const {
 void StereoRectifyParameter::Swap(StereoRectifyParameter* other) {
   if (other != this) {
     std::swap(filename_, other->filename_);
+    std::swap(calib_, other->calib_);
+    std::swap(cache_dir_, other->cache_dir_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
@@ -10601,6 +10918,7 @@ const int SURFPointParameter::kStrideFieldNumber;
 const int SURFPointParameter::kOctavesFieldNumber;
 const int SURFPointParameter::kIntervalsFieldNumber;
 const int SURFPointParameter::kThreshFieldNumber;
+const int SURFPointParameter::kBudgetParamFieldNumber;
 #endif  // !_MSC_VER
 
 SURFPointParameter::SURFPointParameter()
@@ -10610,6 +10928,7 @@ SURFPointParameter::SURFPointParameter()
 }
 
 void SURFPointParameter::InitAsDefaultInstance() {
+  budget_param_ = const_cast< ::svaf::PointBudgetParameter*>(&::svaf::PointBudgetParameter::default_instance());
 }
 
 SURFPointParameter::SURFPointParameter(const SURFPointParameter& from)
@@ -10625,6 +10944,7 @@ void SURFPointParameter::SharedCtor() {
   octaves_ = 5;
   intervals_ = 4;
   thresh_ = 0.0004f;
+  budget_param_ = NULL;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -10635,6 +10955,7 @@ SURFPointParameter::~SURFPointParameter() {
 
 void SURFPointParameter::SharedDtor() {
   if (this != default_instance_) {
+    delete budget_param_;
   }
 }
 
@@ -10660,11 +10981,14 @@ SURFPointParameter* SURFPointParameter::New() const {
 }
 
 void SURFPointParameter::Clear() {
-  if (_has_bits_[0 / 32] & 15) {
+  if (_has_bits_[0 / 32] & 31) {
     stride_ = 2;
     octaves_ = 5;
     intervals_ = 4;
     thresh_ = 0.0004f;
+    if (has_budget_param()) {
+      if (budget_param_ != NULL) budget_param_->::svaf::PointBudgetParameter::Clear();
+    }
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
@@ -10735,6 +11059,19 @@ bool SURFPointParameter::MergePartialFromCodedStream(
         } else {
           goto handle_unusual;
         }
+        if (input->ExpectTag(42)) goto parse_budget_param;
+        break;
+      }
+
+      // optional .svaf.PointBudgetParameter budget_param = 5;
+      case 5: {
+        if (tag == 42) {
+         parse_budget_param:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_budget_param()));
+        } else {
+          goto handle_unusual;
+        }
         if (input->ExpectAtEnd()) goto success;
         break;
       }
@@ -10784,6 +11121,12 @@ void SURFPointParameter::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormatLite::WriteFloat(4, this->thresh(), output);
   }
 
+  // optional .svaf.PointBudgetParameter budget_param = 5;
+  if (has_budget_param()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      5, this->budget_param(), output);
+  }
+
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -10814,6 +11157,13 @@ void SURFPointParameter::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(4, this->thresh(), target);
   }
 
+  // optional .svaf.PointBudgetParameter budget_param = 5;
+  if (has_budget_param()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        5, this->budget_param(), target);
+  }
+
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -10852,6 +11202,13 @@ int SURFPointParameter::ByteSize() const {
       total_size += 1 + 4;
     }
 
+    // optional .svaf.PointBudgetParameter budget_param = 5;
+    if (has_budget_param()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->budget_param());
+    }
+
   }
   if (!unknown_fields().empty()) {
     total_size +=
@@ -10891,6 +11248,9 @@ void SURFPointParameter::MergeFrom(const SURFPointParameter& from) {
     if (from.has_thresh()) {
       set_thresh(from.thresh());
     }
+    if (from.has_budget_param()) {
+      mutable_budget_param()->::svaf::PointBudgetParameter::MergeFrom(from.budget_param());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -10918,6 +11278,7 @@ void SURFPointParameter::Swap(SURFPointParameter* other) {
     std::swap(octaves_, other->octaves_);
     std::swap(intervals_, other->intervals_);
     std::swap(thresh_, other->thresh_);
+    std::swap(budget_param_, other->budget_param_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
@@ -10936,116 +11297,295 @@ void SURFPointParameter::Swap(SURFPointParameter* other) {
 // ===================================================================
 
 #ifndef _MSC_VER
+const int PointBudgetParameter::kBudgetFieldNumber;
+const int PointBudgetParameter::kGridColsFieldNumber;
+const int PointBudgetParameter::kGridRowsFieldNumber;
+const int PointBudgetParameter::kAdaptiveFieldNumber;
+const int PointBudgetParameter::kOvershootFieldNumber;
 #endif  // !_MSC_VER
 
-STARPointParameter::STARPointParameter()
+PointBudgetParameter::PointBudgetParameter()
   : ::google::protobuf::Message() {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:svaf.STARPointParameter)
+  // @@protoc_insertion_point(constructor:svaf.PointBudgetParameter)
 }
 
-void STARPointParameter::InitAsDefaultInstance() {
+void PointBudgetParameter::InitAsDefaultInstance() {
 }
 
-STARPointParameter::STARPointParameter(const STARPointParameter& from)
+PointBudgetParameter::PointBudgetParameter(const PointBudgetParameter& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:svaf.STARPointParameter)
+  // @@protoc_insertion_point(copy_constructor:svaf.PointBudgetParameter)
 }
 
-void STARPointParameter::SharedCtor() {
+void PointBudgetParameter::SharedCtor() {
   _cached_size_ = 0;
+  budget_ = 0;
+  grid_cols_ = 8;
+  grid_rows_ = 6;
+  adaptive_ = true;
+  overshoot_ = 1.5f;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-STARPointParameter::~STARPointParameter() {
-  // @@protoc_insertion_point(destructor:svaf.STARPointParameter)
+PointBudgetParameter::~PointBudgetParameter() {
+  // @@protoc_insertion_point(destructor:svaf.PointBudgetParameter)
   SharedDtor();
 }
 
-void STARPointParameter::SharedDtor() {
+void PointBudgetParameter::SharedDtor() {
   if (this != default_instance_) {
   }
 }
 
-void STARPointParameter::SetCachedSize(int size) const {
+void PointBudgetParameter::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* STARPointParameter::descriptor() {
+const ::google::protobuf::Descriptor* PointBudgetParameter::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return STARPointParameter_descriptor_;
+  return PointBudgetParameter_descriptor_;
 }
 
-const STARPointParameter& STARPointParameter::default_instance() {
+const PointBudgetParameter& PointBudgetParameter::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_svaf_2eproto();
   return *default_instance_;
 }
 
-STARPointParameter* STARPointParameter::default_instance_ = NULL;
+PointBudgetParameter* PointBudgetParameter::default_instance_ = NULL;
 
-STARPointParameter* STARPointParameter::New() const {
-  return new STARPointParameter;
+PointBudgetParameter* PointBudgetParameter::New() const {
+  return new PointBudgetParameter;
 }
 
-void STARPointParameter::Clear() {
+void PointBudgetParameter::Clear() {
+  if (_has_bits_[0 / 32] & 31) {
+    budget_ = 0;
+    grid_cols_ = 8;
+    grid_rows_ = 6;
+    adaptive_ = true;
+    overshoot_ = 1.5f;
+  }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool STARPointParameter::MergePartialFromCodedStream(
+bool PointBudgetParameter::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:svaf.STARPointParameter)
+  // @@protoc_insertion_point(parse_start:svaf.PointBudgetParameter)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
-  handle_unusual:
-    if (tag == 0 ||
-        ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-        ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-      goto success;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional int32 budget = 1 [default = 0];
+      case 1: {
+        if (tag == 8) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &budget_)));
+          set_has_budget();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(16)) goto parse_grid_cols;
+        break;
+      }
+
+      // optional int32 grid_cols = 2 [default = 8];
+      case 2: {
+        if (tag == 16) {
+         parse_grid_cols:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &grid_cols_)));
+          set_has_grid_cols();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(24)) goto parse_grid_rows;
+        break;
+      }
+
+      // optional int32 grid_rows = 3 [default = 6];
+      case 3: {
+        if (tag == 24) {
+         parse_grid_rows:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &grid_rows_)));
+          set_has_grid_rows();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(32)) goto parse_adaptive;
+        break;
+      }
+
+      // optional bool adaptive = 4 [default = true];
+      case 4: {
+        if (tag == 32) {
+         parse_adaptive:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &adaptive_)));
+          set_has_adaptive();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(45)) goto parse_overshoot;
+        break;
+      }
+
+      // optional float overshoot = 5 [default = 1.5];
+      case 5: {
+        if (tag == 45) {
+         parse_overshoot:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &overshoot_)));
+          set_has_overshoot();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectAtEnd()) goto success;
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
     }
-    DO_(::google::protobuf::internal::WireFormat::SkipField(
-          input, tag, mutable_unknown_fields()));
   }
 success:
-  // @@protoc_insertion_point(parse_success:svaf.STARPointParameter)
+  // @@protoc_insertion_point(parse_success:svaf.PointBudgetParameter)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:svaf.STARPointParameter)
+  // @@protoc_insertion_point(parse_failure:svaf.PointBudgetParameter)
   return false;
 #undef DO_
 }
 
-void STARPointParameter::SerializeWithCachedSizes(
+void PointBudgetParameter::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:svaf.STARPointParameter)
+  // @@protoc_insertion_point(serialize_start:svaf.PointBudgetParameter)
+  // optional int32 budget = 1 [default = 0];
+  if (has_budget()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->budget(), output);
+  }
+
+  // optional int32 grid_cols = 2 [default = 8];
+  if (has_grid_cols()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->grid_cols(), output);
+  }
+
+  // optional int32 grid_rows = 3 [default = 6];
+  if (has_grid_rows()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->grid_rows(), output);
+  }
+
+  // optional bool adaptive = 4 [default = true];
+  if (has_adaptive()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(4, this->adaptive(), output);
+  }
+
+  // optional float overshoot = 5 [default = 1.5];
+  if (has_overshoot()) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(5, this->overshoot(), output);
+  }
+
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
   }
-  // @@protoc_insertion_point(serialize_end:svaf.STARPointParameter)
+  // @@protoc_insertion_point(serialize_end:svaf.PointBudgetParameter)
 }
 
-::google::protobuf::uint8* STARPointParameter::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* PointBudgetParameter::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:svaf.STARPointParameter)
+  // @@protoc_insertion_point(serialize_to_array_start:svaf.PointBudgetParameter)
+  // optional int32 budget = 1 [default = 0];
+  if (has_budget()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->budget(), target);
+  }
+
+  // optional int32 grid_cols = 2 [default = 8];
+  if (has_grid_cols()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->grid_cols(), target);
+  }
+
+  // optional int32 grid_rows = 3 [default = 6];
+  if (has_grid_rows()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->grid_rows(), target);
+  }
+
+  // optional bool adaptive = 4 [default = true];
+  if (has_adaptive()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(4, this->adaptive(), target);
+  }
+
+  // optional float overshoot = 5 [default = 1.5];
+  if (has_overshoot()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(5, this->overshoot(), target);
+  }
+
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:svaf.STARPointParameter)
+  // @@protoc_insertion_point(serialize_to_array_end:svaf.PointBudgetParameter)
   return target;
 }
 
-int STARPointParameter::ByteSize() const {
+int PointBudgetParameter::ByteSize() const {
   int total_size = 0;
 
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional int32 budget = 1 [default = 0];
+    if (has_budget()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->budget());
+    }
+
+    // optional int32 grid_cols = 2 [default = 8];
+    if (has_grid_cols()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->grid_cols());
+    }
+
+    // optional int32 grid_rows = 3 [default = 6];
+    if (has_grid_rows()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->grid_rows());
+    }
+
+    // optional bool adaptive = 4 [default = true];
+    if (has_adaptive()) {
+      total_size += 1 + 1;
+    }
+
+    // optional float overshoot = 5 [default = 1.5];
+    if (has_overshoot()) {
+      total_size += 1 + 4;
+    }
+
+  }
   if (!unknown_fields().empty()) {
     total_size +=
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
@@ -11057,10 +11597,10 @@ int STARPointParameter::ByteSize() const {
   return total_size;
 }
 
-void STARPointParameter::MergeFrom(const ::google::protobuf::Message& from) {
+void PointBudgetParameter::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const STARPointParameter* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const STARPointParameter*>(
+  const PointBudgetParameter* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const PointBudgetParameter*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -11069,9 +11609,206 @@ void STARPointParameter::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void STARPointParameter::MergeFrom(const STARPointParameter& from) {
+void PointBudgetParameter::MergeFrom(const PointBudgetParameter& from) {
   GOOGLE_CHECK_NE(&from, this);
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_budget()) {
+      set_budget(from.budget());
+    }
+    if (from.has_grid_cols()) {
+      set_grid_cols(from.grid_cols());
+    }
+    if (from.has_grid_rows()) {
+      set_grid_rows(from.grid_rows());
+    }
+    if (from.has_adaptive()) {
+      set_adaptive(from.adaptive());
+    }
+    if (from.has_overshoot()) {
+      set_overshoot(from.overshoot());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void PointBudgetParameter::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void PointBudgetParameter::CopyFrom(const PointBudgetParameter& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PointBudgetParameter::IsInitialized() const {
+
+  return true;
+}
+
+void PointBudgetParameter::Swap(PointBudgetParameter* other) {
+  if (other != this) {
+    std::swap(budget_, other->budget_);
+    std::swap(grid_cols_, other->grid_cols_);
+    std::swap(grid_rows_, other->grid_rows_);
+    std::swap(adaptive_, other->adaptive_);
+    std::swap(overshoot_, other->overshoot_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata PointBudgetParameter::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = PointBudgetParameter_descriptor_;
+  metadata.reflection = PointBudgetParameter_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+#endif  // !_MSC_VER
+
+STARPointParameter::STARPointParameter()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:svaf.STARPointParameter)
+}
+
+void STARPointParameter::InitAsDefaultInstance() {
+}
+
+STARPointParameter::STARPointParameter(const STARPointParameter& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+  // @@protoc_insertion_point(copy_constructor:svaf.STARPointParameter)
+}
+
+void STARPointParameter::SharedCtor() {
+  _cached_size_ = 0;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+STARPointParameter::~STARPointParameter() {
+  // @@protoc_insertion_point(destructor:svaf.STARPointParameter)
+  SharedDtor();
+}
+
+void STARPointParameter::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void STARPointParameter::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* STARPointParameter::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return STARPointParameter_descriptor_;
+}
+
+const STARPointParameter& STARPointParameter::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_svaf_2eproto();
+  return *default_instance_;
+}
+
+STARPointParameter* STARPointParameter::default_instance_ = NULL;
+
+STARPointParameter* STARPointParameter::New() const {
+  return new STARPointParameter;
+}
+
+void STARPointParameter::Clear() {
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool STARPointParameter::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:svaf.STARPointParameter)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+  handle_unusual:
+    if (tag == 0 ||
+        ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+        ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+      goto success;
+    }
+    DO_(::google::protobuf::internal::WireFormat::SkipField(
+          input, tag, mutable_unknown_fields()));
+  }
+success:
+  // @@protoc_insertion_point(parse_success:svaf.STARPointParameter)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:svaf.STARPointParameter)
+  return false;
+#undef DO_
+}
+
+void STARPointParameter::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:svaf.STARPointParameter)
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:svaf.STARPointParameter)
+}
+
+::google::protobuf::uint8* STARPointParameter::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:svaf.STARPointParameter)
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:svaf.STARPointParameter)
+  return target;
+}
+
+int STARPointParameter::ByteSize() const {
+  int total_size = 0;
+
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void STARPointParameter::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const STARPointParameter* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const STARPointParameter*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void STARPointParameter::MergeFrom(const STARPointParameter& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
 void STARPointParameter::CopyFrom(const ::google::protobuf::Message& from) {
@@ -16869,6 +17606,7 @@ const int CVPointParameter::kHarrisParamFieldNumber;
 const int CVPointParameter::kDenseParamFieldNumber;
 const int CVPointParameter::kSbParamFieldNumber;
 const int CVPointParameter::kAkazeParamFieldNumber;
+const int CVPointParameter::kBudgetParamFieldNumber;
 #endif  // !_MSC_VER
 
 CVPointParameter::CVPointParameter()
@@ -16891,6 +17629,7 @@ void CVPointParameter::InitAsDefaultInstance() {
   dense_param_ = const_cast< ::svaf::DenseParamCP*>(&::svaf::DenseParamCP::default_instance());
   sb_param_ = const_cast< ::svaf::SimpleBlobParamCP*>(&::svaf::SimpleBlobParamCP::default_instance());
   akaze_param_ = const_cast< ::svaf::AkazeParamCP*>(&::svaf::AkazeParamCP::default_instance());
+  budget_param_ = const_cast< ::svaf::PointBudgetParameter*>(&::svaf::PointBudgetParameter::default_instance());
 }
 
 CVPointParameter::CVPointParameter(const CVPointParameter& from)
@@ -16917,6 +17656,7 @@ void CVPointParameter::SharedCtor() {
   dense_param_ = NULL;
   sb_param_ = NULL;
   akaze_param_ = NULL;
+  budget_param_ = NULL;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -16940,6 +17680,7 @@ void CVPointParameter::SharedDtor() {
     delete dense_param_;
     delete sb_param_;
     delete akaze_param_;
+    delete budget_param_;
   }
 }
 
@@ -16987,7 +17728,7 @@ void CVPointParameter::Clear() {
       if (star_param_ != NULL) star_param_->::svaf::StarParamCP::Clear();
     }
   }
-  if (_has_bits_[8 / 32] & 32512) {
+  if (_has_bits_[8 / 32] & 65280) {
     if (has_sift_param()) {
       if (sift_param_ != NULL) sift_param_->::svaf::SiftParamCP::Clear();
     }
@@ -17009,6 +17750,9 @@ void CVPointParameter::Clear() {
     if (has_akaze_param()) {
       if (akaze_param_ != NULL) akaze_param_->::svaf::AkazeParamCP::Clear();
     }
+    if (has_budget_param()) {
+      if (budget_param_ != NULL) budget_param_->::svaf::PointBudgetParameter::Clear();
+    }
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
@@ -17054,6 +17798,19 @@ bool CVPointParameter::MergePartialFromCodedStream(
         } else {
           goto handle_unusual;
         }
+        if (input->ExpectTag(26)) goto parse_budget_param;
+        break;
+      }
+
+      // optional .svaf.PointBudgetParameter budget_param = 3;
+      case 3: {
+        if (tag == 26) {
+         parse_budget_param:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_budget_param()));
+        } else {
+          goto handle_unusual;
+        }
         if (input->ExpectTag(90)) goto parse_fast_param;
         break;
       }
@@ -17263,6 +18020,12 @@ void CVPointParameter::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormatLite::WriteBool(2, this->isadd(), output);
   }
 
+  // optional .svaf.PointBudgetParameter budget_param = 3;
+  if (has_budget_param()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3, this->budget_param(), output);
+  }
+
   // optional .svaf.FastParamCP fast_param = 11;
   if (has_fast_param()) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
@@ -17362,6 +18125,13 @@ void CVPointParameter::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(2, this->isadd(), target);
   }
 
+  // optional .svaf.PointBudgetParameter budget_param = 3;
+  if (has_budget_param()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        3, this->budget_param(), target);
+  }
+
   // optional .svaf.FastParamCP fast_param = 11;
   if (has_fast_param()) {
     target = ::google::protobuf::internal::WireFormatLite::
@@ -17569,6 +18339,13 @@ int CVPointParameter::ByteSize() const {
           this->akaze_param());
     }
 
+    // optional .svaf.PointBudgetParameter budget_param = 3;
+    if (has_budget_param()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->budget_param());
+    }
+
   }
   if (!unknown_fields().empty()) {
     total_size +=
@@ -17643,6 +18420,9 @@ void CVPointParameter::MergeFrom(const CVPointParameter& from) {
     if (from.has_akaze_param()) {
       mutable_akaze_param()->::svaf::AkazeParamCP::MergeFrom(from.akaze_param());
     }
+    if (from.has_budget_param()) {
+      mutable_budget_param()->::svaf::PointBudgetParameter::MergeFrom(from.budget_param());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -17681,6 +18461,7 @@ void CVPointParameter::Swap(CVPointParameter* other) {
     std::swap(dense_param_, other->dense_param_);
     std::swap(sb_param_, other->sb_param_);
     std::swap(akaze_param_, other->akaze_param_);
+    std::swap(budget_param_, other->budget_param_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
@@ -20012,6 +20793,11 @@ void VectorMatchParameter::Swap(VectorMatchParameter* other) {
 // ===================================================================
 
 #ifndef _MSC_VER
+const int KDTreeMatchParameter::kTreesFieldNumber;
+const int KDTreeMatchParameter::kChecksFieldNumber;
+const int KDTreeMatchParameter::kLeafsizeFieldNumber;
+const int KDTreeMatchParameter::kThreshFieldNumber;
+const int KDTreeMatchParameter::kKeeptrainFieldNumber;
 #endif  // !_MSC_VER
 
 KDTreeMatchParameter::KDTreeMatchParameter()
@@ -20032,6 +20818,11 @@ KDTreeMatchParameter::KDTreeMatchParameter(const KDTreeMatchParameter& from)
 
 void KDTreeMatchParameter::SharedCtor() {
   _cached_size_ = 0;
+  trees_ = 4;
+  checks_ = 64;
+  leafsize_ = 8;
+  thresh_ = 0.65f;
+  keeptrain_ = false;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -20067,6 +20858,13 @@ KDTreeMatchParameter* KDTreeMatchParameter::New() const {
 }
 
 void KDTreeMatchParameter::Clear() {
+  if (_has_bits_[0 / 32] & 31) {
+    trees_ = 4;
+    checks_ = 64;
+    leafsize_ = 8;
+    thresh_ = 0.65f;
+    keeptrain_ = false;
+  }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
@@ -20080,48 +20878,210 @@ bool KDTreeMatchParameter::MergePartialFromCodedStream(
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
-  handle_unusual:
-    if (tag == 0 ||
-        ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-        ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-      goto success;
-    }
-    DO_(::google::protobuf::internal::WireFormat::SkipField(
-          input, tag, mutable_unknown_fields()));
-  }
-success:
-  // @@protoc_insertion_point(parse_success:svaf.KDTreeMatchParameter)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:svaf.KDTreeMatchParameter)
-  return false;
-#undef DO_
-}
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional int32 trees = 1 [default = 4];
+      case 1: {
+        if (tag == 8) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &trees_)));
+          set_has_trees();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(16)) goto parse_checks;
+        break;
+      }
 
-void KDTreeMatchParameter::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:svaf.KDTreeMatchParameter)
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:svaf.KDTreeMatchParameter)
-}
+      // optional int32 checks = 2 [default = 64];
+      case 2: {
+        if (tag == 16) {
+         parse_checks:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &checks_)));
+          set_has_checks();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(24)) goto parse_leafsize;
+        break;
+      }
 
-::google::protobuf::uint8* KDTreeMatchParameter::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:svaf.KDTreeMatchParameter)
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:svaf.KDTreeMatchParameter)
-  return target;
+      // optional int32 leafsize = 3 [default = 8];
+      case 3: {
+        if (tag == 24) {
+         parse_leafsize:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &leafsize_)));
+          set_has_leafsize();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(37)) goto parse_thresh;
+        break;
+      }
+
+      // optional float thresh = 4 [default = 0.65];
+      case 4: {
+        if (tag == 37) {
+         parse_thresh:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &thresh_)));
+          set_has_thresh();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(40)) goto parse_keeptrain;
+        break;
+      }
+
+      // optional bool keeptrain = 5 [default = false];
+      case 5: {
+        if (tag == 40) {
+         parse_keeptrain:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &keeptrain_)));
+          set_has_keeptrain();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectAtEnd()) goto success;
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:svaf.KDTreeMatchParameter)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:svaf.KDTreeMatchParameter)
+  return false;
+#undef DO_
+}
+
+void KDTreeMatchParameter::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:svaf.KDTreeMatchParameter)
+  // optional int32 trees = 1 [default = 4];
+  if (has_trees()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->trees(), output);
+  }
+
+  // optional int32 checks = 2 [default = 64];
+  if (has_checks()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->checks(), output);
+  }
+
+  // optional int32 leafsize = 3 [default = 8];
+  if (has_leafsize()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->leafsize(), output);
+  }
+
+  // optional float thresh = 4 [default = 0.65];
+  if (has_thresh()) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(4, this->thresh(), output);
+  }
+
+  // optional bool keeptrain = 5 [default = false];
+  if (has_keeptrain()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(5, this->keeptrain(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:svaf.KDTreeMatchParameter)
+}
+
+::google::protobuf::uint8* KDTreeMatchParameter::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:svaf.KDTreeMatchParameter)
+  // optional int32 trees = 1 [default = 4];
+  if (has_trees()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->trees(), target);
+  }
+
+  // optional int32 checks = 2 [default = 64];
+  if (has_checks()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->checks(), target);
+  }
+
+  // optional int32 leafsize = 3 [default = 8];
+  if (has_leafsize()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->leafsize(), target);
+  }
+
+  // optional float thresh = 4 [default = 0.65];
+  if (has_thresh()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(4, this->thresh(), target);
+  }
+
+  // optional bool keeptrain = 5 [default = false];
+  if (has_keeptrain()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(5, this->keeptrain(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:svaf.KDTreeMatchParameter)
+  return target;
 }
 
 int KDTreeMatchParameter::ByteSize() const {
   int total_size = 0;
 
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional int32 trees = 1 [default = 4];
+    if (has_trees()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->trees());
+    }
+
+    // optional int32 checks = 2 [default = 64];
+    if (has_checks()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->checks());
+    }
+
+    // optional int32 leafsize = 3 [default = 8];
+    if (has_leafsize()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->leafsize());
+    }
+
+    // optional float thresh = 4 [default = 0.65];
+    if (has_thresh()) {
+      total_size += 1 + 4;
+    }
+
+    // optional bool keeptrain = 5 [default = false];
+    if (has_keeptrain()) {
+      total_size += 1 + 1;
+    }
+
+  }
   if (!unknown_fields().empty()) {
     total_size +=
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
@@ -20147,6 +21107,23 @@ void KDTreeMatchParameter::MergeFrom(const ::google::protobuf::Message& from) {
 
 void KDTreeMatchParameter::MergeFrom(const KDTreeMatchParameter& from) {
   GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_trees()) {
+      set_trees(from.trees());
+    }
+    if (from.has_checks()) {
+      set_checks(from.checks());
+    }
+    if (from.has_leafsize()) {
+      set_leafsize(from.leafsize());
+    }
+    if (from.has_thresh()) {
+      set_thresh(from.thresh());
+    }
+    if (from.has_keeptrain()) {
+      set_keeptrain(from.keeptrain());
+    }
+  }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
@@ -20169,6 +21146,12 @@ bool KDTreeMatchParameter::IsInitialized() const {
 
 void KDTreeMatchParameter::Swap(KDTreeMatchParameter* other) {
   if (other != this) {
+    std::swap(trees_, other->trees_);
+    std::swap(checks_, other->checks_);
+    std::swap(leafsize_, other->leafsize_);
+    std::swap(thresh_, other->thresh_);
+    std::swap(keeptrain_, other->keeptrain_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
@@ -20187,6 +21170,7 @@ void KDTreeMatchParameter::Swap(KDTreeMatchParameter* other) {
 
 #ifndef _MSC_VER
 const int EularMatchParameter::kThreshFieldNumber;
+const int EularMatchParameter::kCrosscheckFieldNumber;
 #endif  // !_MSC_VER
 
 EularMatchParameter::EularMatchParameter()
@@ -20208,6 +21192,7 @@ EularMatchParameter::EularMatchParameter(const EularMatchParameter& from)
 void EularMatchParameter::SharedCtor() {
   _cached_size_ = 0;
   thresh_ = 0.65f;
+  crosscheck_ = false;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -20243,7 +21228,10 @@ EularMatchParameter* EularMatchParameter::New() const {
 }
 
 void EularMatchParameter::Clear() {
-  thresh_ = 0.65f;
+  if (_has_bits_[0 / 32] & 3) {
+    thresh_ = 0.65f;
+    crosscheck_ = false;
+  }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
@@ -20268,6 +21256,21 @@ bool EularMatchParameter::MergePartialFromCodedStream(
         } else {
           goto handle_unusual;
         }
+        if (input->ExpectTag(16)) goto parse_crosscheck;
+        break;
+      }
+
+      // optional bool crosscheck = 2 [default = false];
+      case 2: {
+        if (tag == 16) {
+         parse_crosscheck:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &crosscheck_)));
+          set_has_crosscheck();
+        } else {
+          goto handle_unusual;
+        }
         if (input->ExpectAtEnd()) goto success;
         break;
       }
@@ -20302,6 +21305,11 @@ void EularMatchParameter::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->thresh(), output);
   }
 
+  // optional bool crosscheck = 2 [default = false];
+  if (has_crosscheck()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(2, this->crosscheck(), output);
+  }
+
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -20317,6 +21325,11 @@ void EularMatchParameter::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->thresh(), target);
   }
 
+  // optional bool crosscheck = 2 [default = false];
+  if (has_crosscheck()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(2, this->crosscheck(), target);
+  }
+
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -20334,6 +21347,11 @@ int EularMatchParameter::ByteSize() const {
       total_size += 1 + 4;
     }
 
+    // optional bool crosscheck = 2 [default = false];
+    if (has_crosscheck()) {
+      total_size += 1 + 1;
+    }
+
   }
   if (!unknown_fields().empty()) {
     total_size +=
@@ -20364,6 +21382,9 @@ void EularMatchParameter::MergeFrom(const EularMatchParameter& from) {
     if (from.has_thresh()) {
       set_thresh(from.thresh());
     }
+    if (from.has_crosscheck()) {
+      set_crosscheck(from.crosscheck());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -20388,6 +21409,7 @@ bool EularMatchParameter::IsInitialized() const {
 void EularMatchParameter::Swap(EularMatchParameter* other) {
   if (other != this) {
     std::swap(thresh_, other->thresh_);
+    std::swap(crosscheck_, other->crosscheck_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
@@ -20405,8 +21427,40 @@ void EularMatchParameter::Swap(EularMatchParameter* other) {
 
 // ===================================================================
 
+const ::google::protobuf::EnumDescriptor* RansacParameter_ModelType_descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return RansacParameter_ModelType_descriptor_;
+}
+bool RansacParameter_ModelType_IsValid(int value) {
+  switch(value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#ifndef _MSC_VER
+const RansacParameter_ModelType RansacParameter::HOMOGRAPHY;
+const RansacParameter_ModelType RansacParameter::FUNDAMENTAL;
+const RansacParameter_ModelType RansacParameter::ESSENTIAL;
+const RansacParameter_ModelType RansacParameter::DISPARITY;
+const RansacParameter_ModelType RansacParameter::ModelType_MIN;
+const RansacParameter_ModelType RansacParameter::ModelType_MAX;
+const int RansacParameter::ModelType_ARRAYSIZE;
+#endif  // _MSC_VER
 #ifndef _MSC_VER
 const int RansacParameter::kThreshFieldNumber;
+const int RansacParameter::kModelFieldNumber;
+const int RansacParameter::kConfidenceFieldNumber;
+const int RansacParameter::kMaxitersFieldNumber;
+const int RansacParameter::kBudgetFieldNumber;
+const int RansacParameter::kProsacFieldNumber;
+const int RansacParameter::kSprtFieldNumber;
+const int RansacParameter::kCalibFieldNumber;
 #endif  // !_MSC_VER
 
 RansacParameter::RansacParameter()
@@ -20426,8 +21480,16 @@ RansacParameter::RansacParameter(const RansacParameter& from)
 }
 
 void RansacParameter::SharedCtor() {
+  ::google::protobuf::internal::GetEmptyString();
   _cached_size_ = 0;
   thresh_ = 5;
+  model_ = 0;
+  confidence_ = 0.995f;
+  maxiters_ = 2000;
+  budget_ = 0;
+  prosac_ = true;
+  sprt_ = true;
+  calib_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -20437,6 +21499,9 @@ RansacParameter::~RansacParameter() {
 }
 
 void RansacParameter::SharedDtor() {
+  if (calib_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete calib_;
+  }
   if (this != default_instance_) {
   }
 }
@@ -20463,7 +21528,20 @@ RansacParameter* RansacParameter::New() const {
 }
 
 void RansacParameter::Clear() {
-  thresh_ = 5;
+  if (_has_bits_[0 / 32] & 255) {
+    thresh_ = 5;
+    model_ = 0;
+    confidence_ = 0.995f;
+    maxiters_ = 2000;
+    budget_ = 0;
+    prosac_ = true;
+    sprt_ = true;
+    if (has_calib()) {
+      if (calib_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        calib_->clear();
+      }
+    }
+  }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
@@ -20488,54 +21566,249 @@ bool RansacParameter::MergePartialFromCodedStream(
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectAtEnd()) goto success;
+        if (input->ExpectTag(16)) goto parse_model;
         break;
       }
 
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
+      // optional .svaf.RansacParameter.ModelType model = 2 [default = HOMOGRAPHY];
+      case 2: {
+        if (tag == 16) {
+         parse_model:
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::svaf::RansacParameter_ModelType_IsValid(value)) {
+            set_model(static_cast< ::svaf::RansacParameter_ModelType >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(2, value);
+          }
+        } else {
+          goto handle_unusual;
         }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
+        if (input->ExpectTag(29)) goto parse_confidence;
         break;
       }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:svaf.RansacParameter)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:svaf.RansacParameter)
-  return false;
-#undef DO_
-}
-
-void RansacParameter::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:svaf.RansacParameter)
-  // optional float thresh = 1 [default = 5];
-  if (has_thresh()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->thresh(), output);
-  }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:svaf.RansacParameter)
-}
+      // optional float confidence = 3 [default = 0.995];
+      case 3: {
+        if (tag == 29) {
+         parse_confidence:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &confidence_)));
+          set_has_confidence();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(32)) goto parse_maxiters;
+        break;
+      }
 
-::google::protobuf::uint8* RansacParameter::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:svaf.RansacParameter)
-  // optional float thresh = 1 [default = 5];
-  if (has_thresh()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->thresh(), target);
-  }
+      // optional int32 maxiters = 4 [default = 2000];
+      case 4: {
+        if (tag == 32) {
+         parse_maxiters:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &maxiters_)));
+          set_has_maxiters();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(45)) goto parse_budget;
+        break;
+      }
+
+      // optional float budget = 5 [default = 0];
+      case 5: {
+        if (tag == 45) {
+         parse_budget:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &budget_)));
+          set_has_budget();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(48)) goto parse_prosac;
+        break;
+      }
+
+      // optional bool prosac = 6 [default = true];
+      case 6: {
+        if (tag == 48) {
+         parse_prosac:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &prosac_)));
+          set_has_prosac();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(56)) goto parse_sprt;
+        break;
+      }
+
+      // optional bool sprt = 7 [default = true];
+      case 7: {
+        if (tag == 56) {
+         parse_sprt:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &sprt_)));
+          set_has_sprt();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(66)) goto parse_calib;
+        break;
+      }
+
+      // optional string calib = 8;
+      case 8: {
+        if (tag == 66) {
+         parse_calib:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_calib()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->calib().data(), this->calib().length(),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "calib");
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectAtEnd()) goto success;
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:svaf.RansacParameter)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:svaf.RansacParameter)
+  return false;
+#undef DO_
+}
+
+void RansacParameter::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:svaf.RansacParameter)
+  // optional float thresh = 1 [default = 5];
+  if (has_thresh()) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->thresh(), output);
+  }
+
+  // optional .svaf.RansacParameter.ModelType model = 2 [default = HOMOGRAPHY];
+  if (has_model()) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      2, this->model(), output);
+  }
+
+  // optional float confidence = 3 [default = 0.995];
+  if (has_confidence()) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->confidence(), output);
+  }
+
+  // optional int32 maxiters = 4 [default = 2000];
+  if (has_maxiters()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(4, this->maxiters(), output);
+  }
+
+  // optional float budget = 5 [default = 0];
+  if (has_budget()) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(5, this->budget(), output);
+  }
+
+  // optional bool prosac = 6 [default = true];
+  if (has_prosac()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(6, this->prosac(), output);
+  }
+
+  // optional bool sprt = 7 [default = true];
+  if (has_sprt()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(7, this->sprt(), output);
+  }
+
+  // optional string calib = 8;
+  if (has_calib()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->calib().data(), this->calib().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "calib");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      8, this->calib(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:svaf.RansacParameter)
+}
+
+::google::protobuf::uint8* RansacParameter::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:svaf.RansacParameter)
+  // optional float thresh = 1 [default = 5];
+  if (has_thresh()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->thresh(), target);
+  }
+
+  // optional .svaf.RansacParameter.ModelType model = 2 [default = HOMOGRAPHY];
+  if (has_model()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      2, this->model(), target);
+  }
+
+  // optional float confidence = 3 [default = 0.995];
+  if (has_confidence()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->confidence(), target);
+  }
+
+  // optional int32 maxiters = 4 [default = 2000];
+  if (has_maxiters()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(4, this->maxiters(), target);
+  }
+
+  // optional float budget = 5 [default = 0];
+  if (has_budget()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(5, this->budget(), target);
+  }
+
+  // optional bool prosac = 6 [default = true];
+  if (has_prosac()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(6, this->prosac(), target);
+  }
+
+  // optional bool sprt = 7 [default = true];
+  if (has_sprt()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(7, this->sprt(), target);
+  }
+
+  // optional string calib = 8;
+  if (has_calib()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->calib().data(), this->calib().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "calib");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        8, this->calib(), target);
+  }
 
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
@@ -20554,6 +21827,46 @@ int RansacParameter::ByteSize() const {
       total_size += 1 + 4;
     }
 
+    // optional .svaf.RansacParameter.ModelType model = 2 [default = HOMOGRAPHY];
+    if (has_model()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->model());
+    }
+
+    // optional float confidence = 3 [default = 0.995];
+    if (has_confidence()) {
+      total_size += 1 + 4;
+    }
+
+    // optional int32 maxiters = 4 [default = 2000];
+    if (has_maxiters()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->maxiters());
+    }
+
+    // optional float budget = 5 [default = 0];
+    if (has_budget()) {
+      total_size += 1 + 4;
+    }
+
+    // optional bool prosac = 6 [default = true];
+    if (has_prosac()) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool sprt = 7 [default = true];
+    if (has_sprt()) {
+      total_size += 1 + 1;
+    }
+
+    // optional string calib = 8;
+    if (has_calib()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->calib());
+    }
+
   }
   if (!unknown_fields().empty()) {
     total_size +=
@@ -20584,6 +21897,27 @@ void RansacParameter::MergeFrom(const RansacParameter& from) {
     if (from.has_thresh()) {
       set_thresh(from.thresh());
     }
+    if (from.has_model()) {
+      set_model(from.model());
+    }
+    if (from.has_confidence()) {
+      set_confidence(from.confidence());
+    }
+    if (from.has_maxiters()) {
+      set_maxiters(from.maxiters());
+    }
+    if (from.has_budget()) {
+      set_budget(from.budget());
+    }
+    if (from.has_prosac()) {
+      set_prosac(from.prosac());
+    }
+    if (from.has_sprt()) {
+      set_sprt(from.sprt());
+    }
+    if (from.has_calib()) {
+      set_calib(from.calib());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -20608,6 +21942,13 @@ bool RansacParameter::IsInitialized() const {
 void RansacParameter::Swap(RansacParameter* other) {
   if (other != this) {
     std::swap(thresh_, other->thresh_);
+    std::swap(model_, other->model_);
+    std::swap(confidence_, other->confidence_);
+    std::swap(maxiters_, other->maxiters_);
+    std::swap(budget_, other->budget_);
+    std::swap(prosac_, other->prosac_);
+    std::swap(sprt_, other->sprt_);
+    std::swap(calib_, other->calib_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
@@ -20974,6 +22315,11 @@ void FLANNMatchParameter::Swap(FLANNMatchParameter* other) {
 // ===================================================================
 
 #ifndef _MSC_VER
+const int ECMatchParameter::kRowtolFieldNumber;
+const int ECMatchParameter::kMindispFieldNumber;
+const int ECMatchParameter::kMaxdispFieldNumber;
+const int ECMatchParameter::kThreshFieldNumber;
+const int ECMatchParameter::kCrosscheckFieldNumber;
 #endif  // !_MSC_VER
 
 ECMatchParameter::ECMatchParameter()
@@ -20994,6 +22340,11 @@ ECMatchParameter::ECMatchParameter(const ECMatchParameter& from)
 
 void ECMatchParameter::SharedCtor() {
   _cached_size_ = 0;
+  rowtol_ = 1;
+  mindisp_ = 0;
+  maxdisp_ = 0;
+  thresh_ = 0.65f;
+  crosscheck_ = false;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -21029,6 +22380,26 @@ ECMatchParameter* ECMatchParameter::New() const {
 }
 
 void ECMatchParameter::Clear() {
+#define OFFSET_OF_FIELD_(f) (reinterpret_cast<char*>(      \
+  &reinterpret_cast<ECMatchParameter*>(16)->f) - \
+   reinterpret_cast<char*>(16))
+
+#define ZR_(first, last) do {                              \
+    size_t f = OFFSET_OF_FIELD_(first);                    \
+    size_t n = OFFSET_OF_FIELD_(last) - f + sizeof(last);  \
+    ::memset(&first, 0, n);                                \
+  } while (0)
+
+  if (_has_bits_[0 / 32] & 31) {
+    ZR_(mindisp_, maxdisp_);
+    rowtol_ = 1;
+    thresh_ = 0.65f;
+    crosscheck_ = false;
+  }
+
+#undef OFFSET_OF_FIELD_
+#undef ZR_
+
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
@@ -21042,14 +22413,93 @@ bool ECMatchParameter::MergePartialFromCodedStream(
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
-  handle_unusual:
-    if (tag == 0 ||
-        ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-        ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-      goto success;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional int32 rowtol = 1 [default = 1];
+      case 1: {
+        if (tag == 8) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &rowtol_)));
+          set_has_rowtol();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(21)) goto parse_mindisp;
+        break;
+      }
+
+      // optional float mindisp = 2;
+      case 2: {
+        if (tag == 21) {
+         parse_mindisp:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &mindisp_)));
+          set_has_mindisp();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(29)) goto parse_maxdisp;
+        break;
+      }
+
+      // optional float maxdisp = 3;
+      case 3: {
+        if (tag == 29) {
+         parse_maxdisp:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &maxdisp_)));
+          set_has_maxdisp();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(37)) goto parse_thresh;
+        break;
+      }
+
+      // optional float thresh = 4 [default = 0.65];
+      case 4: {
+        if (tag == 37) {
+         parse_thresh:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &thresh_)));
+          set_has_thresh();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(40)) goto parse_crosscheck;
+        break;
+      }
+
+      // optional bool crosscheck = 5 [default = false];
+      case 5: {
+        if (tag == 40) {
+         parse_crosscheck:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &crosscheck_)));
+          set_has_crosscheck();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectAtEnd()) goto success;
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
     }
-    DO_(::google::protobuf::internal::WireFormat::SkipField(
-          input, tag, mutable_unknown_fields()));
   }
 success:
   // @@protoc_insertion_point(parse_success:svaf.ECMatchParameter)
@@ -21063,18 +22513,68 @@ failure:
 void ECMatchParameter::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
   // @@protoc_insertion_point(serialize_start:svaf.ECMatchParameter)
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // optional int32 rowtol = 1 [default = 1];
+  if (has_rowtol()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->rowtol(), output);
   }
-  // @@protoc_insertion_point(serialize_end:svaf.ECMatchParameter)
-}
 
-::google::protobuf::uint8* ECMatchParameter::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:svaf.ECMatchParameter)
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+  // optional float mindisp = 2;
+  if (has_mindisp()) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->mindisp(), output);
+  }
+
+  // optional float maxdisp = 3;
+  if (has_maxdisp()) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->maxdisp(), output);
+  }
+
+  // optional float thresh = 4 [default = 0.65];
+  if (has_thresh()) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(4, this->thresh(), output);
+  }
+
+  // optional bool crosscheck = 5 [default = false];
+  if (has_crosscheck()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(5, this->crosscheck(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:svaf.ECMatchParameter)
+}
+
+::google::protobuf::uint8* ECMatchParameter::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:svaf.ECMatchParameter)
+  // optional int32 rowtol = 1 [default = 1];
+  if (has_rowtol()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->rowtol(), target);
+  }
+
+  // optional float mindisp = 2;
+  if (has_mindisp()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->mindisp(), target);
+  }
+
+  // optional float maxdisp = 3;
+  if (has_maxdisp()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->maxdisp(), target);
+  }
+
+  // optional float thresh = 4 [default = 0.65];
+  if (has_thresh()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(4, this->thresh(), target);
+  }
+
+  // optional bool crosscheck = 5 [default = false];
+  if (has_crosscheck()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(5, this->crosscheck(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
   }
   // @@protoc_insertion_point(serialize_to_array_end:svaf.ECMatchParameter)
@@ -21084,6 +22584,35 @@ void ECMatchParameter::SerializeWithCachedSizes(
 int ECMatchParameter::ByteSize() const {
   int total_size = 0;
 
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional int32 rowtol = 1 [default = 1];
+    if (has_rowtol()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->rowtol());
+    }
+
+    // optional float mindisp = 2;
+    if (has_mindisp()) {
+      total_size += 1 + 4;
+    }
+
+    // optional float maxdisp = 3;
+    if (has_maxdisp()) {
+      total_size += 1 + 4;
+    }
+
+    // optional float thresh = 4 [default = 0.65];
+    if (has_thresh()) {
+      total_size += 1 + 4;
+    }
+
+    // optional bool crosscheck = 5 [default = false];
+    if (has_crosscheck()) {
+      total_size += 1 + 1;
+    }
+
+  }
   if (!unknown_fields().empty()) {
     total_size +=
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
@@ -21109,6 +22638,23 @@ void ECMatchParameter::MergeFrom(const ::google::protobuf::Message& from) {
 
 void ECMatchParameter::MergeFrom(const ECMatchParameter& from) {
   GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_rowtol()) {
+      set_rowtol(from.rowtol());
+    }
+    if (from.has_mindisp()) {
+      set_mindisp(from.mindisp());
+    }
+    if (from.has_maxdisp()) {
+      set_maxdisp(from.maxdisp());
+    }
+    if (from.has_thresh()) {
+      set_thresh(from.thresh());
+    }
+    if (from.has_crosscheck()) {
+      set_crosscheck(from.crosscheck());
+    }
+  }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
@@ -21131,6 +22677,12 @@ bool ECMatchParameter::IsInitialized() const {
 
 void ECMatchParameter::Swap(ECMatchParameter* other) {
   if (other != this) {
+    std::swap(rowtol_, other->rowtol_);
+    std::swap(mindisp_, other->mindisp_);
+    std::swap(maxdisp_, other->maxdisp_);
+    std::swap(thresh_, other->thresh_);
+    std::swap(crosscheck_, other->crosscheck_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
@@ -21624,6 +23176,15 @@ const int SGMMatchParameter::kR1FieldNumber;
 const int SGMMatchParameter::kR2FieldNumber;
 const int SGMMatchParameter::kPrefixFieldNumber;
 const int SGMMatchParameter::kSavetxtFieldNumber;
+const int SGMMatchParameter::kPyramidFieldNumber;
+const int SGMMatchParameter::kMarginFieldNumber;
+const int SGMMatchParameter::kTemporalFieldNumber;
+const int SGMMatchParameter::kTileFieldNumber;
+const int SGMMatchParameter::kMotionFieldNumber;
+const int SGMMatchParameter::kUniquenessFieldNumber;
+const int SGMMatchParameter::kSubpixelFieldNumber;
+const int SGMMatchParameter::kRoiFieldNumber;
+const int SGMMatchParameter::kPointsFieldNumber;
 #endif  // !_MSC_VER
 
 SGMMatchParameter::SGMMatchParameter()
@@ -21652,6 +23213,15 @@ void SGMMatchParameter::SharedCtor() {
   r2_ = 500;
   prefix_ = const_cast< ::std::string*>(_default_prefix_);
   savetxt_ = false;
+  pyramid_ = 0;
+  margin_ = 2;
+  temporal_ = false;
+  tile_ = 16;
+  motion_ = 8;
+  uniqueness_ = 0;
+  subpixel_ = false;
+  roi_ = true;
+  points_ = true;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -21690,7 +23260,17 @@ SGMMatchParameter* SGMMatchParameter::New() const {
 }
 
 void SGMMatchParameter::Clear() {
-  if (_has_bits_[0 / 32] & 127) {
+#define OFFSET_OF_FIELD_(f) (reinterpret_cast<char*>(      \
+  &reinterpret_cast<SGMMatchParameter*>(16)->f) - \
+   reinterpret_cast<char*>(16))
+
+#define ZR_(first, last) do {                              \
+    size_t f = OFFSET_OF_FIELD_(first);                    \
+    size_t n = OFFSET_OF_FIELD_(last) - f + sizeof(last);  \
+    ::memset(&first, 0, n);                                \
+  } while (0)
+
+  if (_has_bits_[0 / 32] & 255) {
     max_disp_ = 24;
     factor_ = 2560;
     dispmr_ = 1;
@@ -21702,7 +23282,21 @@ void SGMMatchParameter::Clear() {
       }
     }
     savetxt_ = false;
+    pyramid_ = 0;
+  }
+  if (_has_bits_[8 / 32] & 65280) {
+    ZR_(temporal_, subpixel_);
+    margin_ = 2;
+    tile_ = 16;
+    motion_ = 8;
+    uniqueness_ = 0;
+    roi_ = true;
+    points_ = true;
   }
+
+#undef OFFSET_OF_FIELD_
+#undef ZR_
+
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
@@ -21713,7 +23307,7 @@ bool SGMMatchParameter::MergePartialFromCodedStream(
   ::google::protobuf::uint32 tag;
   // @@protoc_insertion_point(parse_start:svaf.SGMMatchParameter)
   for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(16383);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
@@ -21819,6 +23413,141 @@ bool SGMMatchParameter::MergePartialFromCodedStream(
         } else {
           goto handle_unusual;
         }
+        if (input->ExpectTag(64)) goto parse_pyramid;
+        break;
+      }
+
+      // optional int32 pyramid = 8 [default = 0];
+      case 8: {
+        if (tag == 64) {
+         parse_pyramid:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &pyramid_)));
+          set_has_pyramid();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(72)) goto parse_margin;
+        break;
+      }
+
+      // optional int32 margin = 9 [default = 2];
+      case 9: {
+        if (tag == 72) {
+         parse_margin:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &margin_)));
+          set_has_margin();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(80)) goto parse_temporal;
+        break;
+      }
+
+      // optional bool temporal = 10 [default = false];
+      case 10: {
+        if (tag == 80) {
+         parse_temporal:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &temporal_)));
+          set_has_temporal();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(88)) goto parse_tile;
+        break;
+      }
+
+      // optional int32 tile = 11 [default = 16];
+      case 11: {
+        if (tag == 88) {
+         parse_tile:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &tile_)));
+          set_has_tile();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(96)) goto parse_motion;
+        break;
+      }
+
+      // optional int32 motion = 12 [default = 8];
+      case 12: {
+        if (tag == 96) {
+         parse_motion:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &motion_)));
+          set_has_motion();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(104)) goto parse_uniqueness;
+        break;
+      }
+
+      // optional int32 uniqueness = 13 [default = 0];
+      case 13: {
+        if (tag == 104) {
+         parse_uniqueness:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &uniqueness_)));
+          set_has_uniqueness();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(112)) goto parse_subpixel;
+        break;
+      }
+
+      // optional bool subpixel = 14 [default = false];
+      case 14: {
+        if (tag == 112) {
+         parse_subpixel:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &subpixel_)));
+          set_has_subpixel();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(120)) goto parse_roi;
+        break;
+      }
+
+      // optional bool roi = 15 [default = true];
+      case 15: {
+        if (tag == 120) {
+         parse_roi:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &roi_)));
+          set_has_roi();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(128)) goto parse_points;
+        break;
+      }
+
+      // optional bool points = 16 [default = true];
+      case 16: {
+        if (tag == 128) {
+         parse_points:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &points_)));
+          set_has_points();
+        } else {
+          goto handle_unusual;
+        }
         if (input->ExpectAtEnd()) goto success;
         break;
       }
@@ -21888,6 +23617,51 @@ void SGMMatchParameter::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormatLite::WriteBool(7, this->savetxt(), output);
   }
 
+  // optional int32 pyramid = 8 [default = 0];
+  if (has_pyramid()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(8, this->pyramid(), output);
+  }
+
+  // optional int32 margin = 9 [default = 2];
+  if (has_margin()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(9, this->margin(), output);
+  }
+
+  // optional bool temporal = 10 [default = false];
+  if (has_temporal()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(10, this->temporal(), output);
+  }
+
+  // optional int32 tile = 11 [default = 16];
+  if (has_tile()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(11, this->tile(), output);
+  }
+
+  // optional int32 motion = 12 [default = 8];
+  if (has_motion()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(12, this->motion(), output);
+  }
+
+  // optional int32 uniqueness = 13 [default = 0];
+  if (has_uniqueness()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(13, this->uniqueness(), output);
+  }
+
+  // optional bool subpixel = 14 [default = false];
+  if (has_subpixel()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(14, this->subpixel(), output);
+  }
+
+  // optional bool roi = 15 [default = true];
+  if (has_roi()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(15, this->roi(), output);
+  }
+
+  // optional bool points = 16 [default = true];
+  if (has_points()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(16, this->points(), output);
+  }
+
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -21939,6 +23713,51 @@ void SGMMatchParameter::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(7, this->savetxt(), target);
   }
 
+  // optional int32 pyramid = 8 [default = 0];
+  if (has_pyramid()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(8, this->pyramid(), target);
+  }
+
+  // optional int32 margin = 9 [default = 2];
+  if (has_margin()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(9, this->margin(), target);
+  }
+
+  // optional bool temporal = 10 [default = false];
+  if (has_temporal()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(10, this->temporal(), target);
+  }
+
+  // optional int32 tile = 11 [default = 16];
+  if (has_tile()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(11, this->tile(), target);
+  }
+
+  // optional int32 motion = 12 [default = 8];
+  if (has_motion()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(12, this->motion(), target);
+  }
+
+  // optional int32 uniqueness = 13 [default = 0];
+  if (has_uniqueness()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(13, this->uniqueness(), target);
+  }
+
+  // optional bool subpixel = 14 [default = false];
+  if (has_subpixel()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(14, this->subpixel(), target);
+  }
+
+  // optional bool roi = 15 [default = true];
+  if (has_roi()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(15, this->roi(), target);
+  }
+
+  // optional bool points = 16 [default = true];
+  if (has_points()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(16, this->points(), target);
+  }
+
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -21994,6 +23813,63 @@ int SGMMatchParameter::ByteSize() const {
       total_size += 1 + 1;
     }
 
+    // optional int32 pyramid = 8 [default = 0];
+    if (has_pyramid()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->pyramid());
+    }
+
+  }
+  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    // optional int32 margin = 9 [default = 2];
+    if (has_margin()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->margin());
+    }
+
+    // optional bool temporal = 10 [default = false];
+    if (has_temporal()) {
+      total_size += 1 + 1;
+    }
+
+    // optional int32 tile = 11 [default = 16];
+    if (has_tile()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->tile());
+    }
+
+    // optional int32 motion = 12 [default = 8];
+    if (has_motion()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->motion());
+    }
+
+    // optional int32 uniqueness = 13 [default = 0];
+    if (has_uniqueness()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->uniqueness());
+    }
+
+    // optional bool subpixel = 14 [default = false];
+    if (has_subpixel()) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool roi = 15 [default = true];
+    if (has_roi()) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool points = 16 [default = true];
+    if (has_points()) {
+      total_size += 2 + 1;
+    }
+
   }
   if (!unknown_fields().empty()) {
     total_size +=
@@ -22042,13 +23918,42 @@ void SGMMatchParameter::MergeFrom(const SGMMatchParameter& from) {
     if (from.has_savetxt()) {
       set_savetxt(from.savetxt());
     }
+    if (from.has_pyramid()) {
+      set_pyramid(from.pyramid());
+    }
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void SGMMatchParameter::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
+  if (from._has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    if (from.has_margin()) {
+      set_margin(from.margin());
+    }
+    if (from.has_temporal()) {
+      set_temporal(from.temporal());
+    }
+    if (from.has_tile()) {
+      set_tile(from.tile());
+    }
+    if (from.has_motion()) {
+      set_motion(from.motion());
+    }
+    if (from.has_uniqueness()) {
+      set_uniqueness(from.uniqueness());
+    }
+    if (from.has_subpixel()) {
+      set_subpixel(from.subpixel());
+    }
+    if (from.has_roi()) {
+      set_roi(from.roi());
+    }
+    if (from.has_points()) {
+      set_points(from.points());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void SGMMatchParameter::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
   MergeFrom(from);
 }
 
@@ -22072,6 +23977,15 @@ void SGMMatchParameter::Swap(SGMMatchParameter* other) {
     std::swap(r2_, other->r2_);
     std::swap(prefix_, other->prefix_);
     std::swap(savetxt_, other->savetxt_);
+    std::swap(pyramid_, other->pyramid_);
+    std::swap(margin_, other->margin_);
+    std::swap(temporal_, other->temporal_);
+    std::swap(tile_, other->tile_);
+    std::swap(motion_, other->motion_);
+    std::swap(uniqueness_, other->uniqueness_);
+    std::swap(subpixel_, other->subpixel_);
+    std::swap(roi_, other->roi_);
+    std::swap(points_, other->points_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
@@ -22101,6 +24015,9 @@ const int EADPMatchParameter::kR1FieldNumber;
 const int EADPMatchParameter::kR2FieldNumber;
 const int EADPMatchParameter::kPrefixFieldNumber;
 const int EADPMatchParameter::kSavetxtFieldNumber;
+const int EADPMatchParameter::kFastFieldNumber;
+const int EADPMatchParameter::kRoiFieldNumber;
+const int EADPMatchParameter::kPointsFieldNumber;
 #endif  // !_MSC_VER
 
 EADPMatchParameter::EADPMatchParameter()
@@ -22132,6 +24049,9 @@ void EADPMatchParameter::SharedCtor() {
   r2_ = 500;
   prefix_ = const_cast< ::std::string*>(_default_prefix_);
   savetxt_ = false;
+  fast_ = false;
+  roi_ = true;
+  points_ = true;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -22170,6 +24090,16 @@ EADPMatchParameter* EADPMatchParameter::New() const {
 }
 
 void EADPMatchParameter::Clear() {
+#define OFFSET_OF_FIELD_(f) (reinterpret_cast<char*>(      \
+  &reinterpret_cast<EADPMatchParameter*>(16)->f) - \
+   reinterpret_cast<char*>(16))
+
+#define ZR_(first, last) do {                              \
+    size_t f = OFFSET_OF_FIELD_(first);                    \
+    size_t n = OFFSET_OF_FIELD_(last) - f + sizeof(last);  \
+    ::memset(&first, 0, n);                                \
+  } while (0)
+
   if (_has_bits_[0 / 32] & 255) {
     max_disp_ = 24;
     factor_ = 2560;
@@ -22180,14 +24110,20 @@ void EADPMatchParameter::Clear() {
     r1_ = 10;
     r2_ = 500;
   }
-  if (_has_bits_[8 / 32] & 768) {
+  if (_has_bits_[8 / 32] & 7936) {
+    ZR_(savetxt_, fast_);
     if (has_prefix()) {
       if (prefix_ != _default_prefix_) {
         prefix_->assign(*_default_prefix_);
       }
     }
-    savetxt_ = false;
+    roi_ = true;
+    points_ = true;
   }
+
+#undef OFFSET_OF_FIELD_
+#undef ZR_
+
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
@@ -22349,6 +24285,51 @@ bool EADPMatchParameter::MergePartialFromCodedStream(
         } else {
           goto handle_unusual;
         }
+        if (input->ExpectTag(88)) goto parse_fast;
+        break;
+      }
+
+      // optional bool fast = 11 [default = false];
+      case 11: {
+        if (tag == 88) {
+         parse_fast:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &fast_)));
+          set_has_fast();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(96)) goto parse_roi;
+        break;
+      }
+
+      // optional bool roi = 12 [default = true];
+      case 12: {
+        if (tag == 96) {
+         parse_roi:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &roi_)));
+          set_has_roi();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(104)) goto parse_points;
+        break;
+      }
+
+      // optional bool points = 13 [default = true];
+      case 13: {
+        if (tag == 104) {
+         parse_points:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &points_)));
+          set_has_points();
+        } else {
+          goto handle_unusual;
+        }
         if (input->ExpectAtEnd()) goto success;
         break;
       }
@@ -22433,6 +24414,21 @@ void EADPMatchParameter::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormatLite::WriteBool(10, this->savetxt(), output);
   }
 
+  // optional bool fast = 11 [default = false];
+  if (has_fast()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(11, this->fast(), output);
+  }
+
+  // optional bool roi = 12 [default = true];
+  if (has_roi()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(12, this->roi(), output);
+  }
+
+  // optional bool points = 13 [default = true];
+  if (has_points()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(13, this->points(), output);
+  }
+
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -22499,6 +24495,21 @@ void EADPMatchParameter::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(10, this->savetxt(), target);
   }
 
+  // optional bool fast = 11 [default = false];
+  if (has_fast()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(11, this->fast(), target);
+  }
+
+  // optional bool roi = 12 [default = true];
+  if (has_roi()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(12, this->roi(), target);
+  }
+
+  // optional bool points = 13 [default = true];
+  if (has_points()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(13, this->points(), target);
+  }
+
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -22573,6 +24584,21 @@ int EADPMatchParameter::ByteSize() const {
       total_size += 1 + 1;
     }
 
+    // optional bool fast = 11 [default = false];
+    if (has_fast()) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool roi = 12 [default = true];
+    if (has_roi()) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool points = 13 [default = true];
+    if (has_points()) {
+      total_size += 1 + 1;
+    }
+
   }
   if (!unknown_fields().empty()) {
     total_size +=
@@ -22632,6 +24658,15 @@ void EADPMatchParameter::MergeFrom(const EADPMatchParameter& from) {
     if (from.has_savetxt()) {
       set_savetxt(from.savetxt());
     }
+    if (from.has_fast()) {
+      set_fast(from.fast());
+    }
+    if (from.has_roi()) {
+      set_roi(from.roi());
+    }
+    if (from.has_points()) {
+      set_points(from.points());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -22665,6 +24700,9 @@ void EADPMatchParameter::Swap(EADPMatchParameter* other) {
     std::swap(r2_, other->r2_);
     std::swap(prefix_, other->prefix_);
     std::swap(savetxt_, other->savetxt_);
+    std::swap(fast_, other->fast_);
+    std::swap(roi_, other->roi_);
+    std::swap(points_, other->points_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
@@ -22857,12 +24895,18 @@ void OutputParameter::Swap(OutputParameter* other) {
 // ===================================================================
 
 ::std::string* TriangularParameter::_default_pcname_ = NULL;
+::std::string* TriangularParameter::_default_calib_raw_ = NULL;
+::std::string* TriangularParameter::_default_calib_rect_ = NULL;
 #ifndef _MSC_VER
 const int TriangularParameter::kVisibleFieldNumber;
 const int TriangularParameter::kToolboxDirFieldNumber;
 const int TriangularParameter::kCalibmatDirFieldNumber;
 const int TriangularParameter::kSavepcFieldNumber;
 const int TriangularParameter::kPcnameFieldNumber;
+const int TriangularParameter::kCalibRawFieldNumber;
+const int TriangularParameter::kCalibRectFieldNumber;
+const int TriangularParameter::kCalibFieldNumber;
+const int TriangularParameter::kVoxelFieldNumber;
 #endif  // !_MSC_VER
 
 TriangularParameter::TriangularParameter()
@@ -22889,6 +24933,10 @@ void TriangularParameter::SharedCtor() {
   calibmat_dir_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   savepc_ = false;
   pcname_ = const_cast< ::std::string*>(_default_pcname_);
+  calib_raw_ = const_cast< ::std::string*>(_default_calib_raw_);
+  calib_rect_ = const_cast< ::std::string*>(_default_calib_rect_);
+  calib_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  voxel_ = 0;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -22907,6 +24955,15 @@ void TriangularParameter::SharedDtor() {
   if (pcname_ != _default_pcname_) {
     delete pcname_;
   }
+  if (calib_raw_ != _default_calib_raw_) {
+    delete calib_raw_;
+  }
+  if (calib_rect_ != _default_calib_rect_) {
+    delete calib_rect_;
+  }
+  if (calib_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete calib_;
+  }
   if (this != default_instance_) {
   }
 }
@@ -22933,7 +24990,7 @@ TriangularParameter* TriangularParameter::New() const {
 }
 
 void TriangularParameter::Clear() {
-  if (_has_bits_[0 / 32] & 31) {
+  if (_has_bits_[0 / 32] & 255) {
     visible_ = true;
     if (has_toolbox_dir()) {
       if (toolbox_dir_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
@@ -22951,7 +25008,23 @@ void TriangularParameter::Clear() {
         pcname_->assign(*_default_pcname_);
       }
     }
+    if (has_calib_raw()) {
+      if (calib_raw_ != _default_calib_raw_) {
+        calib_raw_->assign(*_default_calib_raw_);
+      }
+    }
+    if (has_calib_rect()) {
+      if (calib_rect_ != _default_calib_rect_) {
+        calib_rect_->assign(*_default_calib_rect_);
+      }
+    }
+    if (has_calib()) {
+      if (calib_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        calib_->clear();
+      }
+    }
   }
+  voxel_ = 0;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
@@ -23042,6 +25115,72 @@ bool TriangularParameter::MergePartialFromCodedStream(
         } else {
           goto handle_unusual;
         }
+        if (input->ExpectTag(50)) goto parse_calib_raw;
+        break;
+      }
+
+      // optional string calib_raw = 6 [default = "Calib_Results_stereo.yml"];
+      case 6: {
+        if (tag == 50) {
+         parse_calib_raw:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_calib_raw()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->calib_raw().data(), this->calib_raw().length(),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "calib_raw");
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(58)) goto parse_calib_rect;
+        break;
+      }
+
+      // optional string calib_rect = 7 [default = "Calib_Results_stereo_rectified.yml"];
+      case 7: {
+        if (tag == 58) {
+         parse_calib_rect:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_calib_rect()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->calib_rect().data(), this->calib_rect().length(),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "calib_rect");
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(66)) goto parse_calib;
+        break;
+      }
+
+      // optional string calib = 8;
+      case 8: {
+        if (tag == 66) {
+         parse_calib:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_calib()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->calib().data(), this->calib().length(),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "calib");
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(77)) goto parse_voxel;
+        break;
+      }
+
+      // optional float voxel = 9 [default = 0];
+      case 9: {
+        if (tag == 77) {
+         parse_voxel:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &voxel_)));
+          set_has_voxel();
+        } else {
+          goto handle_unusual;
+        }
         if (input->ExpectAtEnd()) goto success;
         break;
       }
@@ -23111,6 +25250,41 @@ void TriangularParameter::SerializeWithCachedSizes(
       5, this->pcname(), output);
   }
 
+  // optional string calib_raw = 6 [default = "Calib_Results_stereo.yml"];
+  if (has_calib_raw()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->calib_raw().data(), this->calib_raw().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "calib_raw");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      6, this->calib_raw(), output);
+  }
+
+  // optional string calib_rect = 7 [default = "Calib_Results_stereo_rectified.yml"];
+  if (has_calib_rect()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->calib_rect().data(), this->calib_rect().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "calib_rect");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      7, this->calib_rect(), output);
+  }
+
+  // optional string calib = 8;
+  if (has_calib()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->calib().data(), this->calib().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "calib");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      8, this->calib(), output);
+  }
+
+  // optional float voxel = 9 [default = 0];
+  if (has_voxel()) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(9, this->voxel(), output);
+  }
+
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -23164,6 +25338,44 @@ void TriangularParameter::SerializeWithCachedSizes(
         5, this->pcname(), target);
   }
 
+  // optional string calib_raw = 6 [default = "Calib_Results_stereo.yml"];
+  if (has_calib_raw()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->calib_raw().data(), this->calib_raw().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "calib_raw");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        6, this->calib_raw(), target);
+  }
+
+  // optional string calib_rect = 7 [default = "Calib_Results_stereo_rectified.yml"];
+  if (has_calib_rect()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->calib_rect().data(), this->calib_rect().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "calib_rect");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        7, this->calib_rect(), target);
+  }
+
+  // optional string calib = 8;
+  if (has_calib()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->calib().data(), this->calib().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "calib");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        8, this->calib(), target);
+  }
+
+  // optional float voxel = 9 [default = 0];
+  if (has_voxel()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(9, this->voxel(), target);
+  }
+
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -23207,6 +25419,34 @@ int TriangularParameter::ByteSize() const {
           this->pcname());
     }
 
+    // optional string calib_raw = 6 [default = "Calib_Results_stereo.yml"];
+    if (has_calib_raw()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->calib_raw());
+    }
+
+    // optional string calib_rect = 7 [default = "Calib_Results_stereo_rectified.yml"];
+    if (has_calib_rect()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->calib_rect());
+    }
+
+    // optional string calib = 8;
+    if (has_calib()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->calib());
+    }
+
+  }
+  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    // optional float voxel = 9 [default = 0];
+    if (has_voxel()) {
+      total_size += 1 + 4;
+    }
+
   }
   if (!unknown_fields().empty()) {
     total_size +=
@@ -23249,6 +25489,20 @@ void TriangularParameter::MergeFrom(const TriangularParameter& from) {
     if (from.has_pcname()) {
       set_pcname(from.pcname());
     }
+    if (from.has_calib_raw()) {
+      set_calib_raw(from.calib_raw());
+    }
+    if (from.has_calib_rect()) {
+      set_calib_rect(from.calib_rect());
+    }
+    if (from.has_calib()) {
+      set_calib(from.calib());
+    }
+  }
+  if (from._has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    if (from.has_voxel()) {
+      set_voxel(from.voxel());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -23277,6 +25531,10 @@ void TriangularParameter::Swap(TriangularParameter* other) {
     std::swap(calibmat_dir_, other->calibmat_dir_);
     std::swap(savepc_, other->savepc_);
     std::swap(pcname_, other->pcname_);
+    std::swap(calib_raw_, other->calib_raw_);
+    std::swap(calib_rect_, other->calib_rect_);
+    std::swap(calib_, other->calib_);
+    std::swap(voxel_, other->voxel_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
@@ -23295,178 +25553,333 @@ void TriangularParameter::Swap(TriangularParameter* other) {
 // ===================================================================
 
 #ifndef _MSC_VER
-const int MatrixMulParameter::kFilenameFieldNumber;
-const int MatrixMulParameter::kCol0FieldNumber;
-const int MatrixMulParameter::kCol1FieldNumber;
-const int MatrixMulParameter::kCol2FieldNumber;
+const int ReprojectParameter::kCalibFileFieldNumber;
+const int ReprojectParameter::kFxFieldNumber;
+const int ReprojectParameter::kFyFieldNumber;
+const int ReprojectParameter::kCxFieldNumber;
+const int ReprojectParameter::kCyFieldNumber;
+const int ReprojectParameter::kCxRightFieldNumber;
+const int ReprojectParameter::kBaselineFieldNumber;
+const int ReprojectParameter::kStrideFieldNumber;
+const int ReprojectParameter::kColorFieldNumber;
+const int ReprojectParameter::kPointlFieldNumber;
+const int ReprojectParameter::kSavepcFieldNumber;
+const int ReprojectParameter::kCalibFieldNumber;
+const int ReprojectParameter::kVoxelFieldNumber;
 #endif  // !_MSC_VER
 
-MatrixMulParameter::MatrixMulParameter()
+ReprojectParameter::ReprojectParameter()
   : ::google::protobuf::Message() {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:svaf.MatrixMulParameter)
+  // @@protoc_insertion_point(constructor:svaf.ReprojectParameter)
 }
 
-void MatrixMulParameter::InitAsDefaultInstance() {
+void ReprojectParameter::InitAsDefaultInstance() {
 }
 
-MatrixMulParameter::MatrixMulParameter(const MatrixMulParameter& from)
+ReprojectParameter::ReprojectParameter(const ReprojectParameter& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:svaf.MatrixMulParameter)
+  // @@protoc_insertion_point(copy_constructor:svaf.ReprojectParameter)
 }
 
-void MatrixMulParameter::SharedCtor() {
+void ReprojectParameter::SharedCtor() {
   ::google::protobuf::internal::GetEmptyString();
   _cached_size_ = 0;
-  filename_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  col0_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  col1_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  col2_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  calib_file_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  fx_ = 0;
+  fy_ = 0;
+  cx_ = 0;
+  cy_ = 0;
+  cx_right_ = 0;
+  baseline_ = 0;
+  stride_ = 1;
+  color_ = false;
+  pointl_ = true;
+  savepc_ = false;
+  calib_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  voxel_ = 0;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-MatrixMulParameter::~MatrixMulParameter() {
-  // @@protoc_insertion_point(destructor:svaf.MatrixMulParameter)
+ReprojectParameter::~ReprojectParameter() {
+  // @@protoc_insertion_point(destructor:svaf.ReprojectParameter)
   SharedDtor();
 }
 
-void MatrixMulParameter::SharedDtor() {
-  if (filename_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete filename_;
-  }
-  if (col0_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete col0_;
+void ReprojectParameter::SharedDtor() {
+  if (calib_file_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete calib_file_;
   }
-  if (col1_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete col1_;
-  }
-  if (col2_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete col2_;
+  if (calib_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete calib_;
   }
   if (this != default_instance_) {
   }
 }
 
-void MatrixMulParameter::SetCachedSize(int size) const {
+void ReprojectParameter::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* MatrixMulParameter::descriptor() {
+const ::google::protobuf::Descriptor* ReprojectParameter::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return MatrixMulParameter_descriptor_;
+  return ReprojectParameter_descriptor_;
 }
 
-const MatrixMulParameter& MatrixMulParameter::default_instance() {
+const ReprojectParameter& ReprojectParameter::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_svaf_2eproto();
   return *default_instance_;
 }
 
-MatrixMulParameter* MatrixMulParameter::default_instance_ = NULL;
+ReprojectParameter* ReprojectParameter::default_instance_ = NULL;
 
-MatrixMulParameter* MatrixMulParameter::New() const {
-  return new MatrixMulParameter;
+ReprojectParameter* ReprojectParameter::New() const {
+  return new ReprojectParameter;
 }
 
-void MatrixMulParameter::Clear() {
-  if (_has_bits_[0 / 32] & 15) {
-    if (has_filename()) {
-      if (filename_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-        filename_->clear();
+void ReprojectParameter::Clear() {
+#define OFFSET_OF_FIELD_(f) (reinterpret_cast<char*>(      \
+  &reinterpret_cast<ReprojectParameter*>(16)->f) - \
+   reinterpret_cast<char*>(16))
+
+#define ZR_(first, last) do {                              \
+    size_t f = OFFSET_OF_FIELD_(first);                    \
+    size_t n = OFFSET_OF_FIELD_(last) - f + sizeof(last);  \
+    ::memset(&first, 0, n);                                \
+  } while (0)
+
+  if (_has_bits_[0 / 32] & 255) {
+    ZR_(fx_, baseline_);
+    if (has_calib_file()) {
+      if (calib_file_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        calib_file_->clear();
       }
     }
-    if (has_col0()) {
-      if (col0_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-        col0_->clear();
-      }
-    }
-    if (has_col1()) {
-      if (col1_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-        col1_->clear();
-      }
-    }
-    if (has_col2()) {
-      if (col2_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-        col2_->clear();
+    stride_ = 1;
+  }
+  if (_has_bits_[8 / 32] & 7936) {
+    color_ = false;
+    pointl_ = true;
+    savepc_ = false;
+    if (has_calib()) {
+      if (calib_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        calib_->clear();
       }
     }
+    voxel_ = 0;
   }
+
+#undef OFFSET_OF_FIELD_
+#undef ZR_
+
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool MatrixMulParameter::MergePartialFromCodedStream(
+bool ReprojectParameter::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:svaf.MatrixMulParameter)
+  // @@protoc_insertion_point(parse_start:svaf.ReprojectParameter)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional string filename = 1;
+      // optional string calib_file = 1;
       case 1: {
         if (tag == 10) {
           DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_filename()));
+                input, this->mutable_calib_file()));
           ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->filename().data(), this->filename().length(),
+            this->calib_file().data(), this->calib_file().length(),
             ::google::protobuf::internal::WireFormat::PARSE,
-            "filename");
+            "calib_file");
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(18)) goto parse_col0;
+        if (input->ExpectTag(21)) goto parse_fx;
         break;
       }
 
-      // optional string col0 = 2;
+      // optional float fx = 2;
       case 2: {
-        if (tag == 18) {
-         parse_col0:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_col0()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->col0().data(), this->col0().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "col0");
+        if (tag == 21) {
+         parse_fx:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &fx_)));
+          set_has_fx();
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(26)) goto parse_col1;
+        if (input->ExpectTag(29)) goto parse_fy;
         break;
       }
 
-      // optional string col1 = 3;
+      // optional float fy = 3;
       case 3: {
-        if (tag == 26) {
-         parse_col1:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_col1()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->col1().data(), this->col1().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "col1");
+        if (tag == 29) {
+         parse_fy:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &fy_)));
+          set_has_fy();
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(34)) goto parse_col2;
+        if (input->ExpectTag(37)) goto parse_cx;
         break;
       }
 
-      // optional string col2 = 4;
+      // optional float cx = 4;
       case 4: {
-        if (tag == 34) {
-         parse_col2:
+        if (tag == 37) {
+         parse_cx:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &cx_)));
+          set_has_cx();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(45)) goto parse_cy;
+        break;
+      }
+
+      // optional float cy = 5;
+      case 5: {
+        if (tag == 45) {
+         parse_cy:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &cy_)));
+          set_has_cy();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(53)) goto parse_cx_right;
+        break;
+      }
+
+      // optional float cx_right = 6;
+      case 6: {
+        if (tag == 53) {
+         parse_cx_right:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &cx_right_)));
+          set_has_cx_right();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(61)) goto parse_baseline;
+        break;
+      }
+
+      // optional float baseline = 7;
+      case 7: {
+        if (tag == 61) {
+         parse_baseline:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &baseline_)));
+          set_has_baseline();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(64)) goto parse_stride;
+        break;
+      }
+
+      // optional int32 stride = 8 [default = 1];
+      case 8: {
+        if (tag == 64) {
+         parse_stride:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &stride_)));
+          set_has_stride();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(72)) goto parse_color;
+        break;
+      }
+
+      // optional bool color = 9 [default = false];
+      case 9: {
+        if (tag == 72) {
+         parse_color:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &color_)));
+          set_has_color();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(80)) goto parse_pointl;
+        break;
+      }
+
+      // optional bool pointl = 10 [default = true];
+      case 10: {
+        if (tag == 80) {
+         parse_pointl:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &pointl_)));
+          set_has_pointl();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(88)) goto parse_savepc;
+        break;
+      }
+
+      // optional bool savepc = 11 [default = false];
+      case 11: {
+        if (tag == 88) {
+         parse_savepc:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &savepc_)));
+          set_has_savepc();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(98)) goto parse_calib;
+        break;
+      }
+
+      // optional string calib = 12;
+      case 12: {
+        if (tag == 98) {
+         parse_calib:
           DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_col2()));
+                input, this->mutable_calib()));
           ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->col2().data(), this->col2().length(),
+            this->calib().data(), this->calib().length(),
             ::google::protobuf::internal::WireFormat::PARSE,
-            "col2");
+            "calib");
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(109)) goto parse_voxel;
+        break;
+      }
+
+      // optional float voxel = 13 [default = 0];
+      case 13: {
+        if (tag == 109) {
+         parse_voxel:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &voxel_)));
+          set_has_voxel();
         } else {
           goto handle_unusual;
         }
@@ -23488,149 +25901,262 @@ bool MatrixMulParameter::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:svaf.MatrixMulParameter)
+  // @@protoc_insertion_point(parse_success:svaf.ReprojectParameter)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:svaf.MatrixMulParameter)
+  // @@protoc_insertion_point(parse_failure:svaf.ReprojectParameter)
   return false;
 #undef DO_
 }
 
-void MatrixMulParameter::SerializeWithCachedSizes(
+void ReprojectParameter::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:svaf.MatrixMulParameter)
-  // optional string filename = 1;
-  if (has_filename()) {
+  // @@protoc_insertion_point(serialize_start:svaf.ReprojectParameter)
+  // optional string calib_file = 1;
+  if (has_calib_file()) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->filename().data(), this->filename().length(),
+      this->calib_file().data(), this->calib_file().length(),
       ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "filename");
+      "calib_file");
     ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->filename(), output);
+      1, this->calib_file(), output);
   }
 
-  // optional string col0 = 2;
-  if (has_col0()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->col0().data(), this->col0().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "col0");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->col0(), output);
+  // optional float fx = 2;
+  if (has_fx()) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->fx(), output);
   }
 
-  // optional string col1 = 3;
-  if (has_col1()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->col1().data(), this->col1().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "col1");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      3, this->col1(), output);
+  // optional float fy = 3;
+  if (has_fy()) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->fy(), output);
   }
 
-  // optional string col2 = 4;
-  if (has_col2()) {
+  // optional float cx = 4;
+  if (has_cx()) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(4, this->cx(), output);
+  }
+
+  // optional float cy = 5;
+  if (has_cy()) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(5, this->cy(), output);
+  }
+
+  // optional float cx_right = 6;
+  if (has_cx_right()) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(6, this->cx_right(), output);
+  }
+
+  // optional float baseline = 7;
+  if (has_baseline()) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(7, this->baseline(), output);
+  }
+
+  // optional int32 stride = 8 [default = 1];
+  if (has_stride()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(8, this->stride(), output);
+  }
+
+  // optional bool color = 9 [default = false];
+  if (has_color()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(9, this->color(), output);
+  }
+
+  // optional bool pointl = 10 [default = true];
+  if (has_pointl()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(10, this->pointl(), output);
+  }
+
+  // optional bool savepc = 11 [default = false];
+  if (has_savepc()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(11, this->savepc(), output);
+  }
+
+  // optional string calib = 12;
+  if (has_calib()) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->col2().data(), this->col2().length(),
+      this->calib().data(), this->calib().length(),
       ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "col2");
+      "calib");
     ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      4, this->col2(), output);
+      12, this->calib(), output);
+  }
+
+  // optional float voxel = 13 [default = 0];
+  if (has_voxel()) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(13, this->voxel(), output);
   }
 
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
   }
-  // @@protoc_insertion_point(serialize_end:svaf.MatrixMulParameter)
+  // @@protoc_insertion_point(serialize_end:svaf.ReprojectParameter)
 }
 
-::google::protobuf::uint8* MatrixMulParameter::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* ReprojectParameter::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:svaf.MatrixMulParameter)
-  // optional string filename = 1;
-  if (has_filename()) {
+  // @@protoc_insertion_point(serialize_to_array_start:svaf.ReprojectParameter)
+  // optional string calib_file = 1;
+  if (has_calib_file()) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->filename().data(), this->filename().length(),
+      this->calib_file().data(), this->calib_file().length(),
       ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "filename");
+      "calib_file");
     target =
       ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->filename(), target);
+        1, this->calib_file(), target);
   }
 
-  // optional string col0 = 2;
-  if (has_col0()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->col0().data(), this->col0().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "col0");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->col0(), target);
+  // optional float fx = 2;
+  if (has_fx()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->fx(), target);
   }
 
-  // optional string col1 = 3;
-  if (has_col1()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->col1().data(), this->col1().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "col1");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->col1(), target);
+  // optional float fy = 3;
+  if (has_fy()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->fy(), target);
   }
 
-  // optional string col2 = 4;
-  if (has_col2()) {
+  // optional float cx = 4;
+  if (has_cx()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(4, this->cx(), target);
+  }
+
+  // optional float cy = 5;
+  if (has_cy()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(5, this->cy(), target);
+  }
+
+  // optional float cx_right = 6;
+  if (has_cx_right()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(6, this->cx_right(), target);
+  }
+
+  // optional float baseline = 7;
+  if (has_baseline()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(7, this->baseline(), target);
+  }
+
+  // optional int32 stride = 8 [default = 1];
+  if (has_stride()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(8, this->stride(), target);
+  }
+
+  // optional bool color = 9 [default = false];
+  if (has_color()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(9, this->color(), target);
+  }
+
+  // optional bool pointl = 10 [default = true];
+  if (has_pointl()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(10, this->pointl(), target);
+  }
+
+  // optional bool savepc = 11 [default = false];
+  if (has_savepc()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(11, this->savepc(), target);
+  }
+
+  // optional string calib = 12;
+  if (has_calib()) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->col2().data(), this->col2().length(),
+      this->calib().data(), this->calib().length(),
       ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "col2");
+      "calib");
     target =
       ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        4, this->col2(), target);
+        12, this->calib(), target);
+  }
+
+  // optional float voxel = 13 [default = 0];
+  if (has_voxel()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(13, this->voxel(), target);
   }
 
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:svaf.MatrixMulParameter)
+  // @@protoc_insertion_point(serialize_to_array_end:svaf.ReprojectParameter)
   return target;
 }
 
-int MatrixMulParameter::ByteSize() const {
+int ReprojectParameter::ByteSize() const {
   int total_size = 0;
 
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional string filename = 1;
-    if (has_filename()) {
+    // optional string calib_file = 1;
+    if (has_calib_file()) {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->filename());
+          this->calib_file());
     }
 
-    // optional string col0 = 2;
-    if (has_col0()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->col0());
+    // optional float fx = 2;
+    if (has_fx()) {
+      total_size += 1 + 4;
     }
 
-    // optional string col1 = 3;
-    if (has_col1()) {
+    // optional float fy = 3;
+    if (has_fy()) {
+      total_size += 1 + 4;
+    }
+
+    // optional float cx = 4;
+    if (has_cx()) {
+      total_size += 1 + 4;
+    }
+
+    // optional float cy = 5;
+    if (has_cy()) {
+      total_size += 1 + 4;
+    }
+
+    // optional float cx_right = 6;
+    if (has_cx_right()) {
+      total_size += 1 + 4;
+    }
+
+    // optional float baseline = 7;
+    if (has_baseline()) {
+      total_size += 1 + 4;
+    }
+
+    // optional int32 stride = 8 [default = 1];
+    if (has_stride()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->col1());
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->stride());
     }
 
-    // optional string col2 = 4;
-    if (has_col2()) {
+  }
+  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    // optional bool color = 9 [default = false];
+    if (has_color()) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool pointl = 10 [default = true];
+    if (has_pointl()) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool savepc = 11 [default = false];
+    if (has_savepc()) {
+      total_size += 1 + 1;
+    }
+
+    // optional string calib = 12;
+    if (has_calib()) {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->col2());
+          this->calib());
+    }
+
+    // optional float voxel = 13 [default = 0];
+    if (has_voxel()) {
+      total_size += 1 + 4;
     }
 
   }
@@ -23645,10 +26171,10 @@ int MatrixMulParameter::ByteSize() const {
   return total_size;
 }
 
-void MatrixMulParameter::MergeFrom(const ::google::protobuf::Message& from) {
+void ReprojectParameter::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const MatrixMulParameter* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const MatrixMulParameter*>(
+  const ReprojectParameter* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const ReprojectParameter*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -23657,59 +26183,97 @@ void MatrixMulParameter::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void MatrixMulParameter::MergeFrom(const MatrixMulParameter& from) {
+void ReprojectParameter::MergeFrom(const ReprojectParameter& from) {
   GOOGLE_CHECK_NE(&from, this);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_filename()) {
-      set_filename(from.filename());
+    if (from.has_calib_file()) {
+      set_calib_file(from.calib_file());
     }
-    if (from.has_col0()) {
-      set_col0(from.col0());
+    if (from.has_fx()) {
+      set_fx(from.fx());
     }
-    if (from.has_col1()) {
-      set_col1(from.col1());
+    if (from.has_fy()) {
+      set_fy(from.fy());
     }
-    if (from.has_col2()) {
-      set_col2(from.col2());
+    if (from.has_cx()) {
+      set_cx(from.cx());
+    }
+    if (from.has_cy()) {
+      set_cy(from.cy());
+    }
+    if (from.has_cx_right()) {
+      set_cx_right(from.cx_right());
+    }
+    if (from.has_baseline()) {
+      set_baseline(from.baseline());
+    }
+    if (from.has_stride()) {
+      set_stride(from.stride());
+    }
+  }
+  if (from._has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    if (from.has_color()) {
+      set_color(from.color());
+    }
+    if (from.has_pointl()) {
+      set_pointl(from.pointl());
+    }
+    if (from.has_savepc()) {
+      set_savepc(from.savepc());
+    }
+    if (from.has_calib()) {
+      set_calib(from.calib());
+    }
+    if (from.has_voxel()) {
+      set_voxel(from.voxel());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void MatrixMulParameter::CopyFrom(const ::google::protobuf::Message& from) {
+void ReprojectParameter::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void MatrixMulParameter::CopyFrom(const MatrixMulParameter& from) {
+void ReprojectParameter::CopyFrom(const ReprojectParameter& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool MatrixMulParameter::IsInitialized() const {
+bool ReprojectParameter::IsInitialized() const {
 
   return true;
 }
 
-void MatrixMulParameter::Swap(MatrixMulParameter* other) {
+void ReprojectParameter::Swap(ReprojectParameter* other) {
   if (other != this) {
-    std::swap(filename_, other->filename_);
-    std::swap(col0_, other->col0_);
-    std::swap(col1_, other->col1_);
-    std::swap(col2_, other->col2_);
+    std::swap(calib_file_, other->calib_file_);
+    std::swap(fx_, other->fx_);
+    std::swap(fy_, other->fy_);
+    std::swap(cx_, other->cx_);
+    std::swap(cy_, other->cy_);
+    std::swap(cx_right_, other->cx_right_);
+    std::swap(baseline_, other->baseline_);
+    std::swap(stride_, other->stride_);
+    std::swap(color_, other->color_);
+    std::swap(pointl_, other->pointl_);
+    std::swap(savepc_, other->savepc_);
+    std::swap(calib_, other->calib_);
+    std::swap(voxel_, other->voxel_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata MatrixMulParameter::GetMetadata() const {
+::google::protobuf::Metadata ReprojectParameter::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = MatrixMulParameter_descriptor_;
-  metadata.reflection = MatrixMulParameter_reflection_;
+  metadata.descriptor = ReprojectParameter_descriptor_;
+  metadata.reflection = ReprojectParameter_reflection_;
   return metadata;
 }
 
@@ -23717,114 +26281,769 @@ void MatrixMulParameter::Swap(MatrixMulParameter* other) {
 // ===================================================================
 
 #ifndef _MSC_VER
+const int MatrixMulParameter::kFilenameFieldNumber;
+const int MatrixMulParameter::kCol0FieldNumber;
+const int MatrixMulParameter::kCol1FieldNumber;
+const int MatrixMulParameter::kCol2FieldNumber;
+const int MatrixMulParameter::kCalibFieldNumber;
 #endif  // !_MSC_VER
 
-PositionEstimateParameter::PositionEstimateParameter()
+MatrixMulParameter::MatrixMulParameter()
   : ::google::protobuf::Message() {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:svaf.PositionEstimateParameter)
+  // @@protoc_insertion_point(constructor:svaf.MatrixMulParameter)
 }
 
-void PositionEstimateParameter::InitAsDefaultInstance() {
+void MatrixMulParameter::InitAsDefaultInstance() {
 }
 
-PositionEstimateParameter::PositionEstimateParameter(const PositionEstimateParameter& from)
+MatrixMulParameter::MatrixMulParameter(const MatrixMulParameter& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:svaf.PositionEstimateParameter)
+  // @@protoc_insertion_point(copy_constructor:svaf.MatrixMulParameter)
 }
 
-void PositionEstimateParameter::SharedCtor() {
+void MatrixMulParameter::SharedCtor() {
+  ::google::protobuf::internal::GetEmptyString();
   _cached_size_ = 0;
+  filename_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  col0_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  col1_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  col2_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  calib_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-PositionEstimateParameter::~PositionEstimateParameter() {
-  // @@protoc_insertion_point(destructor:svaf.PositionEstimateParameter)
+MatrixMulParameter::~MatrixMulParameter() {
+  // @@protoc_insertion_point(destructor:svaf.MatrixMulParameter)
   SharedDtor();
 }
 
-void PositionEstimateParameter::SharedDtor() {
+void MatrixMulParameter::SharedDtor() {
+  if (filename_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete filename_;
+  }
+  if (col0_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete col0_;
+  }
+  if (col1_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete col1_;
+  }
+  if (col2_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete col2_;
+  }
+  if (calib_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete calib_;
+  }
   if (this != default_instance_) {
   }
 }
 
-void PositionEstimateParameter::SetCachedSize(int size) const {
+void MatrixMulParameter::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* PositionEstimateParameter::descriptor() {
+const ::google::protobuf::Descriptor* MatrixMulParameter::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return PositionEstimateParameter_descriptor_;
+  return MatrixMulParameter_descriptor_;
 }
 
-const PositionEstimateParameter& PositionEstimateParameter::default_instance() {
+const MatrixMulParameter& MatrixMulParameter::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_svaf_2eproto();
   return *default_instance_;
 }
 
-PositionEstimateParameter* PositionEstimateParameter::default_instance_ = NULL;
+MatrixMulParameter* MatrixMulParameter::default_instance_ = NULL;
 
-PositionEstimateParameter* PositionEstimateParameter::New() const {
-  return new PositionEstimateParameter;
+MatrixMulParameter* MatrixMulParameter::New() const {
+  return new MatrixMulParameter;
 }
 
-void PositionEstimateParameter::Clear() {
+void MatrixMulParameter::Clear() {
+  if (_has_bits_[0 / 32] & 31) {
+    if (has_filename()) {
+      if (filename_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        filename_->clear();
+      }
+    }
+    if (has_col0()) {
+      if (col0_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        col0_->clear();
+      }
+    }
+    if (has_col1()) {
+      if (col1_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        col1_->clear();
+      }
+    }
+    if (has_col2()) {
+      if (col2_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        col2_->clear();
+      }
+    }
+    if (has_calib()) {
+      if (calib_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        calib_->clear();
+      }
+    }
+  }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool PositionEstimateParameter::MergePartialFromCodedStream(
+bool MatrixMulParameter::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:svaf.PositionEstimateParameter)
+  // @@protoc_insertion_point(parse_start:svaf.MatrixMulParameter)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
-  handle_unusual:
-    if (tag == 0 ||
-        ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-        ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-      goto success;
-    }
-    DO_(::google::protobuf::internal::WireFormat::SkipField(
-          input, tag, mutable_unknown_fields()));
-  }
-success:
-  // @@protoc_insertion_point(parse_success:svaf.PositionEstimateParameter)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:svaf.PositionEstimateParameter)
-  return false;
-#undef DO_
-}
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional string filename = 1;
+      case 1: {
+        if (tag == 10) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_filename()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->filename().data(), this->filename().length(),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "filename");
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(18)) goto parse_col0;
+        break;
+      }
 
-void PositionEstimateParameter::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:svaf.PositionEstimateParameter)
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:svaf.PositionEstimateParameter)
-}
+      // optional string col0 = 2;
+      case 2: {
+        if (tag == 18) {
+         parse_col0:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_col0()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->col0().data(), this->col0().length(),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "col0");
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(26)) goto parse_col1;
+        break;
+      }
 
-::google::protobuf::uint8* PositionEstimateParameter::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:svaf.PositionEstimateParameter)
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:svaf.PositionEstimateParameter)
-  return target;
-}
+      // optional string col1 = 3;
+      case 3: {
+        if (tag == 26) {
+         parse_col1:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_col1()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->col1().data(), this->col1().length(),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "col1");
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(34)) goto parse_col2;
+        break;
+      }
 
-int PositionEstimateParameter::ByteSize() const {
+      // optional string col2 = 4;
+      case 4: {
+        if (tag == 34) {
+         parse_col2:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_col2()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->col2().data(), this->col2().length(),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "col2");
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(42)) goto parse_calib;
+        break;
+      }
+
+      // optional string calib = 5;
+      case 5: {
+        if (tag == 42) {
+         parse_calib:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_calib()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->calib().data(), this->calib().length(),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "calib");
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectAtEnd()) goto success;
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:svaf.MatrixMulParameter)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:svaf.MatrixMulParameter)
+  return false;
+#undef DO_
+}
+
+void MatrixMulParameter::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:svaf.MatrixMulParameter)
+  // optional string filename = 1;
+  if (has_filename()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->filename().data(), this->filename().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "filename");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->filename(), output);
+  }
+
+  // optional string col0 = 2;
+  if (has_col0()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->col0().data(), this->col0().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "col0");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      2, this->col0(), output);
+  }
+
+  // optional string col1 = 3;
+  if (has_col1()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->col1().data(), this->col1().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "col1");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      3, this->col1(), output);
+  }
+
+  // optional string col2 = 4;
+  if (has_col2()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->col2().data(), this->col2().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "col2");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      4, this->col2(), output);
+  }
+
+  // optional string calib = 5;
+  if (has_calib()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->calib().data(), this->calib().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "calib");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      5, this->calib(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:svaf.MatrixMulParameter)
+}
+
+::google::protobuf::uint8* MatrixMulParameter::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:svaf.MatrixMulParameter)
+  // optional string filename = 1;
+  if (has_filename()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->filename().data(), this->filename().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "filename");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->filename(), target);
+  }
+
+  // optional string col0 = 2;
+  if (has_col0()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->col0().data(), this->col0().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "col0");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->col0(), target);
+  }
+
+  // optional string col1 = 3;
+  if (has_col1()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->col1().data(), this->col1().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "col1");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        3, this->col1(), target);
+  }
+
+  // optional string col2 = 4;
+  if (has_col2()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->col2().data(), this->col2().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "col2");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        4, this->col2(), target);
+  }
+
+  // optional string calib = 5;
+  if (has_calib()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->calib().data(), this->calib().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "calib");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        5, this->calib(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:svaf.MatrixMulParameter)
+  return target;
+}
+
+int MatrixMulParameter::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional string filename = 1;
+    if (has_filename()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->filename());
+    }
+
+    // optional string col0 = 2;
+    if (has_col0()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->col0());
+    }
+
+    // optional string col1 = 3;
+    if (has_col1()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->col1());
+    }
+
+    // optional string col2 = 4;
+    if (has_col2()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->col2());
+    }
+
+    // optional string calib = 5;
+    if (has_calib()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->calib());
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void MatrixMulParameter::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const MatrixMulParameter* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const MatrixMulParameter*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void MatrixMulParameter::MergeFrom(const MatrixMulParameter& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_filename()) {
+      set_filename(from.filename());
+    }
+    if (from.has_col0()) {
+      set_col0(from.col0());
+    }
+    if (from.has_col1()) {
+      set_col1(from.col1());
+    }
+    if (from.has_col2()) {
+      set_col2(from.col2());
+    }
+    if (from.has_calib()) {
+      set_calib(from.calib());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void MatrixMulParameter::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void MatrixMulParameter::CopyFrom(const MatrixMulParameter& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MatrixMulParameter::IsInitialized() const {
+
+  return true;
+}
+
+void MatrixMulParameter::Swap(MatrixMulParameter* other) {
+  if (other != this) {
+    std::swap(filename_, other->filename_);
+    std::swap(col0_, other->col0_);
+    std::swap(col1_, other->col1_);
+    std::swap(col2_, other->col2_);
+    std::swap(calib_, other->calib_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata MatrixMulParameter::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = MatrixMulParameter_descriptor_;
+  metadata.reflection = MatrixMulParameter_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+#endif  // !_MSC_VER
+
+PositionEstimateParameter::PositionEstimateParameter()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:svaf.PositionEstimateParameter)
+}
+
+void PositionEstimateParameter::InitAsDefaultInstance() {
+}
+
+PositionEstimateParameter::PositionEstimateParameter(const PositionEstimateParameter& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+  // @@protoc_insertion_point(copy_constructor:svaf.PositionEstimateParameter)
+}
+
+void PositionEstimateParameter::SharedCtor() {
+  _cached_size_ = 0;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+PositionEstimateParameter::~PositionEstimateParameter() {
+  // @@protoc_insertion_point(destructor:svaf.PositionEstimateParameter)
+  SharedDtor();
+}
+
+void PositionEstimateParameter::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void PositionEstimateParameter::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* PositionEstimateParameter::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return PositionEstimateParameter_descriptor_;
+}
+
+const PositionEstimateParameter& PositionEstimateParameter::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_svaf_2eproto();
+  return *default_instance_;
+}
+
+PositionEstimateParameter* PositionEstimateParameter::default_instance_ = NULL;
+
+PositionEstimateParameter* PositionEstimateParameter::New() const {
+  return new PositionEstimateParameter;
+}
+
+void PositionEstimateParameter::Clear() {
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool PositionEstimateParameter::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:svaf.PositionEstimateParameter)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+  handle_unusual:
+    if (tag == 0 ||
+        ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+        ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+      goto success;
+    }
+    DO_(::google::protobuf::internal::WireFormat::SkipField(
+          input, tag, mutable_unknown_fields()));
+  }
+success:
+  // @@protoc_insertion_point(parse_success:svaf.PositionEstimateParameter)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:svaf.PositionEstimateParameter)
+  return false;
+#undef DO_
+}
+
+void PositionEstimateParameter::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:svaf.PositionEstimateParameter)
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:svaf.PositionEstimateParameter)
+}
+
+::google::protobuf::uint8* PositionEstimateParameter::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:svaf.PositionEstimateParameter)
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:svaf.PositionEstimateParameter)
+  return target;
+}
+
+int PositionEstimateParameter::ByteSize() const {
+  int total_size = 0;
+
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void PositionEstimateParameter::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const PositionEstimateParameter* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const PositionEstimateParameter*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void PositionEstimateParameter::MergeFrom(const PositionEstimateParameter& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void PositionEstimateParameter::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void PositionEstimateParameter::CopyFrom(const PositionEstimateParameter& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PositionEstimateParameter::IsInitialized() const {
+
+  return true;
+}
+
+void PositionEstimateParameter::Swap(PositionEstimateParameter* other) {
+  if (other != this) {
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata PositionEstimateParameter::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = PositionEstimateParameter_descriptor_;
+  metadata.reflection = PositionEstimateParameter_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+#endif  // !_MSC_VER
+
+CenterPointParameter::CenterPointParameter()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:svaf.CenterPointParameter)
+}
+
+void CenterPointParameter::InitAsDefaultInstance() {
+}
+
+CenterPointParameter::CenterPointParameter(const CenterPointParameter& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+  // @@protoc_insertion_point(copy_constructor:svaf.CenterPointParameter)
+}
+
+void CenterPointParameter::SharedCtor() {
+  _cached_size_ = 0;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+CenterPointParameter::~CenterPointParameter() {
+  // @@protoc_insertion_point(destructor:svaf.CenterPointParameter)
+  SharedDtor();
+}
+
+void CenterPointParameter::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void CenterPointParameter::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* CenterPointParameter::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return CenterPointParameter_descriptor_;
+}
+
+const CenterPointParameter& CenterPointParameter::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_svaf_2eproto();
+  return *default_instance_;
+}
+
+CenterPointParameter* CenterPointParameter::default_instance_ = NULL;
+
+CenterPointParameter* CenterPointParameter::New() const {
+  return new CenterPointParameter;
+}
+
+void CenterPointParameter::Clear() {
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool CenterPointParameter::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:svaf.CenterPointParameter)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+  handle_unusual:
+    if (tag == 0 ||
+        ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+        ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+      goto success;
+    }
+    DO_(::google::protobuf::internal::WireFormat::SkipField(
+          input, tag, mutable_unknown_fields()));
+  }
+success:
+  // @@protoc_insertion_point(parse_success:svaf.CenterPointParameter)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:svaf.CenterPointParameter)
+  return false;
+#undef DO_
+}
+
+void CenterPointParameter::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:svaf.CenterPointParameter)
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:svaf.CenterPointParameter)
+}
+
+::google::protobuf::uint8* CenterPointParameter::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:svaf.CenterPointParameter)
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:svaf.CenterPointParameter)
+  return target;
+}
+
+int CenterPointParameter::ByteSize() const {
   int total_size = 0;
 
   if (!unknown_fields().empty()) {
@@ -23838,10 +27057,10 @@ int PositionEstimateParameter::ByteSize() const {
   return total_size;
 }
 
-void PositionEstimateParameter::MergeFrom(const ::google::protobuf::Message& from) {
+void CenterPointParameter::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const PositionEstimateParameter* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const PositionEstimateParameter*>(
+  const CenterPointParameter* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const CenterPointParameter*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -23850,157 +27069,544 @@ void PositionEstimateParameter::MergeFrom(const ::google::protobuf::Message& fro
   }
 }
 
-void PositionEstimateParameter::MergeFrom(const PositionEstimateParameter& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
+void CenterPointParameter::MergeFrom(const CenterPointParameter& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void CenterPointParameter::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void CenterPointParameter::CopyFrom(const CenterPointParameter& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CenterPointParameter::IsInitialized() const {
+
+  return true;
+}
+
+void CenterPointParameter::Swap(CenterPointParameter* other) {
+  if (other != this) {
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata CenterPointParameter::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = CenterPointParameter_descriptor_;
+  metadata.reflection = CenterPointParameter_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int FeaturePoolParameter::kCapacityFieldNumber;
+const int FeaturePoolParameter::kThreshFieldNumber;
+const int FeaturePoolParameter::kCellFieldNumber;
+const int FeaturePoolParameter::kRadiusFieldNumber;
+const int FeaturePoolParameter::kInlierFieldNumber;
+const int FeaturePoolParameter::kItersFieldNumber;
+const int FeaturePoolParameter::kMinmatchFieldNumber;
+const int FeaturePoolParameter::kTreesFieldNumber;
+const int FeaturePoolParameter::kChecksFieldNumber;
+const int FeaturePoolParameter::kStoreFieldNumber;
+const int FeaturePoolParameter::kMaxfailFieldNumber;
+#endif  // !_MSC_VER
+
+FeaturePoolParameter::FeaturePoolParameter()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:svaf.FeaturePoolParameter)
+}
+
+void FeaturePoolParameter::InitAsDefaultInstance() {
+}
+
+FeaturePoolParameter::FeaturePoolParameter(const FeaturePoolParameter& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+  // @@protoc_insertion_point(copy_constructor:svaf.FeaturePoolParameter)
+}
+
+void FeaturePoolParameter::SharedCtor() {
+  _cached_size_ = 0;
+  capacity_ = 5000;
+  thresh_ = 0.65f;
+  cell_ = 10;
+  radius_ = 5;
+  inlier_ = 5;
+  iters_ = 200;
+  minmatch_ = 6;
+  trees_ = 4;
+  checks_ = 64;
+  store_ = true;
+  maxfail_ = 5;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+FeaturePoolParameter::~FeaturePoolParameter() {
+  // @@protoc_insertion_point(destructor:svaf.FeaturePoolParameter)
+  SharedDtor();
+}
+
+void FeaturePoolParameter::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void FeaturePoolParameter::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* FeaturePoolParameter::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return FeaturePoolParameter_descriptor_;
+}
+
+const FeaturePoolParameter& FeaturePoolParameter::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_svaf_2eproto();
+  return *default_instance_;
+}
+
+FeaturePoolParameter* FeaturePoolParameter::default_instance_ = NULL;
+
+FeaturePoolParameter* FeaturePoolParameter::New() const {
+  return new FeaturePoolParameter;
+}
+
+void FeaturePoolParameter::Clear() {
+  if (_has_bits_[0 / 32] & 255) {
+    capacity_ = 5000;
+    thresh_ = 0.65f;
+    cell_ = 10;
+    radius_ = 5;
+    inlier_ = 5;
+    iters_ = 200;
+    minmatch_ = 6;
+    trees_ = 4;
+  }
+  if (_has_bits_[8 / 32] & 1792) {
+    checks_ = 64;
+    store_ = true;
+    maxfail_ = 5;
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool FeaturePoolParameter::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:svaf.FeaturePoolParameter)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional int32 capacity = 1 [default = 5000];
+      case 1: {
+        if (tag == 8) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &capacity_)));
+          set_has_capacity();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(21)) goto parse_thresh;
+        break;
+      }
+
+      // optional float thresh = 2 [default = 0.65];
+      case 2: {
+        if (tag == 21) {
+         parse_thresh:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &thresh_)));
+          set_has_thresh();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(29)) goto parse_cell;
+        break;
+      }
+
+      // optional float cell = 3 [default = 10];
+      case 3: {
+        if (tag == 29) {
+         parse_cell:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &cell_)));
+          set_has_cell();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(37)) goto parse_radius;
+        break;
+      }
+
+      // optional float radius = 4 [default = 5];
+      case 4: {
+        if (tag == 37) {
+         parse_radius:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &radius_)));
+          set_has_radius();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(45)) goto parse_inlier;
+        break;
+      }
+
+      // optional float inlier = 5 [default = 5];
+      case 5: {
+        if (tag == 45) {
+         parse_inlier:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &inlier_)));
+          set_has_inlier();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(48)) goto parse_iters;
+        break;
+      }
+
+      // optional int32 iters = 6 [default = 200];
+      case 6: {
+        if (tag == 48) {
+         parse_iters:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &iters_)));
+          set_has_iters();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(56)) goto parse_minmatch;
+        break;
+      }
+
+      // optional int32 minmatch = 7 [default = 6];
+      case 7: {
+        if (tag == 56) {
+         parse_minmatch:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &minmatch_)));
+          set_has_minmatch();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(64)) goto parse_trees;
+        break;
+      }
+
+      // optional int32 trees = 8 [default = 4];
+      case 8: {
+        if (tag == 64) {
+         parse_trees:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &trees_)));
+          set_has_trees();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(72)) goto parse_checks;
+        break;
+      }
+
+      // optional int32 checks = 9 [default = 64];
+      case 9: {
+        if (tag == 72) {
+         parse_checks:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &checks_)));
+          set_has_checks();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(80)) goto parse_store;
+        break;
+      }
+
+      // optional bool store = 10 [default = true];
+      case 10: {
+        if (tag == 80) {
+         parse_store:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &store_)));
+          set_has_store();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(88)) goto parse_maxfail;
+        break;
+      }
+
+      // optional int32 maxfail = 11 [default = 5];
+      case 11: {
+        if (tag == 88) {
+         parse_maxfail:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &maxfail_)));
+          set_has_maxfail();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectAtEnd()) goto success;
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:svaf.FeaturePoolParameter)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:svaf.FeaturePoolParameter)
+  return false;
+#undef DO_
+}
+
+void FeaturePoolParameter::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:svaf.FeaturePoolParameter)
+  // optional int32 capacity = 1 [default = 5000];
+  if (has_capacity()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->capacity(), output);
+  }
 
-void PositionEstimateParameter::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
+  // optional float thresh = 2 [default = 0.65];
+  if (has_thresh()) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->thresh(), output);
+  }
 
-void PositionEstimateParameter::CopyFrom(const PositionEstimateParameter& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
+  // optional float cell = 3 [default = 10];
+  if (has_cell()) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->cell(), output);
+  }
 
-bool PositionEstimateParameter::IsInitialized() const {
+  // optional float radius = 4 [default = 5];
+  if (has_radius()) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(4, this->radius(), output);
+  }
 
-  return true;
-}
+  // optional float inlier = 5 [default = 5];
+  if (has_inlier()) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(5, this->inlier(), output);
+  }
 
-void PositionEstimateParameter::Swap(PositionEstimateParameter* other) {
-  if (other != this) {
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
+  // optional int32 iters = 6 [default = 200];
+  if (has_iters()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(6, this->iters(), output);
   }
-}
 
-::google::protobuf::Metadata PositionEstimateParameter::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = PositionEstimateParameter_descriptor_;
-  metadata.reflection = PositionEstimateParameter_reflection_;
-  return metadata;
-}
+  // optional int32 minmatch = 7 [default = 6];
+  if (has_minmatch()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(7, this->minmatch(), output);
+  }
 
+  // optional int32 trees = 8 [default = 4];
+  if (has_trees()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(8, this->trees(), output);
+  }
 
-// ===================================================================
+  // optional int32 checks = 9 [default = 64];
+  if (has_checks()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(9, this->checks(), output);
+  }
 
-#ifndef _MSC_VER
-#endif  // !_MSC_VER
+  // optional bool store = 10 [default = true];
+  if (has_store()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(10, this->store(), output);
+  }
 
-CenterPointParameter::CenterPointParameter()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:svaf.CenterPointParameter)
-}
+  // optional int32 maxfail = 11 [default = 5];
+  if (has_maxfail()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(11, this->maxfail(), output);
+  }
 
-void CenterPointParameter::InitAsDefaultInstance() {
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:svaf.FeaturePoolParameter)
 }
 
-CenterPointParameter::CenterPointParameter(const CenterPointParameter& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:svaf.CenterPointParameter)
-}
+::google::protobuf::uint8* FeaturePoolParameter::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:svaf.FeaturePoolParameter)
+  // optional int32 capacity = 1 [default = 5000];
+  if (has_capacity()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->capacity(), target);
+  }
 
-void CenterPointParameter::SharedCtor() {
-  _cached_size_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-}
+  // optional float thresh = 2 [default = 0.65];
+  if (has_thresh()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->thresh(), target);
+  }
 
-CenterPointParameter::~CenterPointParameter() {
-  // @@protoc_insertion_point(destructor:svaf.CenterPointParameter)
-  SharedDtor();
-}
+  // optional float cell = 3 [default = 10];
+  if (has_cell()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->cell(), target);
+  }
 
-void CenterPointParameter::SharedDtor() {
-  if (this != default_instance_) {
+  // optional float radius = 4 [default = 5];
+  if (has_radius()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(4, this->radius(), target);
   }
-}
 
-void CenterPointParameter::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* CenterPointParameter::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CenterPointParameter_descriptor_;
-}
+  // optional float inlier = 5 [default = 5];
+  if (has_inlier()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(5, this->inlier(), target);
+  }
 
-const CenterPointParameter& CenterPointParameter::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_svaf_2eproto();
-  return *default_instance_;
-}
+  // optional int32 iters = 6 [default = 200];
+  if (has_iters()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(6, this->iters(), target);
+  }
 
-CenterPointParameter* CenterPointParameter::default_instance_ = NULL;
+  // optional int32 minmatch = 7 [default = 6];
+  if (has_minmatch()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(7, this->minmatch(), target);
+  }
 
-CenterPointParameter* CenterPointParameter::New() const {
-  return new CenterPointParameter;
-}
+  // optional int32 trees = 8 [default = 4];
+  if (has_trees()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(8, this->trees(), target);
+  }
 
-void CenterPointParameter::Clear() {
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
+  // optional int32 checks = 9 [default = 64];
+  if (has_checks()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(9, this->checks(), target);
+  }
 
-bool CenterPointParameter::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:svaf.CenterPointParameter)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-  handle_unusual:
-    if (tag == 0 ||
-        ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-        ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-      goto success;
-    }
-    DO_(::google::protobuf::internal::WireFormat::SkipField(
-          input, tag, mutable_unknown_fields()));
+  // optional bool store = 10 [default = true];
+  if (has_store()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(10, this->store(), target);
   }
-success:
-  // @@protoc_insertion_point(parse_success:svaf.CenterPointParameter)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:svaf.CenterPointParameter)
-  return false;
-#undef DO_
-}
 
-void CenterPointParameter::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:svaf.CenterPointParameter)
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // optional int32 maxfail = 11 [default = 5];
+  if (has_maxfail()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(11, this->maxfail(), target);
   }
-  // @@protoc_insertion_point(serialize_end:svaf.CenterPointParameter)
-}
 
-::google::protobuf::uint8* CenterPointParameter::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:svaf.CenterPointParameter)
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:svaf.CenterPointParameter)
+  // @@protoc_insertion_point(serialize_to_array_end:svaf.FeaturePoolParameter)
   return target;
 }
 
-int CenterPointParameter::ByteSize() const {
+int FeaturePoolParameter::ByteSize() const {
   int total_size = 0;
 
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional int32 capacity = 1 [default = 5000];
+    if (has_capacity()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->capacity());
+    }
+
+    // optional float thresh = 2 [default = 0.65];
+    if (has_thresh()) {
+      total_size += 1 + 4;
+    }
+
+    // optional float cell = 3 [default = 10];
+    if (has_cell()) {
+      total_size += 1 + 4;
+    }
+
+    // optional float radius = 4 [default = 5];
+    if (has_radius()) {
+      total_size += 1 + 4;
+    }
+
+    // optional float inlier = 5 [default = 5];
+    if (has_inlier()) {
+      total_size += 1 + 4;
+    }
+
+    // optional int32 iters = 6 [default = 200];
+    if (has_iters()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->iters());
+    }
+
+    // optional int32 minmatch = 7 [default = 6];
+    if (has_minmatch()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->minmatch());
+    }
+
+    // optional int32 trees = 8 [default = 4];
+    if (has_trees()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->trees());
+    }
+
+  }
+  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    // optional int32 checks = 9 [default = 64];
+    if (has_checks()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->checks());
+    }
+
+    // optional bool store = 10 [default = true];
+    if (has_store()) {
+      total_size += 1 + 1;
+    }
+
+    // optional int32 maxfail = 11 [default = 5];
+    if (has_maxfail()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->maxfail());
+    }
+
+  }
   if (!unknown_fields().empty()) {
     total_size +=
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
@@ -24012,10 +27618,10 @@ int CenterPointParameter::ByteSize() const {
   return total_size;
 }
 
-void CenterPointParameter::MergeFrom(const ::google::protobuf::Message& from) {
+void FeaturePoolParameter::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const CenterPointParameter* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CenterPointParameter*>(
+  const FeaturePoolParameter* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const FeaturePoolParameter*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -24024,40 +27630,89 @@ void CenterPointParameter::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void CenterPointParameter::MergeFrom(const CenterPointParameter& from) {
+void FeaturePoolParameter::MergeFrom(const FeaturePoolParameter& from) {
   GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_capacity()) {
+      set_capacity(from.capacity());
+    }
+    if (from.has_thresh()) {
+      set_thresh(from.thresh());
+    }
+    if (from.has_cell()) {
+      set_cell(from.cell());
+    }
+    if (from.has_radius()) {
+      set_radius(from.radius());
+    }
+    if (from.has_inlier()) {
+      set_inlier(from.inlier());
+    }
+    if (from.has_iters()) {
+      set_iters(from.iters());
+    }
+    if (from.has_minmatch()) {
+      set_minmatch(from.minmatch());
+    }
+    if (from.has_trees()) {
+      set_trees(from.trees());
+    }
+  }
+  if (from._has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    if (from.has_checks()) {
+      set_checks(from.checks());
+    }
+    if (from.has_store()) {
+      set_store(from.store());
+    }
+    if (from.has_maxfail()) {
+      set_maxfail(from.maxfail());
+    }
+  }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void CenterPointParameter::CopyFrom(const ::google::protobuf::Message& from) {
+void FeaturePoolParameter::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void CenterPointParameter::CopyFrom(const CenterPointParameter& from) {
+void FeaturePoolParameter::CopyFrom(const FeaturePoolParameter& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CenterPointParameter::IsInitialized() const {
+bool FeaturePoolParameter::IsInitialized() const {
 
   return true;
 }
 
-void CenterPointParameter::Swap(CenterPointParameter* other) {
+void FeaturePoolParameter::Swap(FeaturePoolParameter* other) {
   if (other != this) {
+    std::swap(capacity_, other->capacity_);
+    std::swap(thresh_, other->thresh_);
+    std::swap(cell_, other->cell_);
+    std::swap(radius_, other->radius_);
+    std::swap(inlier_, other->inlier_);
+    std::swap(iters_, other->iters_);
+    std::swap(minmatch_, other->minmatch_);
+    std::swap(trees_, other->trees_);
+    std::swap(checks_, other->checks_);
+    std::swap(store_, other->store_);
+    std::swap(maxfail_, other->maxfail_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata CenterPointParameter::GetMetadata() const {
+::google::protobuf::Metadata FeaturePoolParameter::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CenterPointParameter_descriptor_;
-  metadata.reflection = CenterPointParameter_reflection_;
+  metadata.descriptor = FeaturePoolParameter_descriptor_;
+  metadata.reflection = FeaturePoolParameter_reflection_;
   return metadata;
 }
 
@@ -26659,7 +30314,9 @@ bool LayerParameter_LayerType_IsValid(int value) {
     case 72:
     case 81:
     case 82:
+    case 83:
     case 91:
+    case 93:
     case 94:
     case 95:
     case 96:
@@ -26716,7 +30373,9 @@ const LayerParameter_LayerType LayerParameter::SGM_MATCH;
 const LayerParameter_LayerType LayerParameter::EADP_MATCH;
 const LayerParameter_LayerType LayerParameter::TRIANG;
 const LayerParameter_LayerType LayerParameter::MXMUL;
+const LayerParameter_LayerType LayerParameter::REPROJECT;
 const LayerParameter_LayerType LayerParameter::CENTER_POS;
+const LayerParameter_LayerType LayerParameter::FEAT_POOL;
 const LayerParameter_LayerType LayerParameter::IA_EST;
 const LayerParameter_LayerType LayerParameter::IAICP_EST;
 const LayerParameter_LayerType LayerParameter::IANDT_EST;
@@ -26792,8 +30451,10 @@ const int LayerParameter::kEadpParamFieldNumber;
 const int LayerParameter::kOutputParamFieldNumber;
 const int LayerParameter::kTriangParamFieldNumber;
 const int LayerParameter::kMxmulParamFieldNumber;
+const int LayerParameter::kReprojectParamFieldNumber;
 const int LayerParameter::kPosestParamFieldNumber;
 const int LayerParameter::kCenterpointParamFieldNumber;
+const int LayerParameter::kFeatpoolParamFieldNumber;
 const int LayerParameter::kSaciaParamFieldNumber;
 const int LayerParameter::kIaicpParamFieldNumber;
 const int LayerParameter::kIandtParamFieldNumber;
@@ -26863,8 +30524,10 @@ void LayerParameter::InitAsDefaultInstance() {
   output_param_ = const_cast< ::svaf::OutputParameter*>(&::svaf::OutputParameter::default_instance());
   triang_param_ = const_cast< ::svaf::TriangularParameter*>(&::svaf::TriangularParameter::default_instance());
   mxmul_param_ = const_cast< ::svaf::MatrixMulParameter*>(&::svaf::MatrixMulParameter::default_instance());
+  reproject_param_ = const_cast< ::svaf::ReprojectParameter*>(&::svaf::ReprojectParameter::default_instance());
   posest_param_ = const_cast< ::svaf::PositionEstimateParameter*>(&::svaf::PositionEstimateParameter::default_instance());
   centerpoint_param_ = const_cast< ::svaf::CenterPointParameter*>(&::svaf::CenterPointParameter::default_instance());
+  featpool_param_ = const_cast< ::svaf::FeaturePoolParameter*>(&::svaf::FeaturePoolParameter::default_instance());
   sacia_param_ = const_cast< ::svaf::SACIAEstimateParameter*>(&::svaf::SACIAEstimateParameter::default_instance());
   iaicp_param_ = const_cast< ::svaf::IAICPEstimateParameter*>(&::svaf::IAICPEstimateParameter::default_instance());
   iandt_param_ = const_cast< ::svaf::IANDTEstimateParameter*>(&::svaf::IANDTEstimateParameter::default_instance());
@@ -26945,8 +30608,10 @@ void LayerParameter::SharedCtor() {
   output_param_ = NULL;
   triang_param_ = NULL;
   mxmul_param_ = NULL;
+  reproject_param_ = NULL;
   posest_param_ = NULL;
   centerpoint_param_ = NULL;
+  featpool_param_ = NULL;
   sacia_param_ = NULL;
   iaicp_param_ = NULL;
   iandt_param_ = NULL;
@@ -27026,8 +30691,10 @@ void LayerParameter::SharedDtor() {
     delete output_param_;
     delete triang_param_;
     delete mxmul_param_;
+    delete reproject_param_;
     delete posest_param_;
     delete centerpoint_param_;
+    delete featpool_param_;
     delete sacia_param_;
     delete iaicp_param_;
     delete iandt_param_;
@@ -27266,16 +30933,22 @@ void LayerParameter::Clear() {
       if (triang_param_ != NULL) triang_param_->::svaf::TriangularParameter::Clear();
     }
   }
-  if (_has_bits_[64 / 32] & 63) {
+  if (_has_bits_[64 / 32] & 255) {
     if (has_mxmul_param()) {
       if (mxmul_param_ != NULL) mxmul_param_->::svaf::MatrixMulParameter::Clear();
     }
+    if (has_reproject_param()) {
+      if (reproject_param_ != NULL) reproject_param_->::svaf::ReprojectParameter::Clear();
+    }
     if (has_posest_param()) {
       if (posest_param_ != NULL) posest_param_->::svaf::PositionEstimateParameter::Clear();
     }
     if (has_centerpoint_param()) {
       if (centerpoint_param_ != NULL) centerpoint_param_->::svaf::CenterPointParameter::Clear();
     }
+    if (has_featpool_param()) {
+      if (featpool_param_ != NULL) featpool_param_->::svaf::FeaturePoolParameter::Clear();
+    }
     if (has_sacia_param()) {
       if (sacia_param_ != NULL) sacia_param_->::svaf::SACIAEstimateParameter::Clear();
     }
@@ -28093,6 +31766,19 @@ bool LayerParameter::MergePartialFromCodedStream(
         } else {
           goto handle_unusual;
         }
+        if (input->ExpectTag(1466)) goto parse_reproject_param;
+        break;
+      }
+
+      // optional .svaf.ReprojectParameter reproject_param = 183;
+      case 183: {
+        if (tag == 1466) {
+         parse_reproject_param:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_reproject_param()));
+        } else {
+          goto handle_unusual;
+        }
         if (input->ExpectTag(1522)) goto parse_posest_param;
         break;
       }
@@ -28119,6 +31805,19 @@ bool LayerParameter::MergePartialFromCodedStream(
         } else {
           goto handle_unusual;
         }
+        if (input->ExpectTag(1546)) goto parse_featpool_param;
+        break;
+      }
+
+      // optional .svaf.FeaturePoolParameter featpool_param = 193;
+      case 193: {
+        if (tag == 1546) {
+         parse_featpool_param:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_featpool_param()));
+        } else {
+          goto handle_unusual;
+        }
         if (input->ExpectTag(1554)) goto parse_sacia_param;
         break;
       }
@@ -28627,6 +32326,12 @@ void LayerParameter::SerializeWithCachedSizes(
       182, this->mxmul_param(), output);
   }
 
+  // optional .svaf.ReprojectParameter reproject_param = 183;
+  if (has_reproject_param()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      183, this->reproject_param(), output);
+  }
+
   // optional .svaf.PositionEstimateParameter posest_param = 190;
   if (has_posest_param()) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
@@ -28639,6 +32344,12 @@ void LayerParameter::SerializeWithCachedSizes(
       191, this->centerpoint_param(), output);
   }
 
+  // optional .svaf.FeaturePoolParameter featpool_param = 193;
+  if (has_featpool_param()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      193, this->featpool_param(), output);
+  }
+
   // optional .svaf.SACIAEstimateParameter sacia_param = 194;
   if (has_sacia_param()) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
@@ -29119,6 +32830,13 @@ void LayerParameter::SerializeWithCachedSizes(
         182, this->mxmul_param(), target);
   }
 
+  // optional .svaf.ReprojectParameter reproject_param = 183;
+  if (has_reproject_param()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        183, this->reproject_param(), target);
+  }
+
   // optional .svaf.PositionEstimateParameter posest_param = 190;
   if (has_posest_param()) {
     target = ::google::protobuf::internal::WireFormatLite::
@@ -29133,6 +32851,13 @@ void LayerParameter::SerializeWithCachedSizes(
         191, this->centerpoint_param(), target);
   }
 
+  // optional .svaf.FeaturePoolParameter featpool_param = 193;
+  if (has_featpool_param()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        193, this->featpool_param(), target);
+  }
+
   // optional .svaf.SACIAEstimateParameter sacia_param = 194;
   if (has_sacia_param()) {
     target = ::google::protobuf::internal::WireFormatLite::
@@ -29670,6 +33395,13 @@ int LayerParameter::ByteSize() const {
           this->mxmul_param());
     }
 
+    // optional .svaf.ReprojectParameter reproject_param = 183;
+    if (has_reproject_param()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->reproject_param());
+    }
+
     // optional .svaf.PositionEstimateParameter posest_param = 190;
     if (has_posest_param()) {
       total_size += 2 +
@@ -29684,6 +33416,13 @@ int LayerParameter::ByteSize() const {
           this->centerpoint_param());
     }
 
+    // optional .svaf.FeaturePoolParameter featpool_param = 193;
+    if (has_featpool_param()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->featpool_param());
+    }
+
     // optional .svaf.SACIAEstimateParameter sacia_param = 194;
     if (has_sacia_param()) {
       total_size += 2 +
@@ -29943,12 +33682,18 @@ void LayerParameter::MergeFrom(const LayerParameter& from) {
     if (from.has_mxmul_param()) {
       mutable_mxmul_param()->::svaf::MatrixMulParameter::MergeFrom(from.mxmul_param());
     }
+    if (from.has_reproject_param()) {
+      mutable_reproject_param()->::svaf::ReprojectParameter::MergeFrom(from.reproject_param());
+    }
     if (from.has_posest_param()) {
       mutable_posest_param()->::svaf::PositionEstimateParameter::MergeFrom(from.posest_param());
     }
     if (from.has_centerpoint_param()) {
       mutable_centerpoint_param()->::svaf::CenterPointParameter::MergeFrom(from.centerpoint_param());
     }
+    if (from.has_featpool_param()) {
+      mutable_featpool_param()->::svaf::FeaturePoolParameter::MergeFrom(from.featpool_param());
+    }
     if (from.has_sacia_param()) {
       mutable_sacia_param()->::svaf::SACIAEstimateParameter::MergeFrom(from.sacia_param());
     }
@@ -30046,8 +33791,10 @@ void LayerParameter::Swap(LayerParameter* other) {
     std::swap(output_param_, other->output_param_);
     std::swap(triang_param_, other->triang_param_);
     std::swap(mxmul_param_, other->mxmul_param_);
+    std::swap(reproject_param_, other->reproject_param_);
     std::swap(posest_param_, other->posest_param_);
     std::swap(centerpoint_param_, other->centerpoint_param_);
+    std::swap(featpool_param_, other->featpool_param_);
     std::swap(sacia_param_, other->sacia_param_);
     std::swap(iaicp_param_, other->iaicp_param_);
     std::swap(iandt_param_, other->iandt_param_);
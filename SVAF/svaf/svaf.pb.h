@@ -63,6 +63,7 @@ class MilTrackParameter;
 class FeaturePointParameter;
 class SIFTPointParameter;
 class SURFPointParameter;
+class PointBudgetParameter;
 class STARPointParameter;
 class BRISKPointParameter;
 class FASTPointParameter;
@@ -107,9 +108,11 @@ class SGMMatchParameter;
 class EADPMatchParameter;
 class OutputParameter;
 class TriangularParameter;
+class ReprojectParameter;
 class MatrixMulParameter;
 class PositionEstimateParameter;
 class CenterPointParameter;
+class FeaturePoolParameter;
 class CoordiParameter;
 class SACIAParameter;
 class SACIAEstimateParameter;
@@ -257,6 +260,27 @@ inline bool CVDescriptorParameter_DespType_Parse(
   return ::google::protobuf::internal::ParseNamedEnum<CVDescriptorParameter_DespType>(
     CVDescriptorParameter_DespType_descriptor(), name, value);
 }
+enum RansacParameter_ModelType {
+  RansacParameter_ModelType_HOMOGRAPHY = 0,
+  RansacParameter_ModelType_FUNDAMENTAL = 1,
+  RansacParameter_ModelType_ESSENTIAL = 2,
+  RansacParameter_ModelType_DISPARITY = 3
+};
+bool RansacParameter_ModelType_IsValid(int value);
+const RansacParameter_ModelType RansacParameter_ModelType_ModelType_MIN = RansacParameter_ModelType_HOMOGRAPHY;
+const RansacParameter_ModelType RansacParameter_ModelType_ModelType_MAX = RansacParameter_ModelType_DISPARITY;
+const int RansacParameter_ModelType_ModelType_ARRAYSIZE = RansacParameter_ModelType_ModelType_MAX + 1;
+
+const ::google::protobuf::EnumDescriptor* RansacParameter_ModelType_descriptor();
+inline const ::std::string& RansacParameter_ModelType_Name(RansacParameter_ModelType value) {
+  return ::google::protobuf::internal::NameOfEnum(
+    RansacParameter_ModelType_descriptor(), value);
+}
+inline bool RansacParameter_ModelType_Parse(
+    const ::std::string& name, RansacParameter_ModelType* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<RansacParameter_ModelType>(
+    RansacParameter_ModelType_descriptor(), name, value);
+}
 enum CVMatchParameter_MatchType {
   CVMatchParameter_MatchType_BFL1 = 1,
   CVMatchParameter_MatchType_BFL2 = 2,
@@ -324,7 +348,9 @@ enum LayerParameter_LayerType {
   LayerParameter_LayerType_EADP_MATCH = 72,
   LayerParameter_LayerType_TRIANG = 81,
   LayerParameter_LayerType_MXMUL = 82,
+  LayerParameter_LayerType_REPROJECT = 83,
   LayerParameter_LayerType_CENTER_POS = 91,
+  LayerParameter_LayerType_FEAT_POOL = 93,
   LayerParameter_LayerType_IA_EST = 94,
   LayerParameter_LayerType_IAICP_EST = 95,
   LayerParameter_LayerType_IANDT_EST = 96,
@@ -937,16 +963,47 @@ class StereoRectifyParameter : public ::google::protobuf::Message {
   inline ::std::string* release_filename();
   inline void set_allocated_filename(::std::string* filename);
 
+  // optional string calib = 2;
+  inline bool has_calib() const;
+  inline void clear_calib();
+  static const int kCalibFieldNumber = 2;
+  inline const ::std::string& calib() const;
+  inline void set_calib(const ::std::string& value);
+  inline void set_calib(const char* value);
+  inline void set_calib(const char* value, size_t size);
+  inline ::std::string* mutable_calib();
+  inline ::std::string* release_calib();
+  inline void set_allocated_calib(::std::string* calib);
+
+  // optional string cache_dir = 3 [default = "./calib/"];
+  inline bool has_cache_dir() const;
+  inline void clear_cache_dir();
+  static const int kCacheDirFieldNumber = 3;
+  inline const ::std::string& cache_dir() const;
+  inline void set_cache_dir(const ::std::string& value);
+  inline void set_cache_dir(const char* value);
+  inline void set_cache_dir(const char* value, size_t size);
+  inline ::std::string* mutable_cache_dir();
+  inline ::std::string* release_cache_dir();
+  inline void set_allocated_cache_dir(::std::string* cache_dir);
+
   // @@protoc_insertion_point(class_scope:svaf.StereoRectifyParameter)
  private:
   inline void set_has_filename();
   inline void clear_has_filename();
+  inline void set_has_calib();
+  inline void clear_has_calib();
+  inline void set_has_cache_dir();
+  inline void clear_has_cache_dir();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
   ::google::protobuf::uint32 _has_bits_[1];
   mutable int _cached_size_;
   ::std::string* filename_;
+  ::std::string* calib_;
+  static ::std::string* _default_cache_dir_;
+  ::std::string* cache_dir_;
   friend void  protobuf_AddDesc_svaf_2eproto();
   friend void protobuf_AssignDesc_svaf_2eproto();
   friend void protobuf_ShutdownFile_svaf_2eproto();
@@ -3179,6 +3236,15 @@ class SURFPointParameter : public ::google::protobuf::Message {
   inline float thresh() const;
   inline void set_thresh(float value);
 
+  // optional .svaf.PointBudgetParameter budget_param = 5;
+  inline bool has_budget_param() const;
+  inline void clear_budget_param();
+  static const int kBudgetParamFieldNumber = 5;
+  inline const ::svaf::PointBudgetParameter& budget_param() const;
+  inline ::svaf::PointBudgetParameter* mutable_budget_param();
+  inline ::svaf::PointBudgetParameter* release_budget_param();
+  inline void set_allocated_budget_param(::svaf::PointBudgetParameter* budget_param);
+
   // @@protoc_insertion_point(class_scope:svaf.SURFPointParameter)
  private:
   inline void set_has_stride();
@@ -3189,6 +3255,8 @@ class SURFPointParameter : public ::google::protobuf::Message {
   inline void clear_has_intervals();
   inline void set_has_thresh();
   inline void clear_has_thresh();
+  inline void set_has_budget_param();
+  inline void clear_has_budget_param();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
@@ -3198,6 +3266,7 @@ class SURFPointParameter : public ::google::protobuf::Message {
   ::google::protobuf::int32 octaves_;
   ::google::protobuf::int32 intervals_;
   float thresh_;
+  ::svaf::PointBudgetParameter* budget_param_;
   friend void  protobuf_AddDesc_svaf_2eproto();
   friend void protobuf_AssignDesc_svaf_2eproto();
   friend void protobuf_ShutdownFile_svaf_2eproto();
@@ -3207,6 +3276,125 @@ class SURFPointParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
+class PointBudgetParameter : public ::google::protobuf::Message {
+ public:
+  PointBudgetParameter();
+  virtual ~PointBudgetParameter();
+
+  PointBudgetParameter(const PointBudgetParameter& from);
+
+  inline PointBudgetParameter& operator=(const PointBudgetParameter& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const PointBudgetParameter& default_instance();
+
+  void Swap(PointBudgetParameter* other);
+
+  // implements Message ----------------------------------------------
+
+  PointBudgetParameter* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const PointBudgetParameter& from);
+  void MergeFrom(const PointBudgetParameter& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional int32 budget = 1 [default = 0];
+  inline bool has_budget() const;
+  inline void clear_budget();
+  static const int kBudgetFieldNumber = 1;
+  inline ::google::protobuf::int32 budget() const;
+  inline void set_budget(::google::protobuf::int32 value);
+
+  // optional int32 grid_cols = 2 [default = 8];
+  inline bool has_grid_cols() const;
+  inline void clear_grid_cols();
+  static const int kGridColsFieldNumber = 2;
+  inline ::google::protobuf::int32 grid_cols() const;
+  inline void set_grid_cols(::google::protobuf::int32 value);
+
+  // optional int32 grid_rows = 3 [default = 6];
+  inline bool has_grid_rows() const;
+  inline void clear_grid_rows();
+  static const int kGridRowsFieldNumber = 3;
+  inline ::google::protobuf::int32 grid_rows() const;
+  inline void set_grid_rows(::google::protobuf::int32 value);
+
+  // optional bool adaptive = 4 [default = true];
+  inline bool has_adaptive() const;
+  inline void clear_adaptive();
+  static const int kAdaptiveFieldNumber = 4;
+  inline bool adaptive() const;
+  inline void set_adaptive(bool value);
+
+  // optional float overshoot = 5 [default = 1.5];
+  inline bool has_overshoot() const;
+  inline void clear_overshoot();
+  static const int kOvershootFieldNumber = 5;
+  inline float overshoot() const;
+  inline void set_overshoot(float value);
+
+  // @@protoc_insertion_point(class_scope:svaf.PointBudgetParameter)
+ private:
+  inline void set_has_budget();
+  inline void clear_has_budget();
+  inline void set_has_grid_cols();
+  inline void clear_has_grid_cols();
+  inline void set_has_grid_rows();
+  inline void clear_has_grid_rows();
+  inline void set_has_adaptive();
+  inline void clear_has_adaptive();
+  inline void set_has_overshoot();
+  inline void clear_has_overshoot();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::uint32 _has_bits_[1];
+  mutable int _cached_size_;
+  ::google::protobuf::int32 budget_;
+  ::google::protobuf::int32 grid_cols_;
+  ::google::protobuf::int32 grid_rows_;
+  bool adaptive_;
+  float overshoot_;
+  friend void  protobuf_AddDesc_svaf_2eproto();
+  friend void protobuf_AssignDesc_svaf_2eproto();
+  friend void protobuf_ShutdownFile_svaf_2eproto();
+
+  void InitAsDefaultInstance();
+  static PointBudgetParameter* default_instance_;
+};
+// -------------------------------------------------------------------
+
 class STARPointParameter : public ::google::protobuf::Message {
  public:
   STARPointParameter();
@@ -5407,6 +5595,15 @@ class CVPointParameter : public ::google::protobuf::Message {
   inline ::svaf::AkazeParamCP* release_akaze_param();
   inline void set_allocated_akaze_param(::svaf::AkazeParamCP* akaze_param);
 
+  // optional .svaf.PointBudgetParameter budget_param = 3;
+  inline bool has_budget_param() const;
+  inline void clear_budget_param();
+  static const int kBudgetParamFieldNumber = 3;
+  inline const ::svaf::PointBudgetParameter& budget_param() const;
+  inline ::svaf::PointBudgetParameter* mutable_budget_param();
+  inline ::svaf::PointBudgetParameter* release_budget_param();
+  inline void set_allocated_budget_param(::svaf::PointBudgetParameter* budget_param);
+
   // @@protoc_insertion_point(class_scope:svaf.CVPointParameter)
  private:
   inline void set_has_type();
@@ -5439,6 +5636,8 @@ class CVPointParameter : public ::google::protobuf::Message {
   inline void clear_has_sb_param();
   inline void set_has_akaze_param();
   inline void clear_has_akaze_param();
+  inline void set_has_budget_param();
+  inline void clear_has_budget_param();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
@@ -5459,6 +5658,7 @@ class CVPointParameter : public ::google::protobuf::Message {
   ::svaf::DenseParamCP* dense_param_;
   ::svaf::SimpleBlobParamCP* sb_param_;
   ::svaf::AkazeParamCP* akaze_param_;
+  ::svaf::PointBudgetParameter* budget_param_;
   friend void  protobuf_AddDesc_svaf_2eproto();
   friend void protobuf_AssignDesc_svaf_2eproto();
   friend void protobuf_ShutdownFile_svaf_2eproto();
@@ -6420,13 +6620,63 @@ class KDTreeMatchParameter : public ::google::protobuf::Message {
 
   // accessors -------------------------------------------------------
 
+  // optional int32 trees = 1 [default = 4];
+  inline bool has_trees() const;
+  inline void clear_trees();
+  static const int kTreesFieldNumber = 1;
+  inline ::google::protobuf::int32 trees() const;
+  inline void set_trees(::google::protobuf::int32 value);
+
+  // optional int32 checks = 2 [default = 64];
+  inline bool has_checks() const;
+  inline void clear_checks();
+  static const int kChecksFieldNumber = 2;
+  inline ::google::protobuf::int32 checks() const;
+  inline void set_checks(::google::protobuf::int32 value);
+
+  // optional int32 leafsize = 3 [default = 8];
+  inline bool has_leafsize() const;
+  inline void clear_leafsize();
+  static const int kLeafsizeFieldNumber = 3;
+  inline ::google::protobuf::int32 leafsize() const;
+  inline void set_leafsize(::google::protobuf::int32 value);
+
+  // optional float thresh = 4 [default = 0.65];
+  inline bool has_thresh() const;
+  inline void clear_thresh();
+  static const int kThreshFieldNumber = 4;
+  inline float thresh() const;
+  inline void set_thresh(float value);
+
+  // optional bool keeptrain = 5 [default = false];
+  inline bool has_keeptrain() const;
+  inline void clear_keeptrain();
+  static const int kKeeptrainFieldNumber = 5;
+  inline bool keeptrain() const;
+  inline void set_keeptrain(bool value);
+
   // @@protoc_insertion_point(class_scope:svaf.KDTreeMatchParameter)
  private:
+  inline void set_has_trees();
+  inline void clear_has_trees();
+  inline void set_has_checks();
+  inline void clear_has_checks();
+  inline void set_has_leafsize();
+  inline void clear_has_leafsize();
+  inline void set_has_thresh();
+  inline void clear_has_thresh();
+  inline void set_has_keeptrain();
+  inline void clear_has_keeptrain();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
   ::google::protobuf::uint32 _has_bits_[1];
   mutable int _cached_size_;
+  ::google::protobuf::int32 trees_;
+  ::google::protobuf::int32 checks_;
+  ::google::protobuf::int32 leafsize_;
+  float thresh_;
+  bool keeptrain_;
   friend void  protobuf_AddDesc_svaf_2eproto();
   friend void protobuf_AssignDesc_svaf_2eproto();
   friend void protobuf_ShutdownFile_svaf_2eproto();
@@ -6496,16 +6746,26 @@ class EularMatchParameter : public ::google::protobuf::Message {
   inline float thresh() const;
   inline void set_thresh(float value);
 
+  // optional bool crosscheck = 2 [default = false];
+  inline bool has_crosscheck() const;
+  inline void clear_crosscheck();
+  static const int kCrosscheckFieldNumber = 2;
+  inline bool crosscheck() const;
+  inline void set_crosscheck(bool value);
+
   // @@protoc_insertion_point(class_scope:svaf.EularMatchParameter)
  private:
   inline void set_has_thresh();
   inline void clear_has_thresh();
+  inline void set_has_crosscheck();
+  inline void clear_has_crosscheck();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
   ::google::protobuf::uint32 _has_bits_[1];
   mutable int _cached_size_;
   float thresh_;
+  bool crosscheck_;
   friend void  protobuf_AddDesc_svaf_2eproto();
   friend void protobuf_AssignDesc_svaf_2eproto();
   friend void protobuf_ShutdownFile_svaf_2eproto();
@@ -6566,6 +6826,32 @@ class RansacParameter : public ::google::protobuf::Message {
 
   // nested types ----------------------------------------------------
 
+  typedef RansacParameter_ModelType ModelType;
+  static const ModelType HOMOGRAPHY = RansacParameter_ModelType_HOMOGRAPHY;
+  static const ModelType FUNDAMENTAL = RansacParameter_ModelType_FUNDAMENTAL;
+  static const ModelType ESSENTIAL = RansacParameter_ModelType_ESSENTIAL;
+  static const ModelType DISPARITY = RansacParameter_ModelType_DISPARITY;
+  static inline bool ModelType_IsValid(int value) {
+    return RansacParameter_ModelType_IsValid(value);
+  }
+  static const ModelType ModelType_MIN =
+    RansacParameter_ModelType_ModelType_MIN;
+  static const ModelType ModelType_MAX =
+    RansacParameter_ModelType_ModelType_MAX;
+  static const int ModelType_ARRAYSIZE =
+    RansacParameter_ModelType_ModelType_ARRAYSIZE;
+  static inline const ::google::protobuf::EnumDescriptor*
+  ModelType_descriptor() {
+    return RansacParameter_ModelType_descriptor();
+  }
+  static inline const ::std::string& ModelType_Name(ModelType value) {
+    return RansacParameter_ModelType_Name(value);
+  }
+  static inline bool ModelType_Parse(const ::std::string& name,
+      ModelType* value) {
+    return RansacParameter_ModelType_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
   // optional float thresh = 1 [default = 5];
@@ -6575,16 +6861,91 @@ class RansacParameter : public ::google::protobuf::Message {
   inline float thresh() const;
   inline void set_thresh(float value);
 
+  // optional .svaf.RansacParameter.ModelType model = 2 [default = HOMOGRAPHY];
+  inline bool has_model() const;
+  inline void clear_model();
+  static const int kModelFieldNumber = 2;
+  inline ::svaf::RansacParameter_ModelType model() const;
+  inline void set_model(::svaf::RansacParameter_ModelType value);
+
+  // optional float confidence = 3 [default = 0.995];
+  inline bool has_confidence() const;
+  inline void clear_confidence();
+  static const int kConfidenceFieldNumber = 3;
+  inline float confidence() const;
+  inline void set_confidence(float value);
+
+  // optional int32 maxiters = 4 [default = 2000];
+  inline bool has_maxiters() const;
+  inline void clear_maxiters();
+  static const int kMaxitersFieldNumber = 4;
+  inline ::google::protobuf::int32 maxiters() const;
+  inline void set_maxiters(::google::protobuf::int32 value);
+
+  // optional float budget = 5 [default = 0];
+  inline bool has_budget() const;
+  inline void clear_budget();
+  static const int kBudgetFieldNumber = 5;
+  inline float budget() const;
+  inline void set_budget(float value);
+
+  // optional bool prosac = 6 [default = true];
+  inline bool has_prosac() const;
+  inline void clear_prosac();
+  static const int kProsacFieldNumber = 6;
+  inline bool prosac() const;
+  inline void set_prosac(bool value);
+
+  // optional bool sprt = 7 [default = true];
+  inline bool has_sprt() const;
+  inline void clear_sprt();
+  static const int kSprtFieldNumber = 7;
+  inline bool sprt() const;
+  inline void set_sprt(bool value);
+
+  // optional string calib = 8;
+  inline bool has_calib() const;
+  inline void clear_calib();
+  static const int kCalibFieldNumber = 8;
+  inline const ::std::string& calib() const;
+  inline void set_calib(const ::std::string& value);
+  inline void set_calib(const char* value);
+  inline void set_calib(const char* value, size_t size);
+  inline ::std::string* mutable_calib();
+  inline ::std::string* release_calib();
+  inline void set_allocated_calib(::std::string* calib);
+
   // @@protoc_insertion_point(class_scope:svaf.RansacParameter)
  private:
   inline void set_has_thresh();
   inline void clear_has_thresh();
+  inline void set_has_model();
+  inline void clear_has_model();
+  inline void set_has_confidence();
+  inline void clear_has_confidence();
+  inline void set_has_maxiters();
+  inline void clear_has_maxiters();
+  inline void set_has_budget();
+  inline void clear_has_budget();
+  inline void set_has_prosac();
+  inline void clear_has_prosac();
+  inline void set_has_sprt();
+  inline void clear_has_sprt();
+  inline void set_has_calib();
+  inline void clear_has_calib();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
   ::google::protobuf::uint32 _has_bits_[1];
   mutable int _cached_size_;
   float thresh_;
+  int model_;
+  float confidence_;
+  ::google::protobuf::int32 maxiters_;
+  float budget_;
+  bool prosac_;
+  bool sprt_;
+  ::std::string* calib_;
   friend void  protobuf_AddDesc_svaf_2eproto();
   friend void protobuf_AssignDesc_svaf_2eproto();
   friend void protobuf_ShutdownFile_svaf_2eproto();
@@ -6785,13 +7146,63 @@ class ECMatchParameter : public ::google::protobuf::Message {
 
   // accessors -------------------------------------------------------
 
+  // optional int32 rowtol = 1 [default = 1];
+  inline bool has_rowtol() const;
+  inline void clear_rowtol();
+  static const int kRowtolFieldNumber = 1;
+  inline ::google::protobuf::int32 rowtol() const;
+  inline void set_rowtol(::google::protobuf::int32 value);
+
+  // optional float mindisp = 2;
+  inline bool has_mindisp() const;
+  inline void clear_mindisp();
+  static const int kMindispFieldNumber = 2;
+  inline float mindisp() const;
+  inline void set_mindisp(float value);
+
+  // optional float maxdisp = 3;
+  inline bool has_maxdisp() const;
+  inline void clear_maxdisp();
+  static const int kMaxdispFieldNumber = 3;
+  inline float maxdisp() const;
+  inline void set_maxdisp(float value);
+
+  // optional float thresh = 4 [default = 0.65];
+  inline bool has_thresh() const;
+  inline void clear_thresh();
+  static const int kThreshFieldNumber = 4;
+  inline float thresh() const;
+  inline void set_thresh(float value);
+
+  // optional bool crosscheck = 5 [default = false];
+  inline bool has_crosscheck() const;
+  inline void clear_crosscheck();
+  static const int kCrosscheckFieldNumber = 5;
+  inline bool crosscheck() const;
+  inline void set_crosscheck(bool value);
+
   // @@protoc_insertion_point(class_scope:svaf.ECMatchParameter)
  private:
+  inline void set_has_rowtol();
+  inline void clear_has_rowtol();
+  inline void set_has_mindisp();
+  inline void clear_has_mindisp();
+  inline void set_has_maxdisp();
+  inline void clear_has_maxdisp();
+  inline void set_has_thresh();
+  inline void clear_has_thresh();
+  inline void set_has_crosscheck();
+  inline void clear_has_crosscheck();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
   ::google::protobuf::uint32 _has_bits_[1];
   mutable int _cached_size_;
+  ::google::protobuf::int32 rowtol_;
+  float mindisp_;
+  float maxdisp_;
+  float thresh_;
+  bool crosscheck_;
   friend void  protobuf_AddDesc_svaf_2eproto();
   friend void protobuf_AssignDesc_svaf_2eproto();
   friend void protobuf_ShutdownFile_svaf_2eproto();
@@ -7093,6 +7504,69 @@ class SGMMatchParameter : public ::google::protobuf::Message {
   inline bool savetxt() const;
   inline void set_savetxt(bool value);
 
+  // optional int32 pyramid = 8 [default = 0];
+  inline bool has_pyramid() const;
+  inline void clear_pyramid();
+  static const int kPyramidFieldNumber = 8;
+  inline ::google::protobuf::int32 pyramid() const;
+  inline void set_pyramid(::google::protobuf::int32 value);
+
+  // optional int32 margin = 9 [default = 2];
+  inline bool has_margin() const;
+  inline void clear_margin();
+  static const int kMarginFieldNumber = 9;
+  inline ::google::protobuf::int32 margin() const;
+  inline void set_margin(::google::protobuf::int32 value);
+
+  // optional bool temporal = 10 [default = false];
+  inline bool has_temporal() const;
+  inline void clear_temporal();
+  static const int kTemporalFieldNumber = 10;
+  inline bool temporal() const;
+  inline void set_temporal(bool value);
+
+  // optional int32 tile = 11 [default = 16];
+  inline bool has_tile() const;
+  inline void clear_tile();
+  static const int kTileFieldNumber = 11;
+  inline ::google::protobuf::int32 tile() const;
+  inline void set_tile(::google::protobuf::int32 value);
+
+  // optional int32 motion = 12 [default = 8];
+  inline bool has_motion() const;
+  inline void clear_motion();
+  static const int kMotionFieldNumber = 12;
+  inline ::google::protobuf::int32 motion() const;
+  inline void set_motion(::google::protobuf::int32 value);
+
+  // optional int32 uniqueness = 13 [default = 0];
+  inline bool has_uniqueness() const;
+  inline void clear_uniqueness();
+  static const int kUniquenessFieldNumber = 13;
+  inline ::google::protobuf::int32 uniqueness() const;
+  inline void set_uniqueness(::google::protobuf::int32 value);
+
+  // optional bool subpixel = 14 [default = false];
+  inline bool has_subpixel() const;
+  inline void clear_subpixel();
+  static const int kSubpixelFieldNumber = 14;
+  inline bool subpixel() const;
+  inline void set_subpixel(bool value);
+
+  // optional bool roi = 15 [default = true];
+  inline bool has_roi() const;
+  inline void clear_roi();
+  static const int kRoiFieldNumber = 15;
+  inline bool roi() const;
+  inline void set_roi(bool value);
+
+  // optional bool points = 16 [default = true];
+  inline bool has_points() const;
+  inline void clear_points();
+  static const int kPointsFieldNumber = 16;
+  inline bool points() const;
+  inline void set_points(bool value);
+
   // @@protoc_insertion_point(class_scope:svaf.SGMMatchParameter)
  private:
   inline void set_has_max_disp();
@@ -7109,6 +7583,24 @@ class SGMMatchParameter : public ::google::protobuf::Message {
   inline void clear_has_prefix();
   inline void set_has_savetxt();
   inline void clear_has_savetxt();
+  inline void set_has_pyramid();
+  inline void clear_has_pyramid();
+  inline void set_has_margin();
+  inline void clear_has_margin();
+  inline void set_has_temporal();
+  inline void clear_has_temporal();
+  inline void set_has_tile();
+  inline void clear_has_tile();
+  inline void set_has_motion();
+  inline void clear_has_motion();
+  inline void set_has_uniqueness();
+  inline void clear_has_uniqueness();
+  inline void set_has_subpixel();
+  inline void clear_has_subpixel();
+  inline void set_has_roi();
+  inline void clear_has_roi();
+  inline void set_has_points();
+  inline void clear_has_points();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
@@ -7121,7 +7613,16 @@ class SGMMatchParameter : public ::google::protobuf::Message {
   static ::std::string* _default_prefix_;
   ::std::string* prefix_;
   float r2_;
+  ::google::protobuf::int32 pyramid_;
+  ::google::protobuf::int32 margin_;
+  ::google::protobuf::int32 tile_;
   bool savetxt_;
+  bool temporal_;
+  bool subpixel_;
+  bool roi_;
+  ::google::protobuf::int32 motion_;
+  ::google::protobuf::int32 uniqueness_;
+  bool points_;
   friend void  protobuf_AddDesc_svaf_2eproto();
   friend void protobuf_AssignDesc_svaf_2eproto();
   friend void protobuf_ShutdownFile_svaf_2eproto();
@@ -7259,6 +7760,27 @@ class EADPMatchParameter : public ::google::protobuf::Message {
   inline bool savetxt() const;
   inline void set_savetxt(bool value);
 
+  // optional bool fast = 11 [default = false];
+  inline bool has_fast() const;
+  inline void clear_fast();
+  static const int kFastFieldNumber = 11;
+  inline bool fast() const;
+  inline void set_fast(bool value);
+
+  // optional bool roi = 12 [default = true];
+  inline bool has_roi() const;
+  inline void clear_roi();
+  static const int kRoiFieldNumber = 12;
+  inline bool roi() const;
+  inline void set_roi(bool value);
+
+  // optional bool points = 13 [default = true];
+  inline bool has_points() const;
+  inline void clear_points();
+  static const int kPointsFieldNumber = 13;
+  inline bool points() const;
+  inline void set_points(bool value);
+
   // @@protoc_insertion_point(class_scope:svaf.EADPMatchParameter)
  private:
   inline void set_has_max_disp();
@@ -7281,6 +7803,12 @@ class EADPMatchParameter : public ::google::protobuf::Message {
   inline void clear_has_prefix();
   inline void set_has_savetxt();
   inline void clear_has_savetxt();
+  inline void set_has_fast();
+  inline void clear_has_fast();
+  inline void set_has_roi();
+  inline void clear_has_roi();
+  inline void set_has_points();
+  inline void clear_has_points();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
@@ -7297,6 +7825,9 @@ class EADPMatchParameter : public ::google::protobuf::Message {
   static ::std::string* _default_prefix_;
   ::std::string* prefix_;
   bool savetxt_;
+  bool fast_;
+  bool roi_;
+  bool points_;
   friend void  protobuf_AddDesc_svaf_2eproto();
   friend void protobuf_AssignDesc_svaf_2eproto();
   friend void protobuf_ShutdownFile_svaf_2eproto();
@@ -7478,6 +8009,49 @@ class TriangularParameter : public ::google::protobuf::Message {
   inline ::std::string* release_pcname();
   inline void set_allocated_pcname(::std::string* pcname);
 
+  // optional string calib_raw = 6 [default = "Calib_Results_stereo.yml"];
+  inline bool has_calib_raw() const;
+  inline void clear_calib_raw();
+  static const int kCalibRawFieldNumber = 6;
+  inline const ::std::string& calib_raw() const;
+  inline void set_calib_raw(const ::std::string& value);
+  inline void set_calib_raw(const char* value);
+  inline void set_calib_raw(const char* value, size_t size);
+  inline ::std::string* mutable_calib_raw();
+  inline ::std::string* release_calib_raw();
+  inline void set_allocated_calib_raw(::std::string* calib_raw);
+
+  // optional string calib_rect = 7 [default = "Calib_Results_stereo_rectified.yml"];
+  inline bool has_calib_rect() const;
+  inline void clear_calib_rect();
+  static const int kCalibRectFieldNumber = 7;
+  inline const ::std::string& calib_rect() const;
+  inline void set_calib_rect(const ::std::string& value);
+  inline void set_calib_rect(const char* value);
+  inline void set_calib_rect(const char* value, size_t size);
+  inline ::std::string* mutable_calib_rect();
+  inline ::std::string* release_calib_rect();
+  inline void set_allocated_calib_rect(::std::string* calib_rect);
+
+  // optional string calib = 8;
+  inline bool has_calib() const;
+  inline void clear_calib();
+  static const int kCalibFieldNumber = 8;
+  inline const ::std::string& calib() const;
+  inline void set_calib(const ::std::string& value);
+  inline void set_calib(const char* value);
+  inline void set_calib(const char* value, size_t size);
+  inline ::std::string* mutable_calib();
+  inline ::std::string* release_calib();
+  inline void set_allocated_calib(::std::string* calib);
+
+  // optional float voxel = 9 [default = 0];
+  inline bool has_voxel() const;
+  inline void clear_voxel();
+  static const int kVoxelFieldNumber = 9;
+  inline float voxel() const;
+  inline void set_voxel(float value);
+
   // @@protoc_insertion_point(class_scope:svaf.TriangularParameter)
  private:
   inline void set_has_visible();
@@ -7490,6 +8064,14 @@ class TriangularParameter : public ::google::protobuf::Message {
   inline void clear_has_savepc();
   inline void set_has_pcname();
   inline void clear_has_pcname();
+  inline void set_has_calib_raw();
+  inline void clear_has_calib_raw();
+  inline void set_has_calib_rect();
+  inline void clear_has_calib_rect();
+  inline void set_has_calib();
+  inline void clear_has_calib();
+  inline void set_has_voxel();
+  inline void clear_has_voxel();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
@@ -7497,10 +8079,16 @@ class TriangularParameter : public ::google::protobuf::Message {
   mutable int _cached_size_;
   ::std::string* toolbox_dir_;
   ::std::string* calibmat_dir_;
-  static ::std::string* _default_pcname_;
-  ::std::string* pcname_;
   bool visible_;
   bool savepc_;
+  float voxel_;
+  static ::std::string* _default_pcname_;
+  ::std::string* pcname_;
+  static ::std::string* _default_calib_raw_;
+  ::std::string* calib_raw_;
+  static ::std::string* _default_calib_rect_;
+  ::std::string* calib_rect_;
+  ::std::string* calib_;
   friend void  protobuf_AddDesc_svaf_2eproto();
   friend void protobuf_AssignDesc_svaf_2eproto();
   friend void protobuf_ShutdownFile_svaf_2eproto();
@@ -7510,6 +8098,215 @@ class TriangularParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
+class ReprojectParameter : public ::google::protobuf::Message {
+ public:
+  ReprojectParameter();
+  virtual ~ReprojectParameter();
+
+  ReprojectParameter(const ReprojectParameter& from);
+
+  inline ReprojectParameter& operator=(const ReprojectParameter& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const ReprojectParameter& default_instance();
+
+  void Swap(ReprojectParameter* other);
+
+  // implements Message ----------------------------------------------
+
+  ReprojectParameter* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const ReprojectParameter& from);
+  void MergeFrom(const ReprojectParameter& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional string calib_file = 1;
+  inline bool has_calib_file() const;
+  inline void clear_calib_file();
+  static const int kCalibFileFieldNumber = 1;
+  inline const ::std::string& calib_file() const;
+  inline void set_calib_file(const ::std::string& value);
+  inline void set_calib_file(const char* value);
+  inline void set_calib_file(const char* value, size_t size);
+  inline ::std::string* mutable_calib_file();
+  inline ::std::string* release_calib_file();
+  inline void set_allocated_calib_file(::std::string* calib_file);
+
+  // optional float fx = 2;
+  inline bool has_fx() const;
+  inline void clear_fx();
+  static const int kFxFieldNumber = 2;
+  inline float fx() const;
+  inline void set_fx(float value);
+
+  // optional float fy = 3;
+  inline bool has_fy() const;
+  inline void clear_fy();
+  static const int kFyFieldNumber = 3;
+  inline float fy() const;
+  inline void set_fy(float value);
+
+  // optional float cx = 4;
+  inline bool has_cx() const;
+  inline void clear_cx();
+  static const int kCxFieldNumber = 4;
+  inline float cx() const;
+  inline void set_cx(float value);
+
+  // optional float cy = 5;
+  inline bool has_cy() const;
+  inline void clear_cy();
+  static const int kCyFieldNumber = 5;
+  inline float cy() const;
+  inline void set_cy(float value);
+
+  // optional float cx_right = 6;
+  inline bool has_cx_right() const;
+  inline void clear_cx_right();
+  static const int kCxRightFieldNumber = 6;
+  inline float cx_right() const;
+  inline void set_cx_right(float value);
+
+  // optional float baseline = 7;
+  inline bool has_baseline() const;
+  inline void clear_baseline();
+  static const int kBaselineFieldNumber = 7;
+  inline float baseline() const;
+  inline void set_baseline(float value);
+
+  // optional int32 stride = 8 [default = 1];
+  inline bool has_stride() const;
+  inline void clear_stride();
+  static const int kStrideFieldNumber = 8;
+  inline ::google::protobuf::int32 stride() const;
+  inline void set_stride(::google::protobuf::int32 value);
+
+  // optional bool color = 9 [default = false];
+  inline bool has_color() const;
+  inline void clear_color();
+  static const int kColorFieldNumber = 9;
+  inline bool color() const;
+  inline void set_color(bool value);
+
+  // optional bool pointl = 10 [default = true];
+  inline bool has_pointl() const;
+  inline void clear_pointl();
+  static const int kPointlFieldNumber = 10;
+  inline bool pointl() const;
+  inline void set_pointl(bool value);
+
+  // optional bool savepc = 11 [default = false];
+  inline bool has_savepc() const;
+  inline void clear_savepc();
+  static const int kSavepcFieldNumber = 11;
+  inline bool savepc() const;
+  inline void set_savepc(bool value);
+
+  // optional string calib = 12;
+  inline bool has_calib() const;
+  inline void clear_calib();
+  static const int kCalibFieldNumber = 12;
+  inline const ::std::string& calib() const;
+  inline void set_calib(const ::std::string& value);
+  inline void set_calib(const char* value);
+  inline void set_calib(const char* value, size_t size);
+  inline ::std::string* mutable_calib();
+  inline ::std::string* release_calib();
+  inline void set_allocated_calib(::std::string* calib);
+
+  // optional float voxel = 13 [default = 0];
+  inline bool has_voxel() const;
+  inline void clear_voxel();
+  static const int kVoxelFieldNumber = 13;
+  inline float voxel() const;
+  inline void set_voxel(float value);
+
+  // @@protoc_insertion_point(class_scope:svaf.ReprojectParameter)
+ private:
+  inline void set_has_calib_file();
+  inline void clear_has_calib_file();
+  inline void set_has_fx();
+  inline void clear_has_fx();
+  inline void set_has_fy();
+  inline void clear_has_fy();
+  inline void set_has_cx();
+  inline void clear_has_cx();
+  inline void set_has_cy();
+  inline void clear_has_cy();
+  inline void set_has_cx_right();
+  inline void clear_has_cx_right();
+  inline void set_has_baseline();
+  inline void clear_has_baseline();
+  inline void set_has_stride();
+  inline void clear_has_stride();
+  inline void set_has_color();
+  inline void clear_has_color();
+  inline void set_has_pointl();
+  inline void clear_has_pointl();
+  inline void set_has_savepc();
+  inline void clear_has_savepc();
+  inline void set_has_calib();
+  inline void clear_has_calib();
+  inline void set_has_voxel();
+  inline void clear_has_voxel();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::uint32 _has_bits_[1];
+  mutable int _cached_size_;
+  ::std::string* calib_file_;
+  float fx_;
+  float fy_;
+  float cx_;
+  float cy_;
+  float cx_right_;
+  float baseline_;
+  ::google::protobuf::int32 stride_;
+  bool color_;
+  bool pointl_;
+  bool savepc_;
+  ::std::string* calib_;
+  float voxel_;
+  friend void  protobuf_AddDesc_svaf_2eproto();
+  friend void protobuf_AssignDesc_svaf_2eproto();
+  friend void protobuf_ShutdownFile_svaf_2eproto();
+
+  void InitAsDefaultInstance();
+  static ReprojectParameter* default_instance_;
+};
+// -------------------------------------------------------------------
+
 class MatrixMulParameter : public ::google::protobuf::Message {
  public:
   MatrixMulParameter();
@@ -7611,6 +8408,18 @@ class MatrixMulParameter : public ::google::protobuf::Message {
   inline ::std::string* release_col2();
   inline void set_allocated_col2(::std::string* col2);
 
+  // optional string calib = 5;
+  inline bool has_calib() const;
+  inline void clear_calib();
+  static const int kCalibFieldNumber = 5;
+  inline const ::std::string& calib() const;
+  inline void set_calib(const ::std::string& value);
+  inline void set_calib(const char* value);
+  inline void set_calib(const char* value, size_t size);
+  inline ::std::string* mutable_calib();
+  inline ::std::string* release_calib();
+  inline void set_allocated_calib(::std::string* calib);
+
   // @@protoc_insertion_point(class_scope:svaf.MatrixMulParameter)
  private:
   inline void set_has_filename();
@@ -7621,6 +8430,8 @@ class MatrixMulParameter : public ::google::protobuf::Message {
   inline void clear_has_col1();
   inline void set_has_col2();
   inline void clear_has_col2();
+  inline void set_has_calib();
+  inline void clear_has_calib();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
@@ -7630,6 +8441,7 @@ class MatrixMulParameter : public ::google::protobuf::Message {
   ::std::string* col0_;
   ::std::string* col1_;
   ::std::string* col2_;
+  ::std::string* calib_;
   friend void  protobuf_AddDesc_svaf_2eproto();
   friend void protobuf_AssignDesc_svaf_2eproto();
   friend void protobuf_ShutdownFile_svaf_2eproto();
@@ -7777,14 +8589,14 @@ class CenterPointParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class CoordiParameter : public ::google::protobuf::Message {
+class FeaturePoolParameter : public ::google::protobuf::Message {
  public:
-  CoordiParameter();
-  virtual ~CoordiParameter();
+  FeaturePoolParameter();
+  virtual ~FeaturePoolParameter();
 
-  CoordiParameter(const CoordiParameter& from);
+  FeaturePoolParameter(const FeaturePoolParameter& from);
 
-  inline CoordiParameter& operator=(const CoordiParameter& from) {
+  inline FeaturePoolParameter& operator=(const FeaturePoolParameter& from) {
     CopyFrom(from);
     return *this;
   }
@@ -7798,17 +8610,17 @@ class CoordiParameter : public ::google::protobuf::Message {
   }
 
   static const ::google::protobuf::Descriptor* descriptor();
-  static const CoordiParameter& default_instance();
+  static const FeaturePoolParameter& default_instance();
 
-  void Swap(CoordiParameter* other);
+  void Swap(FeaturePoolParameter* other);
 
   // implements Message ----------------------------------------------
 
-  CoordiParameter* New() const;
+  FeaturePoolParameter* New() const;
   void CopyFrom(const ::google::protobuf::Message& from);
   void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CoordiParameter& from);
-  void MergeFrom(const CoordiParameter& from);
+  void CopyFrom(const FeaturePoolParameter& from);
+  void MergeFrom(const FeaturePoolParameter& from);
   void Clear();
   bool IsInitialized() const;
 
@@ -7830,46 +8642,225 @@ class CoordiParameter : public ::google::protobuf::Message {
 
   // accessors -------------------------------------------------------
 
-  // optional float x = 1 [default = 0];
-  inline bool has_x() const;
-  inline void clear_x();
-  static const int kXFieldNumber = 1;
-  inline float x() const;
-  inline void set_x(float value);
+  // optional int32 capacity = 1 [default = 5000];
+  inline bool has_capacity() const;
+  inline void clear_capacity();
+  static const int kCapacityFieldNumber = 1;
+  inline ::google::protobuf::int32 capacity() const;
+  inline void set_capacity(::google::protobuf::int32 value);
 
-  // optional float y = 2 [default = 0];
-  inline bool has_y() const;
-  inline void clear_y();
-  static const int kYFieldNumber = 2;
-  inline float y() const;
-  inline void set_y(float value);
+  // optional float thresh = 2 [default = 0.65];
+  inline bool has_thresh() const;
+  inline void clear_thresh();
+  static const int kThreshFieldNumber = 2;
+  inline float thresh() const;
+  inline void set_thresh(float value);
 
-  // optional float z = 3 [default = 0];
-  inline bool has_z() const;
-  inline void clear_z();
-  static const int kZFieldNumber = 3;
-  inline float z() const;
-  inline void set_z(float value);
+  // optional float cell = 3 [default = 10];
+  inline bool has_cell() const;
+  inline void clear_cell();
+  static const int kCellFieldNumber = 3;
+  inline float cell() const;
+  inline void set_cell(float value);
+
+  // optional float radius = 4 [default = 5];
+  inline bool has_radius() const;
+  inline void clear_radius();
+  static const int kRadiusFieldNumber = 4;
+  inline float radius() const;
+  inline void set_radius(float value);
+
+  // optional float inlier = 5 [default = 5];
+  inline bool has_inlier() const;
+  inline void clear_inlier();
+  static const int kInlierFieldNumber = 5;
+  inline float inlier() const;
+  inline void set_inlier(float value);
+
+  // optional int32 iters = 6 [default = 200];
+  inline bool has_iters() const;
+  inline void clear_iters();
+  static const int kItersFieldNumber = 6;
+  inline ::google::protobuf::int32 iters() const;
+  inline void set_iters(::google::protobuf::int32 value);
+
+  // optional int32 minmatch = 7 [default = 6];
+  inline bool has_minmatch() const;
+  inline void clear_minmatch();
+  static const int kMinmatchFieldNumber = 7;
+  inline ::google::protobuf::int32 minmatch() const;
+  inline void set_minmatch(::google::protobuf::int32 value);
+
+  // optional int32 trees = 8 [default = 4];
+  inline bool has_trees() const;
+  inline void clear_trees();
+  static const int kTreesFieldNumber = 8;
+  inline ::google::protobuf::int32 trees() const;
+  inline void set_trees(::google::protobuf::int32 value);
+
+  // optional int32 checks = 9 [default = 64];
+  inline bool has_checks() const;
+  inline void clear_checks();
+  static const int kChecksFieldNumber = 9;
+  inline ::google::protobuf::int32 checks() const;
+  inline void set_checks(::google::protobuf::int32 value);
+
+  // optional bool store = 10 [default = true];
+  inline bool has_store() const;
+  inline void clear_store();
+  static const int kStoreFieldNumber = 10;
+  inline bool store() const;
+  inline void set_store(bool value);
+
+  // optional int32 maxfail = 11 [default = 5];
+  inline bool has_maxfail() const;
+  inline void clear_maxfail();
+  static const int kMaxfailFieldNumber = 11;
+  inline ::google::protobuf::int32 maxfail() const;
+  inline void set_maxfail(::google::protobuf::int32 value);
+
+  // @@protoc_insertion_point(class_scope:svaf.FeaturePoolParameter)
+ private:
+  inline void set_has_capacity();
+  inline void clear_has_capacity();
+  inline void set_has_thresh();
+  inline void clear_has_thresh();
+  inline void set_has_cell();
+  inline void clear_has_cell();
+  inline void set_has_radius();
+  inline void clear_has_radius();
+  inline void set_has_inlier();
+  inline void clear_has_inlier();
+  inline void set_has_iters();
+  inline void clear_has_iters();
+  inline void set_has_minmatch();
+  inline void clear_has_minmatch();
+  inline void set_has_trees();
+  inline void clear_has_trees();
+  inline void set_has_checks();
+  inline void clear_has_checks();
+  inline void set_has_store();
+  inline void clear_has_store();
+  inline void set_has_maxfail();
+  inline void clear_has_maxfail();
 
-  // optional float a = 4 [default = 0];
-  inline bool has_a() const;
-  inline void clear_a();
-  static const int kAFieldNumber = 4;
-  inline float a() const;
-  inline void set_a(float value);
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
-  // optional float b = 5 [default = 0];
-  inline bool has_b() const;
-  inline void clear_b();
-  static const int kBFieldNumber = 5;
-  inline float b() const;
-  inline void set_b(float value);
+  ::google::protobuf::uint32 _has_bits_[1];
+  mutable int _cached_size_;
+  ::google::protobuf::int32 capacity_;
+  float thresh_;
+  float cell_;
+  float radius_;
+  float inlier_;
+  ::google::protobuf::int32 iters_;
+  ::google::protobuf::int32 minmatch_;
+  ::google::protobuf::int32 trees_;
+  ::google::protobuf::int32 checks_;
+  bool store_;
+  ::google::protobuf::int32 maxfail_;
+  friend void  protobuf_AddDesc_svaf_2eproto();
+  friend void protobuf_AssignDesc_svaf_2eproto();
+  friend void protobuf_ShutdownFile_svaf_2eproto();
 
-  // optional float c = 6 [default = 0];
-  inline bool has_c() const;
-  inline void clear_c();
-  static const int kCFieldNumber = 6;
-  inline float c() const;
+  void InitAsDefaultInstance();
+  static FeaturePoolParameter* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class CoordiParameter : public ::google::protobuf::Message {
+ public:
+  CoordiParameter();
+  virtual ~CoordiParameter();
+
+  CoordiParameter(const CoordiParameter& from);
+
+  inline CoordiParameter& operator=(const CoordiParameter& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const CoordiParameter& default_instance();
+
+  void Swap(CoordiParameter* other);
+
+  // implements Message ----------------------------------------------
+
+  CoordiParameter* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const CoordiParameter& from);
+  void MergeFrom(const CoordiParameter& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional float x = 1 [default = 0];
+  inline bool has_x() const;
+  inline void clear_x();
+  static const int kXFieldNumber = 1;
+  inline float x() const;
+  inline void set_x(float value);
+
+  // optional float y = 2 [default = 0];
+  inline bool has_y() const;
+  inline void clear_y();
+  static const int kYFieldNumber = 2;
+  inline float y() const;
+  inline void set_y(float value);
+
+  // optional float z = 3 [default = 0];
+  inline bool has_z() const;
+  inline void clear_z();
+  static const int kZFieldNumber = 3;
+  inline float z() const;
+  inline void set_z(float value);
+
+  // optional float a = 4 [default = 0];
+  inline bool has_a() const;
+  inline void clear_a();
+  static const int kAFieldNumber = 4;
+  inline float a() const;
+  inline void set_a(float value);
+
+  // optional float b = 5 [default = 0];
+  inline bool has_b() const;
+  inline void clear_b();
+  static const int kBFieldNumber = 5;
+  inline float b() const;
+  inline void set_b(float value);
+
+  // optional float c = 6 [default = 0];
+  inline bool has_c() const;
+  inline void clear_c();
+  static const int kCFieldNumber = 6;
+  inline float c() const;
   inline void set_c(float value);
 
   // @@protoc_insertion_point(class_scope:svaf.CoordiParameter)
@@ -8687,7 +9678,9 @@ class LayerParameter : public ::google::protobuf::Message {
   static const LayerType EADP_MATCH = LayerParameter_LayerType_EADP_MATCH;
   static const LayerType TRIANG = LayerParameter_LayerType_TRIANG;
   static const LayerType MXMUL = LayerParameter_LayerType_MXMUL;
+  static const LayerType REPROJECT = LayerParameter_LayerType_REPROJECT;
   static const LayerType CENTER_POS = LayerParameter_LayerType_CENTER_POS;
+  static const LayerType FEAT_POOL = LayerParameter_LayerType_FEAT_POOL;
   static const LayerType IA_EST = LayerParameter_LayerType_IA_EST;
   static const LayerType IAICP_EST = LayerParameter_LayerType_IAICP_EST;
   static const LayerType IANDT_EST = LayerParameter_LayerType_IANDT_EST;
@@ -9300,6 +10293,15 @@ class LayerParameter : public ::google::protobuf::Message {
   inline ::svaf::MatrixMulParameter* release_mxmul_param();
   inline void set_allocated_mxmul_param(::svaf::MatrixMulParameter* mxmul_param);
 
+  // optional .svaf.ReprojectParameter reproject_param = 183;
+  inline bool has_reproject_param() const;
+  inline void clear_reproject_param();
+  static const int kReprojectParamFieldNumber = 183;
+  inline const ::svaf::ReprojectParameter& reproject_param() const;
+  inline ::svaf::ReprojectParameter* mutable_reproject_param();
+  inline ::svaf::ReprojectParameter* release_reproject_param();
+  inline void set_allocated_reproject_param(::svaf::ReprojectParameter* reproject_param);
+
   // optional .svaf.PositionEstimateParameter posest_param = 190;
   inline bool has_posest_param() const;
   inline void clear_posest_param();
@@ -9318,6 +10320,15 @@ class LayerParameter : public ::google::protobuf::Message {
   inline ::svaf::CenterPointParameter* release_centerpoint_param();
   inline void set_allocated_centerpoint_param(::svaf::CenterPointParameter* centerpoint_param);
 
+  // optional .svaf.FeaturePoolParameter featpool_param = 193;
+  inline bool has_featpool_param() const;
+  inline void clear_featpool_param();
+  static const int kFeatpoolParamFieldNumber = 193;
+  inline const ::svaf::FeaturePoolParameter& featpool_param() const;
+  inline ::svaf::FeaturePoolParameter* mutable_featpool_param();
+  inline ::svaf::FeaturePoolParameter* release_featpool_param();
+  inline void set_allocated_featpool_param(::svaf::FeaturePoolParameter* featpool_param);
+
   // optional .svaf.SACIAEstimateParameter sacia_param = 194;
   inline bool has_sacia_param() const;
   inline void clear_sacia_param();
@@ -9477,10 +10488,14 @@ class LayerParameter : public ::google::protobuf::Message {
   inline void clear_has_triang_param();
   inline void set_has_mxmul_param();
   inline void clear_has_mxmul_param();
+  inline void set_has_reproject_param();
+  inline void clear_has_reproject_param();
   inline void set_has_posest_param();
   inline void clear_has_posest_param();
   inline void set_has_centerpoint_param();
   inline void clear_has_centerpoint_param();
+  inline void set_has_featpool_param();
+  inline void clear_has_featpool_param();
   inline void set_has_sacia_param();
   inline void clear_has_sacia_param();
   inline void set_has_iaicp_param();
@@ -9557,8 +10572,10 @@ class LayerParameter : public ::google::protobuf::Message {
   ::svaf::OutputParameter* output_param_;
   ::svaf::TriangularParameter* triang_param_;
   ::svaf::MatrixMulParameter* mxmul_param_;
+  ::svaf::ReprojectParameter* reproject_param_;
   ::svaf::PositionEstimateParameter* posest_param_;
   ::svaf::CenterPointParameter* centerpoint_param_;
+  ::svaf::FeaturePoolParameter* featpool_param_;
   ::svaf::SACIAEstimateParameter* sacia_param_;
   ::svaf::IAICPEstimateParameter* iaicp_param_;
   ::svaf::IANDTEstimateParameter* iandt_param_;
@@ -10054,6 +11071,158 @@ inline void StereoRectifyParameter::set_allocated_filename(::std::string* filena
   // @@protoc_insertion_point(field_set_allocated:svaf.StereoRectifyParameter.filename)
 }
 
+// optional string calib = 2;
+inline bool StereoRectifyParameter::has_calib() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void StereoRectifyParameter::set_has_calib() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void StereoRectifyParameter::clear_has_calib() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void StereoRectifyParameter::clear_calib() {
+  if (calib_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    calib_->clear();
+  }
+  clear_has_calib();
+}
+inline const ::std::string& StereoRectifyParameter::calib() const {
+  // @@protoc_insertion_point(field_get:svaf.StereoRectifyParameter.calib)
+  return *calib_;
+}
+inline void StereoRectifyParameter::set_calib(const ::std::string& value) {
+  set_has_calib();
+  if (calib_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    calib_ = new ::std::string;
+  }
+  calib_->assign(value);
+  // @@protoc_insertion_point(field_set:svaf.StereoRectifyParameter.calib)
+}
+inline void StereoRectifyParameter::set_calib(const char* value) {
+  set_has_calib();
+  if (calib_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    calib_ = new ::std::string;
+  }
+  calib_->assign(value);
+  // @@protoc_insertion_point(field_set_char:svaf.StereoRectifyParameter.calib)
+}
+inline void StereoRectifyParameter::set_calib(const char* value, size_t size) {
+  set_has_calib();
+  if (calib_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    calib_ = new ::std::string;
+  }
+  calib_->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:svaf.StereoRectifyParameter.calib)
+}
+inline ::std::string* StereoRectifyParameter::mutable_calib() {
+  set_has_calib();
+  if (calib_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    calib_ = new ::std::string;
+  }
+  // @@protoc_insertion_point(field_mutable:svaf.StereoRectifyParameter.calib)
+  return calib_;
+}
+inline ::std::string* StereoRectifyParameter::release_calib() {
+  clear_has_calib();
+  if (calib_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    return NULL;
+  } else {
+    ::std::string* temp = calib_;
+    calib_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    return temp;
+  }
+}
+inline void StereoRectifyParameter::set_allocated_calib(::std::string* calib) {
+  if (calib_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete calib_;
+  }
+  if (calib) {
+    set_has_calib();
+    calib_ = calib;
+  } else {
+    clear_has_calib();
+    calib_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  }
+  // @@protoc_insertion_point(field_set_allocated:svaf.StereoRectifyParameter.calib)
+}
+
+// optional string cache_dir = 3 [default = "./calib/"];
+inline bool StereoRectifyParameter::has_cache_dir() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void StereoRectifyParameter::set_has_cache_dir() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void StereoRectifyParameter::clear_has_cache_dir() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void StereoRectifyParameter::clear_cache_dir() {
+  if (cache_dir_ != _default_cache_dir_) {
+    cache_dir_->assign(*_default_cache_dir_);
+  }
+  clear_has_cache_dir();
+}
+inline const ::std::string& StereoRectifyParameter::cache_dir() const {
+  // @@protoc_insertion_point(field_get:svaf.StereoRectifyParameter.cache_dir)
+  return *cache_dir_;
+}
+inline void StereoRectifyParameter::set_cache_dir(const ::std::string& value) {
+  set_has_cache_dir();
+  if (cache_dir_ == _default_cache_dir_) {
+    cache_dir_ = new ::std::string;
+  }
+  cache_dir_->assign(value);
+  // @@protoc_insertion_point(field_set:svaf.StereoRectifyParameter.cache_dir)
+}
+inline void StereoRectifyParameter::set_cache_dir(const char* value) {
+  set_has_cache_dir();
+  if (cache_dir_ == _default_cache_dir_) {
+    cache_dir_ = new ::std::string;
+  }
+  cache_dir_->assign(value);
+  // @@protoc_insertion_point(field_set_char:svaf.StereoRectifyParameter.cache_dir)
+}
+inline void StereoRectifyParameter::set_cache_dir(const char* value, size_t size) {
+  set_has_cache_dir();
+  if (cache_dir_ == _default_cache_dir_) {
+    cache_dir_ = new ::std::string;
+  }
+  cache_dir_->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:svaf.StereoRectifyParameter.cache_dir)
+}
+inline ::std::string* StereoRectifyParameter::mutable_cache_dir() {
+  set_has_cache_dir();
+  if (cache_dir_ == _default_cache_dir_) {
+    cache_dir_ = new ::std::string(*_default_cache_dir_);
+  }
+  // @@protoc_insertion_point(field_mutable:svaf.StereoRectifyParameter.cache_dir)
+  return cache_dir_;
+}
+inline ::std::string* StereoRectifyParameter::release_cache_dir() {
+  clear_has_cache_dir();
+  if (cache_dir_ == _default_cache_dir_) {
+    return NULL;
+  } else {
+    ::std::string* temp = cache_dir_;
+    cache_dir_ = const_cast< ::std::string*>(_default_cache_dir_);
+    return temp;
+  }
+}
+inline void StereoRectifyParameter::set_allocated_cache_dir(::std::string* cache_dir) {
+  if (cache_dir_ != _default_cache_dir_) {
+    delete cache_dir_;
+  }
+  if (cache_dir) {
+    set_has_cache_dir();
+    cache_dir_ = cache_dir;
+  } else {
+    clear_has_cache_dir();
+    cache_dir_ = const_cast< ::std::string*>(_default_cache_dir_);
+  }
+  // @@protoc_insertion_point(field_set_allocated:svaf.StereoRectifyParameter.cache_dir)
+}
+
 // -------------------------------------------------------------------
 
 // DataParameter
@@ -11937,6 +13106,171 @@ inline void SURFPointParameter::set_thresh(float value) {
   // @@protoc_insertion_point(field_set:svaf.SURFPointParameter.thresh)
 }
 
+// optional .svaf.PointBudgetParameter budget_param = 5;
+inline bool SURFPointParameter::has_budget_param() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void SURFPointParameter::set_has_budget_param() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void SURFPointParameter::clear_has_budget_param() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void SURFPointParameter::clear_budget_param() {
+  if (budget_param_ != NULL) budget_param_->::svaf::PointBudgetParameter::Clear();
+  clear_has_budget_param();
+}
+inline const ::svaf::PointBudgetParameter& SURFPointParameter::budget_param() const {
+  // @@protoc_insertion_point(field_get:svaf.SURFPointParameter.budget_param)
+  return budget_param_ != NULL ? *budget_param_ : *default_instance_->budget_param_;
+}
+inline ::svaf::PointBudgetParameter* SURFPointParameter::mutable_budget_param() {
+  set_has_budget_param();
+  if (budget_param_ == NULL) budget_param_ = new ::svaf::PointBudgetParameter;
+  // @@protoc_insertion_point(field_mutable:svaf.SURFPointParameter.budget_param)
+  return budget_param_;
+}
+inline ::svaf::PointBudgetParameter* SURFPointParameter::release_budget_param() {
+  clear_has_budget_param();
+  ::svaf::PointBudgetParameter* temp = budget_param_;
+  budget_param_ = NULL;
+  return temp;
+}
+inline void SURFPointParameter::set_allocated_budget_param(::svaf::PointBudgetParameter* budget_param) {
+  delete budget_param_;
+  budget_param_ = budget_param;
+  if (budget_param) {
+    set_has_budget_param();
+  } else {
+    clear_has_budget_param();
+  }
+  // @@protoc_insertion_point(field_set_allocated:svaf.SURFPointParameter.budget_param)
+}
+
+// -------------------------------------------------------------------
+
+// PointBudgetParameter
+
+// optional int32 budget = 1 [default = 0];
+inline bool PointBudgetParameter::has_budget() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void PointBudgetParameter::set_has_budget() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void PointBudgetParameter::clear_has_budget() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void PointBudgetParameter::clear_budget() {
+  budget_ = 0;
+  clear_has_budget();
+}
+inline ::google::protobuf::int32 PointBudgetParameter::budget() const {
+  // @@protoc_insertion_point(field_get:svaf.PointBudgetParameter.budget)
+  return budget_;
+}
+inline void PointBudgetParameter::set_budget(::google::protobuf::int32 value) {
+  set_has_budget();
+  budget_ = value;
+  // @@protoc_insertion_point(field_set:svaf.PointBudgetParameter.budget)
+}
+
+// optional int32 grid_cols = 2 [default = 8];
+inline bool PointBudgetParameter::has_grid_cols() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void PointBudgetParameter::set_has_grid_cols() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void PointBudgetParameter::clear_has_grid_cols() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void PointBudgetParameter::clear_grid_cols() {
+  grid_cols_ = 8;
+  clear_has_grid_cols();
+}
+inline ::google::protobuf::int32 PointBudgetParameter::grid_cols() const {
+  // @@protoc_insertion_point(field_get:svaf.PointBudgetParameter.grid_cols)
+  return grid_cols_;
+}
+inline void PointBudgetParameter::set_grid_cols(::google::protobuf::int32 value) {
+  set_has_grid_cols();
+  grid_cols_ = value;
+  // @@protoc_insertion_point(field_set:svaf.PointBudgetParameter.grid_cols)
+}
+
+// optional int32 grid_rows = 3 [default = 6];
+inline bool PointBudgetParameter::has_grid_rows() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void PointBudgetParameter::set_has_grid_rows() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void PointBudgetParameter::clear_has_grid_rows() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void PointBudgetParameter::clear_grid_rows() {
+  grid_rows_ = 6;
+  clear_has_grid_rows();
+}
+inline ::google::protobuf::int32 PointBudgetParameter::grid_rows() const {
+  // @@protoc_insertion_point(field_get:svaf.PointBudgetParameter.grid_rows)
+  return grid_rows_;
+}
+inline void PointBudgetParameter::set_grid_rows(::google::protobuf::int32 value) {
+  set_has_grid_rows();
+  grid_rows_ = value;
+  // @@protoc_insertion_point(field_set:svaf.PointBudgetParameter.grid_rows)
+}
+
+// optional bool adaptive = 4 [default = true];
+inline bool PointBudgetParameter::has_adaptive() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void PointBudgetParameter::set_has_adaptive() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void PointBudgetParameter::clear_has_adaptive() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void PointBudgetParameter::clear_adaptive() {
+  adaptive_ = true;
+  clear_has_adaptive();
+}
+inline bool PointBudgetParameter::adaptive() const {
+  // @@protoc_insertion_point(field_get:svaf.PointBudgetParameter.adaptive)
+  return adaptive_;
+}
+inline void PointBudgetParameter::set_adaptive(bool value) {
+  set_has_adaptive();
+  adaptive_ = value;
+  // @@protoc_insertion_point(field_set:svaf.PointBudgetParameter.adaptive)
+}
+
+// optional float overshoot = 5 [default = 1.5];
+inline bool PointBudgetParameter::has_overshoot() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void PointBudgetParameter::set_has_overshoot() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void PointBudgetParameter::clear_has_overshoot() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void PointBudgetParameter::clear_overshoot() {
+  overshoot_ = 1.5f;
+  clear_has_overshoot();
+}
+inline float PointBudgetParameter::overshoot() const {
+  // @@protoc_insertion_point(field_get:svaf.PointBudgetParameter.overshoot)
+  return overshoot_;
+}
+inline void PointBudgetParameter::set_overshoot(float value) {
+  set_has_overshoot();
+  overshoot_ = value;
+  // @@protoc_insertion_point(field_set:svaf.PointBudgetParameter.overshoot)
+}
+
 // -------------------------------------------------------------------
 
 // STARPointParameter
@@ -14089,6 +15423,47 @@ inline void CVPointParameter::set_allocated_akaze_param(::svaf::AkazeParamCP* ak
   // @@protoc_insertion_point(field_set_allocated:svaf.CVPointParameter.akaze_param)
 }
 
+// optional .svaf.PointBudgetParameter budget_param = 3;
+inline bool CVPointParameter::has_budget_param() const {
+  return (_has_bits_[0] & 0x00008000u) != 0;
+}
+inline void CVPointParameter::set_has_budget_param() {
+  _has_bits_[0] |= 0x00008000u;
+}
+inline void CVPointParameter::clear_has_budget_param() {
+  _has_bits_[0] &= ~0x00008000u;
+}
+inline void CVPointParameter::clear_budget_param() {
+  if (budget_param_ != NULL) budget_param_->::svaf::PointBudgetParameter::Clear();
+  clear_has_budget_param();
+}
+inline const ::svaf::PointBudgetParameter& CVPointParameter::budget_param() const {
+  // @@protoc_insertion_point(field_get:svaf.CVPointParameter.budget_param)
+  return budget_param_ != NULL ? *budget_param_ : *default_instance_->budget_param_;
+}
+inline ::svaf::PointBudgetParameter* CVPointParameter::mutable_budget_param() {
+  set_has_budget_param();
+  if (budget_param_ == NULL) budget_param_ = new ::svaf::PointBudgetParameter;
+  // @@protoc_insertion_point(field_mutable:svaf.CVPointParameter.budget_param)
+  return budget_param_;
+}
+inline ::svaf::PointBudgetParameter* CVPointParameter::release_budget_param() {
+  clear_has_budget_param();
+  ::svaf::PointBudgetParameter* temp = budget_param_;
+  budget_param_ = NULL;
+  return temp;
+}
+inline void CVPointParameter::set_allocated_budget_param(::svaf::PointBudgetParameter* budget_param) {
+  delete budget_param_;
+  budget_param_ = budget_param;
+  if (budget_param) {
+    set_has_budget_param();
+  } else {
+    clear_has_budget_param();
+  }
+  // @@protoc_insertion_point(field_set_allocated:svaf.CVPointParameter.budget_param)
+}
+
 // -------------------------------------------------------------------
 
 // FeatureDescriptorParameter
@@ -14255,36 +15630,180 @@ inline void CVDescriptorParameter::set_allocated_brief_param(::svaf::BriefDespCV
 
 // KDTreeMatchParameter
 
-// -------------------------------------------------------------------
-
-// EularMatchParameter
-
-// optional float thresh = 1 [default = 0.65];
-inline bool EularMatchParameter::has_thresh() const {
+// optional int32 trees = 1 [default = 4];
+inline bool KDTreeMatchParameter::has_trees() const {
   return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void EularMatchParameter::set_has_thresh() {
+inline void KDTreeMatchParameter::set_has_trees() {
   _has_bits_[0] |= 0x00000001u;
 }
-inline void EularMatchParameter::clear_has_thresh() {
+inline void KDTreeMatchParameter::clear_has_trees() {
   _has_bits_[0] &= ~0x00000001u;
 }
-inline void EularMatchParameter::clear_thresh() {
-  thresh_ = 0.65f;
-  clear_has_thresh();
+inline void KDTreeMatchParameter::clear_trees() {
+  trees_ = 4;
+  clear_has_trees();
 }
-inline float EularMatchParameter::thresh() const {
-  // @@protoc_insertion_point(field_get:svaf.EularMatchParameter.thresh)
-  return thresh_;
+inline ::google::protobuf::int32 KDTreeMatchParameter::trees() const {
+  // @@protoc_insertion_point(field_get:svaf.KDTreeMatchParameter.trees)
+  return trees_;
 }
-inline void EularMatchParameter::set_thresh(float value) {
-  set_has_thresh();
-  thresh_ = value;
-  // @@protoc_insertion_point(field_set:svaf.EularMatchParameter.thresh)
+inline void KDTreeMatchParameter::set_trees(::google::protobuf::int32 value) {
+  set_has_trees();
+  trees_ = value;
+  // @@protoc_insertion_point(field_set:svaf.KDTreeMatchParameter.trees)
 }
 
-// -------------------------------------------------------------------
-
+// optional int32 checks = 2 [default = 64];
+inline bool KDTreeMatchParameter::has_checks() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void KDTreeMatchParameter::set_has_checks() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void KDTreeMatchParameter::clear_has_checks() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void KDTreeMatchParameter::clear_checks() {
+  checks_ = 64;
+  clear_has_checks();
+}
+inline ::google::protobuf::int32 KDTreeMatchParameter::checks() const {
+  // @@protoc_insertion_point(field_get:svaf.KDTreeMatchParameter.checks)
+  return checks_;
+}
+inline void KDTreeMatchParameter::set_checks(::google::protobuf::int32 value) {
+  set_has_checks();
+  checks_ = value;
+  // @@protoc_insertion_point(field_set:svaf.KDTreeMatchParameter.checks)
+}
+
+// optional int32 leafsize = 3 [default = 8];
+inline bool KDTreeMatchParameter::has_leafsize() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void KDTreeMatchParameter::set_has_leafsize() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void KDTreeMatchParameter::clear_has_leafsize() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void KDTreeMatchParameter::clear_leafsize() {
+  leafsize_ = 8;
+  clear_has_leafsize();
+}
+inline ::google::protobuf::int32 KDTreeMatchParameter::leafsize() const {
+  // @@protoc_insertion_point(field_get:svaf.KDTreeMatchParameter.leafsize)
+  return leafsize_;
+}
+inline void KDTreeMatchParameter::set_leafsize(::google::protobuf::int32 value) {
+  set_has_leafsize();
+  leafsize_ = value;
+  // @@protoc_insertion_point(field_set:svaf.KDTreeMatchParameter.leafsize)
+}
+
+// optional float thresh = 4 [default = 0.65];
+inline bool KDTreeMatchParameter::has_thresh() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void KDTreeMatchParameter::set_has_thresh() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void KDTreeMatchParameter::clear_has_thresh() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void KDTreeMatchParameter::clear_thresh() {
+  thresh_ = 0.65f;
+  clear_has_thresh();
+}
+inline float KDTreeMatchParameter::thresh() const {
+  // @@protoc_insertion_point(field_get:svaf.KDTreeMatchParameter.thresh)
+  return thresh_;
+}
+inline void KDTreeMatchParameter::set_thresh(float value) {
+  set_has_thresh();
+  thresh_ = value;
+  // @@protoc_insertion_point(field_set:svaf.KDTreeMatchParameter.thresh)
+}
+
+// optional bool keeptrain = 5 [default = false];
+inline bool KDTreeMatchParameter::has_keeptrain() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void KDTreeMatchParameter::set_has_keeptrain() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void KDTreeMatchParameter::clear_has_keeptrain() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void KDTreeMatchParameter::clear_keeptrain() {
+  keeptrain_ = false;
+  clear_has_keeptrain();
+}
+inline bool KDTreeMatchParameter::keeptrain() const {
+  // @@protoc_insertion_point(field_get:svaf.KDTreeMatchParameter.keeptrain)
+  return keeptrain_;
+}
+inline void KDTreeMatchParameter::set_keeptrain(bool value) {
+  set_has_keeptrain();
+  keeptrain_ = value;
+  // @@protoc_insertion_point(field_set:svaf.KDTreeMatchParameter.keeptrain)
+}
+
+// -------------------------------------------------------------------
+
+// EularMatchParameter
+
+// optional float thresh = 1 [default = 0.65];
+inline bool EularMatchParameter::has_thresh() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void EularMatchParameter::set_has_thresh() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void EularMatchParameter::clear_has_thresh() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void EularMatchParameter::clear_thresh() {
+  thresh_ = 0.65f;
+  clear_has_thresh();
+}
+inline float EularMatchParameter::thresh() const {
+  // @@protoc_insertion_point(field_get:svaf.EularMatchParameter.thresh)
+  return thresh_;
+}
+inline void EularMatchParameter::set_thresh(float value) {
+  set_has_thresh();
+  thresh_ = value;
+  // @@protoc_insertion_point(field_set:svaf.EularMatchParameter.thresh)
+}
+
+// optional bool crosscheck = 2 [default = false];
+inline bool EularMatchParameter::has_crosscheck() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void EularMatchParameter::set_has_crosscheck() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void EularMatchParameter::clear_has_crosscheck() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void EularMatchParameter::clear_crosscheck() {
+  crosscheck_ = false;
+  clear_has_crosscheck();
+}
+inline bool EularMatchParameter::crosscheck() const {
+  // @@protoc_insertion_point(field_get:svaf.EularMatchParameter.crosscheck)
+  return crosscheck_;
+}
+inline void EularMatchParameter::set_crosscheck(bool value) {
+  set_has_crosscheck();
+  crosscheck_ = value;
+  // @@protoc_insertion_point(field_set:svaf.EularMatchParameter.crosscheck)
+}
+
+// -------------------------------------------------------------------
+
 // RansacParameter
 
 // optional float thresh = 1 [default = 5];
@@ -14311,6 +15830,227 @@ inline void RansacParameter::set_thresh(float value) {
   // @@protoc_insertion_point(field_set:svaf.RansacParameter.thresh)
 }
 
+// optional .svaf.RansacParameter.ModelType model = 2 [default = HOMOGRAPHY];
+inline bool RansacParameter::has_model() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void RansacParameter::set_has_model() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void RansacParameter::clear_has_model() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void RansacParameter::clear_model() {
+  model_ = 0;
+  clear_has_model();
+}
+inline ::svaf::RansacParameter_ModelType RansacParameter::model() const {
+  // @@protoc_insertion_point(field_get:svaf.RansacParameter.model)
+  return static_cast< ::svaf::RansacParameter_ModelType >(model_);
+}
+inline void RansacParameter::set_model(::svaf::RansacParameter_ModelType value) {
+  assert(::svaf::RansacParameter_ModelType_IsValid(value));
+  set_has_model();
+  model_ = value;
+  // @@protoc_insertion_point(field_set:svaf.RansacParameter.model)
+}
+
+// optional float confidence = 3 [default = 0.995];
+inline bool RansacParameter::has_confidence() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void RansacParameter::set_has_confidence() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void RansacParameter::clear_has_confidence() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void RansacParameter::clear_confidence() {
+  confidence_ = 0.995f;
+  clear_has_confidence();
+}
+inline float RansacParameter::confidence() const {
+  // @@protoc_insertion_point(field_get:svaf.RansacParameter.confidence)
+  return confidence_;
+}
+inline void RansacParameter::set_confidence(float value) {
+  set_has_confidence();
+  confidence_ = value;
+  // @@protoc_insertion_point(field_set:svaf.RansacParameter.confidence)
+}
+
+// optional int32 maxiters = 4 [default = 2000];
+inline bool RansacParameter::has_maxiters() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void RansacParameter::set_has_maxiters() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void RansacParameter::clear_has_maxiters() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void RansacParameter::clear_maxiters() {
+  maxiters_ = 2000;
+  clear_has_maxiters();
+}
+inline ::google::protobuf::int32 RansacParameter::maxiters() const {
+  // @@protoc_insertion_point(field_get:svaf.RansacParameter.maxiters)
+  return maxiters_;
+}
+inline void RansacParameter::set_maxiters(::google::protobuf::int32 value) {
+  set_has_maxiters();
+  maxiters_ = value;
+  // @@protoc_insertion_point(field_set:svaf.RansacParameter.maxiters)
+}
+
+// optional float budget = 5 [default = 0];
+inline bool RansacParameter::has_budget() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void RansacParameter::set_has_budget() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void RansacParameter::clear_has_budget() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void RansacParameter::clear_budget() {
+  budget_ = 0;
+  clear_has_budget();
+}
+inline float RansacParameter::budget() const {
+  // @@protoc_insertion_point(field_get:svaf.RansacParameter.budget)
+  return budget_;
+}
+inline void RansacParameter::set_budget(float value) {
+  set_has_budget();
+  budget_ = value;
+  // @@protoc_insertion_point(field_set:svaf.RansacParameter.budget)
+}
+
+// optional bool prosac = 6 [default = true];
+inline bool RansacParameter::has_prosac() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+inline void RansacParameter::set_has_prosac() {
+  _has_bits_[0] |= 0x00000020u;
+}
+inline void RansacParameter::clear_has_prosac() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline void RansacParameter::clear_prosac() {
+  prosac_ = true;
+  clear_has_prosac();
+}
+inline bool RansacParameter::prosac() const {
+  // @@protoc_insertion_point(field_get:svaf.RansacParameter.prosac)
+  return prosac_;
+}
+inline void RansacParameter::set_prosac(bool value) {
+  set_has_prosac();
+  prosac_ = value;
+  // @@protoc_insertion_point(field_set:svaf.RansacParameter.prosac)
+}
+
+// optional bool sprt = 7 [default = true];
+inline bool RansacParameter::has_sprt() const {
+  return (_has_bits_[0] & 0x00000040u) != 0;
+}
+inline void RansacParameter::set_has_sprt() {
+  _has_bits_[0] |= 0x00000040u;
+}
+inline void RansacParameter::clear_has_sprt() {
+  _has_bits_[0] &= ~0x00000040u;
+}
+inline void RansacParameter::clear_sprt() {
+  sprt_ = true;
+  clear_has_sprt();
+}
+inline bool RansacParameter::sprt() const {
+  // @@protoc_insertion_point(field_get:svaf.RansacParameter.sprt)
+  return sprt_;
+}
+inline void RansacParameter::set_sprt(bool value) {
+  set_has_sprt();
+  sprt_ = value;
+  // @@protoc_insertion_point(field_set:svaf.RansacParameter.sprt)
+}
+
+// optional string calib = 8;
+inline bool RansacParameter::has_calib() const {
+  return (_has_bits_[0] & 0x00000080u) != 0;
+}
+inline void RansacParameter::set_has_calib() {
+  _has_bits_[0] |= 0x00000080u;
+}
+inline void RansacParameter::clear_has_calib() {
+  _has_bits_[0] &= ~0x00000080u;
+}
+inline void RansacParameter::clear_calib() {
+  if (calib_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    calib_->clear();
+  }
+  clear_has_calib();
+}
+inline const ::std::string& RansacParameter::calib() const {
+  // @@protoc_insertion_point(field_get:svaf.RansacParameter.calib)
+  return *calib_;
+}
+inline void RansacParameter::set_calib(const ::std::string& value) {
+  set_has_calib();
+  if (calib_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    calib_ = new ::std::string;
+  }
+  calib_->assign(value);
+  // @@protoc_insertion_point(field_set:svaf.RansacParameter.calib)
+}
+inline void RansacParameter::set_calib(const char* value) {
+  set_has_calib();
+  if (calib_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    calib_ = new ::std::string;
+  }
+  calib_->assign(value);
+  // @@protoc_insertion_point(field_set_char:svaf.RansacParameter.calib)
+}
+inline void RansacParameter::set_calib(const char* value, size_t size) {
+  set_has_calib();
+  if (calib_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    calib_ = new ::std::string;
+  }
+  calib_->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:svaf.RansacParameter.calib)
+}
+inline ::std::string* RansacParameter::mutable_calib() {
+  set_has_calib();
+  if (calib_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    calib_ = new ::std::string;
+  }
+  // @@protoc_insertion_point(field_mutable:svaf.RansacParameter.calib)
+  return calib_;
+}
+inline ::std::string* RansacParameter::release_calib() {
+  clear_has_calib();
+  if (calib_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    return NULL;
+  } else {
+    ::std::string* temp = calib_;
+    calib_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    return temp;
+  }
+}
+inline void RansacParameter::set_allocated_calib(::std::string* calib) {
+  if (calib_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete calib_;
+  }
+  if (calib) {
+    set_has_calib();
+    calib_ = calib;
+  } else {
+    clear_has_calib();
+    calib_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  }
+  // @@protoc_insertion_point(field_set_allocated:svaf.RansacParameter.calib)
+}
+
 // -------------------------------------------------------------------
 
 // BruteForceMatchParameter
@@ -14323,6 +16063,126 @@ inline void RansacParameter::set_thresh(float value) {
 
 // ECMatchParameter
 
+// optional int32 rowtol = 1 [default = 1];
+inline bool ECMatchParameter::has_rowtol() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void ECMatchParameter::set_has_rowtol() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void ECMatchParameter::clear_has_rowtol() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void ECMatchParameter::clear_rowtol() {
+  rowtol_ = 1;
+  clear_has_rowtol();
+}
+inline ::google::protobuf::int32 ECMatchParameter::rowtol() const {
+  // @@protoc_insertion_point(field_get:svaf.ECMatchParameter.rowtol)
+  return rowtol_;
+}
+inline void ECMatchParameter::set_rowtol(::google::protobuf::int32 value) {
+  set_has_rowtol();
+  rowtol_ = value;
+  // @@protoc_insertion_point(field_set:svaf.ECMatchParameter.rowtol)
+}
+
+// optional float mindisp = 2;
+inline bool ECMatchParameter::has_mindisp() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void ECMatchParameter::set_has_mindisp() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void ECMatchParameter::clear_has_mindisp() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void ECMatchParameter::clear_mindisp() {
+  mindisp_ = 0;
+  clear_has_mindisp();
+}
+inline float ECMatchParameter::mindisp() const {
+  // @@protoc_insertion_point(field_get:svaf.ECMatchParameter.mindisp)
+  return mindisp_;
+}
+inline void ECMatchParameter::set_mindisp(float value) {
+  set_has_mindisp();
+  mindisp_ = value;
+  // @@protoc_insertion_point(field_set:svaf.ECMatchParameter.mindisp)
+}
+
+// optional float maxdisp = 3;
+inline bool ECMatchParameter::has_maxdisp() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void ECMatchParameter::set_has_maxdisp() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void ECMatchParameter::clear_has_maxdisp() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void ECMatchParameter::clear_maxdisp() {
+  maxdisp_ = 0;
+  clear_has_maxdisp();
+}
+inline float ECMatchParameter::maxdisp() const {
+  // @@protoc_insertion_point(field_get:svaf.ECMatchParameter.maxdisp)
+  return maxdisp_;
+}
+inline void ECMatchParameter::set_maxdisp(float value) {
+  set_has_maxdisp();
+  maxdisp_ = value;
+  // @@protoc_insertion_point(field_set:svaf.ECMatchParameter.maxdisp)
+}
+
+// optional float thresh = 4 [default = 0.65];
+inline bool ECMatchParameter::has_thresh() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void ECMatchParameter::set_has_thresh() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void ECMatchParameter::clear_has_thresh() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void ECMatchParameter::clear_thresh() {
+  thresh_ = 0.65f;
+  clear_has_thresh();
+}
+inline float ECMatchParameter::thresh() const {
+  // @@protoc_insertion_point(field_get:svaf.ECMatchParameter.thresh)
+  return thresh_;
+}
+inline void ECMatchParameter::set_thresh(float value) {
+  set_has_thresh();
+  thresh_ = value;
+  // @@protoc_insertion_point(field_set:svaf.ECMatchParameter.thresh)
+}
+
+// optional bool crosscheck = 5 [default = false];
+inline bool ECMatchParameter::has_crosscheck() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void ECMatchParameter::set_has_crosscheck() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void ECMatchParameter::clear_has_crosscheck() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void ECMatchParameter::clear_crosscheck() {
+  crosscheck_ = false;
+  clear_has_crosscheck();
+}
+inline bool ECMatchParameter::crosscheck() const {
+  // @@protoc_insertion_point(field_get:svaf.ECMatchParameter.crosscheck)
+  return crosscheck_;
+}
+inline void ECMatchParameter::set_crosscheck(bool value) {
+  set_has_crosscheck();
+  crosscheck_ = value;
+  // @@protoc_insertion_point(field_set:svaf.ECMatchParameter.crosscheck)
+}
+
 // -------------------------------------------------------------------
 
 // CVMatchParameter
@@ -14604,29 +16464,245 @@ inline void SGMMatchParameter::set_savetxt(bool value) {
   // @@protoc_insertion_point(field_set:svaf.SGMMatchParameter.savetxt)
 }
 
-// -------------------------------------------------------------------
-
-// EADPMatchParameter
-
-// optional int32 max_disp = 1 [default = 24];
-inline bool EADPMatchParameter::has_max_disp() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional int32 pyramid = 8 [default = 0];
+inline bool SGMMatchParameter::has_pyramid() const {
+  return (_has_bits_[0] & 0x00000080u) != 0;
 }
-inline void EADPMatchParameter::set_has_max_disp() {
-  _has_bits_[0] |= 0x00000001u;
+inline void SGMMatchParameter::set_has_pyramid() {
+  _has_bits_[0] |= 0x00000080u;
 }
-inline void EADPMatchParameter::clear_has_max_disp() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void SGMMatchParameter::clear_has_pyramid() {
+  _has_bits_[0] &= ~0x00000080u;
 }
-inline void EADPMatchParameter::clear_max_disp() {
-  max_disp_ = 24;
-  clear_has_max_disp();
+inline void SGMMatchParameter::clear_pyramid() {
+  pyramid_ = 0;
+  clear_has_pyramid();
 }
-inline ::google::protobuf::int32 EADPMatchParameter::max_disp() const {
-  // @@protoc_insertion_point(field_get:svaf.EADPMatchParameter.max_disp)
-  return max_disp_;
+inline ::google::protobuf::int32 SGMMatchParameter::pyramid() const {
+  // @@protoc_insertion_point(field_get:svaf.SGMMatchParameter.pyramid)
+  return pyramid_;
 }
-inline void EADPMatchParameter::set_max_disp(::google::protobuf::int32 value) {
+inline void SGMMatchParameter::set_pyramid(::google::protobuf::int32 value) {
+  set_has_pyramid();
+  pyramid_ = value;
+  // @@protoc_insertion_point(field_set:svaf.SGMMatchParameter.pyramid)
+}
+
+// optional int32 margin = 9 [default = 2];
+inline bool SGMMatchParameter::has_margin() const {
+  return (_has_bits_[0] & 0x00000100u) != 0;
+}
+inline void SGMMatchParameter::set_has_margin() {
+  _has_bits_[0] |= 0x00000100u;
+}
+inline void SGMMatchParameter::clear_has_margin() {
+  _has_bits_[0] &= ~0x00000100u;
+}
+inline void SGMMatchParameter::clear_margin() {
+  margin_ = 2;
+  clear_has_margin();
+}
+inline ::google::protobuf::int32 SGMMatchParameter::margin() const {
+  // @@protoc_insertion_point(field_get:svaf.SGMMatchParameter.margin)
+  return margin_;
+}
+inline void SGMMatchParameter::set_margin(::google::protobuf::int32 value) {
+  set_has_margin();
+  margin_ = value;
+  // @@protoc_insertion_point(field_set:svaf.SGMMatchParameter.margin)
+}
+
+// optional bool temporal = 10 [default = false];
+inline bool SGMMatchParameter::has_temporal() const {
+  return (_has_bits_[0] & 0x00000200u) != 0;
+}
+inline void SGMMatchParameter::set_has_temporal() {
+  _has_bits_[0] |= 0x00000200u;
+}
+inline void SGMMatchParameter::clear_has_temporal() {
+  _has_bits_[0] &= ~0x00000200u;
+}
+inline void SGMMatchParameter::clear_temporal() {
+  temporal_ = false;
+  clear_has_temporal();
+}
+inline bool SGMMatchParameter::temporal() const {
+  // @@protoc_insertion_point(field_get:svaf.SGMMatchParameter.temporal)
+  return temporal_;
+}
+inline void SGMMatchParameter::set_temporal(bool value) {
+  set_has_temporal();
+  temporal_ = value;
+  // @@protoc_insertion_point(field_set:svaf.SGMMatchParameter.temporal)
+}
+
+// optional int32 tile = 11 [default = 16];
+inline bool SGMMatchParameter::has_tile() const {
+  return (_has_bits_[0] & 0x00000400u) != 0;
+}
+inline void SGMMatchParameter::set_has_tile() {
+  _has_bits_[0] |= 0x00000400u;
+}
+inline void SGMMatchParameter::clear_has_tile() {
+  _has_bits_[0] &= ~0x00000400u;
+}
+inline void SGMMatchParameter::clear_tile() {
+  tile_ = 16;
+  clear_has_tile();
+}
+inline ::google::protobuf::int32 SGMMatchParameter::tile() const {
+  // @@protoc_insertion_point(field_get:svaf.SGMMatchParameter.tile)
+  return tile_;
+}
+inline void SGMMatchParameter::set_tile(::google::protobuf::int32 value) {
+  set_has_tile();
+  tile_ = value;
+  // @@protoc_insertion_point(field_set:svaf.SGMMatchParameter.tile)
+}
+
+// optional int32 motion = 12 [default = 8];
+inline bool SGMMatchParameter::has_motion() const {
+  return (_has_bits_[0] & 0x00000800u) != 0;
+}
+inline void SGMMatchParameter::set_has_motion() {
+  _has_bits_[0] |= 0x00000800u;
+}
+inline void SGMMatchParameter::clear_has_motion() {
+  _has_bits_[0] &= ~0x00000800u;
+}
+inline void SGMMatchParameter::clear_motion() {
+  motion_ = 8;
+  clear_has_motion();
+}
+inline ::google::protobuf::int32 SGMMatchParameter::motion() const {
+  // @@protoc_insertion_point(field_get:svaf.SGMMatchParameter.motion)
+  return motion_;
+}
+inline void SGMMatchParameter::set_motion(::google::protobuf::int32 value) {
+  set_has_motion();
+  motion_ = value;
+  // @@protoc_insertion_point(field_set:svaf.SGMMatchParameter.motion)
+}
+
+// optional int32 uniqueness = 13 [default = 0];
+inline bool SGMMatchParameter::has_uniqueness() const {
+  return (_has_bits_[0] & 0x00001000u) != 0;
+}
+inline void SGMMatchParameter::set_has_uniqueness() {
+  _has_bits_[0] |= 0x00001000u;
+}
+inline void SGMMatchParameter::clear_has_uniqueness() {
+  _has_bits_[0] &= ~0x00001000u;
+}
+inline void SGMMatchParameter::clear_uniqueness() {
+  uniqueness_ = 0;
+  clear_has_uniqueness();
+}
+inline ::google::protobuf::int32 SGMMatchParameter::uniqueness() const {
+  // @@protoc_insertion_point(field_get:svaf.SGMMatchParameter.uniqueness)
+  return uniqueness_;
+}
+inline void SGMMatchParameter::set_uniqueness(::google::protobuf::int32 value) {
+  set_has_uniqueness();
+  uniqueness_ = value;
+  // @@protoc_insertion_point(field_set:svaf.SGMMatchParameter.uniqueness)
+}
+
+// optional bool subpixel = 14 [default = false];
+inline bool SGMMatchParameter::has_subpixel() const {
+  return (_has_bits_[0] & 0x00002000u) != 0;
+}
+inline void SGMMatchParameter::set_has_subpixel() {
+  _has_bits_[0] |= 0x00002000u;
+}
+inline void SGMMatchParameter::clear_has_subpixel() {
+  _has_bits_[0] &= ~0x00002000u;
+}
+inline void SGMMatchParameter::clear_subpixel() {
+  subpixel_ = false;
+  clear_has_subpixel();
+}
+inline bool SGMMatchParameter::subpixel() const {
+  // @@protoc_insertion_point(field_get:svaf.SGMMatchParameter.subpixel)
+  return subpixel_;
+}
+inline void SGMMatchParameter::set_subpixel(bool value) {
+  set_has_subpixel();
+  subpixel_ = value;
+  // @@protoc_insertion_point(field_set:svaf.SGMMatchParameter.subpixel)
+}
+
+// optional bool roi = 15 [default = true];
+inline bool SGMMatchParameter::has_roi() const {
+  return (_has_bits_[0] & 0x00004000u) != 0;
+}
+inline void SGMMatchParameter::set_has_roi() {
+  _has_bits_[0] |= 0x00004000u;
+}
+inline void SGMMatchParameter::clear_has_roi() {
+  _has_bits_[0] &= ~0x00004000u;
+}
+inline void SGMMatchParameter::clear_roi() {
+  roi_ = true;
+  clear_has_roi();
+}
+inline bool SGMMatchParameter::roi() const {
+  // @@protoc_insertion_point(field_get:svaf.SGMMatchParameter.roi)
+  return roi_;
+}
+inline void SGMMatchParameter::set_roi(bool value) {
+  set_has_roi();
+  roi_ = value;
+  // @@protoc_insertion_point(field_set:svaf.SGMMatchParameter.roi)
+}
+
+// optional bool points = 16 [default = true];
+inline bool SGMMatchParameter::has_points() const {
+  return (_has_bits_[0] & 0x00008000u) != 0;
+}
+inline void SGMMatchParameter::set_has_points() {
+  _has_bits_[0] |= 0x00008000u;
+}
+inline void SGMMatchParameter::clear_has_points() {
+  _has_bits_[0] &= ~0x00008000u;
+}
+inline void SGMMatchParameter::clear_points() {
+  points_ = true;
+  clear_has_points();
+}
+inline bool SGMMatchParameter::points() const {
+  // @@protoc_insertion_point(field_get:svaf.SGMMatchParameter.points)
+  return points_;
+}
+inline void SGMMatchParameter::set_points(bool value) {
+  set_has_points();
+  points_ = value;
+  // @@protoc_insertion_point(field_set:svaf.SGMMatchParameter.points)
+}
+
+// -------------------------------------------------------------------
+
+// EADPMatchParameter
+
+// optional int32 max_disp = 1 [default = 24];
+inline bool EADPMatchParameter::has_max_disp() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void EADPMatchParameter::set_has_max_disp() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void EADPMatchParameter::clear_has_max_disp() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void EADPMatchParameter::clear_max_disp() {
+  max_disp_ = 24;
+  clear_has_max_disp();
+}
+inline ::google::protobuf::int32 EADPMatchParameter::max_disp() const {
+  // @@protoc_insertion_point(field_get:svaf.EADPMatchParameter.max_disp)
+  return max_disp_;
+}
+inline void EADPMatchParameter::set_max_disp(::google::protobuf::int32 value) {
   set_has_max_disp();
   max_disp_ = value;
   // @@protoc_insertion_point(field_set:svaf.EADPMatchParameter.max_disp)
@@ -14900,6 +16976,78 @@ inline void EADPMatchParameter::set_savetxt(bool value) {
   // @@protoc_insertion_point(field_set:svaf.EADPMatchParameter.savetxt)
 }
 
+// optional bool fast = 11 [default = false];
+inline bool EADPMatchParameter::has_fast() const {
+  return (_has_bits_[0] & 0x00000400u) != 0;
+}
+inline void EADPMatchParameter::set_has_fast() {
+  _has_bits_[0] |= 0x00000400u;
+}
+inline void EADPMatchParameter::clear_has_fast() {
+  _has_bits_[0] &= ~0x00000400u;
+}
+inline void EADPMatchParameter::clear_fast() {
+  fast_ = false;
+  clear_has_fast();
+}
+inline bool EADPMatchParameter::fast() const {
+  // @@protoc_insertion_point(field_get:svaf.EADPMatchParameter.fast)
+  return fast_;
+}
+inline void EADPMatchParameter::set_fast(bool value) {
+  set_has_fast();
+  fast_ = value;
+  // @@protoc_insertion_point(field_set:svaf.EADPMatchParameter.fast)
+}
+
+// optional bool roi = 12 [default = true];
+inline bool EADPMatchParameter::has_roi() const {
+  return (_has_bits_[0] & 0x00000800u) != 0;
+}
+inline void EADPMatchParameter::set_has_roi() {
+  _has_bits_[0] |= 0x00000800u;
+}
+inline void EADPMatchParameter::clear_has_roi() {
+  _has_bits_[0] &= ~0x00000800u;
+}
+inline void EADPMatchParameter::clear_roi() {
+  roi_ = true;
+  clear_has_roi();
+}
+inline bool EADPMatchParameter::roi() const {
+  // @@protoc_insertion_point(field_get:svaf.EADPMatchParameter.roi)
+  return roi_;
+}
+inline void EADPMatchParameter::set_roi(bool value) {
+  set_has_roi();
+  roi_ = value;
+  // @@protoc_insertion_point(field_set:svaf.EADPMatchParameter.roi)
+}
+
+// optional bool points = 13 [default = true];
+inline bool EADPMatchParameter::has_points() const {
+  return (_has_bits_[0] & 0x00001000u) != 0;
+}
+inline void EADPMatchParameter::set_has_points() {
+  _has_bits_[0] |= 0x00001000u;
+}
+inline void EADPMatchParameter::clear_has_points() {
+  _has_bits_[0] &= ~0x00001000u;
+}
+inline void EADPMatchParameter::clear_points() {
+  points_ = true;
+  clear_has_points();
+}
+inline bool EADPMatchParameter::points() const {
+  // @@protoc_insertion_point(field_get:svaf.EADPMatchParameter.points)
+  return points_;
+}
+inline void EADPMatchParameter::set_points(bool value) {
+  set_has_points();
+  points_ = value;
+  // @@protoc_insertion_point(field_set:svaf.EADPMatchParameter.points)
+}
+
 // -------------------------------------------------------------------
 
 // OutputParameter
@@ -15118,70 +17266,742 @@ inline void TriangularParameter::set_has_pcname() {
 inline void TriangularParameter::clear_has_pcname() {
   _has_bits_[0] &= ~0x00000010u;
 }
-inline void TriangularParameter::clear_pcname() {
-  if (pcname_ != _default_pcname_) {
-    pcname_->assign(*_default_pcname_);
+inline void TriangularParameter::clear_pcname() {
+  if (pcname_ != _default_pcname_) {
+    pcname_->assign(*_default_pcname_);
+  }
+  clear_has_pcname();
+}
+inline const ::std::string& TriangularParameter::pcname() const {
+  // @@protoc_insertion_point(field_get:svaf.TriangularParameter.pcname)
+  return *pcname_;
+}
+inline void TriangularParameter::set_pcname(const ::std::string& value) {
+  set_has_pcname();
+  if (pcname_ == _default_pcname_) {
+    pcname_ = new ::std::string;
+  }
+  pcname_->assign(value);
+  // @@protoc_insertion_point(field_set:svaf.TriangularParameter.pcname)
+}
+inline void TriangularParameter::set_pcname(const char* value) {
+  set_has_pcname();
+  if (pcname_ == _default_pcname_) {
+    pcname_ = new ::std::string;
+  }
+  pcname_->assign(value);
+  // @@protoc_insertion_point(field_set_char:svaf.TriangularParameter.pcname)
+}
+inline void TriangularParameter::set_pcname(const char* value, size_t size) {
+  set_has_pcname();
+  if (pcname_ == _default_pcname_) {
+    pcname_ = new ::std::string;
+  }
+  pcname_->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:svaf.TriangularParameter.pcname)
+}
+inline ::std::string* TriangularParameter::mutable_pcname() {
+  set_has_pcname();
+  if (pcname_ == _default_pcname_) {
+    pcname_ = new ::std::string(*_default_pcname_);
+  }
+  // @@protoc_insertion_point(field_mutable:svaf.TriangularParameter.pcname)
+  return pcname_;
+}
+inline ::std::string* TriangularParameter::release_pcname() {
+  clear_has_pcname();
+  if (pcname_ == _default_pcname_) {
+    return NULL;
+  } else {
+    ::std::string* temp = pcname_;
+    pcname_ = const_cast< ::std::string*>(_default_pcname_);
+    return temp;
+  }
+}
+inline void TriangularParameter::set_allocated_pcname(::std::string* pcname) {
+  if (pcname_ != _default_pcname_) {
+    delete pcname_;
+  }
+  if (pcname) {
+    set_has_pcname();
+    pcname_ = pcname;
+  } else {
+    clear_has_pcname();
+    pcname_ = const_cast< ::std::string*>(_default_pcname_);
+  }
+  // @@protoc_insertion_point(field_set_allocated:svaf.TriangularParameter.pcname)
+}
+
+// optional string calib_raw = 6 [default = "Calib_Results_stereo.yml"];
+inline bool TriangularParameter::has_calib_raw() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+inline void TriangularParameter::set_has_calib_raw() {
+  _has_bits_[0] |= 0x00000020u;
+}
+inline void TriangularParameter::clear_has_calib_raw() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline void TriangularParameter::clear_calib_raw() {
+  if (calib_raw_ != _default_calib_raw_) {
+    calib_raw_->assign(*_default_calib_raw_);
+  }
+  clear_has_calib_raw();
+}
+inline const ::std::string& TriangularParameter::calib_raw() const {
+  // @@protoc_insertion_point(field_get:svaf.TriangularParameter.calib_raw)
+  return *calib_raw_;
+}
+inline void TriangularParameter::set_calib_raw(const ::std::string& value) {
+  set_has_calib_raw();
+  if (calib_raw_ == _default_calib_raw_) {
+    calib_raw_ = new ::std::string;
+  }
+  calib_raw_->assign(value);
+  // @@protoc_insertion_point(field_set:svaf.TriangularParameter.calib_raw)
+}
+inline void TriangularParameter::set_calib_raw(const char* value) {
+  set_has_calib_raw();
+  if (calib_raw_ == _default_calib_raw_) {
+    calib_raw_ = new ::std::string;
+  }
+  calib_raw_->assign(value);
+  // @@protoc_insertion_point(field_set_char:svaf.TriangularParameter.calib_raw)
+}
+inline void TriangularParameter::set_calib_raw(const char* value, size_t size) {
+  set_has_calib_raw();
+  if (calib_raw_ == _default_calib_raw_) {
+    calib_raw_ = new ::std::string;
+  }
+  calib_raw_->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:svaf.TriangularParameter.calib_raw)
+}
+inline ::std::string* TriangularParameter::mutable_calib_raw() {
+  set_has_calib_raw();
+  if (calib_raw_ == _default_calib_raw_) {
+    calib_raw_ = new ::std::string(*_default_calib_raw_);
+  }
+  // @@protoc_insertion_point(field_mutable:svaf.TriangularParameter.calib_raw)
+  return calib_raw_;
+}
+inline ::std::string* TriangularParameter::release_calib_raw() {
+  clear_has_calib_raw();
+  if (calib_raw_ == _default_calib_raw_) {
+    return NULL;
+  } else {
+    ::std::string* temp = calib_raw_;
+    calib_raw_ = const_cast< ::std::string*>(_default_calib_raw_);
+    return temp;
+  }
+}
+inline void TriangularParameter::set_allocated_calib_raw(::std::string* calib_raw) {
+  if (calib_raw_ != _default_calib_raw_) {
+    delete calib_raw_;
+  }
+  if (calib_raw) {
+    set_has_calib_raw();
+    calib_raw_ = calib_raw;
+  } else {
+    clear_has_calib_raw();
+    calib_raw_ = const_cast< ::std::string*>(_default_calib_raw_);
+  }
+  // @@protoc_insertion_point(field_set_allocated:svaf.TriangularParameter.calib_raw)
+}
+
+// optional string calib_rect = 7 [default = "Calib_Results_stereo_rectified.yml"];
+inline bool TriangularParameter::has_calib_rect() const {
+  return (_has_bits_[0] & 0x00000040u) != 0;
+}
+inline void TriangularParameter::set_has_calib_rect() {
+  _has_bits_[0] |= 0x00000040u;
+}
+inline void TriangularParameter::clear_has_calib_rect() {
+  _has_bits_[0] &= ~0x00000040u;
+}
+inline void TriangularParameter::clear_calib_rect() {
+  if (calib_rect_ != _default_calib_rect_) {
+    calib_rect_->assign(*_default_calib_rect_);
+  }
+  clear_has_calib_rect();
+}
+inline const ::std::string& TriangularParameter::calib_rect() const {
+  // @@protoc_insertion_point(field_get:svaf.TriangularParameter.calib_rect)
+  return *calib_rect_;
+}
+inline void TriangularParameter::set_calib_rect(const ::std::string& value) {
+  set_has_calib_rect();
+  if (calib_rect_ == _default_calib_rect_) {
+    calib_rect_ = new ::std::string;
+  }
+  calib_rect_->assign(value);
+  // @@protoc_insertion_point(field_set:svaf.TriangularParameter.calib_rect)
+}
+inline void TriangularParameter::set_calib_rect(const char* value) {
+  set_has_calib_rect();
+  if (calib_rect_ == _default_calib_rect_) {
+    calib_rect_ = new ::std::string;
+  }
+  calib_rect_->assign(value);
+  // @@protoc_insertion_point(field_set_char:svaf.TriangularParameter.calib_rect)
+}
+inline void TriangularParameter::set_calib_rect(const char* value, size_t size) {
+  set_has_calib_rect();
+  if (calib_rect_ == _default_calib_rect_) {
+    calib_rect_ = new ::std::string;
+  }
+  calib_rect_->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:svaf.TriangularParameter.calib_rect)
+}
+inline ::std::string* TriangularParameter::mutable_calib_rect() {
+  set_has_calib_rect();
+  if (calib_rect_ == _default_calib_rect_) {
+    calib_rect_ = new ::std::string(*_default_calib_rect_);
+  }
+  // @@protoc_insertion_point(field_mutable:svaf.TriangularParameter.calib_rect)
+  return calib_rect_;
+}
+inline ::std::string* TriangularParameter::release_calib_rect() {
+  clear_has_calib_rect();
+  if (calib_rect_ == _default_calib_rect_) {
+    return NULL;
+  } else {
+    ::std::string* temp = calib_rect_;
+    calib_rect_ = const_cast< ::std::string*>(_default_calib_rect_);
+    return temp;
+  }
+}
+inline void TriangularParameter::set_allocated_calib_rect(::std::string* calib_rect) {
+  if (calib_rect_ != _default_calib_rect_) {
+    delete calib_rect_;
+  }
+  if (calib_rect) {
+    set_has_calib_rect();
+    calib_rect_ = calib_rect;
+  } else {
+    clear_has_calib_rect();
+    calib_rect_ = const_cast< ::std::string*>(_default_calib_rect_);
+  }
+  // @@protoc_insertion_point(field_set_allocated:svaf.TriangularParameter.calib_rect)
+}
+
+// optional string calib = 8;
+inline bool TriangularParameter::has_calib() const {
+  return (_has_bits_[0] & 0x00000080u) != 0;
+}
+inline void TriangularParameter::set_has_calib() {
+  _has_bits_[0] |= 0x00000080u;
+}
+inline void TriangularParameter::clear_has_calib() {
+  _has_bits_[0] &= ~0x00000080u;
+}
+inline void TriangularParameter::clear_calib() {
+  if (calib_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    calib_->clear();
+  }
+  clear_has_calib();
+}
+inline const ::std::string& TriangularParameter::calib() const {
+  // @@protoc_insertion_point(field_get:svaf.TriangularParameter.calib)
+  return *calib_;
+}
+inline void TriangularParameter::set_calib(const ::std::string& value) {
+  set_has_calib();
+  if (calib_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    calib_ = new ::std::string;
+  }
+  calib_->assign(value);
+  // @@protoc_insertion_point(field_set:svaf.TriangularParameter.calib)
+}
+inline void TriangularParameter::set_calib(const char* value) {
+  set_has_calib();
+  if (calib_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    calib_ = new ::std::string;
+  }
+  calib_->assign(value);
+  // @@protoc_insertion_point(field_set_char:svaf.TriangularParameter.calib)
+}
+inline void TriangularParameter::set_calib(const char* value, size_t size) {
+  set_has_calib();
+  if (calib_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    calib_ = new ::std::string;
+  }
+  calib_->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:svaf.TriangularParameter.calib)
+}
+inline ::std::string* TriangularParameter::mutable_calib() {
+  set_has_calib();
+  if (calib_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    calib_ = new ::std::string;
+  }
+  // @@protoc_insertion_point(field_mutable:svaf.TriangularParameter.calib)
+  return calib_;
+}
+inline ::std::string* TriangularParameter::release_calib() {
+  clear_has_calib();
+  if (calib_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    return NULL;
+  } else {
+    ::std::string* temp = calib_;
+    calib_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    return temp;
+  }
+}
+inline void TriangularParameter::set_allocated_calib(::std::string* calib) {
+  if (calib_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete calib_;
+  }
+  if (calib) {
+    set_has_calib();
+    calib_ = calib;
+  } else {
+    clear_has_calib();
+    calib_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  }
+  // @@protoc_insertion_point(field_set_allocated:svaf.TriangularParameter.calib)
+}
+
+// optional float voxel = 9 [default = 0];
+inline bool TriangularParameter::has_voxel() const {
+  return (_has_bits_[0] & 0x00000100u) != 0;
+}
+inline void TriangularParameter::set_has_voxel() {
+  _has_bits_[0] |= 0x00000100u;
+}
+inline void TriangularParameter::clear_has_voxel() {
+  _has_bits_[0] &= ~0x00000100u;
+}
+inline void TriangularParameter::clear_voxel() {
+  voxel_ = 0;
+  clear_has_voxel();
+}
+inline float TriangularParameter::voxel() const {
+  // @@protoc_insertion_point(field_get:svaf.TriangularParameter.voxel)
+  return voxel_;
+}
+inline void TriangularParameter::set_voxel(float value) {
+  set_has_voxel();
+  voxel_ = value;
+  // @@protoc_insertion_point(field_set:svaf.TriangularParameter.voxel)
+}
+
+// -------------------------------------------------------------------
+
+// ReprojectParameter
+
+// optional string calib_file = 1;
+inline bool ReprojectParameter::has_calib_file() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void ReprojectParameter::set_has_calib_file() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void ReprojectParameter::clear_has_calib_file() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void ReprojectParameter::clear_calib_file() {
+  if (calib_file_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    calib_file_->clear();
+  }
+  clear_has_calib_file();
+}
+inline const ::std::string& ReprojectParameter::calib_file() const {
+  // @@protoc_insertion_point(field_get:svaf.ReprojectParameter.calib_file)
+  return *calib_file_;
+}
+inline void ReprojectParameter::set_calib_file(const ::std::string& value) {
+  set_has_calib_file();
+  if (calib_file_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    calib_file_ = new ::std::string;
+  }
+  calib_file_->assign(value);
+  // @@protoc_insertion_point(field_set:svaf.ReprojectParameter.calib_file)
+}
+inline void ReprojectParameter::set_calib_file(const char* value) {
+  set_has_calib_file();
+  if (calib_file_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    calib_file_ = new ::std::string;
+  }
+  calib_file_->assign(value);
+  // @@protoc_insertion_point(field_set_char:svaf.ReprojectParameter.calib_file)
+}
+inline void ReprojectParameter::set_calib_file(const char* value, size_t size) {
+  set_has_calib_file();
+  if (calib_file_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    calib_file_ = new ::std::string;
+  }
+  calib_file_->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:svaf.ReprojectParameter.calib_file)
+}
+inline ::std::string* ReprojectParameter::mutable_calib_file() {
+  set_has_calib_file();
+  if (calib_file_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    calib_file_ = new ::std::string;
+  }
+  // @@protoc_insertion_point(field_mutable:svaf.ReprojectParameter.calib_file)
+  return calib_file_;
+}
+inline ::std::string* ReprojectParameter::release_calib_file() {
+  clear_has_calib_file();
+  if (calib_file_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    return NULL;
+  } else {
+    ::std::string* temp = calib_file_;
+    calib_file_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    return temp;
+  }
+}
+inline void ReprojectParameter::set_allocated_calib_file(::std::string* calib_file) {
+  if (calib_file_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete calib_file_;
+  }
+  if (calib_file) {
+    set_has_calib_file();
+    calib_file_ = calib_file;
+  } else {
+    clear_has_calib_file();
+    calib_file_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  }
+  // @@protoc_insertion_point(field_set_allocated:svaf.ReprojectParameter.calib_file)
+}
+
+// optional float fx = 2;
+inline bool ReprojectParameter::has_fx() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void ReprojectParameter::set_has_fx() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void ReprojectParameter::clear_has_fx() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void ReprojectParameter::clear_fx() {
+  fx_ = 0;
+  clear_has_fx();
+}
+inline float ReprojectParameter::fx() const {
+  // @@protoc_insertion_point(field_get:svaf.ReprojectParameter.fx)
+  return fx_;
+}
+inline void ReprojectParameter::set_fx(float value) {
+  set_has_fx();
+  fx_ = value;
+  // @@protoc_insertion_point(field_set:svaf.ReprojectParameter.fx)
+}
+
+// optional float fy = 3;
+inline bool ReprojectParameter::has_fy() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void ReprojectParameter::set_has_fy() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void ReprojectParameter::clear_has_fy() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void ReprojectParameter::clear_fy() {
+  fy_ = 0;
+  clear_has_fy();
+}
+inline float ReprojectParameter::fy() const {
+  // @@protoc_insertion_point(field_get:svaf.ReprojectParameter.fy)
+  return fy_;
+}
+inline void ReprojectParameter::set_fy(float value) {
+  set_has_fy();
+  fy_ = value;
+  // @@protoc_insertion_point(field_set:svaf.ReprojectParameter.fy)
+}
+
+// optional float cx = 4;
+inline bool ReprojectParameter::has_cx() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void ReprojectParameter::set_has_cx() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void ReprojectParameter::clear_has_cx() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void ReprojectParameter::clear_cx() {
+  cx_ = 0;
+  clear_has_cx();
+}
+inline float ReprojectParameter::cx() const {
+  // @@protoc_insertion_point(field_get:svaf.ReprojectParameter.cx)
+  return cx_;
+}
+inline void ReprojectParameter::set_cx(float value) {
+  set_has_cx();
+  cx_ = value;
+  // @@protoc_insertion_point(field_set:svaf.ReprojectParameter.cx)
+}
+
+// optional float cy = 5;
+inline bool ReprojectParameter::has_cy() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void ReprojectParameter::set_has_cy() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void ReprojectParameter::clear_has_cy() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void ReprojectParameter::clear_cy() {
+  cy_ = 0;
+  clear_has_cy();
+}
+inline float ReprojectParameter::cy() const {
+  // @@protoc_insertion_point(field_get:svaf.ReprojectParameter.cy)
+  return cy_;
+}
+inline void ReprojectParameter::set_cy(float value) {
+  set_has_cy();
+  cy_ = value;
+  // @@protoc_insertion_point(field_set:svaf.ReprojectParameter.cy)
+}
+
+// optional float cx_right = 6;
+inline bool ReprojectParameter::has_cx_right() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+inline void ReprojectParameter::set_has_cx_right() {
+  _has_bits_[0] |= 0x00000020u;
+}
+inline void ReprojectParameter::clear_has_cx_right() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline void ReprojectParameter::clear_cx_right() {
+  cx_right_ = 0;
+  clear_has_cx_right();
+}
+inline float ReprojectParameter::cx_right() const {
+  // @@protoc_insertion_point(field_get:svaf.ReprojectParameter.cx_right)
+  return cx_right_;
+}
+inline void ReprojectParameter::set_cx_right(float value) {
+  set_has_cx_right();
+  cx_right_ = value;
+  // @@protoc_insertion_point(field_set:svaf.ReprojectParameter.cx_right)
+}
+
+// optional float baseline = 7;
+inline bool ReprojectParameter::has_baseline() const {
+  return (_has_bits_[0] & 0x00000040u) != 0;
+}
+inline void ReprojectParameter::set_has_baseline() {
+  _has_bits_[0] |= 0x00000040u;
+}
+inline void ReprojectParameter::clear_has_baseline() {
+  _has_bits_[0] &= ~0x00000040u;
+}
+inline void ReprojectParameter::clear_baseline() {
+  baseline_ = 0;
+  clear_has_baseline();
+}
+inline float ReprojectParameter::baseline() const {
+  // @@protoc_insertion_point(field_get:svaf.ReprojectParameter.baseline)
+  return baseline_;
+}
+inline void ReprojectParameter::set_baseline(float value) {
+  set_has_baseline();
+  baseline_ = value;
+  // @@protoc_insertion_point(field_set:svaf.ReprojectParameter.baseline)
+}
+
+// optional int32 stride = 8 [default = 1];
+inline bool ReprojectParameter::has_stride() const {
+  return (_has_bits_[0] & 0x00000080u) != 0;
+}
+inline void ReprojectParameter::set_has_stride() {
+  _has_bits_[0] |= 0x00000080u;
+}
+inline void ReprojectParameter::clear_has_stride() {
+  _has_bits_[0] &= ~0x00000080u;
+}
+inline void ReprojectParameter::clear_stride() {
+  stride_ = 1;
+  clear_has_stride();
+}
+inline ::google::protobuf::int32 ReprojectParameter::stride() const {
+  // @@protoc_insertion_point(field_get:svaf.ReprojectParameter.stride)
+  return stride_;
+}
+inline void ReprojectParameter::set_stride(::google::protobuf::int32 value) {
+  set_has_stride();
+  stride_ = value;
+  // @@protoc_insertion_point(field_set:svaf.ReprojectParameter.stride)
+}
+
+// optional bool color = 9 [default = false];
+inline bool ReprojectParameter::has_color() const {
+  return (_has_bits_[0] & 0x00000100u) != 0;
+}
+inline void ReprojectParameter::set_has_color() {
+  _has_bits_[0] |= 0x00000100u;
+}
+inline void ReprojectParameter::clear_has_color() {
+  _has_bits_[0] &= ~0x00000100u;
+}
+inline void ReprojectParameter::clear_color() {
+  color_ = false;
+  clear_has_color();
+}
+inline bool ReprojectParameter::color() const {
+  // @@protoc_insertion_point(field_get:svaf.ReprojectParameter.color)
+  return color_;
+}
+inline void ReprojectParameter::set_color(bool value) {
+  set_has_color();
+  color_ = value;
+  // @@protoc_insertion_point(field_set:svaf.ReprojectParameter.color)
+}
+
+// optional bool pointl = 10 [default = true];
+inline bool ReprojectParameter::has_pointl() const {
+  return (_has_bits_[0] & 0x00000200u) != 0;
+}
+inline void ReprojectParameter::set_has_pointl() {
+  _has_bits_[0] |= 0x00000200u;
+}
+inline void ReprojectParameter::clear_has_pointl() {
+  _has_bits_[0] &= ~0x00000200u;
+}
+inline void ReprojectParameter::clear_pointl() {
+  pointl_ = true;
+  clear_has_pointl();
+}
+inline bool ReprojectParameter::pointl() const {
+  // @@protoc_insertion_point(field_get:svaf.ReprojectParameter.pointl)
+  return pointl_;
+}
+inline void ReprojectParameter::set_pointl(bool value) {
+  set_has_pointl();
+  pointl_ = value;
+  // @@protoc_insertion_point(field_set:svaf.ReprojectParameter.pointl)
+}
+
+// optional bool savepc = 11 [default = false];
+inline bool ReprojectParameter::has_savepc() const {
+  return (_has_bits_[0] & 0x00000400u) != 0;
+}
+inline void ReprojectParameter::set_has_savepc() {
+  _has_bits_[0] |= 0x00000400u;
+}
+inline void ReprojectParameter::clear_has_savepc() {
+  _has_bits_[0] &= ~0x00000400u;
+}
+inline void ReprojectParameter::clear_savepc() {
+  savepc_ = false;
+  clear_has_savepc();
+}
+inline bool ReprojectParameter::savepc() const {
+  // @@protoc_insertion_point(field_get:svaf.ReprojectParameter.savepc)
+  return savepc_;
+}
+inline void ReprojectParameter::set_savepc(bool value) {
+  set_has_savepc();
+  savepc_ = value;
+  // @@protoc_insertion_point(field_set:svaf.ReprojectParameter.savepc)
+}
+
+// optional string calib = 12;
+inline bool ReprojectParameter::has_calib() const {
+  return (_has_bits_[0] & 0x00000800u) != 0;
+}
+inline void ReprojectParameter::set_has_calib() {
+  _has_bits_[0] |= 0x00000800u;
+}
+inline void ReprojectParameter::clear_has_calib() {
+  _has_bits_[0] &= ~0x00000800u;
+}
+inline void ReprojectParameter::clear_calib() {
+  if (calib_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    calib_->clear();
   }
-  clear_has_pcname();
+  clear_has_calib();
 }
-inline const ::std::string& TriangularParameter::pcname() const {
-  // @@protoc_insertion_point(field_get:svaf.TriangularParameter.pcname)
-  return *pcname_;
+inline const ::std::string& ReprojectParameter::calib() const {
+  // @@protoc_insertion_point(field_get:svaf.ReprojectParameter.calib)
+  return *calib_;
 }
-inline void TriangularParameter::set_pcname(const ::std::string& value) {
-  set_has_pcname();
-  if (pcname_ == _default_pcname_) {
-    pcname_ = new ::std::string;
+inline void ReprojectParameter::set_calib(const ::std::string& value) {
+  set_has_calib();
+  if (calib_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    calib_ = new ::std::string;
   }
-  pcname_->assign(value);
-  // @@protoc_insertion_point(field_set:svaf.TriangularParameter.pcname)
+  calib_->assign(value);
+  // @@protoc_insertion_point(field_set:svaf.ReprojectParameter.calib)
 }
-inline void TriangularParameter::set_pcname(const char* value) {
-  set_has_pcname();
-  if (pcname_ == _default_pcname_) {
-    pcname_ = new ::std::string;
+inline void ReprojectParameter::set_calib(const char* value) {
+  set_has_calib();
+  if (calib_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    calib_ = new ::std::string;
   }
-  pcname_->assign(value);
-  // @@protoc_insertion_point(field_set_char:svaf.TriangularParameter.pcname)
+  calib_->assign(value);
+  // @@protoc_insertion_point(field_set_char:svaf.ReprojectParameter.calib)
 }
-inline void TriangularParameter::set_pcname(const char* value, size_t size) {
-  set_has_pcname();
-  if (pcname_ == _default_pcname_) {
-    pcname_ = new ::std::string;
+inline void ReprojectParameter::set_calib(const char* value, size_t size) {
+  set_has_calib();
+  if (calib_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    calib_ = new ::std::string;
   }
-  pcname_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:svaf.TriangularParameter.pcname)
+  calib_->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:svaf.ReprojectParameter.calib)
 }
-inline ::std::string* TriangularParameter::mutable_pcname() {
-  set_has_pcname();
-  if (pcname_ == _default_pcname_) {
-    pcname_ = new ::std::string(*_default_pcname_);
+inline ::std::string* ReprojectParameter::mutable_calib() {
+  set_has_calib();
+  if (calib_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    calib_ = new ::std::string;
   }
-  // @@protoc_insertion_point(field_mutable:svaf.TriangularParameter.pcname)
-  return pcname_;
+  // @@protoc_insertion_point(field_mutable:svaf.ReprojectParameter.calib)
+  return calib_;
 }
-inline ::std::string* TriangularParameter::release_pcname() {
-  clear_has_pcname();
-  if (pcname_ == _default_pcname_) {
+inline ::std::string* ReprojectParameter::release_calib() {
+  clear_has_calib();
+  if (calib_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
     return NULL;
   } else {
-    ::std::string* temp = pcname_;
-    pcname_ = const_cast< ::std::string*>(_default_pcname_);
+    ::std::string* temp = calib_;
+    calib_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
     return temp;
   }
 }
-inline void TriangularParameter::set_allocated_pcname(::std::string* pcname) {
-  if (pcname_ != _default_pcname_) {
-    delete pcname_;
+inline void ReprojectParameter::set_allocated_calib(::std::string* calib) {
+  if (calib_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete calib_;
   }
-  if (pcname) {
-    set_has_pcname();
-    pcname_ = pcname;
+  if (calib) {
+    set_has_calib();
+    calib_ = calib;
   } else {
-    clear_has_pcname();
-    pcname_ = const_cast< ::std::string*>(_default_pcname_);
+    clear_has_calib();
+    calib_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   }
-  // @@protoc_insertion_point(field_set_allocated:svaf.TriangularParameter.pcname)
+  // @@protoc_insertion_point(field_set_allocated:svaf.ReprojectParameter.calib)
+}
+
+// optional float voxel = 13 [default = 0];
+inline bool ReprojectParameter::has_voxel() const {
+  return (_has_bits_[0] & 0x00001000u) != 0;
+}
+inline void ReprojectParameter::set_has_voxel() {
+  _has_bits_[0] |= 0x00001000u;
+}
+inline void ReprojectParameter::clear_has_voxel() {
+  _has_bits_[0] &= ~0x00001000u;
+}
+inline void ReprojectParameter::clear_voxel() {
+  voxel_ = 0;
+  clear_has_voxel();
+}
+inline float ReprojectParameter::voxel() const {
+  // @@protoc_insertion_point(field_get:svaf.ReprojectParameter.voxel)
+  return voxel_;
+}
+inline void ReprojectParameter::set_voxel(float value) {
+  set_has_voxel();
+  voxel_ = value;
+  // @@protoc_insertion_point(field_set:svaf.ReprojectParameter.voxel)
 }
 
 // -------------------------------------------------------------------
@@ -15492,6 +18312,82 @@ inline void MatrixMulParameter::set_allocated_col2(::std::string* col2) {
   // @@protoc_insertion_point(field_set_allocated:svaf.MatrixMulParameter.col2)
 }
 
+// optional string calib = 5;
+inline bool MatrixMulParameter::has_calib() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void MatrixMulParameter::set_has_calib() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void MatrixMulParameter::clear_has_calib() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void MatrixMulParameter::clear_calib() {
+  if (calib_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    calib_->clear();
+  }
+  clear_has_calib();
+}
+inline const ::std::string& MatrixMulParameter::calib() const {
+  // @@protoc_insertion_point(field_get:svaf.MatrixMulParameter.calib)
+  return *calib_;
+}
+inline void MatrixMulParameter::set_calib(const ::std::string& value) {
+  set_has_calib();
+  if (calib_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    calib_ = new ::std::string;
+  }
+  calib_->assign(value);
+  // @@protoc_insertion_point(field_set:svaf.MatrixMulParameter.calib)
+}
+inline void MatrixMulParameter::set_calib(const char* value) {
+  set_has_calib();
+  if (calib_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    calib_ = new ::std::string;
+  }
+  calib_->assign(value);
+  // @@protoc_insertion_point(field_set_char:svaf.MatrixMulParameter.calib)
+}
+inline void MatrixMulParameter::set_calib(const char* value, size_t size) {
+  set_has_calib();
+  if (calib_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    calib_ = new ::std::string;
+  }
+  calib_->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:svaf.MatrixMulParameter.calib)
+}
+inline ::std::string* MatrixMulParameter::mutable_calib() {
+  set_has_calib();
+  if (calib_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    calib_ = new ::std::string;
+  }
+  // @@protoc_insertion_point(field_mutable:svaf.MatrixMulParameter.calib)
+  return calib_;
+}
+inline ::std::string* MatrixMulParameter::release_calib() {
+  clear_has_calib();
+  if (calib_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    return NULL;
+  } else {
+    ::std::string* temp = calib_;
+    calib_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    return temp;
+  }
+}
+inline void MatrixMulParameter::set_allocated_calib(::std::string* calib) {
+  if (calib_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete calib_;
+  }
+  if (calib) {
+    set_has_calib();
+    calib_ = calib;
+  } else {
+    clear_has_calib();
+    calib_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  }
+  // @@protoc_insertion_point(field_set_allocated:svaf.MatrixMulParameter.calib)
+}
+
 // -------------------------------------------------------------------
 
 // PositionEstimateParameter
@@ -15502,6 +18398,274 @@ inline void MatrixMulParameter::set_allocated_col2(::std::string* col2) {
 
 // -------------------------------------------------------------------
 
+// FeaturePoolParameter
+
+// optional int32 capacity = 1 [default = 5000];
+inline bool FeaturePoolParameter::has_capacity() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void FeaturePoolParameter::set_has_capacity() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void FeaturePoolParameter::clear_has_capacity() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void FeaturePoolParameter::clear_capacity() {
+  capacity_ = 5000;
+  clear_has_capacity();
+}
+inline ::google::protobuf::int32 FeaturePoolParameter::capacity() const {
+  // @@protoc_insertion_point(field_get:svaf.FeaturePoolParameter.capacity)
+  return capacity_;
+}
+inline void FeaturePoolParameter::set_capacity(::google::protobuf::int32 value) {
+  set_has_capacity();
+  capacity_ = value;
+  // @@protoc_insertion_point(field_set:svaf.FeaturePoolParameter.capacity)
+}
+
+// optional float thresh = 2 [default = 0.65];
+inline bool FeaturePoolParameter::has_thresh() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void FeaturePoolParameter::set_has_thresh() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void FeaturePoolParameter::clear_has_thresh() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void FeaturePoolParameter::clear_thresh() {
+  thresh_ = 0.65f;
+  clear_has_thresh();
+}
+inline float FeaturePoolParameter::thresh() const {
+  // @@protoc_insertion_point(field_get:svaf.FeaturePoolParameter.thresh)
+  return thresh_;
+}
+inline void FeaturePoolParameter::set_thresh(float value) {
+  set_has_thresh();
+  thresh_ = value;
+  // @@protoc_insertion_point(field_set:svaf.FeaturePoolParameter.thresh)
+}
+
+// optional float cell = 3 [default = 10];
+inline bool FeaturePoolParameter::has_cell() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void FeaturePoolParameter::set_has_cell() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void FeaturePoolParameter::clear_has_cell() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void FeaturePoolParameter::clear_cell() {
+  cell_ = 10;
+  clear_has_cell();
+}
+inline float FeaturePoolParameter::cell() const {
+  // @@protoc_insertion_point(field_get:svaf.FeaturePoolParameter.cell)
+  return cell_;
+}
+inline void FeaturePoolParameter::set_cell(float value) {
+  set_has_cell();
+  cell_ = value;
+  // @@protoc_insertion_point(field_set:svaf.FeaturePoolParameter.cell)
+}
+
+// optional float radius = 4 [default = 5];
+inline bool FeaturePoolParameter::has_radius() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void FeaturePoolParameter::set_has_radius() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void FeaturePoolParameter::clear_has_radius() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void FeaturePoolParameter::clear_radius() {
+  radius_ = 5;
+  clear_has_radius();
+}
+inline float FeaturePoolParameter::radius() const {
+  // @@protoc_insertion_point(field_get:svaf.FeaturePoolParameter.radius)
+  return radius_;
+}
+inline void FeaturePoolParameter::set_radius(float value) {
+  set_has_radius();
+  radius_ = value;
+  // @@protoc_insertion_point(field_set:svaf.FeaturePoolParameter.radius)
+}
+
+// optional float inlier = 5 [default = 5];
+inline bool FeaturePoolParameter::has_inlier() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void FeaturePoolParameter::set_has_inlier() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void FeaturePoolParameter::clear_has_inlier() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void FeaturePoolParameter::clear_inlier() {
+  inlier_ = 5;
+  clear_has_inlier();
+}
+inline float FeaturePoolParameter::inlier() const {
+  // @@protoc_insertion_point(field_get:svaf.FeaturePoolParameter.inlier)
+  return inlier_;
+}
+inline void FeaturePoolParameter::set_inlier(float value) {
+  set_has_inlier();
+  inlier_ = value;
+  // @@protoc_insertion_point(field_set:svaf.FeaturePoolParameter.inlier)
+}
+
+// optional int32 iters = 6 [default = 200];
+inline bool FeaturePoolParameter::has_iters() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+inline void FeaturePoolParameter::set_has_iters() {
+  _has_bits_[0] |= 0x00000020u;
+}
+inline void FeaturePoolParameter::clear_has_iters() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline void FeaturePoolParameter::clear_iters() {
+  iters_ = 200;
+  clear_has_iters();
+}
+inline ::google::protobuf::int32 FeaturePoolParameter::iters() const {
+  // @@protoc_insertion_point(field_get:svaf.FeaturePoolParameter.iters)
+  return iters_;
+}
+inline void FeaturePoolParameter::set_iters(::google::protobuf::int32 value) {
+  set_has_iters();
+  iters_ = value;
+  // @@protoc_insertion_point(field_set:svaf.FeaturePoolParameter.iters)
+}
+
+// optional int32 minmatch = 7 [default = 6];
+inline bool FeaturePoolParameter::has_minmatch() const {
+  return (_has_bits_[0] & 0x00000040u) != 0;
+}
+inline void FeaturePoolParameter::set_has_minmatch() {
+  _has_bits_[0] |= 0x00000040u;
+}
+inline void FeaturePoolParameter::clear_has_minmatch() {
+  _has_bits_[0] &= ~0x00000040u;
+}
+inline void FeaturePoolParameter::clear_minmatch() {
+  minmatch_ = 6;
+  clear_has_minmatch();
+}
+inline ::google::protobuf::int32 FeaturePoolParameter::minmatch() const {
+  // @@protoc_insertion_point(field_get:svaf.FeaturePoolParameter.minmatch)
+  return minmatch_;
+}
+inline void FeaturePoolParameter::set_minmatch(::google::protobuf::int32 value) {
+  set_has_minmatch();
+  minmatch_ = value;
+  // @@protoc_insertion_point(field_set:svaf.FeaturePoolParameter.minmatch)
+}
+
+// optional int32 trees = 8 [default = 4];
+inline bool FeaturePoolParameter::has_trees() const {
+  return (_has_bits_[0] & 0x00000080u) != 0;
+}
+inline void FeaturePoolParameter::set_has_trees() {
+  _has_bits_[0] |= 0x00000080u;
+}
+inline void FeaturePoolParameter::clear_has_trees() {
+  _has_bits_[0] &= ~0x00000080u;
+}
+inline void FeaturePoolParameter::clear_trees() {
+  trees_ = 4;
+  clear_has_trees();
+}
+inline ::google::protobuf::int32 FeaturePoolParameter::trees() const {
+  // @@protoc_insertion_point(field_get:svaf.FeaturePoolParameter.trees)
+  return trees_;
+}
+inline void FeaturePoolParameter::set_trees(::google::protobuf::int32 value) {
+  set_has_trees();
+  trees_ = value;
+  // @@protoc_insertion_point(field_set:svaf.FeaturePoolParameter.trees)
+}
+
+// optional int32 checks = 9 [default = 64];
+inline bool FeaturePoolParameter::has_checks() const {
+  return (_has_bits_[0] & 0x00000100u) != 0;
+}
+inline void FeaturePoolParameter::set_has_checks() {
+  _has_bits_[0] |= 0x00000100u;
+}
+inline void FeaturePoolParameter::clear_has_checks() {
+  _has_bits_[0] &= ~0x00000100u;
+}
+inline void FeaturePoolParameter::clear_checks() {
+  checks_ = 64;
+  clear_has_checks();
+}
+inline ::google::protobuf::int32 FeaturePoolParameter::checks() const {
+  // @@protoc_insertion_point(field_get:svaf.FeaturePoolParameter.checks)
+  return checks_;
+}
+inline void FeaturePoolParameter::set_checks(::google::protobuf::int32 value) {
+  set_has_checks();
+  checks_ = value;
+  // @@protoc_insertion_point(field_set:svaf.FeaturePoolParameter.checks)
+}
+
+// optional bool store = 10 [default = true];
+inline bool FeaturePoolParameter::has_store() const {
+  return (_has_bits_[0] & 0x00000200u) != 0;
+}
+inline void FeaturePoolParameter::set_has_store() {
+  _has_bits_[0] |= 0x00000200u;
+}
+inline void FeaturePoolParameter::clear_has_store() {
+  _has_bits_[0] &= ~0x00000200u;
+}
+inline void FeaturePoolParameter::clear_store() {
+  store_ = true;
+  clear_has_store();
+}
+inline bool FeaturePoolParameter::store() const {
+  // @@protoc_insertion_point(field_get:svaf.FeaturePoolParameter.store)
+  return store_;
+}
+inline void FeaturePoolParameter::set_store(bool value) {
+  set_has_store();
+  store_ = value;
+  // @@protoc_insertion_point(field_set:svaf.FeaturePoolParameter.store)
+}
+
+// optional int32 maxfail = 11 [default = 5];
+inline bool FeaturePoolParameter::has_maxfail() const {
+  return (_has_bits_[0] & 0x00000400u) != 0;
+}
+inline void FeaturePoolParameter::set_has_maxfail() {
+  _has_bits_[0] |= 0x00000400u;
+}
+inline void FeaturePoolParameter::clear_has_maxfail() {
+  _has_bits_[0] &= ~0x00000400u;
+}
+inline void FeaturePoolParameter::clear_maxfail() {
+  maxfail_ = 5;
+  clear_has_maxfail();
+}
+inline ::google::protobuf::int32 FeaturePoolParameter::maxfail() const {
+  // @@protoc_insertion_point(field_get:svaf.FeaturePoolParameter.maxfail)
+  return maxfail_;
+}
+inline void FeaturePoolParameter::set_maxfail(::google::protobuf::int32 value) {
+  set_has_maxfail();
+  maxfail_ = value;
+  // @@protoc_insertion_point(field_set:svaf.FeaturePoolParameter.maxfail)
+}
+
+// -------------------------------------------------------------------
+
 // CoordiParameter
 
 // optional float x = 1 [default = 0];
@@ -19230,15 +22394,56 @@ inline void LayerParameter::set_allocated_mxmul_param(::svaf::MatrixMulParameter
   // @@protoc_insertion_point(field_set_allocated:svaf.LayerParameter.mxmul_param)
 }
 
+// optional .svaf.ReprojectParameter reproject_param = 183;
+inline bool LayerParameter::has_reproject_param() const {
+  return (_has_bits_[2] & 0x00000002u) != 0;
+}
+inline void LayerParameter::set_has_reproject_param() {
+  _has_bits_[2] |= 0x00000002u;
+}
+inline void LayerParameter::clear_has_reproject_param() {
+  _has_bits_[2] &= ~0x00000002u;
+}
+inline void LayerParameter::clear_reproject_param() {
+  if (reproject_param_ != NULL) reproject_param_->::svaf::ReprojectParameter::Clear();
+  clear_has_reproject_param();
+}
+inline const ::svaf::ReprojectParameter& LayerParameter::reproject_param() const {
+  // @@protoc_insertion_point(field_get:svaf.LayerParameter.reproject_param)
+  return reproject_param_ != NULL ? *reproject_param_ : *default_instance_->reproject_param_;
+}
+inline ::svaf::ReprojectParameter* LayerParameter::mutable_reproject_param() {
+  set_has_reproject_param();
+  if (reproject_param_ == NULL) reproject_param_ = new ::svaf::ReprojectParameter;
+  // @@protoc_insertion_point(field_mutable:svaf.LayerParameter.reproject_param)
+  return reproject_param_;
+}
+inline ::svaf::ReprojectParameter* LayerParameter::release_reproject_param() {
+  clear_has_reproject_param();
+  ::svaf::ReprojectParameter* temp = reproject_param_;
+  reproject_param_ = NULL;
+  return temp;
+}
+inline void LayerParameter::set_allocated_reproject_param(::svaf::ReprojectParameter* reproject_param) {
+  delete reproject_param_;
+  reproject_param_ = reproject_param;
+  if (reproject_param) {
+    set_has_reproject_param();
+  } else {
+    clear_has_reproject_param();
+  }
+  // @@protoc_insertion_point(field_set_allocated:svaf.LayerParameter.reproject_param)
+}
+
 // optional .svaf.PositionEstimateParameter posest_param = 190;
 inline bool LayerParameter::has_posest_param() const {
-  return (_has_bits_[2] & 0x00000002u) != 0;
+  return (_has_bits_[2] & 0x00000004u) != 0;
 }
 inline void LayerParameter::set_has_posest_param() {
-  _has_bits_[2] |= 0x00000002u;
+  _has_bits_[2] |= 0x00000004u;
 }
 inline void LayerParameter::clear_has_posest_param() {
-  _has_bits_[2] &= ~0x00000002u;
+  _has_bits_[2] &= ~0x00000004u;
 }
 inline void LayerParameter::clear_posest_param() {
   if (posest_param_ != NULL) posest_param_->::svaf::PositionEstimateParameter::Clear();
@@ -19273,13 +22478,13 @@ inline void LayerParameter::set_allocated_posest_param(::svaf::PositionEstimateP
 
 // optional .svaf.CenterPointParameter centerpoint_param = 191;
 inline bool LayerParameter::has_centerpoint_param() const {
-  return (_has_bits_[2] & 0x00000004u) != 0;
+  return (_has_bits_[2] & 0x00000008u) != 0;
 }
 inline void LayerParameter::set_has_centerpoint_param() {
-  _has_bits_[2] |= 0x00000004u;
+  _has_bits_[2] |= 0x00000008u;
 }
 inline void LayerParameter::clear_has_centerpoint_param() {
-  _has_bits_[2] &= ~0x00000004u;
+  _has_bits_[2] &= ~0x00000008u;
 }
 inline void LayerParameter::clear_centerpoint_param() {
   if (centerpoint_param_ != NULL) centerpoint_param_->::svaf::CenterPointParameter::Clear();
@@ -19312,15 +22517,56 @@ inline void LayerParameter::set_allocated_centerpoint_param(::svaf::CenterPointP
   // @@protoc_insertion_point(field_set_allocated:svaf.LayerParameter.centerpoint_param)
 }
 
+// optional .svaf.FeaturePoolParameter featpool_param = 193;
+inline bool LayerParameter::has_featpool_param() const {
+  return (_has_bits_[2] & 0x00000010u) != 0;
+}
+inline void LayerParameter::set_has_featpool_param() {
+  _has_bits_[2] |= 0x00000010u;
+}
+inline void LayerParameter::clear_has_featpool_param() {
+  _has_bits_[2] &= ~0x00000010u;
+}
+inline void LayerParameter::clear_featpool_param() {
+  if (featpool_param_ != NULL) featpool_param_->::svaf::FeaturePoolParameter::Clear();
+  clear_has_featpool_param();
+}
+inline const ::svaf::FeaturePoolParameter& LayerParameter::featpool_param() const {
+  // @@protoc_insertion_point(field_get:svaf.LayerParameter.featpool_param)
+  return featpool_param_ != NULL ? *featpool_param_ : *default_instance_->featpool_param_;
+}
+inline ::svaf::FeaturePoolParameter* LayerParameter::mutable_featpool_param() {
+  set_has_featpool_param();
+  if (featpool_param_ == NULL) featpool_param_ = new ::svaf::FeaturePoolParameter;
+  // @@protoc_insertion_point(field_mutable:svaf.LayerParameter.featpool_param)
+  return featpool_param_;
+}
+inline ::svaf::FeaturePoolParameter* LayerParameter::release_featpool_param() {
+  clear_has_featpool_param();
+  ::svaf::FeaturePoolParameter* temp = featpool_param_;
+  featpool_param_ = NULL;
+  return temp;
+}
+inline void LayerParameter::set_allocated_featpool_param(::svaf::FeaturePoolParameter* featpool_param) {
+  delete featpool_param_;
+  featpool_param_ = featpool_param;
+  if (featpool_param) {
+    set_has_featpool_param();
+  } else {
+    clear_has_featpool_param();
+  }
+  // @@protoc_insertion_point(field_set_allocated:svaf.LayerParameter.featpool_param)
+}
+
 // optional .svaf.SACIAEstimateParameter sacia_param = 194;
 inline bool LayerParameter::has_sacia_param() const {
-  return (_has_bits_[2] & 0x00000008u) != 0;
+  return (_has_bits_[2] & 0x00000020u) != 0;
 }
 inline void LayerParameter::set_has_sacia_param() {
-  _has_bits_[2] |= 0x00000008u;
+  _has_bits_[2] |= 0x00000020u;
 }
 inline void LayerParameter::clear_has_sacia_param() {
-  _has_bits_[2] &= ~0x00000008u;
+  _has_bits_[2] &= ~0x00000020u;
 }
 inline void LayerParameter::clear_sacia_param() {
   if (sacia_param_ != NULL) sacia_param_->::svaf::SACIAEstimateParameter::Clear();
@@ -19355,13 +22601,13 @@ inline void LayerParameter::set_allocated_sacia_param(::svaf::SACIAEstimateParam
 
 // optional .svaf.IAICPEstimateParameter iaicp_param = 195;
 inline bool LayerParameter::has_iaicp_param() const {
-  return (_has_bits_[2] & 0x00000010u) != 0;
+  return (_has_bits_[2] & 0x00000040u) != 0;
 }
 inline void LayerParameter::set_has_iaicp_param() {
-  _has_bits_[2] |= 0x00000010u;
+  _has_bits_[2] |= 0x00000040u;
 }
 inline void LayerParameter::clear_has_iaicp_param() {
-  _has_bits_[2] &= ~0x00000010u;
+  _has_bits_[2] &= ~0x00000040u;
 }
 inline void LayerParameter::clear_iaicp_param() {
   if (iaicp_param_ != NULL) iaicp_param_->::svaf::IAICPEstimateParameter::Clear();
@@ -19396,13 +22642,13 @@ inline void LayerParameter::set_allocated_iaicp_param(::svaf::IAICPEstimateParam
 
 // optional .svaf.IANDTEstimateParameter iandt_param = 196;
 inline bool LayerParameter::has_iandt_param() const {
-  return (_has_bits_[2] & 0x00000020u) != 0;
+  return (_has_bits_[2] & 0x00000080u) != 0;
 }
 inline void LayerParameter::set_has_iandt_param() {
-  _has_bits_[2] |= 0x00000020u;
+  _has_bits_[2] |= 0x00000080u;
 }
 inline void LayerParameter::clear_has_iandt_param() {
-  _has_bits_[2] &= ~0x00000020u;
+  _has_bits_[2] &= ~0x00000080u;
 }
 inline void LayerParameter::clear_iandt_param() {
   if (iandt_param_ != NULL) iandt_param_->::svaf::IANDTEstimateParameter::Clear();
@@ -19474,6 +22720,11 @@ template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::svaf::CVDescriptorParameter_DespType>() {
   return ::svaf::CVDescriptorParameter_DespType_descriptor();
 }
+template <> struct is_proto_enum< ::svaf::RansacParameter_ModelType> : ::google::protobuf::internal::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::svaf::RansacParameter_ModelType>() {
+  return ::svaf::RansacParameter_ModelType_descriptor();
+}
 template <> struct is_proto_enum< ::svaf::CVMatchParameter_MatchType> : ::google::protobuf::internal::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::svaf::CVMatchParameter_MatchType>() {
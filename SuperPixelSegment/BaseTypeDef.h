@@ -296,6 +296,17 @@ typedef struct tagImage64
 
 }IMAGE64_S;
 
+/* ͼͼ: ⲿ(ͷ), ֮м */
+typedef struct tagImageView
+{
+    PIXEL *data;    // 
+    int width;      // 
+    int height;     // ߶
+    int channel;    // ͨ
+    int step;       // п(ֽ)
+
+}IMAGEV_S;
+
 /* ͼ */
 typedef struct tagImageSeq
 {
@@ -423,7 +423,7 @@ void Image16Read(IN char* filename, OUT IMAGE32_S *img, IN int buffer)
 
 cv::Mat Image16Mat(IN IMAGE32_S *img, IN RECT_S *rect)
 {
-	IplImage* pNewImg;
+	IplImage pNewImg;
 	CvSize size;
 	int channel;
 	int flag = img->channel;
@@ -443,12 +443,11 @@ cv::Mat Image16Mat(IN IMAGE32_S *img, IN RECT_S *rect)
 		size.width = rect->right - rect->left + 1;
 	}
 
-	pNewImg = cvCreateImage(size, IPL_DEPTH_16U, channel);
-	Image16Hustsong2OpenCv(img, pNewImg, rect);
+	// ֱдMat, ʡȥмIplImageͿ
+	cv::Mat mat(size.height, size.width, CV_16UC(channel));
+	pNewImg = mat;
+	Image16Hustsong2OpenCv(img, &pNewImg, rect);
 
-	cv::Mat mat(pNewImg, true);
-	//cvSaveImage(filename, pNewImg);
-	cvReleaseImage(&pNewImg);
 	return mat;
 }
 
@@ -530,23 +529,22 @@ void ImageHustsong2Parallel(IN IMAGE_S *img, OUT IMAGE_S *img2)
 *******************************************************************************/
 bool MatRead(cv::Mat& mat, OUT IMAGE_S *img)
 {
-	IplImage pImage = mat;
-	IplImage* pIamge = cvCloneImage(&pImage);
+	IplImage pIamge;
 
 	img->width = img->height = 0;
 	img->channel = IMAGE_SEQ_NORMAL;
-	if (NULL == pIamge)
+	if (mat.empty() || mat.depth() != CV_8U)
 	{
 		return false;
 	}
 	else
 	{
-		int size = pIamge->height*pIamge->width*pIamge->nChannels;
+		int size = mat.rows*mat.cols*mat.channels();
 		img->data = MallocType(PIXEL, size);
 
-		ImageOpenCv2Hustsong(pIamge, img);
-
-		cvReleaseImage(&pIamge);
+		// ImageOpenCv2Hustsongпȶȡ, ҪcvCloneImage
+		pIamge = mat;
+		ImageOpenCv2Hustsong(&pIamge, img);
 	}
 
 	return true;
@@ -730,7 +728,7 @@ void ImageSave(IN char* filename, IN IMAGE_S *img, IN RECT_S *rect)
 
 cv::Mat Image2Mat(IN IMAGE_S *img, IN RECT_S *rect)
 {
-	IplImage* pNewImg;
+	IplImage pNewImg;
 	CvSize size;
 	int channel;
 	int flag = img->channel;
@@ -750,16 +748,121 @@ cv::Mat Image2Mat(IN IMAGE_S *img, IN RECT_S *rect)
 		size.width = rect->right - rect->left + 1;
 	}
 
-	pNewImg = cvCreateImage(size, IPL_DEPTH_8U, channel);
-	ImageHustsong2OpenCv(img, pNewImg, rect);
+	// ֱдMat, ʡȥмIplImageͿ
+	cv::Mat mat(size.height, size.width, CV_8UC(channel));
+	pNewImg = mat;
+	ImageHustsong2OpenCv(img, &pNewImg, rect);
 
-	cv::Mat mat(pNewImg, true);
-	//cvShowImage(filename, pNewImg);
-	//cvWaitKey(1);
-	cvReleaseImage(&pNewImg);
 	return mat;
 }
 
+/*******************************************************************************
+    Func Name: MatImageView
+     Function: cv::Matͼͼ, 
+        Input: IN cv::Mat& mat, 8λͼ(ROI, ֮м)
+       Output: OUT IMAGEV_S *view, matͼ
+       Return: ɹtrue, ͼ8λͼ񷵻false
+      Caution: ͼڲܳmat
+      Description: 
+--------------------------------------------------------------------------------
+  Modification History                                                        
+  DATE        NAME             DESCRIPTION                                    
+--------------------------------------------------------------------------------  
+  YYYY-MM-DD                                                           
+                                                                              
+*******************************************************************************/
+bool MatImageView(IN cv::Mat& mat, OUT IMAGEV_S *view)
+{
+	if (mat.empty() || mat.depth() != CV_8U || mat.dims != 2)
+	{
+		return false;
+	}
+
+	view->data = mat.data;
+	view->height = mat.rows;
+	view->width = mat.cols;
+	view->channel = mat.channels();
+	view->step = (int)mat.step;
+
+	return true;
+}
+
+/*******************************************************************************
+    Func Name: ImageViewCompact
+     Function: ͼͼתΪ洢IMAGE_S
+        Input: IN IMAGEV_S *view, ͼͼ
+               INOUT cv::Mat& buf, ҪתʱʹõĻ
+       Output: OUT IMAGE_S *img, 洢ͼ
+       Return: 
+      Caution: ֮ûмҲ4ͨʱֱͼ, תbuf
+      Description: 4ͨ(BGRA)תΪ3ͨ, ImageOpenCv2Hustsongһ
+--------------------------------------------------------------------------------
+  Modification History                                                        
+  DATE        NAME             DESCRIPTION                                    
+--------------------------------------------------------------------------------  
+  YYYY-MM-DD                                                           
+                                                                              
+*******************************************************************************/
+void ImageViewCompact(IN IMAGEV_S *view, OUT IMAGE_S *img, INOUT cv::Mat& buf)
+{
+	int height = view->height;
+	int width = view->width;
+	int channel = view->channel;
+
+	if (channel == 4)
+	{
+		cv::Mat src(height, width, CV_8UC4, view->data, view->step);
+		cv::cvtColor(src, buf, CV_BGRA2BGR);
+		img->data = buf.data;
+		channel = 3;
+	}
+	else if (view->step != width*channel)
+	{
+		cv::Mat src(height, width, CV_8UC(channel), view->data, view->step);
+		src.copyTo(buf);
+		img->data = buf.data;
+	}
+	else
+	{
+		img->data = view->data;
+	}
+
+	img->height = height;
+	img->width = width;
+	img->channel = channel;
+
+	return;
+}
+
+/*******************************************************************************
+    Func Name: MatView
+     Function: cv::MatתΪIMAGE_S, ͬʱ
+        Input: IN cv::Mat& mat, 8λͼ
+               INOUT cv::Mat& buf, ҪתʱʹõĻ
+       Output: OUT IMAGE_S *img, 洢ʽͼ
+       Return: ɹtrue
+      Caution: imgmatbuf, freeͷ
+      Description: MatRead, ʡȥcvCloneImageؿ
+--------------------------------------------------------------------------------
+  Modification History                                                        
+  DATE        NAME             DESCRIPTION                                    
+--------------------------------------------------------------------------------  
+  YYYY-MM-DD                                                           
+                                                                              
+*******************************************************************************/
+bool MatView(IN cv::Mat& mat, OUT IMAGE_S *img, INOUT cv::Mat& buf)
+{
+	IMAGEV_S view;
+
+	if (!MatImageView(mat, &view))
+	{
+		return false;
+	}
+	ImageViewCompact(&view, img, buf);
+
+	return true;
+}
+
 void ImageShow(IN char* filename, IN IMAGE_S *img, IN RECT_S *rect)
 {
     IplImage* pNewImg;
@@ -55,6 +55,11 @@ extern void ImageFree(INOUT IMAGE_S *img);
 extern void ImageShow(IN char* filename, IN IMAGE_S *img, IN RECT_S *rect);
 extern cv::Mat Image2Mat(IN IMAGE_S *img, IN RECT_S *rect);
 
+/* cv::MatIMAGE_S֮㿽ͼ, вͬʱת */
+extern bool MatImageView(IN cv::Mat& mat, OUT IMAGEV_S *view);
+extern void ImageViewCompact(IN IMAGEV_S *view, OUT IMAGE_S *img, INOUT cv::Mat& buf);
+extern bool MatView(IN cv::Mat& mat, OUT IMAGE_S *img, INOUT cv::Mat& buf);
+
 extern void ImageRawReadCcs(IN char *filename, OUT IMAGE_S *img);
 extern void ImageRaw16ReadCcs(IN char *filename, OUT IMAGE_S *img, IN int bits);
 
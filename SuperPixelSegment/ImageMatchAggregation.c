@@ -25,6 +25,10 @@ extern "C"{
 #include "math.h"
 #include "ImageMatchAggregation.h"
 
+#ifdef PLATFORM_SSE
+#include <smmintrin.h>
+#endif
+
 void ImaScanTreeIntAggrPara(ImaScanTreeIntInfo *aggr)
 {
     aggr->mode = 0;
@@ -1826,6 +1830,520 @@ void StaLineSgmaggrUshortXdy(IN ushort *imagecost,
 }
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 䳤ӲSGMۺ: pĴλimagecost + doff[p], ӲΪdmin[p] ~ dmin[p]+dnum[p]-1
+// ImaScanTreeUshortAggrProc(mode 0)ͬ, /ƽ; ûXdy汾, mode != 0ɵ߾ܾ
+void ImaScanTreeUshortAggrProcRange(IN ushort *imagecost,
+                                    IN ushort *dmin,
+                                    IN ushort *dnum,
+                                    IN int *doff,
+                                    IN int height,
+                                    IN int width,
+                                    IN int dlength,
+                                    IN ushort P1,
+                                    IN ushort P2,
+                                    OUT ushort *smoothcost,
+                                    INOUT ushort *LpBuf)
+{
+    int i;
+
+    // ʼ
+    memset(smoothcost, 0, doff[height*width]*sizeof(ushort));
+
+    // зaggr
+    for (i = 0; i < height; i++)
+    {
+        StaLineSgmaggrUshortRange(imagecost, dmin, dnum, doff, height, width, dlength, 
+                                  i, IMAGE_DIRECT_LEFT, P1, P2, smoothcost, LpBuf);
+        StaLineSgmaggrUshortRange(imagecost, dmin, dnum, doff, height, width, dlength, 
+                                  i, IMAGE_DIRECT_RIGHT, P1, P2, smoothcost, LpBuf);
+    }
+
+    // зaggr
+    for (i = 0; i < width; i++)
+    {
+        StaLineSgmaggrUshortRange(imagecost, dmin, dnum, doff, height, width, dlength, 
+                                  i, IMAGE_DIRECT_TOP, P1, P2, smoothcost, LpBuf);
+        StaLineSgmaggrUshortRange(imagecost, dmin, dnum, doff, height, width, dlength, 
+                                  i, IMAGE_DIRECT_BOTTOM, P1, P2, smoothcost, LpBuf);
+    }
+
+    return;
+}
+
+void StaLineSgmaggrUshortRange(IN ushort *imagecost,
+                               IN ushort *dmin,
+                               IN ushort *dnum,
+                               IN int *doff,
+                               IN int height,
+                               IN int width,
+                               IN int dlength,
+                               IN int line,
+                               IN int begin,
+                               IN ushort P1,
+                               IN ushort P2,
+                               OUT ushort *aggrcost,
+                               INOUT ushort *LpBuf)
+{
+    // 0ʾǰһ㣬1ʾǰ; LpӲ, Ϊ
+    int x, d, k;
+    int p, inc, num;
+    int LpBufWidth;
+    int d0, n0, d1, n1;
+
+    ushort *cost, *aggr;
+    ushort *Lp0, *Lp1, *Lptemp;
+
+    int c0, c1, c2;
+    int Lpcost;
+    int minLp0cost, minLp1cost;
+
+    // 
+    if (begin == IMAGE_DIRECT_LEFT)
+    {
+        // 
+        p = line*width;
+        inc = 1;
+        num = width;
+    }
+    else if (begin == IMAGE_DIRECT_RIGHT)
+    {
+        // ҵ
+        p = line*width + width-1;
+        inc = -1;
+        num = width;
+    }
+    else if (begin == IMAGE_DIRECT_TOP)
+    {
+        // ϵ
+        p = line;
+        inc = width;
+        num = height;
+    }
+    else
+    {
+        // µ
+        p = (height-1)*width + line;
+        inc = -width;
+        num = height;
+    }
+
+    LpBufWidth = dlength + IMA_STUS_BUFEX;
+    Lp1 = LpBuf + IMA_STUS_BUFOFF;
+    Lp0 = Lp1 + LpBufWidth;
+    for (d = -1;d <= dlength;d++)
+    {
+        Lp0[d] = Lp1[d] = INT16_INF;
+    }
+
+    // һ
+    d1 = dmin[p];
+    n1 = dnum[p];
+    cost = imagecost + doff[p];
+    aggr = aggrcost + doff[p];
+    minLp1cost = INT16_INF;
+    for (k = 0;k < n1;k++)
+    {
+        Lpcost = cost[k];
+        Lp1[d1+k] = (ushort)Lpcost;
+        aggr[k] += (ushort)Lpcost;
+        if (Lpcost < minLp1cost)    minLp1cost = Lpcost;
+    }
+    d0 = d1;
+    n0 = n1;
+
+    // ݹ
+    for (x = 1; x < num; x++)
+    {
+        // Lp0Ϊǰһ, Lp1ǰΪǰ
+        swapAB(Lp0, Lp1, Lptemp);
+        for (k = 0;k < n0;k++)
+        {
+            Lp1[d0+k] = INT16_INF;
+        }
+        d0 = d1;
+        n0 = n1;
+        minLp0cost = minLp1cost;
+
+        p += inc;
+        d1 = dmin[p];
+        n1 = dnum[p];
+        cost = imagecost + doff[p];
+        aggr = aggrcost + doff[p];
+        minLp1cost = INT16_INF;
+        for (k = 0, d = d1;k < n1;k++, d++)
+        {
+            c0 = Lp0[d];
+            c1 = Lp0[d-1];
+            c2 = Lp0[d+1];
+
+            c1 = ((c1 < c2) ? c1 : c2) + P1;
+            c2 = minLp0cost + P2;
+            c1 = (c1 < c2) ? c1 : c2;
+            c0 = (c1 < c0) ? c1 : c0;
+
+            Lpcost = cost[k] + c0 - minLp0cost;
+            Lp1[d] = (ushort)Lpcost;
+            aggr[k] += (ushort)Lpcost;
+            if (Lpcost < minLp1cost)    minLp1cost = Lpcost;
+        }
+    }
+
+    return;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ImaScanTreeWgtUshortAggrPara(ImaScanTreeWgtUshortInfo *aggr)
+{
+    aggr->sg = 25.0f;
+    aggr->sc = 25.0f;
+    aggr->P1 = 129;
+    aggr->P2 = 2156;
+    aggr->wtablelen = 3*IMAGE_WHITE;
+}
+
+void ImaScanTreeWgtUshortAggrInit(ImaScanTreeWgtUshortInfo *aggr)
+{
+    int height = aggr->height;
+    int width = aggr->width;
+    int dlength = aggr->dlength;
+    int wtablelen = aggr->wtablelen;
+    int hw = (height > width) ? height : width;
+    int dstride, Lplen, costlen;
+    floatcost sg = (floatcost)aggr->sg;
+
+    int i;
+    int *table;
+    floatcost fg;
+
+    dstride = (dlength + IMA_STWUS_DALIGN - 1) & ~(IMA_STWUS_DALIGN - 1);
+    aggr->dstride = dstride;
+    aggr->Lpwidth = dstride + IMA_STWUS_BUFOFF*2;
+    Lplen = hw * 2 * aggr->Lpwidth;
+    costlen = height*width*dstride;
+
+    aggr->padcost = NULL;
+    if (dstride != dlength)
+    {
+        aggr->padcost = mm_MallocType(ushort, costlen);
+    }
+    aggr->smoothcost = mm_MallocType(ushort, costlen);
+    aggr->SoBuf = mm_MallocType(ushort, costlen);
+    aggr->wtable = MallocType(ushort, wtablelen);
+
+    // LpӲ߽һֱΪ, ֻʼһ
+    aggr->LpBuf = mm_MallocType(ushort, Lplen);
+    memset(aggr->LpBuf, 0xFF, Lplen*sizeof(ushort));
+
+    // Ȩֵint汾ȫһ(ΪIMA_STI_S_WEIGHT)
+    if (sg <= 0)    fg = 1.0f;
+    else            fg = (floatcost)exp(-1.0/aggr->sg);
+    table = MallocType(int, wtablelen);
+    StaWeightTabelInt(fg, aggr->sc, table, wtablelen);
+    for (i = 0;i < wtablelen;i++)
+    {
+        aggr->wtable[i] = (ushort)table[i];
+    }
+    FreeType(table, int, wtablelen);
+
+    return;
+}
+
+void ImaScanTreeWgtUshortAggrDestroy(ImaScanTreeWgtUshortInfo *aggr)
+{
+    // PLATFORM_SSEmm_FreeTypeԳ, ֱдں, δʹõľֲ
+    if (aggr->padcost != NULL)
+    {
+        mm_FreeType(aggr->padcost, ushort, aggr->height*aggr->width*aggr->dstride);
+    }
+    mm_FreeType(aggr->smoothcost, ushort, aggr->height*aggr->width*aggr->dstride);
+    mm_FreeType(aggr->SoBuf, ushort, aggr->height*aggr->width*aggr->dstride);
+    mm_FreeType(aggr->LpBuf, ushort, ((aggr->height > aggr->width) ? aggr->height : aggr->width)*2*aggr->Lpwidth);
+    FreeType(aggr->wtable, ushort, aggr->wtablelen);
+
+    return;
+}
+
+void ImaScanTreeWgtUshortAggrProc(INOUT ImaScanTreeWgtUshortInfo *aggr)
+{
+    ushort P1 = aggr->P1;
+    ushort P2 = aggr->P2;
+    int height = aggr->height;
+    int width = aggr->width;
+    int dlength = aggr->dlength;
+    int dstride = aggr->dstride;
+    int costwidth = width*dstride;
+    int Lpwidth = aggr->Lpwidth;
+    ushort *smoothcost = aggr->smoothcost;
+    ushort *SoBuf = aggr->SoBuf;
+    ushort *LpBuf = aggr->LpBuf;
+    ushort *wtable = aggr->wtable;
+    int *gx = aggr->Gx->data;
+    int *gy = aggr->Gy->data;
+
+    int i;
+    ushort *imagecost;
+
+    // Ӳά뵽Ĵ, 벿Ϊ
+    imagecost = aggr->imagecost;
+    if (dstride != dlength)
+    {
+        StaDsiPadUshort(aggr->imagecost, height*width, dlength, dstride, aggr->padcost);
+        imagecost = aggr->padcost;
+    }
+
+    // з: SoBuf = Llr + Lrl - C, ໥
+#pragma omp parallel for
+    for (i = 0; i < height; i++)
+    {
+        ushort *cost = imagecost + i*costwidth;
+        ushort *socost = SoBuf + i*costwidth;
+        ushort *Lp = LpBuf + i*2*Lpwidth;
+        int *g = gx + i*width;
+        int last = width-1;
+
+        // ǰʹǰһݶ, ʹõǰݶ(ͬStaWeightLookupInt)
+        StaLineDpaggrUshort(cost, dstride, g, 1, wtable, width, dstride, 
+                            P1, P2, FALSE, socost, Lp);
+        StaLineDpaggrUshort(cost + last*dstride, -dstride, g + last-1, -1, wtable, width, dstride, 
+                            P1, P2, TRUE, socost + last*dstride, Lp);
+    }
+
+    // з: SoBufΪ, ໥
+#pragma omp parallel for
+    for (i = 0; i < width; i++)
+    {
+        ushort *cost = SoBuf + i*dstride;
+        ushort *socost = smoothcost + i*dstride;
+        ushort *Lp = LpBuf + i*2*Lpwidth;
+        int *g = gy + i;
+        int last = height-1;
+
+        StaLineDpaggrUshort(cost, costwidth, g, width, wtable, height, dstride, 
+                            P1, P2, FALSE, socost, Lp);
+        StaLineDpaggrUshort(cost + last*costwidth, -costwidth, g + (last-1)*width, -width, wtable, height, dstride, 
+                            P1, P2, TRUE, socost + last*costwidth, Lp);
+    }
+
+    return;
+}
+
+/******************************************************************************
+    Func Name: StaLineDpaggrUshort
+     Function: һɨϵļȨDPۻ(16λ)
+        Input: IN ushort *imagecost, Ĵ
+               IN int costinc, ۵ļ(Ϊ)
+               IN int *grad, һõݶ
+               IN int gradinc, ݶȵļ(Ϊ)
+               IN ushort *wtable, ݶ->Ȩֵ
+               IN int num, ɨ߳
+               IN int dstride, Ӳ(IMA_STWUS_DALIGNı)
+               IN ushort P1, IN ushort P2, ͷ
+               IN int accum, FALSE: aggr = Lp; TRUE: aggr += Lp - C
+       Output: OUT ushort *aggrcost, ۻ
+               INOUT ushort *LpBuf, Lp, ߽ΪIMA_STWUS_INF
+       Return: 
+      Caution: Ȩֵֻÿһһαٹ㲥, ӲάΪSIMD;
+               (c5*w)>>8ȷint汾Ľ
+******************************************************************************/
+#ifdef PLATFORM_SSE
+void StaLineDpaggrUshort(IN ushort *imagecost, 
+                         IN int costinc, 
+                         IN int *grad, 
+                         IN int gradinc, 
+                         IN ushort *wtable, 
+                         IN int num, 
+                         IN int dstride, 
+                         IN ushort P1,
+                         IN ushort P2,
+                         IN int accum,
+                         OUT ushort *aggrcost, 
+                         INOUT ushort *LpBuf)
+{
+    // 0ʾǰһ㣬1ʾǰ
+    int x, d;
+    int minLp0cost, minLp1cost;
+    ushort *Lp0, *Lp1, *Lptemp;
+    ushort *cost = imagecost;
+    ushort *aggr = aggrcost;
+
+    __m128i mm_P1, mm_w;
+    __m128i mm_minLp0cost, mm_minLp1cost;
+    __m128i mm_c0, mm_c1, mm_c2;
+    __m128i mm_c3, mm_c4, mm_c5;
+    __m128i mm_lo, mm_hi;
+    __m128i mm_cpd, mm_Lpcost;
+
+    Lp1 = LpBuf + IMA_STWUS_BUFOFF;
+    Lp0 = Lp1 + dstride + IMA_STWUS_BUFOFF*2;
+
+    // һ
+    mm_minLp1cost = _mm_set1_epi16((short)IMA_STWUS_INF);
+    for (d = 0;d < dstride;d += 8)
+    {
+        mm_Lpcost = _mm_load_si128((__m128i *)(cost + d));
+        _mm_store_si128((__m128i *)(Lp1 + d), mm_Lpcost);
+        if (!accum)
+        {
+            _mm_store_si128((__m128i *)(aggr + d), mm_Lpcost);
+        }
+        mm_minLp1cost = _mm_min_epu16(mm_minLp1cost, mm_Lpcost);
+    }
+    minLp1cost = _mm_cvtsi128_si32(_mm_minpos_epu16(mm_minLp1cost)) & 0xFFFF;
+
+    // ݹ
+    mm_P1 = _mm_set1_epi16((short)P1);
+    for (x = 1; x < num; x++)
+    {
+        swapAB(Lp0, Lp1, Lptemp);
+        minLp0cost = minLp1cost;
+        cost += costinc;
+        aggr += costinc;
+        mm_w = _mm_set1_epi16((short)wtable[*grad]);
+        grad += gradinc;
+
+        mm_minLp0cost = _mm_set1_epi16((short)minLp0cost);
+        mm_c4 = _mm_adds_epu16(mm_minLp0cost, _mm_set1_epi16((short)P2));
+        mm_minLp1cost = _mm_set1_epi16((short)IMA_STWUS_INF);
+        for (d = 0;d < dstride;d += 8)
+        {
+            // c5 = min(Lp0[d], Lp0[d-1] + P1, Lp0[d+1] + P1, minLp0 + P2) - minLp0
+            mm_c0 = _mm_load_si128((__m128i *)(Lp0 + d));
+            mm_c1 = _mm_loadu_si128((__m128i *)(Lp0 + d - 1));
+            mm_c2 = _mm_loadu_si128((__m128i *)(Lp0 + d + 1));
+            mm_c3 = _mm_adds_epu16(_mm_min_epu16(mm_c1, mm_c2), mm_P1);
+            mm_c5 = _mm_min_epu16(_mm_min_epu16(mm_c0, mm_c4), mm_c3);
+            mm_c5 = _mm_subs_epu16(mm_c5, mm_minLp0cost);
+
+            // (w*c5) >> 8: 32λ˻[8, 24)λ
+            mm_lo = _mm_mullo_epi16(mm_c5, mm_w);
+            mm_hi = _mm_mulhi_epu16(mm_c5, mm_w);
+            mm_c5 = _mm_or_si128(_mm_slli_epi16(mm_hi, 16-IMA_STI_Q_WEIGHT), 
+                                 _mm_srli_epi16(mm_lo, IMA_STI_Q_WEIGHT));
+
+            mm_cpd = _mm_load_si128((__m128i *)(cost + d));
+            mm_Lpcost = _mm_adds_epu16(mm_cpd, mm_c5);
+            _mm_store_si128((__m128i *)(Lp1 + d), mm_Lpcost);
+            if (accum)
+            {
+                mm_c0 = _mm_load_si128((__m128i *)(aggr + d));
+                _mm_store_si128((__m128i *)(aggr + d), _mm_adds_epu16(mm_c0, mm_c5));
+            }
+            else
+            {
+                _mm_store_si128((__m128i *)(aggr + d), mm_Lpcost);
+            }
+            mm_minLp1cost = _mm_min_epu16(mm_minLp1cost, mm_Lpcost);
+        }
+        minLp1cost = _mm_cvtsi128_si32(_mm_minpos_epu16(mm_minLp1cost)) & 0xFFFF;
+    }
+
+    return;
+}
+#else
+void StaLineDpaggrUshort(IN ushort *imagecost, 
+                         IN int costinc, 
+                         IN int *grad, 
+                         IN int gradinc, 
+                         IN ushort *wtable, 
+                         IN int num, 
+                         IN int dstride, 
+                         IN ushort P1,
+                         IN ushort P2,
+                         IN int accum,
+                         OUT ushort *aggrcost, 
+                         INOUT ushort *LpBuf)
+{
+    // 0ʾǰһ㣬1ʾǰ
+    int x, d;
+    int minLp0cost, minLp1cost;
+    ushort *Lp0, *Lp1, *Lptemp;
+    ushort *cost = imagecost;
+    ushort *aggr = aggrcost;
+
+    int c0, c1, c2;
+    int c3, c4, c5;
+    int w, Lp1cost;
+
+    Lp1 = LpBuf + IMA_STWUS_BUFOFF;
+    Lp0 = Lp1 + dstride + IMA_STWUS_BUFOFF*2;
+
+    // һ
+    minLp1cost = IMA_STWUS_INF;
+    for (d = 0;d < dstride;d++)
+    {
+        Lp1cost = cost[d];
+        Lp1[d] = (ushort)Lp1cost;
+        if (!accum)     aggr[d] = (ushort)Lp1cost;
+        if (Lp1cost < minLp1cost)   minLp1cost = Lp1cost;
+    }
+
+    // ݹ
+    for (x = 1; x < num; x++)
+    {
+        swapAB(Lp0, Lp1, Lptemp);
+        minLp0cost = minLp1cost;
+        minLp1cost = IMA_STWUS_INF;
+        cost += costinc;
+        aggr += costinc;
+        w = wtable[*grad];
+        grad += gradinc;
+
+        c4 = minLp0cost + P2;
+        if (c4 > IMA_STWUS_INF)     c4 = IMA_STWUS_INF;
+        for (d = 0;d < dstride;d++)
+        {
+            c0 = Lp0[d];
+            c1 = Lp0[d-1];
+            c2 = Lp0[d+1];
+            c3 = ((c1 < c2) ? c1 : c2) + P1;
+            if (c3 > IMA_STWUS_INF)     c3 = IMA_STWUS_INF;
+            if (c0 > c4)    c0 = c4;
+            c5 = ((c3 < c0) ? c3 : c0) - minLp0cost;
+            c5 = (w*c5) >> IMA_STI_Q_WEIGHT;
+
+            Lp1cost = cost[d] + c5;
+            if (Lp1cost > IMA_STWUS_INF)    Lp1cost = IMA_STWUS_INF;
+            Lp1[d] = (ushort)Lp1cost;
+            if (accum)
+            {
+                c5 += aggr[d];
+                aggr[d] = (ushort)((c5 > IMA_STWUS_INF) ? IMA_STWUS_INF : c5);
+            }
+            else
+            {
+                aggr[d] = (ushort)Lp1cost;
+            }
+            if (Lp1cost < minLp1cost)   minLp1cost = Lp1cost;
+        }
+    }
+
+    return;
+}
+#endif
+
+void StaDsiPadUshort(IN ushort *dsi, 
+                     IN int num, 
+                     IN int dlength, 
+                     IN int dstride, 
+                     OUT ushort *paddsi)
+{
+    int i, d;
+
+    for (i = 0;i < num;i++, dsi += dlength, paddsi += dstride)
+    {
+        memcpy(paddsi, dsi, dlength*sizeof(ushort));
+        for (d = dlength;d < dstride;d++)
+        {
+            paddsi[d] = IMA_STWUS_INF;
+        }
+    }
+
+    return;
+}
+
 #ifdef __cplusplus
 }
 #endif /* end of __cplusplus */
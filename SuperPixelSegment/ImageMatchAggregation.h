@@ -189,6 +189,89 @@ extern void StaLineSgmaggrUshortXdy(IN ushort *imagecost,
                                     INOUT ushort *minLp,
                                     INOUT ushort *LpBuf);
 
+extern void ImaScanTreeUshortAggrProcRange(IN ushort *imagecost,
+                                           IN ushort *dmin,
+                                           IN ushort *dnum,
+                                           IN int *doff,
+                                           IN int height,
+                                           IN int width,
+                                           IN int dlength,
+                                           IN ushort P1,
+                                           IN ushort P2,
+                                           OUT ushort *smoothcost,
+                                           INOUT ushort *LpBuf);
+extern void StaLineSgmaggrUshortRange(IN ushort *imagecost,
+                                      IN ushort *dmin,
+                                      IN ushort *dnum,
+                                      IN int *doff,
+                                      IN int height,
+                                      IN int width,
+                                      IN int dlength,
+                                      IN int line,
+                                      IN int begin,
+                                      IN ushort P1,
+                                      IN ushort P2,
+                                      OUT ushort *aggrcost,
+                                      INOUT ushort *LpBuf);
+
+
+/* Eadpɨ(16λ): ӲάSIMD, /֮䲢, ImaScanTreeIntInfoһ */
+#define IMA_STWUS_DALIGN            8       // Ӳά(һSSEĴ8ushort)
+#define IMA_STWUS_BUFOFF            8       // LpǰһĴ
+#define IMA_STWUS_INF               0xFFFF  // ޷űµ
+
+typedef struct tagImaScanTreeWgtUshortInfo
+{
+    // ⲿϢ
+    int height;
+    int width;
+    int dlength;
+    ushort *imagecost;  // (ÿdlength)
+    IMAGE32_S *Gx;
+    IMAGE32_S *Gy;
+
+    // 
+    floatcost sg;       // spatial(geo) sigma
+    floatcost sc;       // range(color) sigma
+    ushort P1;
+    ushort P2;
+
+    // ڲϢ
+    int dstride;        // ÿصӲ, smoothcostdstride
+    ushort *padcost;    // Ĵ, 벿ΪIMA_STWUS_INF
+    ushort *smoothcost;
+    ushort *SoBuf;
+
+    // ʱڴ
+    int wtablelen;
+    ushort *wtable;
+    int Lpwidth;        // ÿɨLp0/Lp1ĳ
+    ushort *LpBuf;      // ÿ()һ, ɲ
+
+}ImaScanTreeWgtUshortInfo;
+
+extern void ImaScanTreeWgtUshortAggrPara(ImaScanTreeWgtUshortInfo *aggr);
+extern void ImaScanTreeWgtUshortAggrInit(ImaScanTreeWgtUshortInfo *aggr);
+extern void ImaScanTreeWgtUshortAggrDestroy(ImaScanTreeWgtUshortInfo *aggr);
+extern void ImaScanTreeWgtUshortAggrProc(INOUT ImaScanTreeWgtUshortInfo *aggr);
+extern void StaLineDpaggrUshort(IN ushort *imagecost, 
+                                IN int costinc, 
+                                IN int *grad, 
+                                IN int gradinc, 
+                                IN ushort *wtable, 
+                                IN int num, 
+                                IN int dstride, 
+                                IN ushort P1,
+                                IN ushort P2,
+                                IN int accum,
+                                OUT ushort *aggrcost, 
+                                INOUT ushort *LpBuf);
+extern void StaDsiPadUshort(IN ushort *dsi, 
+                            IN int num, 
+                            IN int dlength, 
+                            IN int dstride, 
+                            OUT ushort *paddsi);
+
 
 #ifdef __cplusplus
 }
@@ -26,19 +26,23 @@ extern "C"{
 #include "string.h"
 #include "ImageMatchCost.h"
 
-void ImcPaperCensusInt(IN IMAGE_S *imageL,
-                       IN IMAGE_S *imageR,
-                       IN int dlength,
-                       IN int cw,
-                       IN int ch,
-                       OUT int *mcost,
-                       OUT int *pixeldsi)
+#ifdef PLATFORM_SSE
+#include <nmmintrin.h>
+#endif
+
+int ImcPaperCensusInt(IN IMAGE_S *imageL,
+                      IN IMAGE_S *imageR,
+                      IN int dlength,
+                      IN int cw,
+                      IN int ch,
+                      OUT int *mcost,
+                      OUT int *pixeldsi)
 {
     int height = imageL->height;
     int width = imageL->width;
     int channel = imageL->channel;
 
-    int maxcost;
+    int maxcost, ret;
     IMAGE_S imageLg, imageRg;
     IMAGE_S *srcL, *srcR;
 
@@ -62,7 +66,7 @@ void ImcPaperCensusInt(IN IMAGE_S *imageL,
     }
 
 	// ƥֵ: Census
-    ImcImageCensusInt(srcL, srcR, cw, ch, dlength, pixeldsi);
+    ret = ImcImageCensusInt(srcL, srcR, cw, ch, dlength, pixeldsi);
 
     if (channel != 1)
     {
@@ -70,7 +74,7 @@ void ImcPaperCensusInt(IN IMAGE_S *imageL,
         FreeType(imageRg.data, PIXEL, height*width);
     }
 
-    return;
+    return ret;
 }
 #if 0
 void ImcImageCensusInt(IN IMAGE_S *imageL, 
@@ -176,112 +180,438 @@ void ImcImageCensusInt(IN IMAGE_S *imageL,
     return;
 }
 #else
-void CensusCostInt(IN IMAGE32_S *censusL32, 
-                   IN IMAGE32_S *censusR32,
-                   IN int dlength,
-                   OUT int *imagedsi)
+// Censusλ(ĵ), 7x9/9x7Ϊ62λ
+#define IMC_CENSUS_MAXBIT           64
+// л, SSEһδ16
+#define IMC_CENSUS_ALIGN            16
+
+#ifdef PLATFORM_SSE
+#define IMC_POPCNT32(x)             _mm_popcnt_u32((unsigned int)(x))
+#elif defined PLATFORM_CCS
+#define IMC_POPCNT32(x)             _dotpu4(_bitc4(x), 0x01010101)
+#else
+#define IMC_POPCNT32(x)             BitCountU32((int)(x))
+#endif
+#define IMC_POPCNT64(x)             (IMC_POPCNT32((unit32)(x)) + IMC_POPCNT32((unit32)((unit64)(x) >> 32)))
+
+/******************************************************************************
+    Func Name: CensusPadRow
+     Function: Ʊ߽չһ, תλԱʹзűȽ
+        Input: IN PIXEL *src, Դͼ
+               IN int width, ͼ
+               IN int padwidth, չ
+               IN int cwx, ڰ
+       Output: OUT PIXEL *dst, չ
+******************************************************************************/
+static void CensusPadRow(IN PIXEL *src,
+                         IN int width,
+                         IN int padwidth,
+                         IN int cwx,
+                         OUT PIXEL *dst)
 {
-    int width = censusL32->width;
-    int height = censusL32->height;
-    int *CL = censusL32->data;
-    int *CR = censusR32->data;
-    int maxdisp = dlength - 1;
+    int x;
+    PIXEL left = src[0] ^ 0x80;
+    PIXEL right = src[width-1] ^ 0x80;
 
-    int y, x, d;
-    int maxd;
-	int *pdsi;
-    int borderval;
-    int cl, cr, temp;
+    for (x = 0;x < cwx;x++)
+    {
+        dst[x] = left;
+    }
+    for (x = 0;x < width;x++)
+    {
+        dst[cwx+x] = src[x] ^ 0x80;
+    }
+    for (x = cwx+width;x < padwidth;x++)
+    {
+        dst[x] = right;
+    }
 
-#ifdef PLATFORM_CCS
-    mix32 bitcount;
-    unit8 *ui8 = bitcount.ui8; 
-#endif
+    return;
+}
+
+/******************************************************************************
+    Func Name: CensusRow
+     Function: һصCensus(شʱ1, ĵ)
+        Input: IN PIXEL **rows, ڸеչл
+               IN int width, ͼ
+               IN int cwx, ڰ
+               IN int cwy, ڰ
+               IN int flag64, 1: 64λCensus, 0: 32λCensus
+       Output: OUT void *census, int64int͵Census
+******************************************************************************/
+static void CensusRow(IN PIXEL **rows,
+                      IN int width,
+                      IN int cwx,
+                      IN int cwy,
+                      IN int flag64,
+                      OUT void *census)
+{
+    int wx = 2*cwx+1;
+    int wy = 2*cwy+1;
+    int x, i, j, k;
 
-	pdsi = imagedsi;
-    for (y = 0;y < height;y++, CL += width, CR += width)
+#ifdef PLATFORM_SSE
+    __m128i plane[8];
+    __m128i bitmask[8];
+    __m128i c, n, m;
+    __m128i a0, a1, b0, b1, c0, c1, c2, c3;
+    __m128i e0, e1, f0, f1, g0, g1, g2, g3;
+    __m128i *dst;
+
+    for (k = 0;k < 8;k++)
     {
-        for (x = 0;x < width;x++, pdsi += dlength)
-        {
-            maxd = (x < maxdisp) ? x : maxdisp;
+        bitmask[k] = _mm_set1_epi8((char)(1 << k));
+    }
 
-            // Ǳ߽
-            cl = CL[x];
-            for (d = 0;d <= maxd;d++)
+    for (x = 0;x < width;x += IMC_CENSUS_ALIGN)
+    {
+        // ÿ8Ϊһλƽ, 16زбȽ
+        for (k = 0;k < 8;k++)
+        {
+            plane[k] = _mm_setzero_si128();
+        }
+        c = _mm_loadu_si128((__m128i *)(rows[cwy] + cwx + x));
+        k = 0;
+        for (i = 0;i < wy;i++)
+        {
+            for (j = 0;j < wx;j++)
             {
-                cr = CR[x - d];
-                temp = cl ^ cr;
+                if (i == cwy && j == cwx)   continue;
 
-#ifdef PLATFORM_SSE
-                pdsi[d] = _mm_popcnt_u32(temp);
-#elif defined PLATFORM_CCS
-                bitcount.ui32 = _bitc4(temp);
-                pdsi[d] = ui8[0] + ui8[1] + ui8[2] + ui8[3];
-#else
-                pdsi[d] = BitCountU32(temp);
-#endif
+                n = _mm_loadu_si128((__m128i *)(rows[i] + j + x));
+                m = _mm_cmpgt_epi8(n, c);
+                plane[k>>3] = _mm_or_si128(plane[k>>3], _mm_and_si128(m, bitmask[k&7]));
+                k++;
             }
+        }
+
+        // λƽת: ֽ0-3 -> ÿص32λ
+        a0 = _mm_unpacklo_epi8(plane[0], plane[1]);
+        a1 = _mm_unpackhi_epi8(plane[0], plane[1]);
+        b0 = _mm_unpacklo_epi8(plane[2], plane[3]);
+        b1 = _mm_unpackhi_epi8(plane[2], plane[3]);
+        c0 = _mm_unpacklo_epi16(a0, b0);
+        c1 = _mm_unpackhi_epi16(a0, b0);
+        c2 = _mm_unpacklo_epi16(a1, b1);
+        c3 = _mm_unpackhi_epi16(a1, b1);
 
-            // ߽
-            borderval = pdsi[maxd];
-            for (d = maxd+1;d < dlength;d++)
+        if (flag64)
+        {
+            // ֽ4-7 -> ÿظ32λ
+            e0 = _mm_unpacklo_epi8(plane[4], plane[5]);
+            e1 = _mm_unpackhi_epi8(plane[4], plane[5]);
+            f0 = _mm_unpacklo_epi8(plane[6], plane[7]);
+            f1 = _mm_unpackhi_epi8(plane[6], plane[7]);
+            g0 = _mm_unpacklo_epi16(e0, f0);
+            g1 = _mm_unpackhi_epi16(e0, f0);
+            g2 = _mm_unpacklo_epi16(e1, f1);
+            g3 = _mm_unpackhi_epi16(e1, f1);
+
+            dst = (__m128i *)((int64 *)census + x);
+            _mm_store_si128(dst + 0, _mm_unpacklo_epi32(c0, g0));
+            _mm_store_si128(dst + 1, _mm_unpackhi_epi32(c0, g0));
+            _mm_store_si128(dst + 2, _mm_unpacklo_epi32(c1, g1));
+            _mm_store_si128(dst + 3, _mm_unpackhi_epi32(c1, g1));
+            _mm_store_si128(dst + 4, _mm_unpacklo_epi32(c2, g2));
+            _mm_store_si128(dst + 5, _mm_unpackhi_epi32(c2, g2));
+            _mm_store_si128(dst + 6, _mm_unpacklo_epi32(c3, g3));
+            _mm_store_si128(dst + 7, _mm_unpackhi_epi32(c3, g3));
+        }
+        else
+        {
+            dst = (__m128i *)((int *)census + x);
+            _mm_store_si128(dst + 0, c0);
+            _mm_store_si128(dst + 1, c1);
+            _mm_store_si128(dst + 2, c2);
+            _mm_store_si128(dst + 3, c3);
+        }
+    }
+#else
+    signed char cur;
+    unit64 val, mask;
+
+    for (x = 0;x < width;x++)
+    {
+        cur = (signed char)rows[cwy][cwx+x];
+        val = 0;
+        mask = 1;
+        for (i = 0;i < wy;i++)
+        {
+            for (j = 0;j < wx;j++)
             {
-                pdsi[d] = borderval;
+                if (i == cwy && j == cwx)   continue;
+
+                if ((signed char)rows[i][j+x] > cur)    val |= mask;
+                mask <<= 1;
             }
         }
+
+        if (flag64)     ((int64 *)census)[x] = (int64)val;
+        else            ((int *)census)[x] = (int)val;
     }
+#endif
+
     return;
 }
 
-void ImcImageCensusInt(IN IMAGE_S *imageL, 
-                       IN IMAGE_S *imageR, 
-                       IN int cwx,
-                       IN int cwy,
-                       IN int dlength,
-                       OUT int *imagedsi)
+// ͼCensusл
+typedef struct tagImcCensusRing
+{
+    int height;
+    int width;
+    int cwx;
+    int cwy;
+    int wy;
+    int width16;
+    int padwidth;
+    int flag64;
+    IMAGE_S *image[2];
+
+    PIXEL *buf[2];
+    PIXEL **rows[2];
+    int64 *census[2];
+
+}ImcCensusRing;
+
+/******************************************************************************
+    Func Name: CensusRingInit
+     Function: 봰л沢д(ϱ߽縴)
+        Input: IN IMAGE_S *imageL, Ҷͼ
+               IN IMAGE_S *imageR, һҶͼ
+               IN int cwx, ڰ
+               IN int cwy, ڰ
+       Output: OUT ImcCensusRing *ring, л
+       Return: ڳ64λʱ0
+******************************************************************************/
+static int CensusRingInit(OUT ImcCensusRing *ring,
+                          IN IMAGE_S *imageL,
+                          IN IMAGE_S *imageR,
+                          IN int cwx,
+                          IN int cwy)
 {
-    int width = imageL->width;
     int height = imageL->height;
+    int width = imageL->width;
+    int wy = 2*cwy+1;
+    int width16 = (width + IMC_CENSUS_ALIGN-1) & ~(IMC_CENSUS_ALIGN-1);
+    int padwidth = width16 + 2*cwx;
+    int bit = (2*cwx+1)*(2*cwy+1)-1;
+    int i, k, sy;
 
-    int bit, flag64;
-    IMAGE64_S censusL64, censusR64;
-    IMAGE32_S censusL32, censusR32;
+    if (bit > IMC_CENSUS_MAXBIT)
+    {
+        printf("ImcImageCensus error!\n");
+        return 0;
+    }
 
-    bit = (2*cwx+1)*(2*cwy+1);
-    if (bit >= 32)  flag64 = 1;
-    else            flag64 = 0;
+    ring->height = height;
+    ring->width = width;
+    ring->cwx = cwx;
+    ring->cwy = cwy;
+    ring->wy = wy;
+    ring->width16 = width16;
+    ring->padwidth = padwidth;
+    ring->flag64 = (bit > 32) ? 1 : 0;
+    ring->image[0] = imageL;
+    ring->image[1] = imageR;
+
+    for (k = 0;k < 2;k++)
+    {
+        ring->buf[k] = mm_MallocType(PIXEL, wy*padwidth);
+        ring->rows[k] = MallocType(PIXEL *, wy);
+        ring->census[k] = mm_MallocType(int64, width16);
 
-    // Census任
-    if (flag64)
+        for (i = 0;i < wy;i++)
+        {
+            sy = i - cwy;
+            sy = (sy < 0) ? 0 : ((sy > height-1) ? height-1 : sy);
+            ring->rows[k][i] = ring->buf[k] + i*padwidth;
+            CensusPadRow(ring->image[k]->data + sy*width, width, padwidth, cwx, ring->rows[k][i]);
+        }
+    }
+
+    return 1;
+}
+
+/******************************************************************************
+    Func Name: CensusRingRow
+     Function: yеCensus, y0ʼе
+        Input: INOUT ImcCensusRing *ring, л
+               IN int y, ǰ
+       Output: ring->census[0], ring->census[1]
+******************************************************************************/
+static void CensusRingRow(INOUT ImcCensusRing *ring, IN int y)
+{
+    int wy = ring->wy;
+    int i, k, sy;
+    PIXEL **rows;
+    PIXEL *temp;
+
+    for (k = 0;k < 2;k++)
     {
-        censusL64.data = MallocType(int64, height*width);
-        censusR64.data = MallocType(int64, height*width);
-        ImageCensus(imageL, &censusL64, cwx, cwy);
-        ImageCensus(imageR, &censusR64, cwx, cwy);
+        rows = ring->rows[k];
+
+        // л: Ƴ, y+cwy(±߽縴ĩ)
+        if (y > 0)
+        {
+            temp = rows[0];
+            for (i = 0;i < wy-1;i++)
+            {
+                rows[i] = rows[i+1];
+            }
+            rows[wy-1] = temp;
+
+            sy = y + ring->cwy;
+            sy = (sy > ring->height-1) ? ring->height-1 : sy;
+            CensusPadRow(ring->image[k]->data + sy*ring->width, ring->width, ring->padwidth, ring->cwx, temp);
+        }
+
+        CensusRow(rows, ring->width, ring->cwx, ring->cwy, ring->flag64, ring->census[k]);
     }
-    else
+
+    return;
+}
+
+static void CensusRingDestroy(INOUT ImcCensusRing *ring)
+{
+    int k;
+
+    for (k = 0;k < 2;k++)
     {
-        censusL32.data = MallocType(int, height*width);
-        censusR32.data = MallocType(int, height*width);
-        ImageCensus32(imageL, &censusL32, cwx, cwy);
-        ImageCensus32(imageR, &censusR32, cwx, cwy);
+        mm_FreeType(ring->buf[k], PIXEL, ring->wy*ring->padwidth);
+        FreeType(ring->rows[k], PIXEL *, ring->wy);
+        mm_FreeType(ring->census[k], int64, ring->width16);
     }
 
-    CensusCostInt(&censusL32, &censusR32, dlength, imagedsi);
+    return;
+}
 
-    if (flag64)
+static void CensusCostRowInt(IN void *censusL,
+                             IN void *censusR,
+                             IN int width,
+                             IN int dlength,
+                             IN int flag64,
+                             OUT int *pdsi);
+static void CensusCostRowUshort(IN void *censusL,
+                                IN void *censusR,
+                                IN int width,
+                                IN int dlength,
+                                IN int flag64,
+                                OUT ushort *pdsi);
+
+/******************************************************************************
+    Func Name: CensusCostFused
+     Function: мCensusֱде(x, d)ƥ, 
+               л, CensusͼӲľͼ
+        Input: IN IMAGE_S *imageL, Ҷͼ
+               IN IMAGE_S *imageR, һҶͼ
+               IN int cwx, ڰ
+               IN int cwy, ڰ
+               IN int dlength, ӲΧ
+       Output: OUT int *dsiint, intƥ(dsiushortѡһ)
+               OUT ushort *dsiushort, ushortƥ
+       Return: ɹTRUE, ڳ64λʱFALSE(δ)
+******************************************************************************/
+static int CensusCostFused(IN IMAGE_S *imageL,
+                           IN IMAGE_S *imageR,
+                           IN int cwx,
+                           IN int cwy,
+                           IN int dlength,
+                           OUT int *dsiint,
+                           OUT ushort *dsiushort)
+{
+    int width = imageL->width;
+    int height = imageL->height;
+    int widthd = width*dlength;
+
+    int y;
+    ImcCensusRing ring;
+
+    if (!CensusRingInit(&ring, imageL, imageR, cwx, cwy))   return FALSE;
+
+    for (y = 0;y < height;y++)
     {
-        FreeType(censusL64.data, int64, height*width);
-        FreeType(censusR64.data, int64, height*width);
+        // Census任
+        CensusRingRow(&ring, y);
+
+        // ƥֵ
+        if (dsiint != NULL)
+        {
+            CensusCostRowInt(ring.census[0], ring.census[1], width, dlength, ring.flag64, dsiint + y*widthd);
+        }
+        else
+        {
+            CensusCostRowUshort(ring.census[0], ring.census[1], width, dlength, ring.flag64, dsiushort + y*widthd);
+        }
     }
-    else
+
+    CensusRingDestroy(&ring);
+
+    return TRUE;
+}
+
+static void CensusCostRowInt(IN void *censusL,
+                             IN void *censusR,
+                             IN int width,
+                             IN int dlength,
+                             IN int flag64,
+                             OUT int *pdsi)
+{
+    int maxdisp = dlength - 1;
+    int *CL32 = (int *)censusL;
+    int *CR32 = (int *)censusR;
+    int64 *CL64 = (int64 *)censusL;
+    int64 *CR64 = (int64 *)censusR;
+
+    int x, d;
+    int maxd;
+    int borderval;
+    int cl32, temp32;
+    int64 cl64, temp64;
+
+    for (x = 0;x < width;x++, pdsi += dlength)
     {
-        FreeType(censusL32.data, int64, height*width);
-        FreeType(censusR32.data, int64, height*width);
+        maxd = (x < maxdisp) ? x : maxdisp;
+
+        // Ǳ߽
+        if (flag64)
+        {
+            cl64 = CL64[x];
+            for (d = 0;d <= maxd;d++)
+            {
+                temp64 = cl64 ^ CR64[x - d];
+                pdsi[d] = IMC_POPCNT64(temp64);
+            }
+        }
+        else
+        {
+            cl32 = CL32[x];
+            for (d = 0;d <= maxd;d++)
+            {
+                temp32 = cl32 ^ CR32[x - d];
+                pdsi[d] = IMC_POPCNT32(temp32);
+            }
+        }
+
+        // ߽
+        borderval = pdsi[maxd];
+        for (d = maxd+1;d < dlength;d++)
+        {
+            pdsi[d] = borderval;
+        }
     }
 
     return;
 }
+
+int ImcImageCensusInt(IN IMAGE_S *imageL, 
+                      IN IMAGE_S *imageR, 
+                      IN int cwx,
+                      IN int cwy,
+                      IN int dlength,
+                      OUT int *imagedsi)
+{
+    return CensusCostFused(imageL, imageR, cwx, cwy, dlength, imagedsi, NULL);
+}
 #endif
 
 // leftͼϵcost任rightͼ
@@ -378,19 +708,20 @@ void ImcDsiReverseInt(IN int *dsi,
     return;
 }
 
-void ImcPaperCensusUshort(IN IMAGE_S *imageL,
-                          IN IMAGE_S *imageR,
-                          IN int dlength,
-                          IN int cw,
-                          IN int ch,
-                          OUT ushort *mcost,
-                          OUT ushort *pixeldsi)
+int ImcPaperCensusUshort(IN IMAGE_S *imageL,
+                         IN IMAGE_S *imageR,
+                         IN int dlength,
+                         IN int cw,
+                         IN int ch,
+                         OUT ushort *mcost,
+                         OUT ushort *pixeldsi)
 {
     int height = imageL->height;
     int width = imageL->width;
     int channel = imageL->channel;
 
     ushort maxcost;
+    int ret;
     IMAGE_S imageLg, imageRg;
     IMAGE_S *srcL, *srcR;
 
@@ -414,7 +745,7 @@ void ImcPaperCensusUshort(IN IMAGE_S *imageL,
     }
 
 	// ƥֵ: Census
-    ImcImageCensusUshort(srcL, srcR, cw, ch, dlength, pixeldsi);
+    ret = ImcImageCensusUshort(srcL, srcR, cw, ch, dlength, pixeldsi);
 
     if (channel != 1)
     {
@@ -422,7 +753,7 @@ void ImcPaperCensusUshort(IN IMAGE_S *imageL,
         FreeType(imageRg.data, PIXEL, height*width);
     }
 
-    return;
+    return ret;
 }
 
 #if 0
@@ -529,112 +860,145 @@ void ImcImageCensusUshort(IN IMAGE_S *imageL,
     return;
 }
 #else
-void CensusCostUshort(IN IMAGE32_S *censusL32, 
-                      IN IMAGE32_S *censusR32,
-                      IN int dlength,
-                      OUT ushort *imagedsi)
+static void CensusCostRowUshort(IN void *censusL,
+                                IN void *censusR,
+                                IN int width,
+                                IN int dlength,
+                                IN int flag64,
+                                OUT ushort *pdsi)
 {
-    int width = censusL32->width;
-    int height = censusL32->height;
-    int *CL = censusL32->data;
-    int *CR = censusR32->data;
     int maxdisp = dlength - 1;
+    int *CL32 = (int *)censusL;
+    int *CR32 = (int *)censusR;
+    int64 *CL64 = (int64 *)censusL;
+    int64 *CR64 = (int64 *)censusR;
 
-    int y, x, d;
+    int x, d;
     int maxd;
-	ushort *pdsi;
     ushort borderval;
-    int cl, cr, temp;
-
-#ifdef PLATFORM_CCS
-    mix32 bitcount;
-    unit8 *ui8 = bitcount.ui8; 
-#endif
+    int cl32, temp32;
+    int64 cl64, temp64;
 
-	pdsi = imagedsi;
-    for (y = 0;y < height;y++, CL += width, CR += width)
+    for (x = 0;x < width;x++, pdsi += dlength)
     {
-        for (x = 0;x < width;x++, pdsi += dlength)
-        {
-            maxd = (x < maxdisp) ? x : maxdisp;
+        maxd = (x < maxdisp) ? x : maxdisp;
 
-            // Ǳ߽
-            cl = CL[x];
+        // Ǳ߽
+        if (flag64)
+        {
+            cl64 = CL64[x];
             for (d = 0;d <= maxd;d++)
             {
-                cr = CR[x - d];
-                temp = cl ^ cr;
-
-#ifdef PLATFORM_SSE
-                pdsi[d] = (ushort)_mm_popcnt_u32(temp);
-#elif defined PLATFORM_CCS
-                bitcount.ui32 = _bitc4(temp);
-                pdsi[d] = ui8[0] + ui8[1] + ui8[2] + ui8[3];
-#else
-                pdsi[d] = (ushort)BitCountU32(temp);
-#endif
+                temp64 = cl64 ^ CR64[x - d];
+                pdsi[d] = (ushort)IMC_POPCNT64(temp64);
             }
-
-            // ߽
-            borderval = pdsi[maxd];
-            for (d = maxd+1;d < dlength;d++)
+        }
+        else
+        {
+            cl32 = CL32[x];
+            for (d = 0;d <= maxd;d++)
             {
-                pdsi[d] = borderval;
+                temp32 = cl32 ^ CR32[x - d];
+                pdsi[d] = (ushort)IMC_POPCNT32(temp32);
             }
         }
+
+        // ߽
+        borderval = pdsi[maxd];
+        for (d = maxd+1;d < dlength;d++)
+        {
+            pdsi[d] = borderval;
+        }
     }
 
     return;
 }
 
-void ImcImageCensusUshort(IN IMAGE_S *imageL, 
-                          IN IMAGE_S *imageR, 
-                          IN int cwx,
-                          IN int cwy,
-                          IN int dlength,
-                          OUT ushort *imagedsi)
+int ImcImageCensusUshort(IN IMAGE_S *imageL, 
+                         IN IMAGE_S *imageR, 
+                         IN int cwx,
+                         IN int cwy,
+                         IN int dlength,
+                         OUT ushort *imagedsi)
+{
+    return CensusCostFused(imageL, imageR, cwx, cwy, dlength, NULL, imagedsi);
+}
+
+/******************************************************************************
+    Func Name: ImcImageCensusRangeUshort
+     Function: ÿصӲ[dmin, dmin+dnum)ڼCensusƥ,
+               յı䳤, pĴλrangecost + doff[p]
+        Input: IN IMAGE_S *imageL, Ҷͼ
+               IN IMAGE_S *imageR, һҶͼ
+               IN int cwx, ڰ
+               IN int cwy, ڰ
+               IN int view, 0: ͼΪο, 1: ͼΪο
+               IN ushort *dmin, ÿصʼӲ
+               IN ushort *dnum, ÿصӲ
+               IN int *doff, ÿڽմеƫ
+       Output: OUT ushort *rangecost, մ
+       Return: ɹTRUE, ڳ64λʱFALSE
+******************************************************************************/
+int ImcImageCensusRangeUshort(IN IMAGE_S *imageL,
+                              IN IMAGE_S *imageR,
+                              IN int cwx,
+                              IN int cwy,
+                              IN int view,
+                              IN ushort *dmin,
+                              IN ushort *dnum,
+                              IN int *doff,
+                              OUT ushort *rangecost)
 {
     int width = imageL->width;
     int height = imageL->height;
 
-    int bit, flag64;
-    IMAGE64_S censusL64, censusR64;
-    IMAGE32_S censusL32, censusR32;
+    int y, x, d, k, n;
+    int p, dc, maxd;
+    ushort *pcost;
+    ImcCensusRing ring;
+    int *CL32, *CR32;
+    int64 *CL64, *CR64;
+    int temp32;
+    int64 temp64;
 
-    bit = (2*cwx+1)*(2*cwy+1);
-    if (bit >= 32)  flag64 = 1;
-    else            flag64 = 0;
+    if (!CensusRingInit(&ring, imageL, imageR, cwx, cwy))   return FALSE;
 
-    // Census任
-    if (flag64)
-    {
-        censusL64.data = MallocType(int64, height*width);
-        censusR64.data = MallocType(int64, height*width);
-        ImageCensus(imageL, &censusL64, cwx, cwy);
-        ImageCensus(imageR, &censusR64, cwx, cwy);
-    }
-    else
-    {
-        censusL32.data = MallocType(int, height*width);
-        censusR32.data = MallocType(int, height*width);
-        ImageCensus32(imageL, &censusL32, cwx, cwy);
-        ImageCensus32(imageR, &censusR32, cwx, cwy);
-    }
-
-    CensusCostUshort(&censusL32, &censusR32, dlength, imagedsi);
+    CL32 = (int *)ring.census[0];
+    CR32 = (int *)ring.census[1];
+    CL64 = ring.census[0];
+    CR64 = ring.census[1];
 
-    if (flag64)
+    for (y = 0, p = 0;y < height;y++)
     {
-        FreeType(censusL64.data, int64, height*width);
-        FreeType(censusR64.data, int64, height*width);
-    }
-    else
-    {
-        FreeType(censusL32.data, int64, height*width);
-        FreeType(censusR32.data, int64, height*width);
+        CensusRingRow(&ring, y);
+
+        for (x = 0;x < width;x++, p++)
+        {
+            // ͼӲƱ߽
+            maxd = (view == 0) ? x : (width-1-x);
+            pcost = rangecost + doff[p];
+            n = dnum[p];
+            for (k = 0, d = dmin[p];k < n;k++, d++)
+            {
+                dc = (d > maxd) ? maxd : d;
+
+                if (ring.flag64)
+                {
+                    temp64 = (view == 0) ? (CL64[x] ^ CR64[x-dc]) : (CL64[x+dc] ^ CR64[x]);
+                    pcost[k] = (ushort)IMC_POPCNT64(temp64);
+                }
+                else
+                {
+                    temp32 = (view == 0) ? (CL32[x] ^ CR32[x-dc]) : (CL32[x+dc] ^ CR32[x]);
+                    pcost[k] = (ushort)IMC_POPCNT32(temp32);
+                }
+            }
+        }
     }
 
-    return;
+    CensusRingDestroy(&ring);
+
+    return TRUE;
 }
 #endif
 
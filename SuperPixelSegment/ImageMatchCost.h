@@ -32,20 +32,20 @@ extern "C"{
 #include "ImageColor.h"
 #include "ImageCensus.h"
 
-extern void ImcPaperCensusInt(IN IMAGE_S *imageL,
-                              IN IMAGE_S *imageR,
-                              IN int dlength,
-                              IN int cw,
-                              IN int ch,
-                              OUT int *mcost,
-                              OUT int *pixeldsi);
+extern int ImcPaperCensusInt(IN IMAGE_S *imageL,
+                             IN IMAGE_S *imageR,
+                             IN int dlength,
+                             IN int cw,
+                             IN int ch,
+                             OUT int *mcost,
+                             OUT int *pixeldsi);
 
-extern void ImcImageCensusInt(IN IMAGE_S *imageL, 
-                              IN IMAGE_S *imageR, 
-                              IN int cwx,
-                              IN int cwy,
-                              IN int dlength,
-                              OUT int *imagedsi);
+extern int ImcImageCensusInt(IN IMAGE_S *imageL, 
+                             IN IMAGE_S *imageR, 
+                             IN int cwx,
+                             IN int cwy,
+                             IN int dlength,
+                             OUT int *imagedsi);
 
 extern void ImcDsiReverseInt(IN int *dsi, 
                              OUT int *invdsi, 
@@ -55,20 +55,30 @@ extern void ImcDsiReverseInt(IN int *dsi,
                              IN int bordercost,
                              IN int intp);
 
-extern void ImcPaperCensusUshort(IN IMAGE_S *imageL,
-                                 IN IMAGE_S *imageR,
-                                 IN int dlength,
-                                 IN int cw,
-                                 IN int ch,
-                                 OUT ushort *mcost,
-                                 OUT ushort *pixeldsi);
+extern int ImcPaperCensusUshort(IN IMAGE_S *imageL,
+                                IN IMAGE_S *imageR,
+                                IN int dlength,
+                                IN int cw,
+                                IN int ch,
+                                OUT ushort *mcost,
+                                OUT ushort *pixeldsi);
+
+extern int ImcImageCensusUshort(IN IMAGE_S *imageL, 
+                                IN IMAGE_S *imageR, 
+                                IN int cwx,
+                                IN int cwy,
+                                IN int dlength,
+                                OUT ushort *imagedsi);
 
-extern void ImcImageCensusUshort(IN IMAGE_S *imageL, 
-                                 IN IMAGE_S *imageR, 
-                                 IN int cwx,
-                                 IN int cwy,
-                                 IN int dlength,
-                                 OUT ushort *imagedsi);
+extern int ImcImageCensusRangeUshort(IN IMAGE_S *imageL,
+                                     IN IMAGE_S *imageR,
+                                     IN int cwx,
+                                     IN int cwy,
+                                     IN int view,
+                                     IN ushort *dmin,
+                                     IN ushort *dnum,
+                                     IN int *doff,
+                                     OUT ushort *rangecost);
 
 extern void ImcDsiReverseUshort(IN ushort *dsi, 
                                 OUT ushort *invdsi, 
@@ -29,6 +29,7 @@ void ImageMatchEadpPara(INOUT ImEadpInfo *eadp)
 {
     eadp->imagenum = 2;
     eadp->mode = 0;
+    eadp->fast = 0;     // 16λۺʽ
     eadp->guildmr = 1;
     eadp->dispmr = 2;
     eadp->sg = -1;
@@ -50,12 +51,9 @@ void ImageMatchEadpInit(INOUT ImEadpInfo *eadp)
     IMAGE32_S *Gx = eadp->Gx;
     IMAGE32_S *Gy = eadp->Gy;
     ImaScanTreeIntInfo *aggr = &eadp->aggr;
-    ImppInvalidInfo *invalid = &eadp->invalid;
 
     int i;
 
-    eadp->imagecost = mm_MallocType(int, height*width*dlength);
-
     for (i = 0;i < imagenum;i++)
     {
         filter[i].data = MallocType(PIXEL, area*channel);
@@ -74,16 +72,41 @@ void ImageMatchEadpInit(INOUT ImEadpInfo *eadp)
         Gy[i].channel = 1;
     }
 
-    ImaScanTreeIntAggrPara(aggr);
-    aggr->height = height;
-    aggr->width = width;
-    aggr->dlength = dlength;
-    aggr->mode = eadp->mode;
-    aggr->sg = eadp->sg;
-    aggr->sc = eadp->sc;
-    ImaScanTreeIntAggrInit(aggr);
+    // 16λɨۺֻһƽʽ, mode
+    if (eadp->fast && eadp->mode != 0)
+    {
+        printf("ImageMatchEadp error: mode %d is not supported with fast aggregation, use mode 0!\n", eadp->mode);
+        eadp->mode = 0;
+    }
 
-    ImppInvalidInit(invalid, area);
+    if (eadp->fast)
+    {
+        ImaScanTreeWgtUshortInfo *aggr16 = &eadp->aggr16;
+
+        ImaScanTreeWgtUshortAggrPara(aggr16);
+        aggr16->height = height;
+        aggr16->width = width;
+        aggr16->dlength = dlength;
+        aggr16->sg = eadp->sg;
+        aggr16->sc = eadp->sc;
+        ImaScanTreeWgtUshortAggrInit(aggr16);
+
+        // aggr16->SoBufСһ, ͼ۽
+        eadp->imagecost16 = mm_MallocType(ushort, area*aggr16->dstride);
+    }
+    else
+    {
+        eadp->imagecost = mm_MallocType(int, height*width*dlength);
+
+        ImaScanTreeIntAggrPara(aggr);
+        aggr->height = height;
+        aggr->width = width;
+        aggr->dlength = dlength;
+        aggr->mode = eadp->mode;
+        aggr->sg = eadp->sg;
+        aggr->sc = eadp->sc;
+        ImaScanTreeIntAggrInit(aggr);
+    }
 
     eadp->left = MallocType(PIXEL, area);
     eadp->right = MallocType(PIXEL, area);
@@ -95,44 +118,43 @@ void ImageMatchEadpInit(INOUT ImEadpInfo *eadp)
 }
 void ImageMatchEadpDestroy(INOUT ImEadpInfo *eadp)
 {
-    int imagenum = eadp->imagenum;
-    int dlength = eadp->dlength;
-    int height = eadp->height;
-    int width = eadp->width;
-    int channel = eadp->channel;
-    int area = height*width;
-
     IMAGE_S *filter = eadp->filter;
     IMAGE32_S *Gx = eadp->Gx;
     IMAGE32_S *Gy = eadp->Gy;
 
     int i;
 
-    mm_FreeType(eadp->imagecost, int, height*width*dlength);
-
-    for (i = 0;i < imagenum;i++)
+    for (i = 0;i < eadp->imagenum;i++)
     {
-        FreeType(filter[i].data, PIXEL, area*channel);
-        FreeType(Gx[i].data, int, area);
-        FreeType(Gy[i].data, int, area);
+        FreeType(filter[i].data, PIXEL, eadp->height*eadp->width*eadp->channel);
+        FreeType(Gx[i].data, int, eadp->height*eadp->width);
+        FreeType(Gy[i].data, int, eadp->height*eadp->width);
     }
 
-    ImaScanTreeIntAggrDestroy(&eadp->aggr);
-    ImppInvalidDestroy(&eadp->invalid, area);
+    if (eadp->fast)
+    {
+        mm_FreeType(eadp->imagecost16, ushort, eadp->height*eadp->width*eadp->aggr16.dstride);
+        ImaScanTreeWgtUshortAggrDestroy(&eadp->aggr16);
+    }
+    else
+    {
+        mm_FreeType(eadp->imagecost, int, eadp->height*eadp->width*eadp->dlength);
+        ImaScanTreeIntAggrDestroy(&eadp->aggr);
+    }
 
-    FreeType(eadp->left, PIXEL, area);
-    FreeType(eadp->right, PIXEL, area);
-    FreeType(eadp->sparse, PIXEL, area);
-    FreeType(eadp->fill, PIXEL, area);
-    FreeType(eadp->dense, PIXEL, area);
+    FreeType(eadp->left, PIXEL, eadp->height*eadp->width);
+    FreeType(eadp->right, PIXEL, eadp->height*eadp->width);
+    FreeType(eadp->sparse, PIXEL, eadp->height*eadp->width);
+    FreeType(eadp->fill, PIXEL, eadp->height*eadp->width);
+    FreeType(eadp->dense, PIXEL, eadp->height*eadp->width);
 
     return;
 }
 
-void ImageMatchEadpProc(INOUT ImEadpInfo *eadp)
+// ɹTRUE, CensusЧʱFALSE(Ӳδ)
+int ImageMatchEadpProc(INOUT ImEadpInfo *eadp)
 {
     ImaScanTreeIntInfo *aggr = &eadp->aggr;
-    ImppInvalidInfo *invalid = &eadp->invalid;
     
     IMAGE_S **src = eadp->src;
     IMAGE32_S *Gx = eadp->Gx;
@@ -149,8 +171,16 @@ void ImageMatchEadpProc(INOUT ImEadpInfo *eadp)
     // guild image
     EadpGradient(eadp);	// ָͼ
 
+    if (eadp->fast)
+    {
+        return ImageMatchEadpProcUshort(eadp);
+    }
+
     // cost
-    ImcPaperCensusInt(src[0], src[1], dlength, 2, 2, &maxcost, imagecost);
+    if (!ImcPaperCensusInt(src[0], src[1], dlength, 2, 2, &maxcost, imagecost))
+    {
+        return FALSE;
+    }
     aggr->P1 = round(eadp->r1*maxcost/dlength);
     aggr->P2 = round(eadp->r2*maxcost/dlength);
 
@@ -181,11 +211,66 @@ void ImageMatchEadpProc(INOUT ImEadpInfo *eadp)
     ImppOptimizeWtaPixel(aggr->smoothcost, dlength, area, eadp->right);
 
     // refine && fill
-    ImppLrCheckPixel(eadp->left, eadp->right, height, width, 1, eadp->sparse);
-    ImppBackgroundFillPixel(eadp->sparse, height, width, eadp->fill, invalid);
-    ImppMedianFilterPixel(eadp->fill, eadp->dense, height, width, eadp->dispmr);
+    ImppPostprocessFusedPixel(eadp->left, eadp->right, height, width, 1, eadp->dispmr, 
+                              eadp->sparse, eadp->fill, eadp->dense);
 
-    return;
+    return TRUE;
+}
+
+int ImageMatchEadpProcUshort(INOUT ImEadpInfo *eadp)
+{
+    ImaScanTreeWgtUshortInfo *aggr = &eadp->aggr16;
+
+    IMAGE_S **src = eadp->src;
+    IMAGE32_S *Gx = eadp->Gx;
+    IMAGE32_S *Gy = eadp->Gy;
+    ushort *imagecost = eadp->imagecost16;
+    int dlength = eadp->dlength;
+    int dstride = aggr->dstride;
+
+    int height = eadp->height;
+    int width = eadp->width;
+    int area = height*width;
+
+    ushort maxcost;
+
+    // cost: int汾ͬcensusͷ
+    if (!ImcPaperCensusUshort(src[0], src[1], dlength, 2, 2, &maxcost, imagecost))
+    {
+        return FALSE;
+    }
+    aggr->P1 = (ushort)round(eadp->r1*maxcost/dlength);
+    aggr->P2 = (ushort)round(eadp->r2*maxcost/dlength);
+
+    // cost aggr
+    aggr->imagecost = imagecost;
+    aggr->Gx = &Gx[0];
+    aggr->Gy = &Gy[0];
+    ImaScanTreeWgtUshortAggrProc(aggr);
+
+    // wta: ӲΪ, ᱻѡ
+    ImppOptimizeWta16Pixel(aggr->smoothcost, dstride, area, eadp->left);
+
+    // invcost
+    ImcDsiReverseUshort(imagecost, aggr->SoBuf, height, width, dlength, maxcost, 2);
+    eadp->imagecost16 = aggr->SoBuf;
+    aggr->SoBuf = imagecost;
+    imagecost = eadp->imagecost16;
+
+    // cost aggr
+    aggr->imagecost = imagecost;
+    aggr->Gx = &Gx[1];
+    aggr->Gy = &Gy[1];
+    ImaScanTreeWgtUshortAggrProc(aggr);
+
+    // wta
+    ImppOptimizeWta16Pixel(aggr->smoothcost, dstride, area, eadp->right);
+
+    // refine && fill
+    ImppPostprocessFusedPixel(eadp->left, eadp->right, height, width, 1, eadp->dispmr, 
+                              eadp->sparse, eadp->fill, eadp->dense);
+
+    return TRUE;
 }
 
 void EadpGradient(INOUT ImEadpInfo *eadp)
@@ -48,7 +48,8 @@ typedef struct tagImEadpInfo
     IMAGE_S *src[2];
 
     // 
-    int mode;
+    int mode;           // , intۺ·¼aggr.mode; fast·ûmode֧, ֻ֧0
+    int fast;           // 1: 16λSIMDоۺ, 0: intۺ
     int guildmr;        // guild image ֵ˲뾶
     int dispmr;         // labelֵ˲뾶
     float sg;
@@ -62,7 +63,8 @@ typedef struct tagImEadpInfo
     IMAGE32_S Gx[2];
     IMAGE32_S Gy[2];
     ImaScanTreeIntInfo aggr;
-    ImppInvalidInfo invalid;
+    ushort *imagecost16;            // aggr16.dstride
+    ImaScanTreeWgtUshortInfo aggr16;
 
     // Ӳ
     PIXEL *left;
@@ -76,7 +78,8 @@ typedef struct tagImEadpInfo
 extern void ImageMatchEadpPara(INOUT ImEadpInfo *eadp);
 extern void ImageMatchEadpInit(INOUT ImEadpInfo *eadp);
 extern void ImageMatchEadpDestroy(INOUT ImEadpInfo *eadp);
-extern void ImageMatchEadpProc(INOUT ImEadpInfo *eadp);
+extern int ImageMatchEadpProc(INOUT ImEadpInfo *eadp);
+extern int ImageMatchEadpProcUshort(INOUT ImEadpInfo *eadp);
 extern void EadpGradient(INOUT ImEadpInfo *eadp);
 extern void ImageGrayMedian3x3(IN IMAGE_S *src, OUT IMAGE_S *filter);
 extern void ImageColorMedian3x3(IN IMAGE_S *src, OUT IMAGE_S *filter);
@@ -29,6 +29,10 @@ extern "C"{
 //#include "ImageMedian3x3.h"
 #include "DataTypeConvert.h"
 
+#ifdef PLATFORM_SSE
+#include <smmintrin.h>
+#endif
+
 void ImppOptimizeWtaPixel(IN int *dsi, 
                           IN int dlength, 
                           IN int num, 
@@ -75,29 +79,162 @@ void ImppOptimizeWta(IN int *dsi,
     return;
 }
 
+/******************************************************************************
+    Func Name: WtaSubpixOne
+     Function: صWTA, ͬʱΨһԼ
+        Input: IN ushort *pdsi, صľۺϴ
+               IN int n, Ӳ
+               IN int uniqueness, ΨһԱ(ٷֱ), 0ʾ
+               IN int subpixel, 1: , 0: Ӳ
+       Output: 
+       Return: Ӳ(x IMPP_DISP_SCALE), ΨһԼʧʱIMPP_DISP16_INVALID
+      Caution: SSE8Ӳһ_mm_minpos_epu16Сֵλ, ʱȡСӲ,
+               ȽϵĽһ; СֵӲӲ
+******************************************************************************/
+static int WtaSubpixOne(IN ushort *pdsi, 
+                        IN int n, 
+                        IN int uniqueness, 
+                        IN int subpixel)
+{
+    int j, d, val, minv, sec;
+    int cm, cp, denom;
+#ifdef PLATFORM_SSE
+    __m128i v, vsec, vidx, vlo, vhi, mask;
+    const __m128i vstep = _mm_set1_epi16(8);
+#endif
+
+    // Сֵ
+    d = 0;
+    minv = 0x10000;
+    j = 0;
+#ifdef PLATFORM_SSE
+    for (;j+8 <= n;j += 8)
+    {
+        val = _mm_cvtsi128_si32(_mm_minpos_epu16(_mm_loadu_si128((__m128i *)(pdsi+j))));
+        if ((val & 0xFFFF) < minv)
+        {
+            minv = val & 0xFFFF;
+            d = j + ((val >> 16) & 7);
+        }
+    }
+#endif
+    for (;j < n;j++)
+    {
+        if (pdsi[j] < minv)
+        {
+            minv = pdsi[j];
+            d = j;
+        }
+    }
+
+    // ΨһԼ: СֵСֵ㹻ӽʱΪƥ䲻ɿ
+    if (uniqueness > 0)
+    {
+        sec = 0x10000;
+        j = 0;
+#ifdef PLATFORM_SSE
+        vsec = _mm_set1_epi16(-1);
+        vidx = _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7);
+        vlo = _mm_set1_epi16((short)(d-2));
+        vhi = _mm_set1_epi16((short)(d+2));
+        for (;j+8 <= n;j += 8, vidx = _mm_add_epi16(vidx, vstep))
+        {
+            v = _mm_loadu_si128((__m128i *)(pdsi+j));
+            mask = _mm_and_si128(_mm_cmpgt_epi16(vidx, vlo), _mm_cmplt_epi16(vidx, vhi));
+            vsec = _mm_min_epu16(vsec, _mm_or_si128(v, mask));
+        }
+        if (j > 0)
+        {
+            // ÿ8Ӳ5
+            sec = _mm_cvtsi128_si32(_mm_minpos_epu16(vsec)) & 0xFFFF;
+        }
+#endif
+        for (;j < n;j++)
+        {
+            if ((j < d-1 || j > d+1) && pdsi[j] < sec)
+            {
+                sec = pdsi[j];
+            }
+        }
+        if (sec < 0x10000 && sec*(100-uniqueness) < minv*100)
+        {
+            return IMPP_DISP16_INVALID;
+        }
+    }
+
+    // : d + (c[d-1]-c[d+1]) / (2*(c[d-1]+c[d+1]-2*c[d]))
+    if (subpixel && d > 0 && d < n-1)
+    {
+        cm = pdsi[d-1];
+        cp = pdsi[d+1];
+        denom = cm + cp - 2*minv;
+        if (denom < 1)  denom = 1;
+        return d*IMPP_DISP_SCALE + ((cm - cp)*IMPP_DISP_SCALE + denom) / (denom*2);
+    }
+
+    return d*IMPP_DISP_SCALE;
+}
+
+/******************************************************************************
+    Func Name: ImppOptimizeWta16Subpix
+     Function: ۺϴ۵WTA, һαΨһԼ
+        Input: IN ushort *dsi, ۺϴ(num*dlength)
+               IN int dlength, Ӳ
+               IN int num, ظ
+               IN int uniqueness, ΨһԱ(ٷֱ), 0ʾ
+               IN int subpixel, 1: , 0: Ӳ
+       Output: OUT short *disp16, Ӳ(x IMPP_DISP_SCALE), ЧΪIMPP_DISP16_INVALID
+******************************************************************************/
+void ImppOptimizeWta16Subpix(IN ushort *dsi, 
+                             IN int dlength, 
+                             IN int num, 
+                             IN int uniqueness, 
+                             IN int subpixel, 
+                             OUT short *disp16)
+{
+    ushort *pdsi = dsi;
+    int i;
+
+    for (i = 0;i < num;i++, pdsi += dlength)
+    {
+        disp16[i] = (short)WtaSubpixOne(pdsi, dlength, uniqueness, subpixel);
+    }
+
+    return;
+}
+
+// 䳤ӲWTA: iĴλdsi + doff[i], Ӳdmin[i]ʼ
+void ImppOptimizeWta16SubpixRange(IN ushort *dsi, 
+                                  IN ushort *dmin, 
+                                  IN ushort *dnum, 
+                                  IN int *doff, 
+                                  IN int num, 
+                                  IN int uniqueness, 
+                                  IN int subpixel, 
+                                  OUT short *disp16)
+{
+    int i, d16;
+
+    for (i = 0;i < num;i++)
+    {
+        d16 = WtaSubpixOne(dsi + doff[i], dnum[i], uniqueness, subpixel);
+        disp16[i] = (short)((d16 == IMPP_DISP16_INVALID) ? d16 : d16 + dmin[i]*IMPP_DISP_SCALE);
+    }
+
+    return;
+}
+
 void ImppOptimizeWta16Pixel(IN ushort *dsi, 
                             IN int dlength, 
                             IN int num, 
                             OUT PIXEL *label)
 {
     ushort *pdsi = dsi;
-    int i, j, disp;
-    ushort val, minv;
+    int i;
 
     for (i = 0;i < num;i++, pdsi += dlength)
     {
-        disp = 0;
-        minv = pdsi[0];
-        for (j = 1;j < dlength;j++)
-        {
-            val = pdsi[j];
-            if (val < minv)
-            {
-                minv = val;
-                disp = j;
-            }
-        }
-        label[i] = (PIXEL)disp;
+        label[i] = (PIXEL)(WtaSubpixOne(pdsi, dlength, 0, 0) >> IMPP_DISP_SHIFT);
     }
 
     return;
@@ -177,6 +314,34 @@ void ImppDisp2Image8(OUT PIXEL *dispimg,
     }
 }
 
+// Ӳ(x IMPP_DISP_SCALE)תΪӲͼ(factor), ЧΪ0xFFFF
+void ImppDisp2ImageShort(OUT int *dispimg, 
+                         IN short *disp16, 
+                         IN int area,
+                         IN float factor)
+{
+    int i;
+    for (i = 0; i < area; i++)
+    {
+        if (disp16[i] == IMPP_DISP16_INVALID)   dispimg[i] = 0xFFFF;
+        else    dispimg[i] = (int)(disp16[i]*factor/IMPP_DISP_SCALE+0.5);
+    }
+}
+
+// ӲתΪ8λʾͼ, ЧΪ0
+void ImppDisp2Image8Short(OUT PIXEL *dispimg, 
+                          IN short *disp16, 
+                          IN int area,
+                          IN int factor)
+{
+    int i;
+    for (i = 0; i < area; i++)
+    {
+        if (disp16[i] == IMPP_DISP16_INVALID)   dispimg[i] = 0;
+        else    dispimg[i] = (PIXEL)((disp16[i] >> IMPP_DISP_SHIFT)*factor);
+    }
+}
+
 void ImppMedianFilterPixel(IN PIXEL *label, 
                            OUT PIXEL *outlabel, 
                            IN int height, 
@@ -450,6 +615,494 @@ void ImppBackgroundFillPixel(IN PIXEL *check,
     return;
 }
 
+/******************************************************************************
+                            ںϺ(ˮ)
+    ԵyнһԼɨ, Եy-radiusнֵ˲,
+    ֵ˲ֻʸд2*radius+1fill, Ӳͼֻдһ
+    PIXEL汾EADP(ЧΪ0xFF), 汾SGM(ЧΪIMPP_DISP16_INVALID),
+    ߵЧֵκЧӲ, ֵ˲߼ͬ
+******************************************************************************/
+
+#define IMPP_SORT2(a, b)    { t = (a < b) ? a : b; b = (a < b) ? b : a; a = t; }
+
+// Devillard opt_med9, 19αȽ, ֵλp4
+#define IMPP_MEDIAN9(SORT2)                                             \
+    SORT2(p1, p2); SORT2(p4, p5); SORT2(p7, p8);                        \
+    SORT2(p0, p1); SORT2(p3, p4); SORT2(p6, p7);                        \
+    SORT2(p1, p2); SORT2(p4, p5); SORT2(p7, p8);                        \
+    SORT2(p0, p3); SORT2(p5, p8); SORT2(p4, p7);                        \
+    SORT2(p3, p6); SORT2(p1, p4); SORT2(p2, p5);                        \
+    SORT2(p4, p7); SORT2(p4, p2); SORT2(p6, p4);                        \
+    SORT2(p4, p2);
+
+// 9ֵ
+static PIXEL ImppMedian9(PIXEL p0, PIXEL p1, PIXEL p2, 
+                         PIXEL p3, PIXEL p4, PIXEL p5, 
+                         PIXEL p6, PIXEL p7, PIXEL p8)
+{
+    PIXEL t;
+
+    IMPP_MEDIAN9(IMPP_SORT2)
+
+    return p4;
+}
+
+static short ImppMedian9Short(short p0, short p1, short p2, 
+                              short p3, short p4, short p5, 
+                              short p6, short p7, short p8)
+{
+    short t;
+
+    IMPP_MEDIAN9(IMPP_SORT2)
+
+    return p4;
+}
+
+#ifdef PLATFORM_SSE
+#define IMPP_SORT2_SSE(a, b)    { t = _mm_min_epu8(a, b); b = _mm_max_epu8(a, b); a = t; }
+#define IMPP_SORT2_SSE16(a, b)  { t = _mm_min_epi16(a, b); b = _mm_max_epi16(a, b); a = t; }
+
+// 16زе3x3ֵ, ImppMedian9ͬ
+static __m128i ImppMedian9Sse(__m128i p0, __m128i p1, __m128i p2, 
+                              __m128i p3, __m128i p4, __m128i p5, 
+                              __m128i p6, __m128i p7, __m128i p8)
+{
+    __m128i t;
+
+    IMPP_MEDIAN9(IMPP_SORT2_SSE)
+
+    return p4;
+}
+
+// 8Ӳе3x3ֵ
+static __m128i ImppMedian9Sse16(__m128i p0, __m128i p1, __m128i p2, 
+                                __m128i p3, __m128i p4, __m128i p5, 
+                                __m128i p6, __m128i p7, __m128i p8)
+{
+    __m128i t;
+
+    IMPP_MEDIAN9(IMPP_SORT2_SSE16)
+
+    return p4;
+}
+#endif
+
+// һеһԼɨ, ImppLrCheckPixel + ImppBackgroundFillPixelһ
+static void ImppCheckFillRow(IN PIXEL *labelL, 
+                             IN PIXEL *labelR, 
+                             IN int width, 
+                             IN int T, 
+                             OUT PIXEL *check, 
+                             OUT PIXEL *fill)
+{
+    int x, s, d, dL;
+    PIXEL v1, v2, v;
+
+    for (x = 0;x < width;x++)
+    {
+        dL = labelL[x];
+        if (x - dL < 0)
+        {
+            check[x] = 0xFF;
+            continue;
+        }
+        d = labelR[x - dL] - dL;
+        if (d < 0)  d = -d;
+        check[x] = (d > T) ? 0xFF : (PIXEL)dL;
+    }
+
+    // ЧΪЧӲĽСֵ
+    for (x = 0;x < width;)
+    {
+        if (check[x] != 0xFF)
+        {
+            fill[x] = check[x];
+            x++;
+            continue;
+        }
+        s = x;
+        while (x < width && check[x] == 0xFF)   x++;
+        v1 = (s > 0) ? check[s-1] : 0xFF;
+        v2 = (x < width) ? check[x] : 0xFF;
+        v = (v1 < v2) ? v1 : v2;
+
+        // ImppBackgroundFillPixelһ: ֻʣĩһЧʱ, ز
+        if (x == width-1)
+        {
+            v = v1;
+            x = width;
+        }
+        memset(fill+s, v, (x-s)*sizeof(PIXEL));
+    }
+
+    return;
+}
+
+// ӲһԼɨ: ӲȡλӲ, ֵTʱЧ
+static void ImppCheckFillRow16(IN short *dispL, 
+                               IN short *dispR, 
+                               IN int width, 
+                               IN int T, 
+                               OUT short *check, 
+                               OUT short *fill)
+{
+    int x, xR, s, d, dL, dR;
+    short v1, v2, v;
+
+    for (x = 0;x < width;x++)
+    {
+        dL = dispL[x];
+        xR = x - ((dL + IMPP_DISP_SCALE/2) >> IMPP_DISP_SHIFT);
+        if (dL == IMPP_DISP16_INVALID || xR < 0)
+        {
+            check[x] = IMPP_DISP16_INVALID;
+            continue;
+        }
+        dR = dispR[xR];
+        d = dR - dL;
+        if (d < 0)  d = -d;
+        check[x] = (dR == IMPP_DISP16_INVALID || d > T*IMPP_DISP_SCALE) ? IMPP_DISP16_INVALID : (short)dL;
+    }
+
+    // ЧΪЧӲĽСֵ
+    for (x = 0;x < width;)
+    {
+        if (check[x] != IMPP_DISP16_INVALID)
+        {
+            fill[x] = check[x];
+            x++;
+            continue;
+        }
+        s = x;
+        while (x < width && check[x] == IMPP_DISP16_INVALID)    x++;
+        v1 = (s > 0) ? check[s-1] : IMPP_DISP16_INVALID;
+        v2 = (x < width) ? check[x] : IMPP_DISP16_INVALID;
+        v = (v1 < v2) ? v1 : v2;
+
+        if (x == width-1)
+        {
+            v = v1;
+            x = width;
+        }
+        for (;s < x;s++)
+        {
+            fill[s] = v;
+        }
+    }
+
+    return;
+}
+
+// һе3x3ֵ˲, Խʱɵߴ븴Ƶı߽
+static void ImppMedianRow(IN PIXEL *r0, 
+                          IN PIXEL *r1, 
+                          IN PIXEL *r2, 
+                          IN int width, 
+                          OUT PIXEL *dst)
+{
+    int x, xl, xr;
+#ifdef PLATFORM_SSE
+    __m128i a0, a1, a2, b0, b1, b2, c0, c1, c2;
+#endif
+
+    // ߽
+    xr = (width > 1) ? 1 : 0;
+    dst[0] = ImppMedian9(r0[0], r0[0], r0[xr], r1[0], r1[0], r1[xr], r2[0], r2[0], r2[xr]);
+    x = 1;
+
+#ifdef PLATFORM_SSE
+    for (;x+16 < width;x += 16)
+    {
+        a0 = _mm_loadu_si128((__m128i *)(r0+x-1));
+        a1 = _mm_loadu_si128((__m128i *)(r0+x));
+        a2 = _mm_loadu_si128((__m128i *)(r0+x+1));
+        b0 = _mm_loadu_si128((__m128i *)(r1+x-1));
+        b1 = _mm_loadu_si128((__m128i *)(r1+x));
+        b2 = _mm_loadu_si128((__m128i *)(r1+x+1));
+        c0 = _mm_loadu_si128((__m128i *)(r2+x-1));
+        c1 = _mm_loadu_si128((__m128i *)(r2+x));
+        c2 = _mm_loadu_si128((__m128i *)(r2+x+1));
+        _mm_storeu_si128((__m128i *)(dst+x), ImppMedian9Sse(a0, a1, a2, b0, b1, b2, c0, c1, c2));
+    }
+#endif
+
+    for (;x < width;x++)
+    {
+        xl = x-1;
+        xr = (x < width-1) ? x+1 : x;
+        dst[x] = ImppMedian9(r0[xl], r0[x], r0[xr], r1[xl], r1[x], r1[xr], r2[xl], r2[x], r2[xr]);
+    }
+
+    return;
+}
+
+static void ImppMedianRow16(IN short *r0, 
+                            IN short *r1, 
+                            IN short *r2, 
+                            IN int width, 
+                            OUT short *dst)
+{
+    int x, xl, xr;
+#ifdef PLATFORM_SSE
+    __m128i a0, a1, a2, b0, b1, b2, c0, c1, c2;
+#endif
+
+    xr = (width > 1) ? 1 : 0;
+    dst[0] = ImppMedian9Short(r0[0], r0[0], r0[xr], r1[0], r1[0], r1[xr], r2[0], r2[0], r2[xr]);
+    x = 1;
+
+#ifdef PLATFORM_SSE
+    for (;x+8 < width;x += 8)
+    {
+        a0 = _mm_loadu_si128((__m128i *)(r0+x-1));
+        a1 = _mm_loadu_si128((__m128i *)(r0+x));
+        a2 = _mm_loadu_si128((__m128i *)(r0+x+1));
+        b0 = _mm_loadu_si128((__m128i *)(r1+x-1));
+        b1 = _mm_loadu_si128((__m128i *)(r1+x));
+        b2 = _mm_loadu_si128((__m128i *)(r1+x+1));
+        c0 = _mm_loadu_si128((__m128i *)(r2+x-1));
+        c1 = _mm_loadu_si128((__m128i *)(r2+x));
+        c2 = _mm_loadu_si128((__m128i *)(r2+x+1));
+        _mm_storeu_si128((__m128i *)(dst+x), ImppMedian9Sse16(a0, a1, a2, b0, b1, b2, c0, c1, c2));
+    }
+#endif
+
+    for (;x < width;x++)
+    {
+        xl = x-1;
+        xr = (x < width-1) ? x+1 : x;
+        dst[x] = ImppMedian9Short(r0[xl], r0[x], r0[xr], r1[xl], r1[x], r1[xr], r2[xl], r2[x], r2[xr]);
+    }
+
+    return;
+}
+
+// Ӳֱͼ±: Чֵһ, [0, nbins-2]
+#define IMPP_HIST16_BIN(v, nbins)   (((v) == IMPP_DISP16_INVALID) ? (nbins)-1 : \
+                                     (((v) < 0) ? 0 : (((v) > (nbins)-2) ? (nbins)-2 : (v))))
+
+/******************************************************************************
+    Func Name: ImppMedianRowHist16
+     Function: 뾶һжӲֵ˲(Huangֱͼ), ұ߽縴
+        Input: IN short **rows, 2*radius+1(Խʱɵߴ븴Ƶı߽)
+               IN int width, 
+               IN int radius, ֵ˲뾶
+               IN int nbins, ֱͼ(ЧӲ + 1Ч)
+               INOUT ushort *hist, ֱͼ, ͷʱΪȫ0
+       Output: OUT short *dst, ֵ˲
+      Caution: һֻɾ2*(2*radius+1)ֵ, ֵһеλ,
+               ÿ뾶Թϵ, Ҫ
+******************************************************************************/
+static void ImppMedianRowHist16(IN short **rows, 
+                                IN int width, 
+                                IN int radius, 
+                                IN int nbins, 
+                                INOUT ushort *hist, 
+                                OUT short *dst)
+{
+    int n = 2*radius + 1;
+    int k = (n*n) >> 1;
+    int x, i, j, b, xo, xi, med, lt;
+
+    // 0еĴ
+    for (i = 0;i < n;i++)
+    {
+        for (j = -radius;j <= radius;j++)
+        {
+            x = (j < 0) ? 0 : ((j > width-1) ? width-1 : j);
+            hist[IMPP_HIST16_BIN(rows[i][x], nbins)]++;
+        }
+    }
+    med = 0;
+    lt = 0;
+    while (lt + hist[med] <= k)
+    {
+        lt += hist[med];
+        med++;
+    }
+    dst[0] = (med == nbins-1) ? IMPP_DISP16_INVALID : (short)med;
+
+    // ltΪСmedĸ, ֵ lt <= k < lt + hist[med]
+    for (x = 1;x < width;x++)
+    {
+        xo = (x-radius-1 < 0) ? 0 : x-radius-1;
+        xi = (x+radius > width-1) ? width-1 : x+radius;
+        for (i = 0;i < n;i++)
+        {
+            b = IMPP_HIST16_BIN(rows[i][xo], nbins);
+            hist[b]--;
+            if (b < med)    lt--;
+            b = IMPP_HIST16_BIN(rows[i][xi], nbins);
+            hist[b]++;
+            if (b < med)    lt++;
+        }
+        while (lt > k)
+        {
+            med--;
+            lt -= hist[med];
+        }
+        while (lt + hist[med] <= k)
+        {
+            lt += hist[med];
+            med++;
+        }
+        dst[x] = (med == nbins-1) ? IMPP_DISP16_INVALID : (short)med;
+    }
+
+    // ƳһеĴ, ֱͼָΪȫ0
+    for (i = 0;i < n;i++)
+    {
+        for (j = width-1-radius;j <= width-1+radius;j++)
+        {
+            x = (j < 0) ? 0 : ((j > width-1) ? width-1 : j);
+            hist[IMPP_HIST16_BIN(rows[i][x], nbins)]--;
+        }
+    }
+
+    return;
+}
+
+/******************************************************************************
+    Func Name: ImppPostprocessFusedPixel
+     Function: һԼ + ɨ + ֵ˲ں
+        Input: IN PIXEL *labelL, Ӳ
+               IN PIXEL *labelR, Ӳ
+               IN int height, ߶
+               IN int width, 
+               IN int T, һֵ
+               IN int radius, ֵ˲뾶
+       Output: OUT PIXEL *check, һԼ(ЧΪ0xFF)
+               OUT PIXEL *fill, 
+               OUT PIXEL *dense, ֵ˲
+      Caution: ImppLrCheckPixel + ImppBackgroundFillPixel + ImppMedianFilterPixel
+               һ; radiusΪ1ʱˮ, 뾶м, ֵ˲
+******************************************************************************/
+void ImppPostprocessFusedPixel(IN PIXEL *labelL, 
+                               IN PIXEL *labelR, 
+                               IN int height, 
+                               IN int width, 
+                               IN int T, 
+                               IN int radius, 
+                               OUT PIXEL *check, 
+                               OUT PIXEL *fill, 
+                               OUT PIXEL *dense)
+{
+    int y, m, up, down;
+
+    if (radius != 1)
+    {
+        for (y = 0;y < height;y++)
+        {
+            ImppCheckFillRow(labelL + y*width, labelR + y*width, width, T, 
+                             check + y*width, fill + y*width);
+        }
+        if (radius > 0) ImppMedianFilterPixel(fill, dense, height, width, radius);
+        else            memcpy(dense, fill, height*width*sizeof(PIXEL));
+        return;
+    }
+
+    // yм, y-1е3x3Ѿ
+    for (y = 0;y <= height;y++)
+    {
+        if (y < height)
+        {
+            ImppCheckFillRow(labelL + y*width, labelR + y*width, width, T, 
+                             check + y*width, fill + y*width);
+        }
+
+        m = y-1;
+        if (m < 0)  continue;
+        up = (m > 0) ? m-1 : m;
+        down = (m < height-1) ? m+1 : m;
+        ImppMedianRow(fill + up*width, fill + m*width, fill + down*width, width, dense + m*width);
+    }
+
+    return;
+}
+
+/******************************************************************************
+    Func Name: ImppPostprocessFused16
+     Function: ӲһԼ + ɨ + ֵ˲ں
+        Input: IN short *dispL, Ӳ(x IMPP_DISP_SCALE)
+               IN short *dispR, Ӳ(x IMPP_DISP_SCALE)
+               IN int height, ߶
+               IN int width, 
+               IN int dlength, Ӳ, ЧӲ[0, dlength*IMPP_DISP_SCALE)
+               IN int T, һֵ()
+               IN int radius, ֵ˲뾶
+       Output: OUT short *check, һԼ
+               OUT short *fill, 
+               OUT short *dense, ֵ˲
+      Caution: ЧӲΪIMPP_DISP16_INVALID; ӲΧPIXEL, ؾ
+               ڼ, ֵ˲б. 뾶ˮ: yм
+               Եy-radius˲, ֵֻȡڻе2*radius+1fill;
+               radiusΪ1ʱ, 뾶ûֱͼ
+******************************************************************************/
+void ImppPostprocessFused16(IN short *dispL, 
+                            IN short *dispR, 
+                            IN int height, 
+                            IN int width, 
+                            IN int dlength, 
+                            IN int T, 
+                            IN int radius, 
+                            OUT short *check, 
+                            OUT short *fill, 
+                            OUT short *dense)
+{
+    int y, m, i, r;
+    int nbins = dlength*IMPP_DISP_SCALE + 1;
+    int rownum = 2*radius + 1;
+    ushort *hist = NULL;
+    short **rows = NULL;
+
+    if (radius > 1)
+    {
+        hist = MallocType(ushort, nbins);
+        memset(hist, 0, nbins*sizeof(ushort));
+        rows = MallocType(short *, rownum);
+    }
+
+    for (y = 0;y < height + radius;y++)
+    {
+        if (y < height)
+        {
+            ImppCheckFillRow16(dispL + y*width, dispR + y*width, width, T, 
+                               check + y*width, fill + y*width);
+        }
+
+        // mеĴ͵m+radius, Ѿ
+        m = y - radius;
+        if (m < 0)  continue;
+        if (radius == 0)
+        {
+            memcpy(dense + m*width, fill + m*width, width*sizeof(short));
+        }
+        else if (radius == 1)
+        {
+            ImppMedianRow16(fill + ((m > 0) ? m-1 : m)*width, fill + m*width, 
+                            fill + ((m < height-1) ? m+1 : m)*width, width, dense + m*width);
+        }
+        else
+        {
+            for (i = 0;i < rownum;i++)
+            {
+                r = m - radius + i;
+                r = (r < 0) ? 0 : ((r > height-1) ? height-1 : r);
+                rows[i] = fill + r*width;
+            }
+            ImppMedianRowHist16(rows, width, radius, nbins, hist, dense + m*width);
+        }
+    }
+
+    if (radius > 1)
+    {
+        FreeType(hist, ushort, nbins);
+        FreeType(rows, short *, rownum);
+    }
+
+    return;
+}
+
 void ImppBackgroundFillInt(IN int *check, 
                            IN int height,
                            IN int width,
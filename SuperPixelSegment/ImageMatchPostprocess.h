@@ -37,6 +37,10 @@ extern "C"{
 #define IMPP_CHECK_ERR_LR           -3
 #define IMPP_CHECK_ERR_SPECKLE      -4
 
+#define IMPP_DISP_SHIFT             4       // ӲĶСλ
+#define IMPP_DISP_SCALE             (1 << IMPP_DISP_SHIFT)
+#define IMPP_DISP16_INVALID         0x7FFF  // ӲЧֵ, κЧӲ
+
 typedef struct tagImppInvalidInfo
 {
     int *row;
@@ -72,6 +76,20 @@ extern void ImppOptimizeWta16Pixel(IN ushort *dsi,
                                    IN int dlength, 
                                    IN int num, 
                                    OUT PIXEL *label);
+extern void ImppOptimizeWta16Subpix(IN ushort *dsi, 
+                                    IN int dlength, 
+                                    IN int num, 
+                                    IN int uniqueness, 
+                                    IN int subpixel, 
+                                    OUT short *disp16);
+extern void ImppOptimizeWta16SubpixRange(IN ushort *dsi, 
+                                         IN ushort *dmin, 
+                                         IN ushort *dnum, 
+                                         IN int *doff, 
+                                         IN int num, 
+                                         IN int uniqueness, 
+                                         IN int subpixel, 
+                                         OUT short *disp16);
 extern void ImppOptimizeWta16(IN ushort *dsi, 
                               IN int dlength, 
                               IN int num, 
@@ -88,6 +106,14 @@ extern void ImppDisp2Image8(OUT PIXEL *dispimg,
                             IN PIXEL *label, 
                             IN int area,
                             IN int factor);
+extern void ImppDisp2ImageShort(OUT int *dispimg, 
+                                IN short *disp16, 
+                                IN int area,
+                                IN float factor);
+extern void ImppDisp2Image8Short(OUT PIXEL *dispimg, 
+                                 IN short *disp16, 
+                                 IN int area,
+                                 IN int factor);
 extern void ImppMedianFilterPixel(IN PIXEL *label, 
                                   OUT PIXEL *outlabel, 
                                   IN int height, 
@@ -123,6 +149,25 @@ extern void ImppBackgroundFillPixel(IN PIXEL *check,
                                     IN int width,
                                     OUT PIXEL *label,
                                     OUT ImppInvalidInfo *invalid);
+extern void ImppPostprocessFusedPixel(IN PIXEL *labelL, 
+                                      IN PIXEL *labelR, 
+                                      IN int height, 
+                                      IN int width, 
+                                      IN int T, 
+                                      IN int radius, 
+                                      OUT PIXEL *check, 
+                                      OUT PIXEL *fill, 
+                                      OUT PIXEL *dense);
+extern void ImppPostprocessFused16(IN short *dispL, 
+                                   IN short *dispR, 
+                                   IN int height, 
+                                   IN int width, 
+                                   IN int dlength, 
+                                   IN int T, 
+                                   IN int radius, 
+                                   OUT short *check, 
+                                   OUT short *fill, 
+                                   OUT short *dense);
 extern void ImppBackgroundFillInt(IN int *check, 
                                   IN int height,
                                   IN int width,
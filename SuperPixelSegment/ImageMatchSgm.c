@@ -31,8 +31,22 @@ void ImageMatchSgmPara(INOUT ImSgmInfo *Sgm)
     Sgm->dispmr = 2;
     Sgm->r1 = 30;
     Sgm->r2 = 500;
+    Sgm->pyramid = 0;
+    Sgm->margin = 2;
+    Sgm->temporal = 0;
+    Sgm->tile = 16;
+    Sgm->motion = 8;
+    Sgm->uniqueness = 0;
+    Sgm->subpixel = 0;
+    Sgm->prev = NULL;
+    Sgm->prevleft = NULL;
+    Sgm->prevright = NULL;
 }
 
+static void SgmRangeInit(INOUT ImSgmInfo *Sgm);
+static void SgmRangeDestroy(INOUT ImSgmInfo *Sgm);
+static int SgmRangeProc(INOUT ImSgmInfo *Sgm);
+
 void ImageMatchSgmInit(INOUT ImSgmInfo *Sgm)
 {
     int dlength = Sgm->dlength;
@@ -41,53 +55,71 @@ void ImageMatchSgmInit(INOUT ImSgmInfo *Sgm)
     int area = height*width;
 
     ImaScanTreeUshortInfo *aggr = &Sgm->aggr;
-    ImppInvalidInfo *invalid = &Sgm->invalid;
 
-    Sgm->imagecost = mm_MallocType(ushort, height*width*dlength);
+    // ֲ㲻СIMSGM_PYR_MINSIZE
+    while (Sgm->pyramid > 0 && ((height >> Sgm->pyramid) < IMSGM_PYR_MINSIZE 
+        || (width >> Sgm->pyramid) < IMSGM_PYR_MINSIZE))
+    {
+        Sgm->pyramid--;
+    }
+
+    // ۺϰƽ(ͬmode 0), ֧Xdyƽ; ߵĴ۾ۺϽͬ
+    if ((Sgm->pyramid > 0 || Sgm->temporal) && Sgm->mode != 0)
+    {
+        printf("ImageMatchSgm error: mode %d is not supported with pyramid/temporal, use mode 0!\n", Sgm->mode);
+        Sgm->mode = 0;
+    }
 
-    ImaScanTreeUshortAggrPara(aggr);
-    aggr->height = height;
-    aggr->width = width;
-    aggr->dlength = dlength;
-    aggr->mode = Sgm->mode;
-    ImaScanTreeUshortAggrInit(aggr);
+    if (Sgm->pyramid > 0 || Sgm->temporal)
+    {
+        SgmRangeInit(Sgm);
+    }
+    else
+    {
+        Sgm->imagecost = mm_MallocType(ushort, height*width*dlength);
 
-    ImppInvalidInit(invalid, area);
-    
-    Sgm->left = MallocType(PIXEL, area);
-    Sgm->right = MallocType(PIXEL, area);
-    Sgm->sparse = MallocType(PIXEL, area);
-    Sgm->fill = MallocType(PIXEL, area);
-    Sgm->dense = MallocType(PIXEL, area);
+        ImaScanTreeUshortAggrPara(aggr);
+        aggr->height = height;
+        aggr->width = width;
+        aggr->dlength = dlength;
+        aggr->mode = Sgm->mode;
+        ImaScanTreeUshortAggrInit(aggr);
+    }
+
+    Sgm->left = MallocType(short, area);
+    Sgm->right = MallocType(short, area);
+    Sgm->sparse = MallocType(short, area);
+    Sgm->fill = MallocType(short, area);
+    Sgm->dense = MallocType(short, area);
 
     return;
 }
 void ImageMatchSgmDestroy(INOUT ImSgmInfo *Sgm)
 {
-    int dlength = Sgm->dlength;
-    int height = Sgm->height;
-    int width = Sgm->width;
-    int area = height*width;
+    if (Sgm->pyramid > 0 || Sgm->temporal)
+    {
+        SgmRangeDestroy(Sgm);
+    }
+    else
+    {
+        mm_FreeType(Sgm->imagecost, ushort, Sgm->height*Sgm->width*Sgm->dlength);
+        ImaScanTreeUshortAggrDestroy(&Sgm->aggr);
+    }
 
-    mm_FreeType(Sgm->imagecost, ushort, height*width*dlength);
-
-    ImaScanTreeUshortAggrDestroy(&Sgm->aggr);
-    ImppInvalidDestroy(&Sgm->invalid, area);
-
-    FreeType(Sgm->left, PIXEL, area);
-    FreeType(Sgm->right, PIXEL, area);
-    FreeType(Sgm->sparse, PIXEL, area);
-    FreeType(Sgm->fill, PIXEL, area);
-    FreeType(Sgm->dense, PIXEL, area);
+    FreeType(Sgm->left, short, Sgm->height*Sgm->width);
+    FreeType(Sgm->right, short, Sgm->height*Sgm->width);
+    FreeType(Sgm->sparse, short, Sgm->height*Sgm->width);
+    FreeType(Sgm->fill, short, Sgm->height*Sgm->width);
+    FreeType(Sgm->dense, short, Sgm->height*Sgm->width);
 
     return;
 }
 
-void ImageMatchSgmProc(INOUT ImSgmInfo *Sgm)
+// ɹTRUE, CensusЧʱFALSE(Ӳδ)
+int ImageMatchSgmProc(INOUT ImSgmInfo *Sgm)
 {
     int mode = Sgm->mode;
     ImaScanTreeUshortInfo *aggr = &Sgm->aggr;
-    ImppInvalidInfo *invalid = &Sgm->invalid;
 
     IMAGE_S **src = Sgm->src;
     ushort *imagecost = Sgm->imagecost;
@@ -99,8 +131,16 @@ void ImageMatchSgmProc(INOUT ImSgmInfo *Sgm)
 
     ushort maxcost;
 
+    if (Sgm->pyramid > 0 || Sgm->temporal)
+    {
+        return SgmRangeProc(Sgm);
+    }
+
     // cost
-    ImcPaperCensusUshort(src[0], src[1], dlength, 2, 2, &maxcost, imagecost);
+    if (!ImcPaperCensusUshort(src[0], src[1], dlength, 2, 2, &maxcost, imagecost))
+    {
+        return FALSE;
+    }
     aggr->P1 = (ushort)round(Sgm->r1*maxcost/dlength);
     aggr->P2 = (ushort)round(Sgm->r2*maxcost/dlength);
 
@@ -110,7 +150,7 @@ void ImageMatchSgmProc(INOUT ImSgmInfo *Sgm)
     else            ImaScanTreeUshortAggrProcXdy(aggr);
 
     // wta
-    ImppOptimizeWta16Pixel(aggr->smoothcost, dlength, area, Sgm->left);
+    ImppOptimizeWta16Subpix(aggr->smoothcost, dlength, area, Sgm->uniqueness, Sgm->subpixel, Sgm->left);
 
     // invcost
     ImcDsiReverseUshort(imagecost, aggr->smoothcost, height, width, dlength, maxcost, 2);  
@@ -124,16 +164,465 @@ void ImageMatchSgmProc(INOUT ImSgmInfo *Sgm)
     else            ImaScanTreeUshortAggrProcXdy(aggr);
 
     // wta
-    ImppOptimizeWta16Pixel(aggr->smoothcost, dlength, area, Sgm->right);
+    ImppOptimizeWta16Subpix(aggr->smoothcost, dlength, area, Sgm->uniqueness, Sgm->subpixel, Sgm->right);
+
+    // refine && fill (һԼ, , ֵ˲ں)
+    ImppPostprocessFused16(Sgm->left, Sgm->right, height, width, dlength, 1, Sgm->dispmr, 
+                           Sgm->sparse, Sgm->fill, Sgm->dense);
+
+    return TRUE;
+}
 
-    // refine && fill
-    ImppLrCheckPixel(Sgm->left, Sgm->right, height, width, 1, Sgm->sparse);
-    ImppBackgroundFillPixel(Sgm->sparse, height, width, Sgm->fill, invalid);
-    ImppMedianFilterPixel(Sgm->fill, Sgm->dense, height, width, Sgm->dispmr);
+/******************************************************************************
+                                SGM
+    pyramid > 0: 1/2^pyramidֱϽȫӲSGM, ɴֲӲ3x3
+                 С/ֵ(չmargin)ȷÿصӲ
+    temporal:    ֹǰһ֡ӲЧķֿ, Ӳȡǰһֿ֡ڵС/ֵ
+                 (չmargin), ֿʹôֲȫӲ
+    ڼۺ(ձ䳤)
+******************************************************************************/
+
+static void SgmRangeInit(INOUT ImSgmInfo *Sgm)
+{
+    int dlength = Sgm->dlength;
+    int height = Sgm->height;
+    int width = Sgm->width;
+    int area = height*width;
+    int cheight = height >> 1;
+    int cwidth = width >> 1;
+    int carea = cheight*cwidth;
+    int tilenum;
+    int k;
+
+    ImSgmInfo *coarse = NULL;
+
+    // ֲ: ֱ, ӲΧ
+    if (Sgm->pyramid > 0)
+    {
+        coarse = MallocType(ImSgmInfo, 1);
+        ImageMatchSgmPara(coarse);
+        coarse->height = cheight;
+        coarse->width = cwidth;
+        coarse->channel = 1;
+        coarse->dlength = (dlength + 1) >> 1;
+        coarse->mode = Sgm->mode;
+        coarse->dispmr = Sgm->dispmr;
+        coarse->r1 = Sgm->r1;
+        coarse->r2 = Sgm->r2;
+        coarse->pyramid = Sgm->pyramid - 1;
+        coarse->margin = Sgm->margin;
+        for (k = 0;k < 2;k++)
+        {
+            Sgm->pyrsrc[k].height = cheight;
+            Sgm->pyrsrc[k].width = cwidth;
+            Sgm->pyrsrc[k].channel = 1;
+            Sgm->pyrsrc[k].data = MallocType(PIXEL, carea);
+            coarse->src[k] = &Sgm->pyrsrc[k];
+        }
+        ImageMatchSgmInit(coarse);
+
+        Sgm->cmin = MallocType(ushort, carea);
+        Sgm->cmax = MallocType(ushort, carea);
+    }
+    Sgm->coarse = coarse;
+
+    if (Sgm->channel != 1)
+    {
+        for (k = 0;k < 2;k++)
+        {
+            Sgm->gray[k].height = height;
+            Sgm->gray[k].width = width;
+            Sgm->gray[k].channel = 1;
+            Sgm->gray[k].data = MallocType(PIXEL, area);
+        }
+    }
+
+    if (Sgm->temporal)
+    {
+        tilenum = ((height + Sgm->tile-1) / Sgm->tile) * ((width + Sgm->tile-1) / Sgm->tile);
+        Sgm->tileflag = MallocType(PIXEL, tilenum);
+    }
+
+    // մ
+    Sgm->dmin = MallocType(ushort, area);
+    Sgm->dnum = MallocType(ushort, area);
+    Sgm->doff = MallocType(int, area + 1);
+    Sgm->rangelen = area * ((dlength < IMSGM_RANGE_INIT) ? dlength : IMSGM_RANGE_INIT);
+    Sgm->rangecost = mm_MallocType(ushort, Sgm->rangelen);
+    Sgm->rangesmooth = mm_MallocType(ushort, Sgm->rangelen);
+    Sgm->LpBuf = MallocType(ushort, (dlength + IMA_STUS_BUFEX) * 2);
 
     return;
 }
 
+static void SgmRangeDestroy(INOUT ImSgmInfo *Sgm)
+{
+    int k;
+
+    // ֲĻ水ֲߴ, ڴֲ㱾ͷ
+    if (Sgm->pyramid > 0)
+    {
+        for (k = 0;k < 2;k++)
+        {
+            FreeType(Sgm->pyrsrc[k].data, PIXEL, Sgm->coarse->height*Sgm->coarse->width);
+        }
+        FreeType(Sgm->cmin, ushort, Sgm->coarse->height*Sgm->coarse->width);
+        FreeType(Sgm->cmax, ushort, Sgm->coarse->height*Sgm->coarse->width);
+        ImageMatchSgmDestroy(Sgm->coarse);
+        FreeType(Sgm->coarse, ImSgmInfo, 1);
+    }
+
+    if (Sgm->channel != 1)
+    {
+        for (k = 0;k < 2;k++)
+        {
+            FreeType(Sgm->gray[k].data, PIXEL, Sgm->height*Sgm->width);
+        }
+    }
+
+    if (Sgm->temporal)
+    {
+        FreeType(Sgm->tileflag, PIXEL, ((Sgm->height + Sgm->tile-1) / Sgm->tile) * ((Sgm->width + Sgm->tile-1) / Sgm->tile));
+    }
+
+    FreeType(Sgm->dmin, ushort, Sgm->height*Sgm->width);
+    FreeType(Sgm->dnum, ushort, Sgm->height*Sgm->width);
+    FreeType(Sgm->doff, int, Sgm->height*Sgm->width + 1);
+    mm_FreeType(Sgm->rangecost, ushort, Sgm->rangelen);
+    mm_FreeType(Sgm->rangesmooth, ushort, Sgm->rangelen);
+    FreeType(Sgm->LpBuf, ushort, (Sgm->dlength + IMA_STUS_BUFEX) * 2);
+
+    return;
+}
+
+// 2x2ֵ²
+static void SgmPyrDown(IN IMAGE_S *src, OUT IMAGE_S *dst)
+{
+    int width = src->width;
+    int dheight = dst->height;
+    int dwidth = dst->width;
+    int x, y;
+    PIXEL *s0, *s1, *d;
+
+    for (y = 0;y < dheight;y++)
+    {
+        s0 = src->data + 2*y*width;
+        s1 = s0 + width;
+        d = dst->data + y*dwidth;
+        for (x = 0;x < dwidth;x++, s0 += 2, s1 += 2)
+        {
+            d[x] = (PIXEL)((s0[0] + s0[1] + s1[0] + s1[1] + 2) >> 2);
+        }
+    }
+
+    return;
+}
+
+// ɴֲӲÿصӲ, cdispΪNULLʱʹȫӲ;
+// ֲ3x3ûЧӲʱ, ôϸͬʹȫӲ
+static void SgmRangeBuild(INOUT ImSgmInfo *Sgm, IN short *cdisp)
+{
+    int height = Sgm->height;
+    int width = Sgm->width;
+    int dlength = Sgm->dlength;
+    int margin = Sgm->margin;
+    int area = height*width;
+    int cheight, cwidth;
+
+    int x, y, i, j, cx, cy, p, c;
+    int lo, hi, val, vmin, vmax;
+    ushort *cmin = Sgm->cmin;
+    ushort *cmax = Sgm->cmax;
+    ushort *dmin = Sgm->dmin;
+    ushort *dnum = Sgm->dnum;
+
+    if (cdisp == NULL)
+    {
+        for (p = 0;p < area;p++)
+        {
+            dmin[p] = 0;
+            dnum[p] = (ushort)dlength;
+        }
+        return;
+    }
+
+    // ֲ3x3ЧӲС/ֵ(), ЧӲʱcmin > cmax
+    cheight = Sgm->coarse->height;
+    cwidth = Sgm->coarse->width;
+    for (y = 0;y < cheight;y++)
+    {
+        for (x = 0;x < cwidth;x++)
+        {
+            vmin = IMPP_DISP16_INVALID;
+            vmax = -1;
+            for (i = y-1;i <= y+1;i++)
+            {
+                if (i < 0 || i >= cheight)  continue;
+                for (j = x-1;j <= x+1;j++)
+                {
+                    if (j < 0 || j >= cwidth)   continue;
+                    val = cdisp[i*cwidth+j];
+                    if (val == IMPP_DISP16_INVALID) continue;
+                    if (val < vmin) vmin = val;
+                    if (val > vmax) vmax = val;
+                }
+            }
+            cmin[y*cwidth+x] = (ushort)vmin;
+            cmax[y*cwidth+x] = (ushort)((vmax < 0) ? 0 : vmax);
+        }
+    }
+
+    // ϸӲ
+    for (y = 0, p = 0;y < height;y++)
+    {
+        cy = y >> 1;
+        if (cy > cheight-1) cy = cheight-1;
+        for (x = 0;x < width;x++, p++)
+        {
+            cx = x >> 1;
+            if (cx > cwidth-1)  cx = cwidth-1;
+            c = cy*cwidth+cx;
+
+            if (cmin[c] > cmax[c])
+            {
+                dmin[p] = 0;
+                dnum[p] = (ushort)dlength;
+                continue;
+            }
+            // ֲӲ2ȡ(/)չ
+            lo = ((2*cmin[c]) >> IMPP_DISP_SHIFT) - margin;
+            hi = ((2*cmax[c] + IMPP_DISP_SCALE-1) >> IMPP_DISP_SHIFT) + 1 + margin;
+            if (lo < 0)         lo = 0;
+            if (hi > dlength-1) hi = dlength-1;
+            if (lo > hi)        lo = hi;
+
+            dmin[p] = (ushort)lo;
+            dnum[p] = (ushort)(hi - lo + 1);
+        }
+    }
+
+    return;
+}
+
+// ֿ˶: ǰһ֡ƽҶȲmotionʱΪ1
+static void SgmTileMotion(INOUT ImSgmInfo *Sgm)
+{
+    int height = Sgm->height;
+    int width = Sgm->width;
+    int channel = Sgm->channel;
+    int tile = Sgm->tile;
+    int tilew = (width + tile-1) / tile;
+    int tileh = (height + tile-1) / tile;
+
+    int tx, ty, x, y, x0, y0, x1, y1;
+    int sad, num, diff;
+    PIXEL *cur, *pre;
+
+    for (ty = 0;ty < tileh;ty++)
+    {
+        y0 = ty*tile;
+        y1 = (y0 + tile < height) ? y0 + tile : height;
+        for (tx = 0;tx < tilew;tx++)
+        {
+            x0 = tx*tile;
+            x1 = (x0 + tile < width) ? x0 + tile : width;
+            sad = 0;
+            for (y = y0;y < y1;y++)
+            {
+                cur = Sgm->src[0]->data + (y*width + x0)*channel;
+                pre = Sgm->prev->data + (y*width + x0)*channel;
+                for (x = 0;x < (x1-x0)*channel;x++)
+                {
+                    diff = cur[x] - pre[x];
+                    sad += (diff < 0) ? -diff : diff;
+                }
+            }
+            num = (y1-y0)*(x1-x0)*channel;
+            Sgm->tileflag[ty*tilew+tx] = (PIXEL)(sad > Sgm->motion*num);
+        }
+    }
+
+    return;
+}
+
+// ֹֿʹǰһ֡ӲС/ֵ(չmargin)ΪӲ
+static void SgmRangeSeed(INOUT ImSgmInfo *Sgm, IN short *prevdisp)
+{
+    int height = Sgm->height;
+    int width = Sgm->width;
+    int dlength = Sgm->dlength;
+    int margin = Sgm->margin;
+    int tile = Sgm->tile;
+    int tilew = (width + tile-1) / tile;
+    int tileh = (height + tile-1) / tile;
+
+    int tx, ty, x, y, x0, y0, x1, y1;
+    int lo, hi, val, vmin, vmax, invalid;
+    ushort *dmin = Sgm->dmin;
+    ushort *dnum = Sgm->dnum;
+
+    for (ty = 0;ty < tileh;ty++)
+    {
+        y0 = ty*tile;
+        y1 = (y0 + tile < height) ? y0 + tile : height;
+        for (tx = 0;tx < tilew;tx++)
+        {
+            if (Sgm->tileflag[ty*tilew+tx])     continue;
+
+            x0 = tx*tile;
+            x1 = (x0 + tile < width) ? x0 + tile : width;
+            vmin = IMPP_DISP16_INVALID;
+            vmax = 0;
+            invalid = 0;
+            for (y = y0;y < y1 && !invalid;y++)
+            {
+                for (x = x0;x < x1;x++)
+                {
+                    val = prevdisp[y*width+x];
+                    if (val == IMPP_DISP16_INVALID)
+                    {
+                        invalid = 1;
+                        break;
+                    }
+                    if (val < vmin) vmin = val;
+                    if (val > vmax) vmax = val;
+                }
+            }
+
+            // ЧӲʱԭ
+            if (invalid)    continue;
+
+            lo = (vmin >> IMPP_DISP_SHIFT) - margin;
+            hi = ((vmax + IMPP_DISP_SCALE-1) >> IMPP_DISP_SHIFT) + margin;
+            if (lo < 0)         lo = 0;
+            if (hi > dlength-1) hi = dlength-1;
+
+            for (y = y0;y < y1;y++)
+            {
+                for (x = x0;x < x1;x++)
+                {
+                    dmin[y*width+x] = (ushort)lo;
+                    dnum[y*width+x] = (ushort)(hi - lo + 1);
+                }
+            }
+        }
+    }
+
+    return;
+}
+
+// մƫ, ʱչ
+static void SgmRangeOffset(INOUT ImSgmInfo *Sgm)
+{
+    int area = Sgm->height*Sgm->width;
+    ushort *dnum = Sgm->dnum;
+    int *doff = Sgm->doff;
+    int p;
+
+    doff[0] = 0;
+    for (p = 0;p < area;p++)
+    {
+        doff[p+1] = doff[p] + dnum[p];
+    }
+
+    if (doff[area] > Sgm->rangelen)
+    {
+        mm_FreeType(Sgm->rangecost, ushort, Sgm->rangelen);
+        mm_FreeType(Sgm->rangesmooth, ushort, Sgm->rangelen);
+        Sgm->rangelen = doff[area];
+        Sgm->rangecost = mm_MallocType(ushort, Sgm->rangelen);
+        Sgm->rangesmooth = mm_MallocType(ushort, Sgm->rangelen);
+    }
+
+    return;
+}
+
+static int SgmRangeProc(INOUT ImSgmInfo *Sgm)
+{
+    ImSgmInfo *coarse = Sgm->coarse;
+    IMAGE_S *src[2];
+    int dlength = Sgm->dlength;
+    int height = Sgm->height;
+    int width = Sgm->width;
+    int area = height*width;
+    int k, view, seed;
+    ushort maxcost, P1, P2;
+    short *cdisp, *prevdisp, *disp;
+
+    // Ҷͼ
+    for (k = 0;k < 2;k++)
+    {
+        if (Sgm->channel != 1)
+        {
+            src[k] = &Sgm->gray[k];
+            ImageRgb2Gray(Sgm->src[k], src[k], NULL);
+        }
+        else
+        {
+            src[k] = Sgm->src[k];
+        }
+    }
+
+    // ֲƥ
+    if (coarse != NULL)
+    {
+        for (k = 0;k < 2;k++)
+        {
+            SgmPyrDown(src[k], coarse->src[k]);
+        }
+        if (!ImageMatchSgmProc(coarse))
+        {
+            return FALSE;
+        }
+    }
+
+    // ǰһֿ֡˶
+    seed = Sgm->temporal && Sgm->prev != NULL && Sgm->prevleft != NULL && Sgm->prevright != NULL;
+    if (seed)
+    {
+        SgmTileMotion(Sgm);
+    }
+
+    maxcost = (2*2+1)*(2*2+1)-1;
+    P1 = (ushort)round(Sgm->r1*maxcost/dlength);
+    P2 = (ushort)round(Sgm->r2*maxcost/dlength);
+
+    // ͼ:  -> cost -> cost aggr -> wta
+    for (view = 0;view < 2;view++)
+    {
+        cdisp = NULL;
+        if (coarse != NULL)
+        {
+            cdisp = (view == 0) ? coarse->fill : coarse->right;
+        }
+        prevdisp = (view == 0) ? Sgm->prevleft : Sgm->prevright;
+        disp = (view == 0) ? Sgm->left : Sgm->right;
+
+        SgmRangeBuild(Sgm, cdisp);
+        if (seed)
+        {
+            SgmRangeSeed(Sgm, prevdisp);
+        }
+        SgmRangeOffset(Sgm);
+
+        if (!ImcImageCensusRangeUshort(src[0], src[1], 2, 2, view, 
+                                       Sgm->dmin, Sgm->dnum, Sgm->doff, Sgm->rangecost))
+        {
+            return FALSE;
+        }
+        ImaScanTreeUshortAggrProcRange(Sgm->rangecost, Sgm->dmin, Sgm->dnum, Sgm->doff, 
+                                       height, width, dlength, P1, P2, Sgm->rangesmooth, Sgm->LpBuf);
+        ImppOptimizeWta16SubpixRange(Sgm->rangesmooth, Sgm->dmin, Sgm->dnum, Sgm->doff, area, 
+                                     Sgm->uniqueness, Sgm->subpixel, disp);
+    }
+
+    // refine && fill (һԼ, , ֵ˲ں)
+    ImppPostprocessFused16(Sgm->left, Sgm->right, height, width, dlength, 1, Sgm->dispmr, 
+                           Sgm->sparse, Sgm->fill, Sgm->dense);
+
+    return TRUE;
+}
+
 #ifdef __cplusplus
 }
 #endif /* end of __cplusplus */
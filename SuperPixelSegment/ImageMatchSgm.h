@@ -35,6 +35,9 @@ extern "C"{
 #include "ImageMatchAggregation.h"
 #include "ImageMatchPostprocess.h"
 
+#define IMSGM_PYR_MINSIZE       16      // ֲС
+#define IMSGM_RANGE_INIT        16      // մʼƽӲ
+
 typedef struct tagImSgmInfo
 {
     // ⲿϢ
@@ -50,25 +53,51 @@ typedef struct tagImSgmInfo
     int dispmr;         // labelֵ˲뾶
     float r1;
     float r2;
+    int pyramid;        // ɴֵĽ, 0ʾȫӲ
+    int margin;         // ֲ/ǰһ֡Ӳչ
+    int temporal;       // 1: ǰһ֡ӲȷֿӲ(Ƶ)
+    int tile;           // ʱֿС
+    int motion;         // ֿƽҶȲֵʱΪ˶, ʹȫӲ
+    int uniqueness;     // WTAΨһԱ(ٷֱ), 0ʾ
+    int subpixel;       // 1: WTA, 0: Ӳ(x IMPP_DISP_SCALE)
+
+    // ǰһ֡Ϣ(temporal, ΪNULLʱʹ)
+    IMAGE_S *prev;      // ǰһ֡ͼ
+    short *prevleft;    // ǰһ֡Ӳ(fill, x IMPP_DISP_SCALE)
+    short *prevright;   // ǰһ֡Ӳ(x IMPP_DISP_SCALE)
 
     // ڲϢ
     ushort *imagecost;
     ImaScanTreeUshortInfo aggr;
-    ImppInvalidInfo invalid;
 
-    // Ӳ
-    PIXEL *left;
-    PIXEL *right;
-    PIXEL *sparse;
-    PIXEL *fill;
-    PIXEL *dense;
+    // ƥڲϢ(pyramid > 0  temporal)
+    struct tagImSgmInfo *coarse;
+    IMAGE_S pyrsrc[2];  // ²ͼ, coarse->src
+    IMAGE_S gray[2];    // ɫʱĻҶͼ
+    ushort *cmin;       // ֲЧӲ3x3Сֵ(x IMPP_DISP_SCALE)
+    PIXEL *tileflag;    // ֿ˶
+    ushort *cmax;       // ֲЧӲ3x3ֵ(x IMPP_DISP_SCALE), СcminʱЧӲ
+    ushort *dmin;       // ÿصʼӲ
+    ushort *dnum;       // ÿصӲ
+    int *doff;          // ÿڽմеƫ
+    int rangelen;       // մ
+    ushort *rangecost;
+    ushort *rangesmooth;
+    ushort *LpBuf;
+
+    // Ӳ: (x IMPP_DISP_SCALE), ЧΪIMPP_DISP16_INVALID
+    short *left;
+    short *right;
+    short *sparse;
+    short *fill;
+    short *dense;
 
 }ImSgmInfo;
 
 extern void ImageMatchSgmPara(INOUT ImSgmInfo *Sgm);
 extern void ImageMatchSgmInit(INOUT ImSgmInfo *Sgm);
 extern void ImageMatchSgmDestroy(INOUT ImSgmInfo *Sgm);
-extern void ImageMatchSgmProc(INOUT ImSgmInfo *Sgm);
+extern int ImageMatchSgmProc(INOUT ImSgmInfo *Sgm);
 extern void SgmGradient(INOUT ImSgmInfo *Sgm);
 
 #ifdef __cplusplus
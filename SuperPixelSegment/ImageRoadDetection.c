@@ -196,10 +196,6 @@ void ImageRdProc(OUT ImageRdInfo *rd)
 
     int feanum;
     int regionnum;
-    PIXEL *left;
-    PIXEL *right;
-    PIXEL *sparse;
-    PIXEL *dense;
     IMAGE32_S markImage;
     IMAGE_S lblImage;
 
@@ -207,24 +203,20 @@ void ImageRdProc(OUT ImageRdInfo *rd)
     if (dispcal == 1)
     {
         ImEadpInfo *eadp = &rd->eadp;
-        ImageMatchEadpProc(eadp);
-        left = eadp->left;
-        right = eadp->right;
-        sparse = eadp->sparse;
-        dense = eadp->dense;
+        if (!ImageMatchEadpProc(eadp))  return;
+        if (rd->dispshow)
+        {
+            ImppDisp2Image8(rd->dispimg, eadp->sparse, height*width, IMAGE_WHITE/dlength);
+        }
     }
     else if (dispcal == 2)
     {
         ImSgmInfo *sgm = &rd->sgm;
-        ImageMatchSgmProc(sgm);
-        left = sgm->left;
-        right = sgm->right;
-        sparse = sgm->sparse;
-        dense = sgm->dense;
-    }
-    if (rd->dispshow)
-    {
-        ImppDisp2Image8(rd->dispimg, sparse, height*width, IMAGE_WHITE/dlength);
+        if (!ImageMatchSgmProc(sgm))    return;
+        if (rd->dispshow)
+        {
+            ImppDisp2Image8Short(rd->dispimg, sgm->sparse, height*width, IMAGE_WHITE/dlength);
+        }
     }
     // SaveMatrixChar("E:/left.txt", left, height, width);
     // SaveMatrixChar("E:/right.txt", right, height, width);
@@ -504,33 +504,33 @@ TsGetTime(t);
     dispimage.width = width;
     dispimage.channel = 1;
 
-    ImppDisp2ImagePixel(dispimage.data, sgm.left, area, (float)factor);
+    ImppDisp2ImageShort(dispimage.data, sgm.left, area, (float)factor);
     sprintf(filename, "%s%s", dstdirname, "/left.png");
     Image16Save(filename, &dispimage, NULL);
 
-    ImppDisp2ImagePixel(dispimage.data, sgm.right, area, (float)factor);
+    ImppDisp2ImageShort(dispimage.data, sgm.right, area, (float)factor);
     sprintf(filename, "%s%s", dstdirname, "/right.png");
     Image16Save(filename, &dispimage, NULL); 
 
-	ImppDisp2ImagePixel(dispimage.data, sgm.sparse, area, (float)factor);
+	ImppDisp2ImageShort(dispimage.data, sgm.sparse, area, (float)factor);
     sprintf(filename, "%s%s", dstdirname, "/check.png");
     Image16Save(filename, &dispimage, NULL); 
 
-	ImppDisp2ImagePixel(dispimage.data, sgm.dense, area, (float)factor);
+	ImppDisp2ImageShort(dispimage.data, sgm.dense, area, (float)factor);
     sprintf(filename, "%s%s", dstdirname, "/fill.png");
     Image16Save(filename, &dispimage, NULL);
 
     sprintf(filename, "%s%s", dstdirname, "/left.txt");
-    SaveMatrixPixel(filename, sgm.left, height, width);
+    SaveMatrixUshort(filename, (ushort*)sgm.left, height, width);
 
     sprintf(filename, "%s%s", dstdirname, "/right.txt");
-    SaveMatrixPixel(filename, sgm.right, height, width);
+    SaveMatrixUshort(filename, (ushort*)sgm.right, height, width);
 
     sprintf(filename, "%s%s", dstdirname, "/check.txt");
-    SaveMatrixPixel(filename, sgm.sparse, height, width);
+    SaveMatrixUshort(filename, (ushort*)sgm.sparse, height, width);
 
     sprintf(filename, "%s%s", dstdirname, "/fill.txt");
-    SaveMatrixPixel(filename, sgm.dense, height, width);
+    SaveMatrixUshort(filename, (ushort*)sgm.dense, height, width);
 
     free(dispimage.data);
 
@@ -15,6 +15,7 @@
 #include "ImageRegionClassify.h"
 
 #include <opencv2\opencv.hpp>
+#include "svafinterface.h"
 
 using namespace std;
 using namespace cv;
@@ -24,11 +25,13 @@ namespace pc{
 Mat SuperPixelSegment(Mat& image, int K, int M, bool optint, bool saveseg, string segname){
 
 	IMAGE_S srcImage8;
+	IMAGE_S dstImage8;
 	IerInfo ier;
 	int height, width, channel;
+	Mat buf;
 
 	Mat mat_empty;
-	if (!MatRead(image, &srcImage8)){
+	if (!MatView(image, &srcImage8, buf)){
 		return mat_empty;
 	}
 
@@ -58,191 +61,310 @@ Mat SuperPixelSegment(Mat& image, int K, int M, bool optint, bool saveseg, strin
 		SaveMatrixInt((char*)segname.c_str(), ier.label, height, width);
 	}
 
-	ImageSegShow(&srcImage8, ier.label, NULL, &srcImage8);
-
-	// תΪMat
-	Mat mat = Image2Mat(&srcImage8, NULL);
+	// ֱӻƵMat, ͼ񱣳ֲ
+	Mat mat(height, width, CV_8UC(channel));
+	dstImage8 = srcImage8;
+	dstImage8.data = mat.data;
+	ImageSegShow(&srcImage8, ier.label, NULL, &dstImage8);
 
 	// ͷڴ
-	free(srcImage8.data);
 	ImageIerDestroy(&ier);
 
 	return mat;
 }
 
-bool EadpMatch(Mat& left, Mat& right, Mat& l_disp, Mat& r_disp, Mat& check, Mat& fill,
-	int dlength, int factor, int guildmr, int dispmr, float sg, float sc, float r1, float r2,
-	string prefix, bool savetxt){
+// PIXELӲתΪCV_16UӲͼ(factor), ImppDisp2ImagePixel + Image16Matһ, 16λʱ
+static void Disp2Mat16(const PIXEL *label, int height, int width, int factor, Mat& mat){
+	mat.create(height, width, CV_16U);
+	for (int i = 0; i < height; ++i){
+		ushort *ptr = mat.ptr<ushort>(i);
+		for (int j = 0; j < width; ++j){
+			int v = (int)(label[j] * (float)factor + 0.5f);
+			ptr[j] = (ushort)(v < 0xFFFF ? v : 0xFFFF);
+		}
+		label += width;
+	}
+}
 
-	IMAGE32_S dispimage;
-	IMAGE_S imageL, imageR;
-	ImEadpInfo eadp;
-	double t = 0;
+// Ӳ(x IMPP_DISP_SCALE)תΪCV_16UӲͼ, ImppDisp2ImageShort + Image16Matһ;
+// ЧΪ0xFFFF, ЧӲ͵0xFFFE, ֤Чֵ(Ҫfactor*max_disp < 0xFFFF)
+static void Disp16Mat16(const short *disp16, int height, int width, int factor, Mat& mat){
+	mat.create(height, width, CV_16U);
+	for (int i = 0; i < height; ++i){
+		ushort *ptr = mat.ptr<ushort>(i);
+		for (int j = 0; j < width; ++j){
+			if (disp16[j] == IMPP_DISP16_INVALID){
+				ptr[j] = 0xFFFF;
+			} else{
+				int v = (int)(disp16[j] * (float)factor / IMPP_DISP_SCALE + 0.5f);
+				ptr[j] = (ushort)(v < 0xFFFE ? v : 0xFFFE);
+			}
+		}
+		disp16 += width;
+	}
+}
 
-	int height, width, channel, area;
+static void SaveDispTxt(string& prefix, PIXEL *left, PIXEL *right, PIXEL *check, PIXEL *fill,
+	int height, int width){
+	char filename[256];
+	sprintf(filename, "%s%s", prefix.c_str(), "_left.txt");
+	SaveMatrixPixel(filename, left, height, width);
 
-	if (!MatRead(left, &imageL)){
-		return false;
-	}
-	if (!MatRead(right, &imageR)){
-		return false;
-	}
+	sprintf(filename, "%s%s", prefix.c_str(), "_right.txt");
+	SaveMatrixPixel(filename, right, height, width);
 
-	height = imageL.height;
-	width = imageL.width;
-	channel = imageL.channel;
-	area = height*width;
-	if (height < 0 || width < 0)    return false;
+	sprintf(filename, "%s%s", prefix.c_str(), "_check.txt");
+	SaveMatrixPixel(filename, check, height, width);
 
-	// ʼ
+	sprintf(filename, "%s%s", prefix.c_str(), "_fill.txt");
+	SaveMatrixPixel(filename, fill, height, width);
+}
+
+// Ӳx IMPP_DISP_SCALE
+static void SaveDispTxt(string& prefix, short *left, short *right, short *check, short *fill,
+	int height, int width){
+	char filename[256];
+	sprintf(filename, "%s%s", prefix.c_str(), "_left.txt");
+	SaveMatrixUshort(filename, (ushort*)left, height, width);
+
+	sprintf(filename, "%s%s", prefix.c_str(), "_right.txt");
+	SaveMatrixUshort(filename, (ushort*)right, height, width);
+
+	sprintf(filename, "%s%s", prefix.c_str(), "_check.txt");
+	SaveMatrixUshort(filename, (ushort*)check, height, width);
+
+	sprintf(filename, "%s%s", prefix.c_str(), "_fill.txt");
+	SaveMatrixUshort(filename, (ushort*)fill, height, width);
+}
+
+EadpMatcher::EadpMatcher() : inited(false){
+	SetParam();
+}
+
+EadpMatcher::~EadpMatcher(){
+	Release();
+}
+
+void EadpMatcher::SetParam(int dlength, int factor, int guildmr, int dispmr,
+	float sg, float sc, float r1, float r2, bool fast){
+	Release();
+	this->dlength = dlength;
+	this->factor = factor;
+	this->guildmr = guildmr;
+	this->dispmr = dispmr;
+	this->sg = sg;
+	this->sc = sc;
+	this->r1 = r1;
+	this->r2 = r2;
+	this->fast = fast;
+}
+
+void EadpMatcher::Init(int height, int width, int channel){
 	ImageMatchEadpPara(&eadp);
 	eadp.height = height;
 	eadp.width = width;
 	eadp.channel = channel;
 	eadp.dlength = dlength;
-	eadp.src[0] = &imageL;
-	eadp.src[1] = &imageR;
+	eadp.src[0] = &src[0];
+	eadp.src[1] = &src[1];
 	eadp.guildmr = guildmr;
 	eadp.dispmr = dispmr;
 	eadp.sg = sg;
 	eadp.sc = sc;
 	eadp.r1 = r1;
 	eadp.r2 = r2;
+	eadp.fast = fast ? 1 : 0;
 	ImageMatchEadpInit(&eadp);
+	inited = true;
+}
 
-	// Ӳ
-	//TsTimeInit();
-	//TsTimeStart(t);
-	ImageMatchEadpProc(&eadp);
-	//TsTimeEnd(t);
-	//TsGetTime(t);
-	//printf("eadp time: %.1f ms\n", t * 1000);
+void EadpMatcher::Release(){
+	if (inited){
+		ImageMatchEadpDestroy(&eadp);
+		inited = false;
+	}
+}
 
-	// 
-	dispimage.data = MallocType(int, height*width);
-	dispimage.height = height;
-	dispimage.width = width;
-	dispimage.channel = 1;
+bool EadpMatcher::Match(Mat& left, Mat& right, Mat& l_disp, Mat& r_disp, Mat& check, Mat& fill,
+	string prefix, bool savetxt){
 
-	ImppDisp2ImagePixel(dispimage.data, eadp.left, area, (float)factor);
-	l_disp = Image16Mat(&dispimage, NULL);
+	if (!MatView(left, &src[0], buf[0]) || !MatView(right, &src[1], buf[1])){
+		return false;
+	}
+	int height = src[0].height;
+	int width = src[0].width;
+	int channel = src[0].channel;
+	if (src[1].height != height || src[1].width != width || src[1].channel != channel){
+		return false;
+	}
 
-	ImppDisp2ImagePixel(dispimage.data, eadp.right, area, (float)factor);
-	r_disp = Image16Mat(&dispimage, NULL);
+	// ֱʱ仯ʱڴ
+	if (!inited || eadp.height != height || eadp.width != width || eadp.channel != channel){
+		Release();
+		Init(height, width, channel);
+	}
 
-	ImppDisp2ImagePixel(dispimage.data, eadp.sparse, area, (float)factor); // check
-	check = Image16Mat(&dispimage, NULL);
+	// Ӳ
+	if (!ImageMatchEadpProc(&eadp)){
+		return false;
+	}
 
-	ImppDisp2ImagePixel(dispimage.data, eadp.dense, area, (float)factor); // fill
-	fill = Image16Mat(&dispimage, NULL);
+	// 
+	Disp2Mat16(eadp.left, height, width, factor, l_disp);
+	Disp2Mat16(eadp.right, height, width, factor, r_disp);
+	Disp2Mat16(eadp.sparse, height, width, factor, check);
+	Disp2Mat16(eadp.dense, height, width, factor, fill);
 
-	char filename[256];
 	if (savetxt){
-		sprintf(filename, "%s%s", prefix.c_str(), "_left.txt");
-		SaveMatrixPixel(filename, eadp.left, height, width);
-
-		sprintf(filename, "%s%s", prefix.c_str(), "_right.txt");
-		SaveMatrixPixel(filename, eadp.right, height, width);
-
-		sprintf(filename, "%s%s", prefix.c_str(), "_check.txt");
-		SaveMatrixPixel(filename, eadp.sparse, height, width);
-
-		sprintf(filename, "%s%s", prefix.c_str(), "_fill.txt");
-		SaveMatrixPixel(filename, eadp.dense, height, width);
+		SaveDispTxt(prefix, eadp.left, eadp.right, eadp.sparse, eadp.dense, height, width);
 	}
 
-	free(dispimage.data);
-
-	// ͷڴ
-	free(imageL.data);
-	free(imageR.data);
-	ImageMatchEadpDestroy(&eadp);
-
 	return true;
 }
 
-bool SgmMatch(Mat& left, Mat& right, Mat& l_disp, Mat& r_disp, Mat& check, Mat& fill,
-	int dlength, int factor, int dispmr, float r1, float r2,
+bool EadpMatch(Mat& left, Mat& right, Mat& l_disp, Mat& r_disp, Mat& check, Mat& fill,
+	int dlength, int factor, int guildmr, int dispmr, float sg, float sc, float r1, float r2,
 	string prefix, bool savetxt){
 
-	IMAGE32_S dispimage;
-	IMAGE_S imageL, imageR;
-	ImSgmInfo sgm;
+	EadpMatcher matcher;
+	matcher.SetParam(dlength, factor, guildmr, dispmr, sg, sc, r1, r2);
+	return matcher.Match(left, right, l_disp, r_disp, check, fill, prefix, savetxt);
+}
 
-	int height, width, channel, area;
-	double t = 0;
+SgmMatcher::SgmMatcher() : inited(false), prevleft(NULL), prevright(NULL){
+	SetParam();
+}
+
+SgmMatcher::~SgmMatcher(){
+	Release();
+}
 
-	MatRead(left, &imageL);
-	MatRead(right, &imageR);
+void SgmMatcher::SetParam(int dlength, int factor, int dispmr, float r1, float r2,
+	int pyramid, int margin, bool temporal, int tile, int motion, int uniqueness, bool subpixel){
+	Release();
+	this->dlength = dlength;
+	this->factor = factor;
+	this->dispmr = dispmr;
+	this->r1 = r1;
+	this->r2 = r2;
+	this->pyramid = pyramid;
+	this->margin = margin;
+	this->temporal = temporal;
+	this->tile = tile;
+	this->motion = motion;
+	this->uniqueness = uniqueness;
+	this->subpixel = subpixel;
+}
 
-	height = imageL.height;
-	width = imageL.width;
-	channel = imageL.channel;
-	area = height*width;
-	if (height < 0 || width < 0)    return false;
+void SgmMatcher::Init(int height, int width, int channel){
+	int area = height*width;
 
-	// ʼ
 	ImageMatchSgmPara(&sgm);
 	sgm.height = height;
 	sgm.width = width;
 	sgm.channel = channel;
 	sgm.dlength = dlength;
-	sgm.src[0] = &imageL;
-	sgm.src[1] = &imageR;
+	sgm.src[0] = &src[0];
+	sgm.src[1] = &src[1];
 	sgm.dispmr = dispmr;
 	sgm.r1 = r1;
 	sgm.r2 = r2;
+	sgm.pyramid = pyramid;
+	sgm.margin = margin;
+	sgm.temporal = temporal;
+	sgm.tile = tile;
+	sgm.motion = motion;
+	sgm.uniqueness = uniqueness;
+	sgm.subpixel = subpixel;
 	ImageMatchSgmInit(&sgm);
 
-	// Ӳ
-	//TsTimeInit();
-	//TsTimeStart(t);
-	ImageMatchSgmProc(&sgm);
-	//TsTimeEnd(t);
-	//TsGetTime(t);
-	//printf("sgm time: %.1f ms\n", t * 1000);
+	if (temporal){
+		prev.height = height;
+		prev.width = width;
+		prev.channel = channel;
+		prev.data = MallocType(PIXEL, area*channel);
+		prevleft = MallocType(short, area);
+		prevright = MallocType(short, area);
+	}
+	inited = true;
+}
 
-	// 
-	dispimage.data = MallocType(int, height*width);
-	dispimage.height = height;
-	dispimage.width = width;
-	dispimage.channel = 1;
+void SgmMatcher::Release(){
+	if (inited){
+		if (prevleft != NULL){
+			free(prev.data);
+			free(prevleft);
+			free(prevright);
+			prevleft = prevright = NULL;
+		}
+		ImageMatchSgmDestroy(&sgm);
+		inited = false;
+	}
+}
 
-	ImppDisp2ImagePixel(dispimage.data, sgm.left, area, (float)factor);
-	l_disp = Image16Mat(&dispimage, NULL);
+void SgmMatcher::ResetTemporal(){
+	if (inited){
+		sgm.prev = NULL;
+		sgm.prevleft = NULL;
+		sgm.prevright = NULL;
+	}
+}
 
-	ImppDisp2ImagePixel(dispimage.data, sgm.right, area, (float)factor);
-	r_disp = Image16Mat(&dispimage, NULL);
+bool SgmMatcher::Match(Mat& left, Mat& right, Mat& l_disp, Mat& r_disp, Mat& check, Mat& fill,
+	string prefix, bool savetxt){
 
-	ImppDisp2ImagePixel(dispimage.data, sgm.sparse, area, (float)factor); // check
-	check = Image16Mat(&dispimage, NULL);
+	if (!MatView(left, &src[0], buf[0]) || !MatView(right, &src[1], buf[1])){
+		return false;
+	}
+	int height = src[0].height;
+	int width = src[0].width;
+	int channel = src[0].channel;
+	int area = height*width;
+	if (src[1].height != height || src[1].width != width || src[1].channel != channel){
+		return false;
+	}
 
-	ImppDisp2ImagePixel(dispimage.data, sgm.dense, area, (float)factor); // fill
-	fill = Image16Mat(&dispimage, NULL);
+	// ֱʱ仯ʱڴ(ǰһ֮֡ʧЧ)
+	if (!inited || sgm.height != height || sgm.width != width || sgm.channel != channel){
+		Release();
+		Init(height, width, channel);
+	}
 
-	char filename[256];
-	if (savetxt){
-		sprintf(filename, "%s%s", prefix.c_str(), "_left.txt");
-		SaveMatrixPixel(filename, sgm.left, height, width);
+	// Ӳ
+	if (!ImageMatchSgmProc(&sgm)){
+		return false;
+	}
 
-		sprintf(filename, "%s%s", prefix.c_str(), "_right.txt");
-		SaveMatrixPixel(filename, sgm.right, height, width);
+	// 汾֡Ϊһ֡Ӳ(Ӳδֵ˲fill)
+	if (temporal){
+		memcpy(prev.data, src[0].data, area*channel*sizeof(PIXEL));
+		memcpy(prevleft, sgm.fill, area*sizeof(short));
+		memcpy(prevright, sgm.right, area*sizeof(short));
+		sgm.prev = &prev;
+		sgm.prevleft = prevleft;
+		sgm.prevright = prevright;
+	}
 
-		sprintf(filename, "%s%s", prefix.c_str(), "_check.txt");
-		SaveMatrixPixel(filename, sgm.sparse, height, width);
+	// 
+	Disp16Mat16(sgm.left, height, width, factor, l_disp);
+	Disp16Mat16(sgm.right, height, width, factor, r_disp);
+	Disp16Mat16(sgm.sparse, height, width, factor, check);
+	Disp16Mat16(sgm.dense, height, width, factor, fill);
 
-		sprintf(filename, "%s%s", prefix.c_str(), "_fill.txt");
-		SaveMatrixPixel(filename, sgm.dense, height, width);
+	if (savetxt){
+		SaveDispTxt(prefix, sgm.left, sgm.right, sgm.sparse, sgm.dense, height, width);
 	}
 
-	free(dispimage.data);
+	return true;
+}
 
-	// ͷڴ
-	free(imageL.data);
-	free(imageR.data);
-	ImageMatchSgmDestroy(&sgm);
+bool SgmMatch(Mat& left, Mat& right, Mat& l_disp, Mat& r_disp, Mat& check, Mat& fill,
+	int dlength, int factor, int dispmr, float r1, float r2,
+	string prefix, bool savetxt, int pyramid, int margin){
 
-	return true;
+	SgmMatcher matcher;
+	matcher.SetParam(dlength, factor, dispmr, r1, r2, pyramid, margin);
+	return matcher.Match(left, right, l_disp, r_disp, check, fill, prefix, savetxt);
 }
 
 void TestImageSupixFeature(int argc, char** argv)
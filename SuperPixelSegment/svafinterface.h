@@ -1,5 +1,9 @@
+#pragma once
 #include <opencv2\opencv.hpp>
 
+#include "ImageMatchEadp.h"
+#include "ImageMatchSgm.h"
+
 using namespace std;
 using namespace cv;
 
@@ -12,6 +16,81 @@ bool EadpMatch(Mat& left, Mat& right, Mat& l_disp, Mat& r_disp, Mat& check, Mat&
 	string prefix = "./eadp", bool savetxt = false);
 bool SgmMatch(Mat& left, Mat& right, Mat& l_disp, Mat& r_disp, Mat& check, Mat& fill,
 	int dlength = 24, int factor = 2560, int dispmr = 1, float r1 = 10, float r2 = 500,
-	string prefix = "./sgm", bool savetxt = false);
+	string prefix = "./sgm", bool savetxt = false, int pyramid = 0, int margin = 2);
+
+// ɸõƥ: ֱһڴ, ֮ÿ֡;
+// 8λֱcv::Mat, дߵMat(ߴ粻ʱ)
+class SgmMatcher{
+public:
+	SgmMatcher();
+	~SgmMatcher();
+	void SetParam(int dlength = 24, int factor = 2560, int dispmr = 1, float r1 = 10, float r2 = 500,
+		int pyramid = 0, int margin = 2, bool temporal = false, int tile = 16, int motion = 8,
+		int uniqueness = 0, bool subpixel = false);
+	bool Match(Mat& left, Mat& right, Mat& l_disp, Mat& r_disp, Mat& check, Mat& fill,
+		string prefix = "./sgm", bool savetxt = false);
+	// ǰһ֡(ԭͼƶǰһ֡ӲٶӦ), һ֡ȫΧ
+	void ResetTemporal();
+
+private:
+	SgmMatcher(const SgmMatcher&);
+	SgmMatcher& operator=(const SgmMatcher&);
+	void Init(int height, int width, int channel);
+	void Release();
+
+	ImSgmInfo	sgm;
+	bool		inited;
+	int			dlength;
+	int			factor;
+	int			dispmr;
+	float		r1;
+	float		r2;
+	int			pyramid;
+	int			margin;
+	bool		temporal;
+	int			tile;
+	int			motion;
+	int			uniqueness;
+	bool		subpixel;
+
+	IMAGE_S		src[2];
+	Mat			buf[2];		// ҪתʱĻ
+
+	// ǰһ֡(temporal)
+	IMAGE_S		prev;
+	short*		prevleft;
+	short*		prevright;
+};
+
+class EadpMatcher{
+public:
+	EadpMatcher();
+	~EadpMatcher();
+	void SetParam(int dlength = 24, int factor = 2560, int guildmr = 1, int dispmr = 1,
+		float sg = -25.0, float sc = 25.5, float r1 = 10, float r2 = 500, bool fast = false);
+	bool Match(Mat& left, Mat& right, Mat& l_disp, Mat& r_disp, Mat& check, Mat& fill,
+		string prefix = "./eadp", bool savetxt = false);
+
+private:
+	EadpMatcher(const EadpMatcher&);
+	EadpMatcher& operator=(const EadpMatcher&);
+	void Init(int height, int width, int channel);
+	void Release();
+
+	ImEadpInfo	eadp;
+	bool		inited;
+	int			dlength;
+	int			factor;
+	int			guildmr;
+	int			dispmr;
+	float		sg;
+	float		sc;
+	float		r1;
+	float		r2;
+	bool		fast;
+
+	IMAGE_S		src[2];
+	Mat			buf[2];
+};
 
 }
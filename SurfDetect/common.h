@@ -60,6 +60,7 @@ typedef struct _Ipoint{
 	float	descriptor[64];
 
 	uchar	laplacian;
+	float	response;
 	int		clusterIndex;
 } Ipoint;
 
@@ -97,5 +98,15 @@ struct AlgParam{
 void SurfPoint(cv::Mat& image, vector<cv::Point2f>& points, vector<float>& scales, vector<int>& label);
 void SurfDescriptor(cv::Mat& image, vector<cv::Point2f>& points, vector<float>& scales,
 	vector<vector<float>>& descriptors);
+// row i of the 64-d descriptors is written to (char*)descriptors + i * step
+void SurfDescriptor(cv::Mat& image, vector<cv::Point2f>& points, vector<float>& scales,
+	float *descriptors, size_t step);
+// the same on a precomputed integral image: CV_32FC1, continuous, the integral of gray / 255
+// with the size of the image (see SVAF/src/Integral.h)
+// response, if given, receives the Hessian response of each point
+void SurfPointIntegral(const cv::Mat& ii, vector<cv::Point2f>& points, vector<float>& scales, vector<int>& label,
+	vector<float>* response = NULL);
+void SurfDescriptorIntegral(const cv::Mat& ii, vector<cv::Point2f>& points, vector<float>& scales,
+	float *descriptors, size_t step);
 
 }
@@ -13,6 +13,8 @@
 
 #include "common.h"
 #include "integral.h"
+#include <xmmintrin.h>
+#include <algorithm>
 
 using namespace std;
 
@@ -59,85 +61,217 @@ inline static const float getAngle(const float X, const float Y){
 	return 0;
 }
 
-static void computeDiscriptors(const fimg& ii_img, vector<Ipoint>& ipts, 
-	const bool upright){
-	for (int idx = 0; idx < ipts.size(); ++idx){
-	  float co, si;
-	  float cx = -0.5f;
-	  float cy = 0.0f;
-	  float len = 0.0f;
-	  int count = 0;
-	  float scale = ipts[idx].s;
-	  int x = int(ipts[idx].x + 0.5);
-	  int y = int(ipts[idx].y + 0.5);
-	  float *desc = ipts[idx].descriptor;
-
-	  if (upright){
-		co = 1;
-		si = 0;
-	  } else{
-		co = cos(ipts[idx].orientation);
-		si = sin(ipts[idx].orientation);
-	  }
-	  int i = -8;
-	  while (i < 12){
-		int j = -8;
-		i = i - 4;
-		cx += 1.0f;
-		cy = -0.5f;
-		while (j < 12){
-		  float dx, dy, mdx, mdy;
-		  dx = dy = mdx = mdy = 0.0f;
-		  cy += 1.0f;
-		  j = j - 4;
-
-		  const int ix = i + 5;
-		  const int jx = j + 5;
-		  const int xs = round(x + (-jx*scale*si + ix*scale*co));
-		  const int ys = round(y + (jx*scale*co + ix*scale*si));
-			for (int k = i; k < i + 9; ++k){
-			  for (int l = j; l < j + 9; ++l){
-				const int sample_x = round(x + (-l*scale*si + k*scale*co));
-				const int sample_y = round(y + (l*scale*co + k*scale*si));
-
-				const float gauss_s1 = gaussian(xs - sample_x, ys - sample_y, 2.5f*scale);
-				const float rx = haarX(ii_img, sample_y, sample_x, 2 * round(scale));
-				const float ry = haarY(ii_img, sample_y, sample_x, 2 * round(scale));
-
-				const float rrx = gauss_s1 * (-rx * si + ry * co);
-				const float rry = gauss_s1 * (rx * co + ry * si);
-
-				dx += rrx;
-				dy += rry;
-				mdx += fabs(rrx);
-				mdy += fabs(rry);
-			  }
-			}
+// the 4x4 subregions of a descriptor sample k, l in [-12, 12) (in units of the
+// scale), subregion b covers [-12 + 5 * b, -12 + 5 * b + 9) around the center
+// -7 + 5 * b, so neighbouring subregions share their border samples
+#define GRID	24
+#define GRID0	12
+
+// exp(-d * d / (2 * sig * sig)) for d = 0 .. table.size() - 1. The 2-d gaussian
+// of the samples is separable, a table per keypoint scale replaces 400 exp calls;
+// its constant factor cancels when the descriptor is normalized.
+static void gaussianTable(const float sig, const int size, float *table){
+	for (int d = 0; d < size; ++d){
+		table[d] = exp(-(float)(d * d) / (2.0f*sig*sig));
+	}
+}
+
+// weight of the 4x4 subregions, gaussian(cx - 2.0f, cy - 2.0f, 1.5f)
+static void subregionTable(float table[4][4]){
+	for (int i = 0; i < 4; ++i){
+		for (int j = 0; j < 4; ++j){
+			table[i][j] = gaussian(i + 0.5f - 2.0f, j + 0.5f - 2.0f, 1.5f);
+		}
+	}
+}
+
+static inline void normalizeDescriptor(float *desc, float len){
+	len = sqrt(len);
+	for (int i = 0; i < 64; ++i){
+		desc[i] /= len;
+	}
+}
+
+// upright: the samples lie on an axis aligned grid, sample_x depends on k only and
+// sample_y on l only, so the gaussian weights are separable. Each subregion column
+// is first weighted along l for all 24 k at once (4 k per SSE instruction), then
+// along k.
+static void uprightDescriptor(const fimg& ii_img, const Ipoint& ipt, const float g2[4][4],
+	const float *table, float *desc){
+	const float scale = ipt.s;
+	const int x = int(ipt.x + 0.5);
+	const int y = int(ipt.y + 0.5);
+	const int size = 2 * round(scale);
 
-			const float gauss_s2 = gaussian(cx - 2.0f, cy - 2.0f, 1.5f);
-			desc[count++] = dx * gauss_s2;
-			desc[count++] = dy * gauss_s2;
-			desc[count++] = mdx * gauss_s2;
-			desc[count++] = mdy * gauss_s2;
+	int sx[GRID], sy[GRID];
+	for (int k = 0; k < GRID; ++k){
+		sx[k] = round(x + (k - GRID0)*scale);
+		sy[k] = round(y + (k - GRID0)*scale);
+	}
+
+	// haar responses, [l][k]: rx, |rx|, ry, |ry|
+	__m128 res[4][GRID][GRID / 4];
+	for (int l = 0; l < GRID; ++l){
+		float *rx = (float*)res[0][l], *ax = (float*)res[1][l];
+		float *ry = (float*)res[2][l], *ay = (float*)res[3][l];
+		for (int k = 0; k < GRID; ++k){
+			rx[k] = haarX(ii_img, sy[l], sx[k], size);
+			ry[k] = haarY(ii_img, sy[l], sx[k], size);
+			ax[k] = fabs(rx[k]);
+			ay[k] = fabs(ry[k]);
+		}
+	}
+
+	// wx[b][k - (-12 + 5 * b)], wy[b][l - (-12 + 5 * b)]
+	float wx[4][9], wy[4][9];
+	for (int b = 0; b < 4; ++b){
+		const int c = -7 + 5 * b;
+		const int xs = round(x + c*scale);
+		const int ys = round(y + c*scale);
+		for (int t = 0; t < 9; ++t){
+			wx[b][t] = table[abs(xs - sx[5 * b + t])];
+			wy[b][t] = table[abs(ys - sy[5 * b + t])];
+		}
+	}
 
+	float len = 0.0f;
+	for (int bj = 0; bj < 4; ++bj){
+		// column sums over the 9 l of the subregion column, for all k
+		__m128 col[4][GRID / 4];
+		for (int q = 0; q < 4; ++q){
+			for (int v = 0; v < GRID / 4; ++v){
+				col[q][v] = _mm_setzero_ps();
+			}
+		}
+		for (int t = 0; t < 9; ++t){
+			const __m128 w = _mm_set1_ps(wy[bj][t]);
+			const int l = 5 * bj + t;
+			for (int q = 0; q < 4; ++q){
+				for (int v = 0; v < GRID / 4; ++v){
+					col[q][v] = _mm_add_ps(col[q][v], _mm_mul_ps(w, res[q][l][v]));
+				}
+			}
+		}
+		const float *cx = (float*)col[0], *cax = (float*)col[1];
+		const float *cy = (float*)col[2], *cay = (float*)col[3];
+		for (int bi = 0; bi < 4; ++bi){
+			float dx = 0.0f, dy = 0.0f, mdx = 0.0f, mdy = 0.0f;
+			for (int t = 0; t < 9; ++t){
+				const int k = 5 * bi + t;
+				dx += wx[bi][t] * cy[k];
+				dy += wx[bi][t] * cx[k];
+				mdx += wx[bi][t] * cay[k];
+				mdy += wx[bi][t] * cax[k];
+			}
+			const float gauss_s2 = g2[bi][bj];
+			float *d = desc + (bi * 4 + bj) * 4;
+			d[0] = dx * gauss_s2;
+			d[1] = dy * gauss_s2;
+			d[2] = mdx * gauss_s2;
+			d[3] = mdy * gauss_s2;
 			len += (dx*dx + dy*dy + mdx*mdx + mdy*mdy) * gauss_s2 * gauss_s2;
-			j += 9;
-		  }
-		  i += 9;
 		}
-		len = sqrt(len);
-		for (int i = 0; i < 64; ++i){
-			desc[i] /= len;
+	}
+	normalizeDescriptor(desc, len);
+}
+
+// oriented: the haar responses of the 24x24 rotated samples are computed once and
+// shared by the overlapping subregions
+static void orientedDescriptor(const fimg& ii_img, const Ipoint& ipt, const float g2[4][4],
+	const float *table, const int tsize, float *desc){
+	const float scale = ipt.s;
+	const int x = int(ipt.x + 0.5);
+	const int y = int(ipt.y + 0.5);
+	const int size = 2 * round(scale);
+	const float co = cos(ipt.orientation);
+	const float si = sin(ipt.orientation);
+
+	int sx[GRID][GRID], sy[GRID][GRID];
+	float rrx[GRID][GRID], rry[GRID][GRID];
+	for (int k = 0; k < GRID; ++k){
+		for (int l = 0; l < GRID; ++l){
+			const int kk = k - GRID0;
+			const int ll = l - GRID0;
+			const int sample_x = sx[k][l] = round(x + (-ll*scale*si + kk*scale*co));
+			const int sample_y = sy[k][l] = round(y + (ll*scale*co + kk*scale*si));
+			const float rx = haarX(ii_img, sample_y, sample_x, size);
+			const float ry = haarY(ii_img, sample_y, sample_x, size);
+			rrx[k][l] = -rx * si + ry * co;
+			rry[k][l] = rx * co + ry * si;
 		}
 	}
 
+	float len = 0.0f;
+	for (int bi = 0; bi < 4; ++bi){
+		for (int bj = 0; bj < 4; ++bj){
+			const int ix = -7 + 5 * bi;
+			const int jx = -7 + 5 * bj;
+			const int xs = round(x + (-jx*scale*si + ix*scale*co));
+			const int ys = round(y + (jx*scale*co + ix*scale*si));
+			float dx = 0.0f, dy = 0.0f, mdx = 0.0f, mdy = 0.0f;
+			for (int k = 5 * bi; k < 5 * bi + 9; ++k){
+				for (int l = 5 * bj; l < 5 * bj + 9; ++l){
+					const float gauss_s1 = table[std::min(abs(xs - sx[k][l]), tsize - 1)]
+						* table[std::min(abs(ys - sy[k][l]), tsize - 1)];
+					const float gx = gauss_s1 * rrx[k][l];
+					const float gy = gauss_s1 * rry[k][l];
+					dx += gx;
+					dy += gy;
+					mdx += fabs(gx);
+					mdy += fabs(gy);
+				}
+			}
+			const float gauss_s2 = g2[bi][bj];
+			float *d = desc + (bi * 4 + bj) * 4;
+			d[0] = dx * gauss_s2;
+			d[1] = dy * gauss_s2;
+			d[2] = mdx * gauss_s2;
+			d[3] = mdy * gauss_s2;
+			len += (dx*dx + dy*dy + mdx*mdx + mdy*mdy) * gauss_s2 * gauss_s2;
+		}
+	}
+	normalizeDescriptor(desc, len);
+}
+
+static void computeDiscriptors(const fimg& ii_img, vector<Ipoint>& ipts,
+	const bool upright, float *out, size_t step){
+	float g2[4][4];
+	subregionTable(g2);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 8)
+#endif
+	for (int idx = 0; idx < (int)ipts.size(); ++idx){
+		float *desc = out ? (float*)((char*)out + idx * step) : ipts[idx].descriptor;
+		// a rounded sample is at most 5 * sqrt(2) scales + 1 pixel from the center
+		const int tsize = int(7.1f * ipts[idx].s) + 3;
+		vector<float> table(tsize);
+		gaussianTable(2.5f * ipts[idx].s, tsize, &table[0]);
+		if (upright){
+			uprightDescriptor(ii_img, ipts[idx], g2, &table[0], desc);
+		} else{
+			orientedDescriptor(ii_img, ipts[idx], g2, &table[0], tsize, desc);
+		}
+	}
 }
 
 static void computeOrientation(const fimg& ii_img, vector<Ipoint>& ipts){
-	const int id[] = { 6, 5, 4, 3, 2, 1, 0, 1, 2, 3, 4, 5, 6 };
-	float resX[109], resY[109], Ang[109];
+	// the 42 windows of PI / 3 starting at 0, 0.15, 0.30 ...
+	float win1[48], win2[48];
+	int nwin = 0;
+	for (float ang1 = 0; ang1 < 2 * PI; ang1 += 0.15f){
+		win1[nwin] = ang1;
+		win2[nwin] = (ang1 + PI / 3.0f > 2 * PI ?
+			ang1 - 5.0f * PI / 3.0f : ang1 + PI / 3.0f);
+		nwin++;
+	}
 
-	for (int idx = 0; idx < ipts.size(); idx++){
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 8)
+#endif
+	for (int idx = 0; idx < (int)ipts.size(); idx++){
+		const int id[] = { 6, 5, 4, 3, 2, 1, 0, 1, 2, 3, 4, 5, 6 };
+		float resX[109], resY[109], Ang[109];
 		const int s = round(ipts[idx].s);
 		const int r = round(ipts[idx].y);
 		const int c = round(ipts[idx].x);
@@ -155,23 +289,39 @@ static void computeOrientation(const fimg& ii_img, vector<Ipoint>& ipts){
 			}
 		}
 
-		float sumX = 0.0f, sumY = 0.0f;
+		// sort the samples by angle, a window (ang1, ang2) is then a range of the
+		// sorted samples (two ranges when it wraps around 2 * PI) and its sum a
+		// difference of prefix sums; both ends only move forward with ang1.
+		// An angle of 0 is in no window.
+		int order[109], n = 0;
+		for (int k = 0; k < 109; ++k){
+			if (Ang[k] > 0 && Ang[k] < 2 * PI){
+				order[n++] = k;
+			}
+		}
+		std::sort(order, order + n, [&Ang](int a, int b){ return Ang[a] < Ang[b]; });
+		double preX[110], preY[110];
+		preX[0] = preY[0] = 0;
+		for (int k = 0; k < n; ++k){
+			preX[k + 1] = preX[k] + resX[order[k]];
+			preY[k + 1] = preY[k] + resY[order[k]];
+		}
+
 		float max = 0.0f, orientation = 0.0f;
-		float ang1 = 0.0f, ang2 = 0.0f;
-
-		for (ang1 = 0; ang1 < 2 * PI; ang1 += 0.15f){
-			ang2 = (ang1 + PI / 3.0f > 2 * PI ? 
-				ang1 - 5.0f * PI / 3.0f : ang1 + PI / 3.0f);
-			sumX = sumY = 0.0f;
-			for (unsigned int k = 0; k < 109; ++k){
-				if (ang1 < ang2 && ang1 < Ang[k] && Ang[k] < ang2){
-					sumX += resX[k];
-					sumY += resY[k];
-				} else if (ang2 < ang1 && ( (Ang[k] > 0 && Ang[k] < ang2) 
-					|| (Ang[k] > ang1 && Ang[k] < 2 * PI) )){
-					sumX += resX[k];
-					sumY += resY[k];
-				}
+		int lo = 0, hi = 0, hw = 0;	// first > ang1, first >= ang2 (no wrap / wrap)
+		for (int w = 0; w < nwin; ++w){
+			const float ang1 = win1[w], ang2 = win2[w];
+			while (lo < n && Ang[order[lo]] <= ang1) lo++;
+			float sumX, sumY;
+			if (ang1 < ang2){
+				hi = std::max(hi, lo);
+				while (hi < n && Ang[order[hi]] < ang2) hi++;
+				sumX = (float)(preX[hi] - preX[lo]);
+				sumY = (float)(preY[hi] - preY[lo]);
+			} else{
+				while (hw < n && Ang[order[hw]] < ang2) hw++;
+				sumX = (float)(preX[hw] + preX[n] - preX[lo]);
+				sumY = (float)(preY[hw] + preY[n] - preY[lo]);
 			}
 
 			if (sumX * sumX + sumY * sumY > max){
@@ -185,14 +335,18 @@ static void computeOrientation(const fimg& ii_img, vector<Ipoint>& ipts){
 }
 
 void surfDescriptors(const fimg& ii_img, vector<Ipoint>& ipts){
+	surfDescriptors(ii_img, ipts, NULL, 0);
+}
+
+void surfDescriptors(const fimg& ii_img, vector<Ipoint>& ipts, float *out, size_t step){
 	if (!ipts.size()){
 		return;
 	}
 	if (suparam.upright){
-		computeDiscriptors(ii_img, ipts, true);
+		computeDiscriptors(ii_img, ipts, true, out, step);
 	} else{
 		computeOrientation(ii_img, ipts);
-		computeDiscriptors(ii_img, ipts, false);
+		computeDiscriptors(ii_img, ipts, false, out, step);
 	}
 
 }
@@ -18,6 +18,8 @@
 namespace pc{
 
 void surfDescriptors(const fimg& ii_img, std::vector<Ipoint>& ipts);
+// write row idx of descriptors to (char*)out + idx * step instead of Ipoint
+void surfDescriptors(const fimg& ii_img, std::vector<Ipoint>& ipts, float *out, size_t step);
 
 }
 
@@ -13,6 +13,8 @@
 
 #include "common.h"
 #include "integral.h"
+#include "fasthessian.h"
+#include "../SVAF/src/CpuFeature.h"
 using namespace std;
 
 namespace pc{
@@ -20,33 +22,62 @@ namespace pc{
 
 extern SurfParam suparam;
 
-static void buildResponseLayer(const fimg& ii_img, ResponseLayer& layer){
+static void padIntegral(const fimg& ii_img, const int pad, PaddedIntegral& pi){
+	pi.pad = pad;
+	pi.stride = ii_img.cols + 2 * pad;
+	const int rows = ii_img.rows + 2 * pad;
+	pi.data.assign((size_t)rows * pi.stride, 0.0f);
+	if (ii_img.rows <= 0 || ii_img.cols <= 0){
+		return;
+	}
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+	for (int i = pad; i < rows; ++i){
+		const float* src = &imgElem(ii_img, std::min(i - pad, ii_img.rows - 1), 0);
+		float* dst = &pi.data[(size_t)i * pi.stride + pad];
+		memcpy(dst, src, ii_img.cols * sizeof(float));
+		std::fill(dst + ii_img.cols, dst + ii_img.cols + pad, src[ii_img.cols - 1]);
+	}
+}
+
+// sumRect on the padded integral image
+static inline float boxSum(const PaddedIntegral& pi, const int row, const int col,
+	const int rows, const int cols){
+	const float* t = pi.at(row - 1, col - 1);
+	const float* b = pi.at(row + rows - 1, col - 1);
+	return std::max(0.0f, t[0] - t[cols] - b[0] + b[cols]);
+}
+
+static inline void hessian(const PaddedIntegral& pi, const int r, const int c,
+	const int b, const int l, const float inv_area, float& response, uchar& laplacian){
+	const float Dxx = (boxSum(pi, r - l + 1, c - b, 2 * l - 1, b * 2 + 1)
+		- boxSum(pi, r - l + 1, c - l / 2, 2 * l - 1, l) * 3) * inv_area;
+	const float Dyy = (boxSum(pi, r - b, c - l + 1, b * 2 + 1, 2 * l - 1)
+		- boxSum(pi, r - l / 2, c - l + 1, l, 2 * l - 1) * 3) * inv_area;
+	const float Dxy = (+boxSum(pi, r - l, c + 1, l, l)
+		+ boxSum(pi, r + 1, c - l, l, l)
+		- boxSum(pi, r - l, c - l, l, l)
+		- boxSum(pi, r + 1, c + 1, l, l)) * inv_area;
+	response = Dxx * Dyy - 0.81f * Dxy * Dxy;
+	laplacian = (Dxx + Dyy >= 0 ? 1 : 0);
+}
+
+// rows [row0, row1) of a response layer, the AVX2 kernel takes 8 samples at a time
+static void buildResponseRows(const PaddedIntegral& pi, ResponseLayer& layer, const int row0, const int row1,
+	const bool avx2){
 	const int step = layer.step;
 	const int b = (layer.filter - 1) / 2;
 	const int l = layer.filter / 3;
 	const int w = layer.filter;
-	const double inv_area = 1.f / (w * w);
-
-	double Dxx, Dyy, Dxy;
-	for (int ar = 0, index = 0; ar < layer.height; ++ar){
-		for (int ac = 0; ac < layer.width; ++ac, index++){
-			const int r = ar * step;
-			const int c = ac * step;
-			Dxx = sumRect(ii_img, r - l + 1, c - b, 2 * l - 1, w)
-				- sumRect(ii_img, r - l + 1, c - l / 2, 2 * l - 1, l) * 3;
-			Dyy = sumRect(ii_img, r - b, c - l + 1, w, 2 * l - 1)
-				- sumRect(ii_img, r - l / 2, c - l + 1, l, 2 * l - 1) * 3;
-			Dxy = +sumRect(ii_img, r - l, c + 1, l, l)
-				+ sumRect(ii_img, r + 1, c - l, l, l)
-				- sumRect(ii_img, r - l, c - l, l, l)
-				- sumRect(ii_img, r + 1, c + 1, l, l);
-
-			Dxx *= inv_area;
-			Dyy *= inv_area;
-			Dxy *= inv_area;
-
-			layer.responses[index] = Dxx * Dyy - 0.81f * Dxy * Dxy;
-			layer.laplacian[index] = (Dxx + Dyy >= 0 ? 1 : 0);
+	const float inv_area = 1.f / (w * w);
+
+	for (int ar = row0; ar < row1; ++ar){
+		const int r = ar * step;
+		int ac = avx2 ? buildResponseRowAVX2(pi, layer, ar) : 0;
+		int index = ar * layer.width + ac;
+		for (; ac < layer.width; ++ac, ++index){
+			hessian(pi, r, ac * step, b, l, inv_area, layer.responses[index], layer.laplacian[index]);
 		}
 	}
 }
@@ -93,7 +124,29 @@ vector<ResponseLayer> buildResponseMap(const fimg& ii_img){
 			(uchar*)calloc(responseMap[i].width * responseMap[i].height, sizeof(uchar));
 		responseMap[i].responses = 
 			(float*)calloc(responseMap[i].width * responseMap[i].height, sizeof(float));
-		buildResponseLayer(ii_img, responseMap[i]);
+	}
+
+	// the largest filter reaches (filter - 1) / 2 + 1 pixels beyond a sample
+	PaddedIntegral pi;
+	padIntegral(ii_img, (filtersize - 1) / 2 + 2, pi);
+
+	// the layers are independent: split them into bands of rows and build all
+	// bands in parallel, so the few large first-octave layers do not serialize
+	static const int band = 16;
+	const bool avx2 = svaf::CpuSupportAVX2();
+	vector<std::pair<int, int> > tasks;
+	for (int i = 0; i < responseMap.size(); ++i){
+		for (int r = 0; r < responseMap[i].height; r += band){
+			tasks.push_back(std::make_pair(i, r));
+		}
+	}
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+	for (int t = 0; t < (int)tasks.size(); ++t){
+		ResponseLayer& layer = responseMap[tasks[t].first];
+		const int row0 = tasks[t].second;
+		buildResponseRows(pi, layer, row0, std::min(row0 + band, layer.height), avx2);
 	}
 
 	return responseMap;
@@ -170,6 +223,7 @@ void interpolateExtremun(const int r, const int c, const ResponseLayer& t,
 		ipt.y = (r + xr) * t.step;
 		ipt.s = 0.1333f * (m.filter + xi * filterStep);
 		ipt.laplacian = getLaplacian(m, r, c, t);
+		ipt.response = getResponse(m, r, c, t);
 		ipts.push_back(ipt);
 	}
 }
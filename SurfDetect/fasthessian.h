@@ -16,6 +16,24 @@
 
 namespace pc{
 
+// Integral image padded by pad pixels on every side. A corner outside the image
+// reads what sumRect clamps it to (0 above/left, the last row/col below/right),
+// so the box filters need no bounds checks or branches.
+typedef struct _PaddedIntegral{
+	std::vector<float>	data;
+	int		pad;
+	int		stride;
+
+	inline const float* at(const int row, const int col) const{
+		return &data[(size_t)(row + pad) * stride + col + pad];
+	}
+} PaddedIntegral;
+
+// AVX2 kernel (fasthessian_avx2.cpp, the only SURF file built with AVX2): the
+// responses of layer row ar in groups of 8 from column 0, returns the columns
+// done. Call it only when svaf::CpuSupportAVX2().
+int buildResponseRowAVX2(const PaddedIntegral& pi, ResponseLayer& layer, const int ar);
+
 std::vector<ResponseLayer> buildResponseMap(const fimg& ii_img);
 void releaseResponseMap(std::vector<ResponseLayer>& responseMap);
 const bool isExtremum(const int r, const int c, 
@@ -0,0 +1,73 @@
+/* SurfDetect
+// Copyright 2016 Peng Chao, (mail to:me@p-chao.com | http://p-chao.com). Build
+// this work with opencv > 2.3.1. The program use surf to detect feature points
+// and generate feature descriptor. You can also directly sample image from video
+// or camera, a webcamera is necessary if you run the program on camera mode.
+// The program can mosaic two image and draw the match point, you can see usage
+// and input the parameters by command line. The surf detect part referenced on
+// OpenSurt(https://github.com/amarburg/opencv-ffi-ext/tree/master/ext/opensurf)
+// project, and the core of code write by C. The test shows the program is more
+// efficiency than OpenSurf. Enjoy it!
+// Created at: 26 Aug. 2016, all rights reserved.*/
+
+
+#include "common.h"
+#include "fasthessian.h"
+#include <immintrin.h>
+
+// AVX2 kernels of fasthessian.cpp. This file alone is built with AVX2 and is
+// only called after a run time cpuid check.
+
+namespace pc{
+
+// boxSum of 8 boxes, the k-th one shifted right by idx[k] columns
+static inline __m256 boxSum8(const PaddedIntegral& pi, const int row, const int col,
+	const int rows, const int cols, const __m256i idx){
+	const float* t = pi.at(row - 1, col - 1);
+	const float* b = pi.at(row + rows - 1, col - 1);
+	const __m256 tl = _mm256_i32gather_ps(t, idx, 4);
+	const __m256 tr = _mm256_i32gather_ps(t + cols, idx, 4);
+	const __m256 bl = _mm256_i32gather_ps(b, idx, 4);
+	const __m256 br = _mm256_i32gather_ps(b + cols, idx, 4);
+	return _mm256_max_ps(_mm256_add_ps(_mm256_sub_ps(_mm256_sub_ps(tl, tr), bl), br), _mm256_setzero_ps());
+}
+
+// responses of 8 adjacent samples (c, c + step, ..., c + 7 * step) of a layer row
+static inline void hessian8(const PaddedIntegral& pi, const int r, const int c,
+	const int b, const int l, const __m256i idx, const __m256 inv_area, float* response, uchar* laplacian){
+	const __m256 three = _mm256_set1_ps(3.0f);
+	const __m256 Dxx = _mm256_mul_ps(_mm256_sub_ps(boxSum8(pi, r - l + 1, c - b, 2 * l - 1, b * 2 + 1, idx),
+		_mm256_mul_ps(boxSum8(pi, r - l + 1, c - l / 2, 2 * l - 1, l, idx), three)), inv_area);
+	const __m256 Dyy = _mm256_mul_ps(_mm256_sub_ps(boxSum8(pi, r - b, c - l + 1, b * 2 + 1, 2 * l - 1, idx),
+		_mm256_mul_ps(boxSum8(pi, r - l / 2, c - l + 1, l, 2 * l - 1, idx), three)), inv_area);
+	__m256 Dxy = _mm256_add_ps(boxSum8(pi, r - l, c + 1, l, l, idx), boxSum8(pi, r + 1, c - l, l, l, idx));
+	Dxy = _mm256_sub_ps(Dxy, boxSum8(pi, r - l, c - l, l, l, idx));
+	Dxy = _mm256_mul_ps(_mm256_sub_ps(Dxy, boxSum8(pi, r + 1, c + 1, l, l, idx)), inv_area);
+
+	const __m256 det = _mm256_sub_ps(_mm256_mul_ps(Dxx, Dyy),
+		_mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.81f), Dxy), Dxy));
+	_mm256_storeu_ps(response, det);
+	const int sign = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_add_ps(Dxx, Dyy), _mm256_setzero_ps(), _CMP_GE_OQ));
+	for (int k = 0; k < 8; ++k){
+		laplacian[k] = (sign >> k) & 1;
+	}
+}
+
+int buildResponseRowAVX2(const PaddedIntegral& pi, ResponseLayer& layer, const int ar){
+	const int step = layer.step;
+	const int b = (layer.filter - 1) / 2;
+	const int l = layer.filter / 3;
+	const int w = layer.filter;
+	const __m256i idx = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(step));
+	const __m256 vinv_area = _mm256_set1_ps(1.f / (w * w));
+
+	const int r = ar * step;
+	int ac = 0;
+	int index = ar * layer.width;
+	for (; ac + 8 <= layer.width; ac += 8, index += 8){
+		hessian8(pi, r, ac * step, b, l, idx, vinv_area, layer.responses + index, layer.laplacian + index);
+	}
+	return ac;
+}
+
+}
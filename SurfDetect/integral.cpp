@@ -12,48 +12,21 @@
 
 
 #include "common.h"
+#include "../SVAF/src/Integral.h"
 
 namespace pc{
 
 
-void computeintegral_channel(const fimg& img, fimg& ii_img){
+// the shared integral image kernel (SVAF/src/Integral.h): exact int32 sums,
+// scaled to the normalized [0, 1] image
+void compute_integral(const uimg& img, fimg& ii_img){
+	assert(img.chns == 1);
 	ii_img.chns = img.chns;
 	ii_img.cols = img.cols;
 	ii_img.rows = img.rows;
-	ii_img.data[0] = img.data[0];
-
-	float rs = 0.0f;
-	for (int j = 0; j < img.cols; j++){
-		rs += img.data[j];
-		ii_img.data[j] = rs;
-	}
-
-	for (int i = 1; i < img.rows; i++){
-		rs = 0.0f;
-		for (int j = 0; j < img.cols; j++){
-			rs += img.data[i * img.cols + j];
-			ii_img.data[i * ii_img.cols + j] = rs + ii_img.data[(i - 1) * img.cols + j];
-		}
-	}
-}
-
-void compute_integral(const uimg& img, fimg& ii_img){
-	if (img.chns == 1){
-		fimg imgf;
-		imgf.chns = img.chns;
-		imgf.cols = img.cols;
-		imgf.rows = img.rows;
-		const int length = img.chns * img.cols * img.rows;
-		imgf.data = (float*)malloc(img.chns * img.cols * img.rows * sizeof(float));
-		for (int i = 0; i < length; ++i){
-			imgf.data[i] = img.data[i] / 255.0f;
-		}
-		computeintegral_channel(imgf, ii_img);
-		free(imgf.data);
-	}
-	else{
-		assert(false);
-	}
+	cv::Mat gray(img.rows, img.cols, CV_8UC1, img.data);
+	cv::Mat sum(img.rows, img.cols, CV_32FC1, ii_img.data);
+	svaf::ComputeIntegral(gray, sum, CV_32F, 1.0 / 255);
 }
 
 float sumRect(const fimg& ii_img, const int row, const int col, 
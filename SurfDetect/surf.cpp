@@ -18,6 +18,7 @@
 #include "mosaic.h"
 #include "stereo.h"
 #include "surfdisp.h"
+#include "../SVAF/src/Integral.h"
 #include <glog\logging.h>
 
 #include <opencv2\opencv.hpp>
@@ -169,34 +170,48 @@ Mat surfMosaic(Mat& image1, Mat& image2){
 
 /*Interface to svaf*/
 
-void SurfPoint(Mat& image, vector<Point2f>& points, vector<float>& scales, vector<int>& label){
+// the integral image of gray / 255, the input of both the detector and descriptor
+static void integralImage(const Mat& image, Mat& ii){
 	Mat gray;
 	if (image.channels() == 3){
 		cvtColor(image, gray, CV_BGR2GRAY);
-	}
-	else if (image.channels() == 1){
-		gray = image.clone();
-	}
-	else{
+	} else if (image.channels() == 1){
+		gray = image;
+	} else{
 		LOG(INFO) << "Unknown Image Format!";
 	}
+	svaf::ComputeIntegral(gray, ii, CV_32F, 1.0 / 255);
+}
 
-	uimg img;
-	img.chns = gray.channels();
-	img.cols = gray.cols;
-	img.rows = gray.rows;
-	img.data = gray.data;
+static fimg wrapIntegral(const Mat& ii){
+	CV_Assert(ii.type() == CV_32FC1 && ii.isContinuous());
+	fimg ii_img;
+	ii_img.chns = 1;
+	ii_img.cols = ii.cols;
+	ii_img.rows = ii.rows;
+	ii_img.data = (float*)ii.data;
+	return ii_img;
+}
 
+static void checkParam(){
 	suparam.thresh = (suparam.thresh >= 0) ? suparam.thresh : THRES;
 	suparam.stride = (suparam.stride > 0 && suparam.stride <= 6) ? suparam.stride : STRIDE;
 	suparam.octaves = (suparam.octaves > 0 && suparam.octaves <= 4) ? suparam.octaves : OCTAVES;
 	suparam.intervals = (suparam.intervals > 0 && suparam.intervals <= 4) ? suparam.intervals : INTERVALS;
+}
 
-	vector<Ipoint> ipts;
-	fimg ii_img;
-	ii_img.data = (float*)calloc(img.cols * img.rows * img.chns, sizeof(float));
-	compute_integral(img, ii_img);
+void SurfPoint(Mat& image, vector<Point2f>& points, vector<float>& scales, vector<int>& label){
+	Mat ii;
+	integralImage(image, ii);
+	SurfPointIntegral(ii, points, scales, label);
+}
+
+void SurfPointIntegral(const Mat& ii, vector<Point2f>& points, vector<float>& scales, vector<int>& label,
+	vector<float>* response){
+	checkParam();
+	fimg ii_img = wrapIntegral(ii);
 
+	vector<Ipoint> ipts;
 	vector<ResponseLayer> responseMap = buildResponseMap(ii_img);
 	static const int filter_map[OCTAVES][INTERVALS]
 		= { { 0, 1, 2, 3 }, { 1, 3, 4, 5 }, { 3, 5, 6, 7 }, { 5, 7, 8, 9 }, { 7, 9, 10, 11 } };
@@ -217,40 +232,37 @@ void SurfPoint(Mat& image, vector<Point2f>& points, vector<float>& scales, vecto
 		}
 	}
 	releaseResponseMap(responseMap);
-	free(ii_img.data);
 
 	for (int i = 0; i < ipts.size(); ++i){
 		points.push_back(Point2f(ipts[i].x, ipts[i].y));
 		scales.push_back(ipts[i].s);
 		label.push_back(ipts[i].laplacian);
+		if (response){
+			response->push_back(ipts[i].response);
+		}
 	}
 }
 
 void SurfDescriptor(Mat& image, vector<Point2f>& points, vector<float>& scales, 
 	vector<vector<float>>& descriptors){
-	Mat gray;
-	if (image.channels() == 3){
-		cvtColor(image, gray, CV_BGR2GRAY);
-	} else if (image.channels() == 1){
-		gray = image.clone();
-	} else{
-		LOG(INFO) << "Unknown Image Format!";
+	vector<float> buffer(points.size() * 64);
+	SurfDescriptor(image, points, scales, buffer.empty() ? NULL : &buffer[0], 64 * sizeof(float));
+	for (int i = 0; i < points.size(); ++i){
+		descriptors.push_back(vector<float>(buffer.begin() + i * 64, buffer.begin() + (i + 1) * 64));
 	}
+}
 
-	uimg img;
-	img.chns = gray.channels();
-	img.cols = gray.cols;
-	img.rows = gray.rows;
-	img.data = gray.data;
-
-	suparam.thresh = (suparam.thresh >= 0) ? suparam.thresh : THRES;
-	suparam.stride = (suparam.stride > 0 && suparam.stride <= 6) ? suparam.stride : STRIDE;
-	suparam.octaves = (suparam.octaves > 0 && suparam.octaves <= 4) ? suparam.octaves : OCTAVES;
-	suparam.intervals = (suparam.intervals > 0 && suparam.intervals <= 4) ? suparam.intervals : INTERVALS;
+void SurfDescriptor(Mat& image, vector<Point2f>& points, vector<float>& scales, 
+	float *descriptors, size_t step){
+	Mat ii;
+	integralImage(image, ii);
+	SurfDescriptorIntegral(ii, points, scales, descriptors, step);
+}
 
-	fimg ii_img;
-	ii_img.data = (float*)calloc(img.cols * img.rows * img.chns, sizeof(float));
-	compute_integral(img, ii_img);
+void SurfDescriptorIntegral(const Mat& ii, vector<Point2f>& points, vector<float>& scales,
+	float *descriptors, size_t step){
+	checkParam();
+	fimg ii_img = wrapIntegral(ii);
 
 	vector<Ipoint> ipts;
 	for (int i = 0; i < points.size(); ++i){
@@ -261,16 +273,6 @@ void SurfDescriptor(Mat& image, vector<Point2f>& points, vector<float>& scales,
 		ipts.push_back(ipt);
 	}
 
-	surfDescriptors(ii_img, ipts);
-	free(ii_img.data);
-
-	for (int i = 0; i < points.size(); ++i){
-		vector<float> descriptor;
-		for (int j = 0; j < 64; ++j){
-			descriptor.push_back(ipts[i].descriptor[j]);
-		}
-		descriptors.push_back(descriptor);
-	}
+	surfDescriptors(ii_img, ipts, descriptors, step);
 }
-
 }